@@ -623,7 +623,7 @@ std::vector<Card*> Console::ProcessSearchCommand(SearchFilter& filter) const
 
     for (Card* card : Cards::GetInstance().GetAllCards())
     {
-        if (card->gameTags.at(GameTag::COLLECTIBLE) == 0)
+        if (card->gameTags.At(GameTag::COLLECTIBLE) == 0)
         {
             continue;
         }
@@ -652,14 +652,14 @@ std::vector<Card*> Console::ProcessSearchCommand(SearchFilter& filter) const
             (filter.name.empty() ||
              card->name.find(filter.name) != std::string::npos);
         bool costCondition =
-            filter.costMin <= card->gameTags.at(GameTag::COST) &&
-            filter.costMax >= card->gameTags.at(GameTag::COST);
+            filter.costMin <= card->gameTags.At(GameTag::COST) &&
+            filter.costMax >= card->gameTags.At(GameTag::COST);
         bool attackCondition =
-            filter.attackMin <= card->gameTags.at(GameTag::ATK) &&
-            filter.attackMax >= card->gameTags.at(GameTag::ATK);
+            filter.attackMin <= card->gameTags.At(GameTag::ATK) &&
+            filter.attackMax >= card->gameTags.At(GameTag::ATK);
         bool healthCondition =
-            filter.healthMin <= card->gameTags.at(GameTag::HEALTH) &&
-            filter.healthMax >= card->gameTags.at(GameTag::HEALTH);
+            filter.healthMin <= card->gameTags.At(GameTag::HEALTH) &&
+            filter.healthMax >= card->gameTags.At(GameTag::HEALTH);
         bool mechanicsCondition = (filter.gameTag == GameTag::INVALID ||
                                    card->HasGameTag(filter.gameTag));
         const bool isMatched =
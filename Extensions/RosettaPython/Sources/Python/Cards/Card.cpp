@@ -24,13 +24,24 @@ void AddCard(pybind11::module& m)
         .def_readwrite("dbf_id", &Card::dbfID, R"pbdoc(dbfID of the card.)pbdoc")
         .def_readwrite("name", &Card::name, R"pbdoc(Name of the card.)pbdoc")
         .def_readwrite("text", &Card::text, R"pbdoc(Text of the card.)pbdoc")
-        .def_readwrite("game_tags", &Card::gameTags,
-                       R"pbdoc(Game tags of the card.)pbdoc")
+        .def_property(
+            "game_tags",
+            [](const Card& card) { return card.gameTags.ToMap(); },
+            [](Card& card, const std::map<GameTag, int>& gameTags) {
+                card.gameTags = gameTags;
+            },
+            R"pbdoc(Game tags of the card.)pbdoc")
         .def_readwrite("play_reqs", &Card::playRequirements,
                        R"pbdoc(Play requirements of the card.)pbdoc")
         .def_readwrite("entourages", &Card::entourages,
                        R"pbdoc(Entourages of the card.)pbdoc")
-        .def_readwrite("power", &Card::power, R"pbdoc(Power of the card.)pbdoc")
+        .def_property(
+            "power", [](const Card& card) { return card.GetPower(); },
+            [](Card& card, const Power& power) {
+                card.power = power;
+                card.cardDef = nullptr;
+            },
+            R"pbdoc(Power of the card.)pbdoc")
         .def_readwrite("max_allowed_in_deck", &Card::maxAllowedInDeck,
                        R"pbdoc(Maximum of card in deck.)pbdoc")
         .def("initialize", &Card::Initialize,
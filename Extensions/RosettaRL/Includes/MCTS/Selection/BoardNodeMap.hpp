@@ -12,8 +12,9 @@
 
 #include <Rosetta/Commons/SpinLocks.hpp>
 #include <Rosetta/Views/Board.hpp>
-#include <Rosetta/Views/ReducedBoardView.hpp>
+#include <Rosetta/Views/PackedBoardView.hpp>
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <shared_mutex>
@@ -25,12 +26,46 @@ namespace RosettaTorch::MCTS
 {
 struct TreeNode;
 
-using MapType = std::unordered_map<ReducedBoardView, std::unique_ptr<TreeNode>>;
+//!
+//! \brief BoardKey struct.
+//!
+//! This struct is the key of a board in BoardNodeMap. The zobrist hash of
+//! the game state picks the bucket cheaply, and the packed board view tells
+//! apart the boards whose hashes collide, so they never share a node.
+//!
+struct BoardKey
+{
+    //! Operator overloading: operator==.
+    bool operator==(const BoardKey& rhs) const
+    {
+        return hash == rhs.hash && view == rhs.view;
+    }
+
+    std::uint64_t hash = 0;
+    PackedBoardView view;
+};
+
+//!
+//! \brief BoardKeyHash struct.
+//!
+//! This struct returns the zobrist hash of BoardKey as the hash of the key.
+//!
+struct BoardKeyHash
+{
+    std::size_t operator()(const BoardKey& key) const noexcept
+    {
+        return static_cast<std::size_t>(key.hash);
+    }
+};
+
+using MapType =
+    std::unordered_map<BoardKey, std::unique_ptr<TreeNode>, BoardKeyHash>;
 
 //!
 //! \brief BoardNodeMap class.
 //!
-//! This class stores several boards that are reduced by hash function.
+//! This class stores several boards that are keyed by the zobrist hash and
+//! the packed board view of the game state that the player can see.
 //!
 class BoardNodeMap
 {
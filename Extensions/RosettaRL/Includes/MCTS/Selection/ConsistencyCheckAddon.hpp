@@ -17,6 +17,7 @@
 #include <Rosetta/Enums/ActionEnums.hpp>
 
 #include <mutex>
+#include <optional>
 
 namespace RosettaTorch::MCTS
 {
@@ -45,17 +46,17 @@ class ConsistencyCheckAddon
     }
 
     //! Sets spin lock and checks board.
-    //! \param view The reduced board view.
+    //! \param view The packed board view.
     //! \return The flag indicates board is consistent.
-    bool LockAndCheckBoard(const ReducedBoardView& view);
+    bool LockAndCheckBoard(const PackedBoardView& view);
 
     //! Returns the type of action.
     //! \return The type of action.
     ActionType GetActionType() const;
 
-    //! Returns the reduced board view.
-    //! \return The reduced board view.
-    ReducedBoardView* GetBoard() const;
+    //! Returns the packed board view.
+    //! \return The packed board view, or nullptr if no board is checked.
+    const PackedBoardView* GetBoard() const;
 
     //! Checks action type.
     //! \param actionType The type of action.
@@ -122,12 +123,12 @@ class ConsistencyCheckAddon
     }
 
     //! Checks board.
-    //! \param view The reduced board view.
+    //! \param view The packed board view.
     //! \return The flag indicates board is consistent.
-    bool CheckBoard(const ReducedBoardView& view);
+    bool CheckBoard(const PackedBoardView& view);
 
     mutable SpinLock m_mutex{};
-    std::unique_ptr<ReducedBoardView> m_boardView;
+    std::optional<PackedBoardView> m_boardView;
     ActionType m_actionType{};
     ActionChoices m_actionChoices;
 };
@@ -41,9 +41,9 @@ void MCTSRunner::Run(const BoardRefView& gameState)
                 "AAEBAfqUAwAPMJMB3ALVA9AE9wTOBtwGkgeeB/sHsQjCCMQI9ggA";
 
             p1Unknown.deckCards =
-                DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
+                DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardHandles();
             p2Unknown.deckCards =
-                DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
+                DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardHandles();
 
             boardView.Parse(gameState, p1Unknown, p2Unknown);
             auto gameRestorer =
@@ -182,15 +182,17 @@ void HeuristicPlayoutHeuristicEarlyCutoffPolicy::DFSBestStateValue(
     auto side = board.GetCurrentPlayer();
     double bestValue = -std::numeric_limits<double>::infinity();
 
+    // NOTE: The game is cloned only once, and each action is rolled back to
+    // the checkpoint after it is evaluated.
+    const auto copiedGame = board.RevealHiddenInfoForSimulation().Clone();
+    Board copyBoard(*copiedGame, board.GetViewType());
+    const std::size_t checkpoint = copiedGame->Checkpoint();
+
     checker.ForEachMainOp([&](std::size_t mainOpIdx, MainOpType mainOp) {
         userChoice.SetMainOpIndex(static_cast<int>(mainOpIdx));
 
         while (true)
         {
-            Game copiedGame;
-            Board copyBoard(copiedGame, board.GetViewType());
-            copyBoard.RefCopyFrom(board);
-
             dfsIter = dfs.begin();
             const auto result = copyBoard.ApplyAction(userChoice);
 
@@ -225,6 +227,8 @@ void HeuristicPlayoutHeuristicEarlyCutoffPolicy::DFSBestStateValue(
                 }
             }
 
+            copiedGame->Rollback(checkpoint);
+
             if (!stepNextDFS())
             {
                 break;
@@ -12,19 +12,20 @@
 
 namespace RosettaTorch::MCTS
 {
-using MapType = std::unordered_map<ReducedBoardView, std::unique_ptr<TreeNode>>;
+using MapType =
+    std::unordered_map<BoardKey, std::unique_ptr<TreeNode>, BoardKeyHash>;
 
 TreeNode* BoardNodeMap::GetOrCreateNode(const Board& board,
                                         bool* newNodeCreated)
 {
-    const auto boardView = board.CreateView();
+    const BoardKey key{ board.GetHash(), board.CreatePackedView() };
 
     {
         std::shared_lock<SharedSpinLock> lock(m_mutex);
 
         if (m_map)
         {
-            const auto it = m_map->find(boardView);
+            const auto it = m_map->find(key);
             if (it != m_map->end())
             {
                 return it->second.get();
@@ -34,7 +35,7 @@ TreeNode* BoardNodeMap::GetOrCreateNode(const Board& board,
 
     {
         std::lock_guard<SharedSpinLock> lock(m_mutex);
-        auto& item = GetLockedMap()[boardView];
+        auto& item = GetLockedMap()[key];
         if (!item)
         {
             item.reset(new TreeNode());
@@ -17,7 +17,7 @@ bool ConsistencyCheckAddon::LockAndCheckActionType(ActionType actionType) const
     return CheckActionType(actionType);
 }
 
-bool ConsistencyCheckAddon::LockAndCheckBoard(const ReducedBoardView& view)
+bool ConsistencyCheckAddon::LockAndCheckBoard(const PackedBoardView& view)
 {
     std::lock_guard<SpinLock> lock(m_mutex);
     return CheckBoard(view);
@@ -29,10 +29,10 @@ ActionType ConsistencyCheckAddon::GetActionType() const
     return m_actionType;
 }
 
-ReducedBoardView* ConsistencyCheckAddon::GetBoard() const
+const PackedBoardView* ConsistencyCheckAddon::GetBoard() const
 {
     std::lock_guard<SpinLock> lock(m_mutex);
-    return m_boardView.get();
+    return m_boardView ? &*m_boardView : nullptr;
 }
 
 bool ConsistencyCheckAddon::CheckActionType(ActionType actionType) const
@@ -45,11 +45,11 @@ bool ConsistencyCheckAddon::CheckActionType(ActionType actionType) const
     return m_actionType == actionType;
 }
 
-bool ConsistencyCheckAddon::CheckBoard(const ReducedBoardView& view)
+bool ConsistencyCheckAddon::CheckBoard(const PackedBoardView& view)
 {
     if (!m_boardView)
     {
-        m_boardView.reset(new ReducedBoardView(view));
+        m_boardView = view;
         return true;
     }
 
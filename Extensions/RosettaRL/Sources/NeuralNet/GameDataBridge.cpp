@@ -13,6 +13,20 @@
 
 namespace RosettaTorch::NeuralNet
 {
+namespace
+{
+//! Returns whether the character in \p lane of \p mirror has \p keyword.
+//! \param mirror The mirror of the characters.
+//! \param lane The lane of the character.
+//! \param keyword The keyword to check.
+//! \return true if the character has \p keyword, false otherwise.
+bool HasKeyword(const RosettaStone::FieldMirror& mirror, int lane,
+                RosettaStone::FieldMirror::Keyword keyword)
+{
+    return (mirror.keywords[lane] & keyword) != 0;
+}
+}  // namespace
+
 void GameDataBridge::Reset(const RosettaStone::Game& game)
 {
     m_game = &game;
@@ -48,7 +62,7 @@ double GameDataBridge::GetSideField(FieldType fieldType, int arg,
                                     const RosettaStone::Player* player) const
 {
     auto& handZone = *(player->GetHandZone());
-    auto& fieldZone = *(player->GetFieldZone());
+    const auto& mirror = player->GetFieldMirror();
 
     switch (fieldType)
     {
@@ -61,26 +75,27 @@ double GameDataBridge::GetSideField(FieldType fieldType, int arg,
         case FieldType::MANA_CRYSTAL_OVERLOAD_LOCKED:
             return player->GetOverloadLocked();
         case FieldType::HERO_HEALTH:
-            return player->GetHero()->GetHealth();
+            return mirror.health[RosettaStone::HERO_BIT];
         case FieldType::HERO_ARMOR:
-            return player->GetHero()->GetArmor();
+            return mirror.armor[RosettaStone::HERO_BIT];
         case FieldType::MINION_COUNT:
-            return fieldZone.GetCount();
+            return player->GetFieldZone()->GetCount();
         case FieldType::MINION_HEALTH:
-            return fieldZone[arg]->GetHealth();
+            return mirror.health[arg];
         case FieldType::MINION_MAX_HEALTH:
-            return fieldZone[arg]->GetMaxHealth();
+            return mirror.health[arg] + mirror.damage[arg];
         case FieldType::MINION_ATTACK:
-            return fieldZone[arg]->GetAttack();
+            return mirror.attack[arg];
         case FieldType::MINION_ATTACKABLE:
-            return fieldZone[arg]->CanAttack();
+            return HasKeyword(mirror, arg,
+                              RosettaStone::FieldMirror::CAN_ATTACK);
         case FieldType::MINION_TAUNT:
-            return fieldZone[arg]->GetGameTag(RosettaStone::GameTag::TAUNT);
+            return HasKeyword(mirror, arg, RosettaStone::FieldMirror::TAUNT);
         case FieldType::MINION_DIVINE_SHIELD:
-            return fieldZone[arg]->GetGameTag(
-                RosettaStone::GameTag::DIVINE_SHIELD);
+            return HasKeyword(mirror, arg,
+                              RosettaStone::FieldMirror::DIVINE_SHIELD);
         case FieldType::MINION_STEALTH:
-            return fieldZone[arg]->GetGameTag(RosettaStone::GameTag::STEALTH);
+            return HasKeyword(mirror, arg, RosettaStone::FieldMirror::STEALTH);
         case FieldType::HAND_COUNT:
             return handZone.GetCount();
         case FieldType::HAND_PLAYABLE:
@@ -6,6 +6,7 @@
 
 #include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Commons/Macros.hpp>
+#include <Rosetta/Loaders/CardLoader.hpp>
 
 #include <lyra/cli_parser.hpp>
 #include <lyra/help.hpp>
@@ -91,7 +92,7 @@ inline void ExportFile(const std::string& projectPath, CardSet cardSet)
         cards.erase(
             std::remove_if(cards.begin(), cards.end(),
                            [](const Card* c) {
-                               return c->gameTags.at(GameTag::COLLECTIBLE) == 0;
+                               return c->gameTags.At(GameTag::COLLECTIBLE) == 0;
                            }),
             cards.end());
 
@@ -115,7 +116,7 @@ inline void ExportFile(const std::string& projectPath, CardSet cardSet)
         for (auto& card : cards)
         {
             std::string gameTagStr;
-            for (auto& gameTag : card->gameTags)
+            for (const auto& gameTag : card->gameTags)
             {
                 gameTagStr += EnumToStr<GameTag>(gameTag.first);
             }
@@ -146,6 +147,30 @@ inline void ExportFile(const std::string& projectPath, CardSet cardSet)
     exit(EXIT_FAILURE);
 }
 
+inline void ExportCardDatabase(const std::string& path)
+{
+    std::vector<Card*> cards;
+    CardLoader::LoadFromJSON(cards);
+
+    try
+    {
+        CardLoader::SaveToBinary(cards, path);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << '\n';
+        exit(EXIT_FAILURE);
+    }
+
+    for (auto& card : cards)
+    {
+        delete card;
+    }
+
+    std::cout << "Export card database is completed.\n";
+    exit(EXIT_SUCCESS);
+}
+
 int main(int argc, char* argv[])
 {
     // Parse command
@@ -153,6 +178,7 @@ int main(int argc, char* argv[])
     bool isExportAllCard = false;
     std::string cardSetName;
     std::string projectPath;
+    std::string databasePath;
 
     // Parsing
     auto parser = lyra::cli_parser() | lyra::help(showHelp) |
@@ -161,7 +187,9 @@ int main(int argc, char* argv[])
                   lyra::opt(cardSetName, "cardSet")["-c"]["--cardset"](
                       "Export a list of specific expansion cards") |
                   lyra::opt(projectPath, "path")["-p"]["--path"](
-                      "Specify RosettaStone project path");
+                      "Specify RosettaStone project path") |
+                  lyra::opt(databasePath, "path")["-b"]["--binary"](
+                      "Export the binary card database from cards.json");
 
     auto result = parser.parse({ argc, argv });
 
@@ -177,6 +205,11 @@ int main(int argc, char* argv[])
         exit(EXIT_SUCCESS);
     }
 
+    if (!databasePath.empty())
+    {
+        ExportCardDatabase(databasePath);
+    }
+
     if (projectPath.empty())
     {
         std::cout << "You should input RosettaStone project path\n";
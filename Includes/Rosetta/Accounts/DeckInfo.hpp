@@ -82,6 +82,10 @@ class DeckInfo
     //! \return A list of card IDs.
     std::vector<std::string> GetCardIDs();
 
+    //! Returns a list of card handles.
+    //! \return A list of card handles.
+    std::vector<CardHandle> GetCardHandles();
+
  private:
     std::string m_name;
     CardClass m_class = CardClass::INVALID;
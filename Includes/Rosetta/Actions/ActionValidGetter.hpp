@@ -11,9 +11,13 @@
 #define ROSETTASTONE_ACTION_VALID_GETTER_HPP
 
 #include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Models/CharacterMasks.hpp>
 #include <Rosetta/Zones/FieldZone.hpp>
 #include <Rosetta/Zones/HandZone.hpp>
 
+#include <array>
+#include <optional>
+
 namespace RosettaStone
 {
 //!
@@ -44,7 +48,7 @@ class ActionValidGetter
                              ? m_game.GetPlayer1()->GetFieldZone()
                              : m_game.GetPlayer2()->GetFieldZone();
 
-        for (auto& minion : fieldZone->GetAll())
+        for (auto& minion : fieldZone->GetView())
         {
             functor(minion);
         }
@@ -57,9 +61,12 @@ class ActionValidGetter
     {
         auto handZone = m_game.GetCurrentPlayer()->GetHandZone();
 
-        for (auto& card : handZone->GetAll())
+        // The masks of characters are built once for all cards in hand
+        std::optional<std::array<CharacterMasks, 2>> masks;
+
+        for (auto& card : handZone->GetView())
         {
-            if (!IsPlayable(m_game.GetCurrentPlayer(), card))
+            if (!IsPlayable(m_game.GetCurrentPlayer(), card, masks))
             {
                 continue;
             }
@@ -76,31 +83,38 @@ class ActionValidGetter
     template <typename Functor>
     void ForEachAttacker(Functor&& functor) const
     {
-        auto fieldZone = m_game.GetCurrentPlayer()->GetFieldZone();
+        const Player* player = m_game.GetCurrentPlayer();
+        const SideMask attackers = GetAttackerMask();
 
-        for (auto& minion : fieldZone->GetAll())
+        FieldZone& fieldZone = *player->GetFieldZone();
+        for (int pos = 0; pos < MAX_FIELD_SIZE; ++pos)
         {
-            if (!minion->CanAttack())
+            if (!(attackers & (1 << pos)))
             {
                 continue;
             }
 
-            if (!functor(minion))
+            if (!functor(fieldZone[pos]))
             {
                 return;
             }
         }
 
-        const auto& hero = m_game.GetCurrentPlayer()->GetHero();
-        if (hero->CanAttack())
+        if (attackers & (1 << HERO_BIT))
         {
-            if (!functor(hero))
+            if (!functor(player->GetHero()))
             {
                 return;
             }
         }
     }
 
+    //! Returns the mask of the characters of the current player that can
+    //! attack. Bit i is the minion at zone position i, and bit HERO_BIT is
+    //! the hero.
+    //! \return The mask of the characters that can attack.
+    SideMask GetAttackerMask() const;
+
     //! Returns the flag indicates whether the player can use hero power.
     //! \return the flag indicates whether the player can use hero power.
     bool CanUseHeroPower();
@@ -109,8 +123,11 @@ class ActionValidGetter
     //! Returns the flag indicates whether the card is playable.
     //! \param player The player context.
     //! \param entity The target entity.
+    //! \param masks The masks of the characters of the player and the
+    //! opponent. They are built if they are needed and not built yet.
     //! \return the flag indicates whether the card is playable.
-    bool IsPlayable(const Player* player, Playable* entity) const;
+    bool IsPlayable(const Player* player, Playable* entity,
+                    std::optional<std::array<CharacterMasks, 2>>& masks) const;
 
     const Game& m_game;
 };
@@ -0,0 +1,96 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_MOVE_GENERATOR_HPP
+#define ROSETTASTONE_MOVE_GENERATOR_HPP
+
+#include <Rosetta/Enums/ActionEnums.hpp>
+#include <Rosetta/Models/CharacterMasks.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace RosettaStone
+{
+class Character;
+class Game;
+class Player;
+
+//!
+//! \brief Move struct.
+//!
+//! This struct is a fully specified action of the current player that can be
+//! applied by Game::ApplyMove() without any more choices. The characters are
+//! identified by their indices: index i (0 <= i <= HERO_BIT) is the friendly
+//! character at bit i of SideMask, and index i + ENEMY_OFFSET is the enemy
+//! character at bit i.
+//!
+struct Move
+{
+    //! The index that indicates no character.
+    static constexpr int NO_TARGET = -1;
+
+    //! The offset of the indices of the enemy characters.
+    static constexpr int ENEMY_OFFSET = HERO_BIT + 1;
+
+    //! Returns the character of \p index in the view of \p player.
+    //! \param player The player that sees the character.
+    //! \param index The index of the character.
+    //! \return The character of \p index, or nullptr if \p index is
+    //! NO_TARGET.
+    static Character* GetCharacter(Player* player, int index);
+
+    //! Operator overloading: operator==.
+    bool operator==(const Move& rhs) const;
+
+    //! Operator overloading: operator!=.
+    bool operator!=(const Move& rhs) const;
+
+    //! The main operation.
+    MainOpType op = MainOpType::INVALID;
+
+    //! The index of card in hand for PLAY_CARD, or the index of the attacker
+    //! for ATTACK.
+    std::int8_t source = 0;
+
+    //! The index of the target, or NO_TARGET.
+    std::int8_t target = NO_TARGET;
+
+    //! The position in field to put a minion, or -1 for the other cards.
+    std::int8_t position = -1;
+
+    //! The index of the chosen card of choose one card, or 0.
+    std::int8_t chooseOne = 0;
+};
+
+//!
+//! \brief MoveGenerator class.
+//!
+//! This class generates all legal moves of the current player as a flat list,
+//! in the same way as a chess engine. It emits every combination of the
+//! choices that ActionParams would be asked for, so a playout policy can pick
+//! a move in one step instead of a round-trip per choice.
+//!
+class MoveGenerator
+{
+ public:
+    //! Constructs move generator with given \p game.
+    //! \param game The game context.
+    explicit MoveGenerator(const Game& game);
+
+    //! Generates all legal moves of the current player. The moves are in the
+    //! order of ActionValidChecker: playing cards, attacking, using hero power
+    //! and ending turn, which is always the last move.
+    //! \param moves The list to store the moves. It is cleared first, so it can
+    //! be reused to avoid allocations.
+    void Generate(std::vector<Move>& moves) const;
+
+ private:
+    const Game& m_game;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_MOVE_GENERATOR_HPP
@@ -37,6 +37,10 @@ class AdjacentAura : public IAura
     //! Updates this effect to apply the effect to recently modified entities.
     void Update() override;
 
+    //! Returns a value indicating whether this effect has nothing to update.
+    //! \return true if this effect has nothing to update, false otherwise.
+    bool IsUpToDate() const override;
+
     //! Removes this effect from the game to stop affecting entities.
     void Remove() override;
 
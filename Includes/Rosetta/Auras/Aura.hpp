@@ -8,7 +8,8 @@
 
 #include <Rosetta/Auras/AuraUpdateInstruction.hpp>
 #include <Rosetta/Auras/IAura.hpp>
-#include <Rosetta/Commons/PriorityQueue.hpp>
+#include <Rosetta/Commons/Constants.hpp>
+#include <Rosetta/Commons/FixedPriorityQueue.hpp>
 #include <Rosetta/Conditions/SelfCondition.hpp>
 #include <Rosetta/Enchants/Enchant.hpp>
 #include <Rosetta/Enums/AuraEnums.hpp>
@@ -20,6 +21,7 @@
 namespace RosettaStone
 {
 class Card;
+class Entity;
 class Playable;
 
 //!
@@ -61,6 +63,10 @@ class Aura : public IAura
     //! if the owner is nullified.
     void Update() override;
 
+    //! Returns a value indicating whether this effect has nothing to update.
+    //! \return true if this effect has nothing to update, false otherwise.
+    bool IsUpToDate() const override;
+
     //! Removes this effect from the game to stop affecting entities.
     void Remove() override;
 
@@ -101,19 +107,39 @@ class Aura : public IAura
     //! \param aura The dynamically allocated Aura instance.
     void AddToGame(Playable& owner, Aura& aura);
 
+    //! Returns a value indicating whether \p entity is changed since the aura
+    //! was last updated.
+    //! \param entity The entity to check.
+    //! \return true if \p entity is changed, false otherwise.
+    bool IsChanged(const Entity* entity) const;
+
+    //! Records the state of this aura to the journal of game before it is
+    //! mutated, once per epoch of journal.
+    virtual void SaveState();
+
     AuraType m_type = AuraType::INVALID;
     Playable* m_owner = nullptr;
 
-    PriorityQueue<AuraUpdateInstruction> m_auraUpdateInstQueue;
+    FixedPriorityQueue<AuraUpdateInstruction,
+                       NUM_INLINE_AURA_UPDATE_INSTRUCTIONS>
+        m_auraUpdateInstQueue;
     std::vector<Playable*> m_appliedEntities;
 
     TriggerEventHandler m_removeHandler;
+    TriggerEvent* m_removeEvent = nullptr;
+    TriggerEvent::Handle m_removeHandle;
 
     Card* m_enchantmentCard = nullptr;
     std::vector<std::shared_ptr<IEffect>> m_effects;
 
     bool m_turnOn = true;
 
+    //! The mutation count of game when the aura was last updated.
+    std::uint64_t m_lastUpdate = 0;
+
+    //! The epoch of journal when the state of aura was last recorded.
+    std::uint64_t m_stateEpoch = 0;
+
  private:
     //! Internal method of Update().
     void UpdateInternal();
@@ -36,6 +36,10 @@ class EnrageEffect : public Aura
     //! Updates this effect to apply the effect to recently modified entities.
     void Update() override;
 
+    //! Returns a value indicating whether this effect has nothing to update.
+    //! \return true if this effect has nothing to update, false otherwise.
+    bool IsUpToDate() const override;
+
     //! Clones aura effect to \p clone.
     //! \param clone The entity to clone aura effect.
     void Clone(Playable* clone) override;
@@ -46,9 +50,16 @@ class EnrageEffect : public Aura
     //! \param owner An owner of adaptive effect.
     EnrageEffect(EnrageEffect& prototype, Playable& owner);
 
+    //! Records the state of this effect to the journal of game before it is
+    //! mutated, once per epoch of journal.
+    void SaveState() override;
+
     Enchantment* m_curInstance = nullptr;
     Playable* m_target = nullptr;
     bool m_enraged = false;
+
+    //! The epoch of journal when the enraged state was last recorded.
+    std::uint64_t m_enrageEpoch = 0;
 };
 }  // namespace RosettaStone
 
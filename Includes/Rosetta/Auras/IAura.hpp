@@ -32,6 +32,15 @@ class IAura
     //! Updates this effect to apply the effect to recently modified entities.
     virtual void Update() = 0;
 
+    //! Returns a value indicating whether this effect has nothing to update,
+    //! because none of the entities that it depends on is changed since it
+    //! was last updated. Game::UpdateAura() skips the effect if it is true.
+    //! \return true if this effect has nothing to update, false otherwise.
+    virtual bool IsUpToDate() const
+    {
+        return false;
+    }
+
     //! Removes this effect from the game to stop affecting entities.
     virtual void Remove() = 0;
 
@@ -49,11 +49,18 @@ class SwitchingAura : public Aura
     //! Internal method of Remove().
     void RemoveInternal() override;
 
+    //! Removes the handlers that switch this aura from the trigger events.
+    void RemoveHandlers();
+
     SelfCondition m_initCondition;
     TriggerType m_offTrigger;
 
     TriggerEventHandler m_onHandler;
     TriggerEventHandler m_offHandler;
+    TriggerEvent* m_offEvent = nullptr;
+    TriggerEvent::Handle m_onHandle;
+    TriggerEvent::Handle m_turnEndHandle;
+    TriggerEvent::Handle m_offHandle;
 
     bool m_isRemoved = false;
 };
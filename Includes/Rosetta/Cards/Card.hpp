@@ -7,13 +7,19 @@
 #ifndef ROSETTASTONE_CARD_HPP
 #define ROSETTASTONE_CARD_HPP
 
+#include <Rosetta/Cards/CardDef.hpp>
+#include <Rosetta/Cards/CardHandle.hpp>
+#include <Rosetta/Cards/CardHotData.hpp>
+#include <Rosetta/Commons/GameTagStore.hpp>
 #include <Rosetta/Enchants/Power.hpp>
 #include <Rosetta/Enums/CardEnums.hpp>
 #include <Rosetta/Enums/TargetingEnums.hpp>
 #include <Rosetta/Loaders/TargetingPredicates.hpp>
+#include <Rosetta/Models/TargetMask.hpp>
 
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace RosettaStone
@@ -25,6 +31,9 @@ class Power;
 //! \brief Card class.
 //!
 //! This class stores card information such as attack, health and cost.
+//! The getters of a loaded card read its CardHotData in the contiguous table
+//! of Cards, and the getters of a card that isn't loaded, e.g. a card that is
+//! made in tests, read its game tags.
 //!
 class Card
 {
@@ -32,33 +41,93 @@ class Card
     //! Initializes card data.
     void Initialize();
 
+    //! Builds the hot data of the card. The card must be initialized.
+    //! \return The hot data of the card.
+    CardHotData MakeHotData() const;
+
     //! Returns the value of card class.
     //! \return The value of card class.
-    CardClass GetCardClass() const;
+    CardClass GetCardClass() const
+    {
+        if (hotData != nullptr)
+        {
+            return hotData->cardClass;
+        }
+
+        return static_cast<CardClass>(gameTags.At(GameTag::CLASS));
+    }
 
     //! Returns the value of card set.
     //! \return The value of card set.
-    CardSet GetCardSet() const;
+    CardSet GetCardSet() const
+    {
+        if (hotData != nullptr)
+        {
+            return hotData->cardSet;
+        }
+
+        return static_cast<CardSet>(gameTags.At(GameTag::CARD_SET));
+    }
 
     //! Returns the value of card type.
     //! \return The value of card type.
-    CardType GetCardType() const;
+    CardType GetCardType() const
+    {
+        if (hotData != nullptr)
+        {
+            return hotData->cardType;
+        }
+
+        return static_cast<CardType>(gameTags.At(GameTag::CARDTYPE));
+    }
 
     //! Returns the value of faction.
     //! \return The value of faction.
-    Faction GetFaction() const;
+    Faction GetFaction() const
+    {
+        if (hotData != nullptr)
+        {
+            return hotData->faction;
+        }
+
+        return static_cast<Faction>(gameTags.At(GameTag::FACTION));
+    }
 
     //! Returns the value of race.
     //! \return The value of race.
-    Race GetRace() const;
+    Race GetRace() const
+    {
+        if (hotData != nullptr)
+        {
+            return hotData->race;
+        }
+
+        return static_cast<Race>(gameTags.At(GameTag::CARDRACE));
+    }
 
     //! Returns the value of rarity.
     //! \return The value of rarity.
-    Rarity GetRarity() const;
+    Rarity GetRarity() const
+    {
+        if (hotData != nullptr)
+        {
+            return hotData->rarity;
+        }
+
+        return static_cast<Rarity>(gameTags.At(GameTag::RARITY));
+    }
 
     //! Returns the value of cost.
     //! \return The value of cost.
-    int GetCost() const;
+    int GetCost() const
+    {
+        if (hotData != nullptr)
+        {
+            return hotData->cost;
+        }
+
+        return gameTags.At(GameTag::COST);
+    }
 
     //! Finds out if this card has game tag.
     //! \param gameTag The game tag of card.
@@ -79,15 +148,67 @@ class Card
 
     //! Returns the flag that indicates whether it is untouchable.
     //! \return The flag that indicates whether it is untouchable.
-    bool IsUntouchable() const;
+    bool IsUntouchable() const
+    {
+        if (hotData != nullptr)
+        {
+            return hotData->HasFlag(CardHotData::UNTOUCHABLE);
+        }
+
+        return HasGameTag(GameTag::UNTOUCHABLE) &&
+               static_cast<bool>(gameTags.At(GameTag::UNTOUCHABLE));
+    }
 
     //! Returns the flag that indicates whether it is secret card.
     //! \return The flag that indicates whether it is secret card.
-    bool IsSecret() const;
+    bool IsSecret() const
+    {
+        if (hotData != nullptr)
+        {
+            return hotData->HasFlag(CardHotData::SECRET);
+        }
+
+        return HasGameTag(GameTag::SECRET) &&
+               static_cast<bool>(gameTags.At(GameTag::SECRET));
+    }
 
     //! Returns the flag that indicates whether it is collectible.
     //! \return The flag that indicates whether it is collectible.
-    bool IsCollectible() const;
+    bool IsCollectible() const
+    {
+        if (hotData != nullptr)
+        {
+            return hotData->HasFlag(CardHotData::COLLECTIBLE);
+        }
+
+        return static_cast<bool>(gameTags.At(GameTag::COLLECTIBLE));
+    }
+
+    //! Returns the flag that indicates whether it is the card of \p rhs.
+    //! \param rhs The card to compare.
+    //! \return The flag that indicates whether it is the card of \p rhs.
+    bool IsCard(const Card& rhs) const
+    {
+        return IsCard(rhs.handle, rhs.id);
+    }
+
+    //! Returns the flag that indicates whether it is the card of \p cardHandle
+    //! and \p cardID. The handles are compared, or the IDs if either handle is
+    //! invalid, e.g. the card is made in tests or the ID isn't loaded, because
+    //! all invalid handles are equal.
+    //! \param cardHandle The handle of the card to compare.
+    //! \param cardID The ID of the card to compare.
+    //! \return The flag that indicates whether it is the card of \p cardHandle
+    //! and \p cardID.
+    bool IsCard(CardHandle cardHandle, std::string_view cardID) const
+    {
+        if (handle.IsValid() && cardHandle.IsValid())
+        {
+            return handle == cardHandle;
+        }
+
+        return id == cardID;
+    }
 
     //! Finds out if this card is in STANDARD set.
     //! \return true if this card is in STANDARD set, and false otherwise.
@@ -120,6 +241,30 @@ class Card
     //! \return A list of valid play targets.
     std::vector<Character*> GetValidPlayTargets(Player* player);
 
+    //! Gets the mask of valid play targets.
+    //! This method defaults to targeting in the context of spells/hero powers.
+    //! \param player The player of the source.
+    //! \return The mask of valid play targets in the view of \p player.
+    TargetMask GetValidPlayTargetMask(Player* player);
+
+    //! Gets the mask of valid play targets with the masks of characters that
+    //! are already built, e.g. to check all cards in hand at once.
+    //! \param player The player of the source.
+    //! \param friendly The masks of the characters of \p player.
+    //! \param enemy The masks of the characters of the opponent.
+    //! \return The mask of valid play targets in the view of \p player.
+    TargetMask GetValidPlayTargetMask(Player* player,
+                                      const CharacterMasks& friendly,
+                                      const CharacterMasks& enemy);
+
+    //! Returns the power of the card. The power of the card that is loaded
+    //! from CardDefs is shared with its card def instead of copied.
+    //! \return The power of the card.
+    const Power& GetPower() const
+    {
+        return cardDef != nullptr ? cardDef->power : power;
+    }
+
     //! Prints brief card information.
     void ShowBriefInfo() const;
 
@@ -128,10 +273,19 @@ class Card
 
     std::string id;
     int dbfID;
+    CardHandle handle;
+
+    //! The hot data of the card in the table of Cards, or nullptr.
+    const CardHotData* hotData = nullptr;
+
+    TargetingType targetingType = TargetingType::NONE;
+    bool mustHaveToTargetToPlay = false;
+    std::size_t maxAllowedInDeck = 0;
+
     std::string name;
     std::string text;
 
-    std::map<GameTag, int> gameTags;
+    GameTagStore gameTags;
     std::map<PlayReq, int> playRequirements;
     std::vector<std::string> chooseCardIDs;
     std::vector<std::string> entourages;
@@ -139,12 +293,12 @@ class Card
     std::vector<TargetingPredicate> targetingPredicate;
     std::vector<AvailabilityPredicate> targetingAvailabilityPredicate;
 
-    TargetingType targetingType;
-    Power power;
-
-    std::size_t maxAllowedInDeck = 0;
+    //! The card def that the card is loaded from, or nullptr.
+    const CardDef* cardDef = nullptr;
 
-    bool mustHaveToTargetToPlay = false;
+    //! The power of the card that isn't loaded from CardDefs, e.g. a card
+    //! that is made in tests.
+    Power power;
 };
 }  // namespace RosettaStone
 
@@ -0,0 +1,101 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_CARD_BITSET_HPP
+#define ROSETTASTONE_CARD_BITSET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief CardBitset class.
+//!
+//! This class is a set of cards that stores a bit for each card ordinal, i.e.
+//! the index of the card in Cards::GetAllCards(). Sets are combined with
+//! word-wide bit operations, so filtering the cards by several indexed
+//! properties doesn't visit the cards themselves. A bitset that is shorter
+//! than the others behaves as if the missing bits are 0.
+//!
+class CardBitset
+{
+ public:
+    //! Default constructor.
+    CardBitset() = default;
+
+    //! Constructs bitset that has \p size bits that are all 0.
+    //! \param size The number of bits.
+    explicit CardBitset(std::size_t size);
+
+    //! Returns the number of bits.
+    //! \return The number of bits.
+    std::size_t GetSize() const;
+
+    //! Sets the bit at \p idx to 1.
+    //! \param idx The index of the bit.
+    void Set(std::size_t idx);
+
+    //! Sets the bit at \p idx to 0.
+    //! \param idx The index of the bit.
+    void Reset(std::size_t idx);
+
+    //! Returns the value of the bit at \p idx.
+    //! \param idx The index of the bit.
+    //! \return true if the bit is 1, false otherwise.
+    bool Test(std::size_t idx) const;
+
+    //! Returns the number of bits that are 1.
+    //! \return The number of bits that are 1.
+    std::size_t Count() const;
+
+    //! Returns the index of the \p n-th bit that is 1.
+    //! \param n The zero-based order of the bit.
+    //! \return The index of the bit, or GetSize() if there are not enough bits.
+    std::size_t FindNth(std::size_t n) const;
+
+    //! Keeps the bits that are 1 in both this bitset and \p rhs.
+    //! \param rhs The bitset to intersect.
+    //! \return The reference to this bitset.
+    CardBitset& operator&=(const CardBitset& rhs);
+
+    //! Sets the bits that are 1 in \p rhs.
+    //! \param rhs The bitset to unite.
+    //! \return The reference to this bitset.
+    CardBitset& operator|=(const CardBitset& rhs);
+
+    //! Calls \p func with the index of each bit that is 1 in ascending order.
+    //! \param func The function to call.
+    template <typename Func>
+    void ForEach(Func&& func) const
+    {
+        for (std::size_t i = 0; i < m_words.size(); ++i)
+        {
+            std::uint64_t word = m_words[i];
+
+            while (word != 0)
+            {
+                func(i * WORD_BITS + CountTrailingZeros(word));
+                word &= word - 1;
+            }
+        }
+    }
+
+ private:
+    static constexpr std::size_t WORD_BITS = 64;
+
+    //! Returns the number of trailing zero bits of \p word.
+    //! \param word The word that is not 0.
+    //! \return The number of trailing zero bits of \p word.
+    static std::size_t CountTrailingZeros(std::uint64_t word);
+
+    std::vector<std::uint64_t> m_words;
+    std::size_t m_size = 0;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_CARD_BITSET_HPP
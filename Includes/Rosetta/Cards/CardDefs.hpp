@@ -39,8 +39,9 @@ class CardDefs
 
     //! Returns the card def data that matches \p cardID.
     //! \param cardID The ID of the card.
-    //! \return The card def data that matches \p cardID.
-    static CardDef FindCardDefByCardID(const std::string_view& cardID);
+    //! \return The card def data that matches \p cardID, or nullptr if the
+    //! card isn't implemented.
+    static const CardDef* FindCardDefByCardID(const std::string_view& cardID);
 
  private:
     //! Constructor: Loads card data (powers and play requirements).
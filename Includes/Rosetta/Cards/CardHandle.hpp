@@ -0,0 +1,95 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_CARD_HANDLE_HPP
+#define ROSETTASTONE_CARD_HANDLE_HPP
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+namespace RosettaStone
+{
+//!
+//! \brief CardHandle class.
+//!
+//! This class identifies a card by its ordinal, i.e. the index of the card in
+//! Cards::GetAllCards() that is assigned when the cards are loaded. Comparing
+//! and hashing handles is a single integer operation, so the engine uses them
+//! instead of card IDs. Card IDs are only used to read and write card data.
+//! A default-constructed handle is invalid, e.g. the handle of a card that is
+//! made in tests. Invalid handles are equal to each other, so the cards that
+//! may not be loaded are compared by Card::IsCard(), which compares card IDs
+//! if either handle is invalid.
+//!
+class CardHandle
+{
+ public:
+    //! The value of invalid handle.
+    static constexpr std::uint32_t INVALID =
+        std::numeric_limits<std::uint32_t>::max();
+
+    //! Default constructor.
+    constexpr CardHandle() = default;
+
+    //! Constructs handle with given \p ordinal.
+    //! \param ordinal The ordinal of the card.
+    constexpr explicit CardHandle(std::uint32_t ordinal) : m_ordinal(ordinal)
+    {
+        // Do nothing
+    }
+
+    //! Returns the ordinal of the card.
+    //! \return The ordinal of the card.
+    constexpr std::uint32_t GetOrdinal() const
+    {
+        return m_ordinal;
+    }
+
+    //! Returns a value indicating whether the handle refers to a card.
+    //! \return true if the handle refers to a card, false otherwise.
+    constexpr bool IsValid() const
+    {
+        return m_ordinal != INVALID;
+    }
+
+    //! Operator overloading: operator==.
+    constexpr bool operator==(const CardHandle& rhs) const
+    {
+        return m_ordinal == rhs.m_ordinal;
+    }
+
+    //! Operator overloading: operator!=.
+    constexpr bool operator!=(const CardHandle& rhs) const
+    {
+        return m_ordinal != rhs.m_ordinal;
+    }
+
+    //! Operator overloading: operator<.
+    constexpr bool operator<(const CardHandle& rhs) const
+    {
+        return m_ordinal < rhs.m_ordinal;
+    }
+
+ private:
+    std::uint32_t m_ordinal = INVALID;
+};
+}  // namespace RosettaStone
+
+namespace std
+{
+template <>
+struct hash<RosettaStone::CardHandle>
+{
+    std::size_t operator()(const RosettaStone::CardHandle& handle) const
+        noexcept
+    {
+        return static_cast<std::size_t>(handle.GetOrdinal());
+    }
+};
+}  // namespace std
+
+#endif  // ROSETTASTONE_CARD_HANDLE_HPP
@@ -0,0 +1,81 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_CARD_HOT_DATA_HPP
+#define ROSETTASTONE_CARD_HOT_DATA_HPP
+
+#include <Rosetta/Enums/CardEnums.hpp>
+#include <Rosetta/Enums/TargetingEnums.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace RosettaStone
+{
+//!
+//! \brief CardHotData struct.
+//!
+//! This struct stores the card data that the rules read while playing, e.g.
+//! cost, type and play requirements, in a single cache line. Cards keeps
+//! the hot data of all loaded cards in a contiguous table that is indexed by
+//! card ordinal, and the rest of card data such as name and text stays in
+//! Card. The hot data is built once when the cards are loaded, so the cards
+//! must not be modified after that.
+//!
+struct alignas(64) CardHotData
+{
+    //! The maximum number of play requirements that are stored inline.
+    static constexpr std::size_t MAX_PLAY_REQS = 8;
+
+    //! The flags of the card.
+    enum Flag : std::uint16_t
+    {
+        COLLECTIBLE = 1 << 0,
+        UNTOUCHABLE = 1 << 1,
+        SECRET = 1 << 2,
+        QUEST = 1 << 3,
+        LACKEY = 1 << 4,
+        GALAKROND = 1 << 5,
+        STANDARD_SET = 1 << 6,
+        WILD_SET = 1 << 7,
+        MUST_HAVE_TARGET_TO_PLAY = 1 << 8,
+        //! The play requirements don't fit inline, so they must be read from
+        //! Card::playRequirements.
+        PLAY_REQS_OVERFLOW = 1 << 9,
+    };
+
+    //! Returns a value indicating whether the card has \p flag.
+    //! \param flag The flag to check.
+    //! \return true if the card has \p flag, false otherwise.
+    bool HasFlag(Flag flag) const
+    {
+        return (flags & flag) != 0;
+    }
+
+    int cost = 0;
+    CardClass cardClass = CardClass::INVALID;
+    CardSet cardSet = CardSet::INVALID;
+    CardType cardType = CardType::INVALID;
+    Faction faction = Faction::INVALID;
+    Race race = Race::INVALID;
+    Rarity rarity = Rarity::INVALID;
+    TargetingType targetingType = TargetingType::NONE;
+
+    std::uint16_t flags = 0;
+    std::uint8_t maxAllowedInDeck = 0;
+    std::uint8_t numPlayReqs = 0;
+
+    std::array<std::uint8_t, MAX_PLAY_REQS> playReqs{};
+    std::array<std::int16_t, MAX_PLAY_REQS> playReqValues{};
+};
+
+static_assert(sizeof(CardHotData) == 64,
+              "The hot data of card must fit in a single cache line.");
+static_assert(static_cast<int>(PlayReq::REQ_DRAG_TO_PLAY) <= 0xFF,
+              "The play requirements are stored in 8 bits.");
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_CARD_HOT_DATA_HPP
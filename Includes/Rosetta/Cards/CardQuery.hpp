@@ -0,0 +1,133 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_CARD_QUERY_HPP
+#define ROSETTASTONE_CARD_QUERY_HPP
+
+#include <Rosetta/Cards/CardBitset.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief CardQuery class.
+//!
+//! This class searches cards using the index that Cards builds when the cards
+//! are loaded. Each With*() method intersects the result with a precomputed
+//! bitset, and Where() filters the remaining cards by a predicate for the
+//! properties that are not indexed. The cards of the result are always in the
+//! order of Cards::GetAllCards(). The query refers to the bitset of Cards that
+//! it starts from, and copies it only when the first filter is applied.
+//!
+//! \code{.cpp}
+//! // The standard 3-cost beasts
+//! const auto cards = CardQuery(FormatType::STANDARD)
+//!                        .WithType(CardType::MINION)
+//!                        .WithRace(Race::BEAST)
+//!                        .WithCost(3)
+//!                        .GetCards();
+//! \endcode
+//!
+class CardQuery
+{
+ public:
+    //! Constructs query that matches all cards.
+    CardQuery();
+
+    //! Constructs query that matches the collectible cards of \p format
+    //! except heroes, i.e. the cards of Cards::GetAllStandardCards() or
+    //! Cards::GetAllWildCards(). The other formats are regarded as wild.
+    //! \param format The format of the cards.
+    explicit CardQuery(FormatType format);
+
+    //! Keeps the cards that has \p cardClass.
+    //! \param cardClass The class of the card.
+    //! \return The reference to this query.
+    CardQuery& WithClass(CardClass cardClass);
+
+    //! Keeps the cards that has \p cardType.
+    //! \param cardType The type of the card.
+    //! \return The reference to this query.
+    CardQuery& WithType(CardType cardType);
+
+    //! Keeps the cards that has \p race.
+    //! \param race The race of the card.
+    //! \return The reference to this query.
+    CardQuery& WithRace(Race race);
+
+    //! Keeps the cards that has \p rarity.
+    //! \param rarity The rarity of the card.
+    //! \return The reference to this query.
+    CardQuery& WithRarity(Rarity rarity);
+
+    //! Keeps the cards whose cost is \p cost.
+    //! \param cost The cost of the card.
+    //! \return The reference to this query.
+    CardQuery& WithCost(int cost);
+
+    //! Keeps the cards whose cost is between \p minVal and \p maxVal.
+    //! \param minVal The minimum cost of the card.
+    //! \param maxVal The maximum cost of the card.
+    //! \return The reference to this query.
+    CardQuery& WithCost(int minVal, int maxVal);
+
+    //! Keeps the cards that satisfy \p predicate. Only the cards that are
+    //! matched so far are evaluated.
+    //! \param predicate The function that takes a card and returns true if
+    //! the card is kept.
+    //! \return The reference to this query.
+    template <typename Predicate>
+    CardQuery& Where(Predicate&& predicate)
+    {
+        const auto& cards = Cards::GetAllCards();
+        CardBitset& bits = GetOwnedBits();
+
+        bits.ForEach([&](std::size_t idx) {
+            if (!predicate(cards[idx]))
+            {
+                bits.Reset(idx);
+            }
+        });
+
+        return *this;
+    }
+
+    //! Returns the number of the matched cards.
+    //! \return The number of the matched cards.
+    std::size_t GetCount() const;
+
+    //! Returns a value indicating whether no cards are matched.
+    //! \return true if no cards are matched, false otherwise.
+    bool IsEmpty() const;
+
+    //! Returns the \p n-th matched card.
+    //! \param n The zero-based order of the card.
+    //! \return The \p n-th matched card, or nullptr if there are not enough
+    //! cards.
+    Card* GetNth(std::size_t n) const;
+
+    //! Returns a list of the matched cards.
+    //! \return A list of the matched cards.
+    std::vector<Card*> GetCards() const;
+
+ private:
+    //! Returns the bitset of the matched cards.
+    //! \return The bitset of the matched cards.
+    const CardBitset& GetMatchedBits() const;
+
+    //! Copies the bitset that the query starts from if it is not copied yet.
+    //! \return The bitset of the matched cards that can be filtered.
+    CardBitset& GetOwnedBits();
+
+    //! The bitset that the query starts from, or nullptr after it is copied.
+    const CardBitset* m_baseBits = nullptr;
+    CardBitset m_bits;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_CARD_QUERY_HPP
@@ -8,8 +8,11 @@
 #define ROSETTASTONE_CARDS_HPP
 
 #include <Rosetta/Cards/Card.hpp>
+#include <Rosetta/Cards/CardBitset.hpp>
 #include <Rosetta/Commons/Constants.hpp>
 
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace RosettaStone
@@ -37,10 +40,15 @@ struct SearchFilter
 //! \brief Cards class.
 //!
 //! This class stores a list of cards and provides several search methods.
+//! When the cards are loaded, it also builds hash maps for ID, dbfID and name
+//! and the bitsets of the cards for each format, class, type, race, rarity
+//! and cost, which CardQuery uses to search cards without visiting them.
 //!
 class Cards
 {
  public:
+    friend class CardQuery;
+
     //! Deleted copy constructor.
     Cards(const Cards& cards) = delete;
 
@@ -61,6 +69,11 @@ class Cards
     //! \return A list of all cards.
     static const std::vector<Card*>& GetAllCards();
 
+    //! Returns a list of the hot data of all cards. The hot data of a card is
+    //! at the ordinal of the card, so it is in the same order as GetAllCards().
+    //! \return A list of the hot data of all cards.
+    static const std::vector<CardHotData>& GetAllHotData();
+
     //! Returns a list of standard cards that matches specific card class.
     //! \param cardClass The card class to match.
     //! \return A list of standard cards that matches specific card class.
@@ -93,6 +106,17 @@ class Cards
     //! \return A card that matches \p dbfID.
     static Card* FindCardByDbfID(int dbfID);
 
+    //! Returns a card that matches \p handle.
+    //! \param handle The handle of the card.
+    //! \return A card that matches \p handle.
+    static Card* FindCardByHandle(CardHandle handle);
+
+    //! Returns the handle of the card that matches \p id.
+    //! \param id The ID of the card.
+    //! \return The handle of the card, or an invalid handle if no card
+    //! matches \p id.
+    static CardHandle GetHandle(const std::string_view& id);
+
     //! Returns a list of cards that matches \p rarity.
     //! \param rarity The rarity of the card.
     //! \return A list of cards that matches condition.
@@ -171,11 +195,25 @@ class Cards
     ~Cards();
 
     static std::vector<Card*> m_cards;
+    static std::vector<CardHotData> m_hotData;
     static std::array<std::vector<Card*>, NUM_PLAYER_CLASS> m_standardCards;
     static std::array<std::vector<Card*>, NUM_PLAYER_CLASS> m_wildCards;
     static std::vector<Card*> m_allStandardCards;
     static std::vector<Card*> m_allWildCards;
     static std::vector<Card*> m_lackeys;
+
+    static std::unordered_map<std::string_view, Card*> m_cardsByID;
+    static std::unordered_map<int, Card*> m_cardsByDbfID;
+    static std::unordered_map<std::string_view, Card*> m_cardsByName;
+
+    static CardBitset m_allCardBits;
+    static CardBitset m_standardCardBits;
+    static CardBitset m_wildCardBits;
+    static std::vector<CardBitset> m_classBits;
+    static std::vector<CardBitset> m_typeBits;
+    static std::vector<CardBitset> m_raceBits;
+    static std::vector<CardBitset> m_rarityBits;
+    static std::vector<CardBitset> m_costBits;
 };
 }  // namespace RosettaStone
 
@@ -0,0 +1,183 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_ARENA_HPP
+#define ROSETTASTONE_ARENA_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace RosettaStone
+{
+//!
+//! \brief Arena class.
+//!
+//! This class is a monotonic allocator that owns all objects created in it.
+//! Memory is carved out of large blocks and is never returned individually;
+//! the destructors of the objects are called in reverse order of creation and
+//! all blocks are freed at once when the arena is released or destroyed.
+//!
+class Arena
+{
+ public:
+    //! The default size of memory block.
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 32 * 1024;
+
+    //! Constructs arena with given \p blockSize.
+    //! \param blockSize The size of memory block.
+    explicit Arena(std::size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+    //! Destructor.
+    ~Arena();
+
+    //! Deleted copy constructor.
+    Arena(const Arena&) = delete;
+
+    //! Deleted move constructor.
+    Arena(Arena&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    Arena& operator=(const Arena&) = delete;
+
+    //! Deleted move assignment operator.
+    Arena& operator=(Arena&&) noexcept = delete;
+
+    //! Allocates uninitialized memory.
+    //! \param size The size of memory in bytes.
+    //! \param alignment The alignment of memory.
+    //! \return A pointer to the allocated memory.
+    void* Allocate(std::size_t size, std::size_t alignment);
+
+    //! Creates an object that is owned by this arena.
+    //! \param args The arguments to pass to the constructor of object.
+    //! \return A pointer to the created object.
+    template <typename T, typename... Args>
+    T* Create(Args&&... args)
+    {
+        void* memory = Allocate(sizeof(T), alignof(T));
+        T* object = new (memory) T(std::forward<Args>(args)...);
+
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            AddDestructor(object,
+                          [](void* ptr) { static_cast<T*>(ptr)->~T(); });
+        }
+
+        return object;
+    }
+
+    //! Destroys all objects and frees all memory blocks.
+    void Release();
+
+    //! Returns the number of bytes allocated from the system.
+    //! \return The number of bytes allocated from the system.
+    std::size_t GetReservedSize() const;
+
+ private:
+    struct Block
+    {
+        Block* next = nullptr;
+        std::size_t size = 0;
+    };
+
+    struct Destructor
+    {
+        void (*destroy)(void*) = nullptr;
+        void* object = nullptr;
+        Destructor* next = nullptr;
+    };
+
+    //! Registers the destructor of object.
+    //! \param object The object to destroy.
+    //! \param destroy The function that destroys \p object.
+    void AddDestructor(void* object, void (*destroy)(void*));
+
+    //! Allocates a new memory block that can hold \p size bytes.
+    //! \param size The minimum size of memory to hold.
+    void AddBlock(std::size_t size);
+
+    std::size_t m_blockSize = DEFAULT_BLOCK_SIZE;
+    std::size_t m_reservedSize = 0;
+
+    Block* m_blocks = nullptr;
+    std::byte* m_cur = nullptr;
+    std::byte* m_end = nullptr;
+
+    Destructor* m_destructors = nullptr;
+};
+
+//!
+//! \brief ArenaAllocator class.
+//!
+//! This class is an allocator adaptor that lets standard containers and
+//! std::allocate_shared() allocate their memory from Arena. Deallocation does
+//! nothing because the memory is freed when the arena is released.
+//!
+template <typename T>
+class ArenaAllocator
+{
+ public:
+    using value_type = T;
+
+    //! Constructs allocator with given \p arena.
+    //! \param arena The arena to allocate from.
+    explicit ArenaAllocator(Arena& arena) : m_arena(&arena)
+    {
+        // Do nothing
+    }
+
+    //! Constructs allocator from the allocator of other type.
+    //! \param rhs The allocator of other type.
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& rhs) : m_arena(rhs.GetArena())
+    {
+        // Do nothing
+    }
+
+    //! Allocates memory for \p count objects.
+    //! \param count The number of objects.
+    //! \return A pointer to the allocated memory.
+    T* allocate(std::size_t count)
+    {
+        return static_cast<T*>(
+            m_arena->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    //! Does nothing. The memory is freed when the arena is released.
+    void deallocate(T*, std::size_t)
+    {
+        // Do nothing
+    }
+
+    //! Returns the arena to allocate from.
+    //! \return The arena to allocate from.
+    Arena* GetArena() const
+    {
+        return m_arena;
+    }
+
+    //! Operator overloading: operator==.
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& rhs) const
+    {
+        return m_arena == rhs.GetArena();
+    }
+
+    //! Operator overloading: operator!=.
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& rhs) const
+    {
+        return m_arena != rhs.GetArena();
+    }
+
+ private:
+    Arena* m_arena = nullptr;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_ARENA_HPP
@@ -10,6 +10,7 @@
 #include <Rosetta/Enums/CardEnums.hpp>
 
 #include <array>
+#include <cstddef>
 #include <string>
 
 namespace RosettaStone
@@ -98,6 +99,10 @@ constexpr int MAX_HAND_SIZE = 10;
 //! The maximum number of secrets in secret zone.
 constexpr int MAX_SECERT_SIZE = 5;
 
+//! The number of pending update instructions of an aura that are stored in
+//! place. The instructions beyond it are stored in the heap.
+constexpr std::size_t NUM_INLINE_AURA_UPDATE_INSTRUCTIONS = 16;
+
 //! The number of menus in main phase.
 //! \note We will refactor it soon.
 constexpr int GAME_MAIN_MENU_SIZE = 3;
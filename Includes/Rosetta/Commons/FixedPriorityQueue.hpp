@@ -0,0 +1,194 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_FIXED_PRIORITY_QUEUE_HPP
+#define ROSETTASTONE_FIXED_PRIORITY_QUEUE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief FixedPriorityQueue class.
+//!
+//! This class is a priority queue that stores up to \p Capacity elements in
+//! place as a binary heap, so it doesn't allocate memory and it is copied with
+//! its owner as a plain array in the common case. The elements beyond
+//! \p Capacity are stored in a vector that continues the heap, so the queue
+//! never overflows. As PriorityQueue does, it pops the element with the
+//! lowest priority first and keeps the elements that have the same priority
+//! in order of insertion.
+//!
+template <typename T, std::size_t Capacity>
+class FixedPriorityQueue
+{
+ public:
+    //! Gets the count of the elements.
+    //! \return The count of the elements.
+    std::size_t GetCount() const
+    {
+        return m_count;
+    }
+
+    //! Gets the number of the elements that are stored in place.
+    //! \return The number of the elements that are stored in place.
+    static constexpr std::size_t GetCapacity()
+    {
+        return Capacity;
+    }
+
+    //! Inserts element and restores the order of the heap.
+    //! \param value The value of the element to push.
+    //! \param priority The priority of the element to push.
+    void Push(T value, int priority)
+    {
+        if (m_count >= Capacity)
+        {
+            m_overflow.emplace_back();
+        }
+
+        // NOTE: The sequence number is used to break ties between the elements
+        // that have the same priority, because the heap itself is not stable.
+        const Element element{ value, priority, m_sequence++ };
+
+        std::size_t pos = m_count++;
+        while (pos > 0)
+        {
+            const std::size_t parent = (pos - 1) / 2;
+            if (!IsBefore(element, At(parent)))
+            {
+                break;
+            }
+
+            At(pos) = At(parent);
+            pos = parent;
+        }
+
+        At(pos) = element;
+    }
+
+    //! Removes the top element from the priority queue.
+    //! \return The top element that is removed.
+    T Pop()
+    {
+        const T top = m_elements[0].value;
+        const Element last = At(--m_count);
+        if (m_count >= Capacity)
+        {
+            m_overflow.pop_back();
+        }
+
+        std::size_t pos = 0;
+        while (true)
+        {
+            std::size_t child = pos * 2 + 1;
+            if (child >= m_count)
+            {
+                break;
+            }
+
+            if (child + 1 < m_count && IsBefore(At(child + 1), At(child)))
+            {
+                ++child;
+            }
+
+            if (!IsBefore(At(child), last))
+            {
+                break;
+            }
+
+            At(pos) = At(child);
+            pos = child;
+        }
+
+        At(pos) = last;
+
+        if (m_count == 0)
+        {
+            m_sequence = 0;
+        }
+
+        return top;
+    }
+
+    //! Checks if the value of the element exists.
+    //! \param value The value of the element to check.
+    //! \return true if the the value of the element exists, false otherwise.
+    bool IsExist(const T& value) const
+    {
+        for (std::size_t i = 0; i < m_count; ++i)
+        {
+            if (At(i).value == value)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //! Checks if the underlying container has no elements.
+    //! \return true if the underlying container is empty, false otherwise.
+    bool IsEmpty() const
+    {
+        return m_count == 0;
+    }
+
+ private:
+    //!
+    //! \brief Element struct.
+    //!
+    //! This struct stores the value and the priority of the element, and the
+    //! sequence number that indicates the order of insertion.
+    //!
+    struct Element
+    {
+        T value = T();
+        int priority = 0;
+        std::uint32_t sequence = 0;
+    };
+
+    //! Returns the element at \p pos of the heap.
+    //! \param pos The position of the element in the heap.
+    //! \return The element at \p pos of the heap.
+    Element& At(std::size_t pos)
+    {
+        return pos < Capacity ? m_elements[pos] : m_overflow[pos - Capacity];
+    }
+
+    //! Returns the element at \p pos of the heap.
+    //! \param pos The position of the element in the heap.
+    //! \return The element at \p pos of the heap.
+    const Element& At(std::size_t pos) const
+    {
+        return pos < Capacity ? m_elements[pos] : m_overflow[pos - Capacity];
+    }
+
+    //! Checks whether \p lhs is popped before \p rhs.
+    //! \param lhs The element to compare.
+    //! \param rhs The element to compare.
+    //! \return true if \p lhs is popped before \p rhs, false otherwise.
+    static bool IsBefore(const Element& lhs, const Element& rhs)
+    {
+        if (lhs.priority != rhs.priority)
+        {
+            return lhs.priority < rhs.priority;
+        }
+
+        return lhs.sequence < rhs.sequence;
+    }
+
+    std::array<Element, Capacity> m_elements{};
+    std::vector<Element> m_overflow;
+    std::size_t m_count = 0;
+    std::uint32_t m_sequence = 0;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_FIXED_PRIORITY_QUEUE_HPP
@@ -0,0 +1,248 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_GAME_TAG_STORE_HPP
+#define ROSETTASTONE_GAME_TAG_STORE_HPP
+
+#include <Rosetta/Enums/CardEnums.hpp>
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace RosettaStone
+{
+//! The number of game tags including custom game tags.
+constexpr std::size_t NUM_GAME_TAGS =
+    sizeof(GAME_TAG_STR) / sizeof(GAME_TAG_STR[0]);
+
+//! A list of game tags that are stored in the dense slots of GameTagStore.
+constexpr GameTag HOT_GAME_TAGS[] = {
+#define X(a) GameTag::a,
+#include "../Enums/GameTagHot.def"
+#undef X
+};
+
+//! The number of game tags that are stored in the dense slots.
+constexpr std::size_t NUM_HOT_GAME_TAGS =
+    sizeof(HOT_GAME_TAGS) / sizeof(HOT_GAME_TAGS[0]);
+
+static_assert(NUM_HOT_GAME_TAGS <= 64,
+              "The presence of hot game tags is stored in 64-bit mask.");
+
+//! The slot value for game tags that are not stored in the dense slots.
+constexpr std::uint8_t INVALID_GAME_TAG_SLOT = 0xFF;
+
+//! Builds a table that maps each game tag to its dense slot.
+//! \return A table that maps each game tag to its dense slot.
+constexpr std::array<std::uint8_t, NUM_GAME_TAGS> MakeGameTagSlots()
+{
+    std::array<std::uint8_t, NUM_GAME_TAGS> slots{};
+
+    for (std::size_t i = 0; i < NUM_GAME_TAGS; ++i)
+    {
+        slots[i] = INVALID_GAME_TAG_SLOT;
+    }
+
+    for (std::size_t i = 0; i < NUM_HOT_GAME_TAGS; ++i)
+    {
+        slots[static_cast<std::size_t>(HOT_GAME_TAGS[i])] =
+            static_cast<std::uint8_t>(i);
+    }
+
+    return slots;
+}
+
+//! A table that maps each game tag to its dense slot.
+constexpr std::array<std::uint8_t, NUM_GAME_TAGS> GAME_TAG_SLOTS =
+    MakeGameTagSlots();
+
+//!
+//! \brief GameTagStore class.
+//!
+//! This class is a container that stores the values of game tags.
+//! The game tags listed in GameTagHot.def are stored in a dense fixed-slot
+//! array, so reading them is a single indexed load. The rest of game tags are
+//! stored in a small sorted overflow list.
+//!
+class GameTagStore
+{
+ public:
+    using ValueType = std::pair<GameTag, int>;
+
+    //!
+    //! \brief ConstIterator class.
+    //!
+    //! This class iterates the game tags in the dense slots and then the game
+    //! tags in the overflow list. The dereferenced value is a pair of
+    //! the game tag and its value.
+    //!
+    class ConstIterator
+    {
+     public:
+        //! Constructs iterator with given \p store and \p pos.
+        //! \param store The game tag store to iterate.
+        //! \param pos The position to start.
+        ConstIterator(const GameTagStore* store, std::size_t pos);
+
+        //! Returns a pair of the game tag and its value.
+        //! \return A pair of the game tag and its value.
+        ValueType operator*() const;
+
+        //! Moves to the next game tag.
+        //! \return The iterator that points to the next game tag.
+        ConstIterator& operator++();
+
+        //! Operator overloading: operator==.
+        bool operator==(const ConstIterator& rhs) const;
+
+        //! Operator overloading: operator!=.
+        bool operator!=(const ConstIterator& rhs) const;
+
+     private:
+        //! Skips the dense slots that have no value.
+        void SkipEmptySlots();
+
+        const GameTagStore* m_store = nullptr;
+        std::size_t m_pos = 0;
+    };
+
+    //! Default constructor.
+    GameTagStore() = default;
+
+    //! Constructs game tag store with given \p tags.
+    //! \param tags A list of game tags and their values.
+    GameTagStore(const std::map<GameTag, int>& tags);
+
+    //! Finds out if this store has game tag.
+    //! \param tag The game tag to check.
+    //! \return true if this store has game tag, and false otherwise.
+    bool Contains(GameTag tag) const
+    {
+        const std::uint8_t slot = GAME_TAG_SLOTS[static_cast<std::size_t>(tag)];
+        if (slot != INVALID_GAME_TAG_SLOT)
+        {
+            return (m_hotMask >> slot) & 1;
+        }
+
+        return FindOverflow(tag) != nullptr;
+    }
+
+    //! Finds the value of game tag.
+    //! \param tag The game tag to find.
+    //! \return A pointer to the value if it exists, nullptr otherwise.
+    const int* Find(GameTag tag) const
+    {
+        const std::uint8_t slot = GAME_TAG_SLOTS[static_cast<std::size_t>(tag)];
+        if (slot != INVALID_GAME_TAG_SLOT)
+        {
+            return ((m_hotMask >> slot) & 1) ? &m_hotValues[slot] : nullptr;
+        }
+
+        return FindOverflow(tag);
+    }
+
+    //! Returns the value of game tag.
+    //! \param tag The game tag to get.
+    //! \return The value of game tag if it exists, 0 otherwise.
+    int Get(GameTag tag) const
+    {
+        const std::uint8_t slot = GAME_TAG_SLOTS[static_cast<std::size_t>(tag)];
+        if (slot != INVALID_GAME_TAG_SLOT)
+        {
+            // NOTE: The values of empty slots are always 0.
+            return m_hotValues[slot];
+        }
+
+        const int* value = FindOverflow(tag);
+        return value != nullptr ? *value : 0;
+    }
+
+    //! Returns the value of game tag with bounds checking.
+    //! \param tag The game tag to get.
+    //! \return The value of game tag.
+    int At(GameTag tag) const;
+
+    //! Sets the value of game tag.
+    //! \param tag The game tag to set.
+    //! \param value The value to set for game tag.
+    void Set(GameTag tag, int value)
+    {
+        const std::uint8_t slot = GAME_TAG_SLOTS[static_cast<std::size_t>(tag)];
+        if (slot != INVALID_GAME_TAG_SLOT)
+        {
+            m_hotMask |= std::uint64_t{ 1 } << slot;
+            m_hotValues[slot] = value;
+            return;
+        }
+
+        SetOverflow(tag, value);
+    }
+
+    //! Returns a reference to the value of game tag, inserting 0 if the game
+    //! tag does not exist.
+    //! \param tag The game tag to access.
+    //! \return A reference to the value of game tag.
+    int& operator[](GameTag tag);
+
+    //! Removes game tag.
+    //! \param tag The game tag to remove.
+    //! \return true if game tag is removed, false otherwise.
+    bool Erase(GameTag tag);
+
+    //! Sets all game tags of \p rhs, overwriting values of existing tags.
+    //! \param rhs The game tag store to merge.
+    void Merge(const GameTagStore& rhs);
+
+    //! Removes all game tags.
+    void Clear();
+
+    //! Returns the number of game tags.
+    //! \return The number of game tags.
+    std::size_t GetCount() const;
+
+    //! Checks if this store has no game tags.
+    //! \return true if this store has no game tags, false otherwise.
+    bool IsEmpty() const;
+
+    //! Converts game tags to the map of game tags.
+    //! \return The map of game tags.
+    std::map<GameTag, int> ToMap() const;
+
+    //! Returns an iterator to the first game tag.
+    //! \return An iterator to the first game tag.
+    ConstIterator begin() const;
+
+    //! Returns an iterator to the element following the last game tag.
+    //! \return An iterator to the element following the last game tag.
+    ConstIterator end() const;
+
+    //! Operator overloading: operator==.
+    bool operator==(const GameTagStore& rhs) const;
+
+    //! Operator overloading: operator!=.
+    bool operator!=(const GameTagStore& rhs) const;
+
+ private:
+    //! Finds the value of game tag in the overflow list.
+    //! \param tag The game tag to find.
+    //! \return A pointer to the value if it exists, nullptr otherwise.
+    const int* FindOverflow(GameTag tag) const;
+
+    //! Sets the value of game tag in the overflow list.
+    //! \param tag The game tag to set.
+    //! \param value The value to set for game tag.
+    void SetOverflow(GameTag tag, int value);
+
+    std::uint64_t m_hotMask = 0;
+    std::array<int, NUM_HOT_GAME_TAGS> m_hotValues{};
+    std::vector<ValueType> m_overflow;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_GAME_TAG_STORE_HPP
@@ -0,0 +1,75 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_MAPPED_FILE_HPP
+#define ROSETTASTONE_MAPPED_FILE_HPP
+
+#include <Rosetta/Commons/Macros.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace RosettaStone
+{
+//!
+//! \brief MappedFile class.
+//!
+//! This class maps a file into memory for reading. The pages of the mapping
+//! are loaded on demand and are shared by all processes that map the same
+//! file, so reading a large file doesn't copy it.
+//!
+class MappedFile
+{
+ public:
+    //! Default constructor.
+    MappedFile() = default;
+
+    //! Destructor.
+    ~MappedFile();
+
+    //! Deleted copy constructor.
+    MappedFile(const MappedFile&) = delete;
+
+    //! Deleted move constructor.
+    MappedFile(MappedFile&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    //! Deleted move assignment operator.
+    MappedFile& operator=(MappedFile&&) noexcept = delete;
+
+    //! Maps the file of \p path into memory. It closes the previous mapping.
+    //! \param path The path of the file.
+    //! \return true if the file is mapped, false otherwise.
+    bool Open(const std::string& path);
+
+    //! Unmaps the file.
+    void Close();
+
+    //! Returns a value indicating whether the file is mapped.
+    //! \return true if the file is mapped, false otherwise.
+    bool IsOpen() const;
+
+    //! Returns the contents of the file.
+    //! \return The contents of the file.
+    const char* GetData() const;
+
+    //! Returns the size of the file in bytes.
+    //! \return The size of the file in bytes.
+    std::size_t GetSize() const;
+
+ private:
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+#if defined(ROSETTASTONE_WINDOWS)
+    void* m_file = nullptr;
+    void* m_mapping = nullptr;
+#endif
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_MAPPED_FILE_HPP
@@ -30,7 +30,12 @@ class PriorityQueue
     //! Destructor.
     ~PriorityQueue()
     {
-        delete m_head;
+        while (m_head != nullptr)
+        {
+            Node* next = m_head->next;
+            delete m_head;
+            m_head = next;
+        }
     }
 
     //! Copy constructor.
@@ -86,6 +91,7 @@ class PriorityQueue
     {
         PriorityQueue<T> temp(rhs);
         std::swap(temp.m_head, m_head);
+        std::swap(temp.m_count, m_count);
         return *this;
     }
 
@@ -94,6 +100,7 @@ class PriorityQueue
     {
         PriorityQueue<T> temp(rhs);
         std::swap(temp.m_head, m_head);
+        std::swap(temp.m_count, m_count);
         return *this;
     }
 
@@ -139,7 +146,10 @@ class PriorityQueue
         m_head->next = node->next;
         m_count--;
 
-        return node->value;
+        const T value = node->value;
+        delete node;
+
+        return value;
     }
 
     //! Checks if the value of the element exists.
@@ -0,0 +1,119 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_RANDOM_ENGINE_HPP
+#define ROSETTASTONE_RANDOM_ENGINE_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <type_traits>
+
+namespace RosettaStone
+{
+//!
+//! \brief RandomEngine class.
+//!
+//! This class is a seedable pseudo-random number generator. Each game owns
+//! its own engine, so games can run in parallel without shared state and
+//! a game can be replayed from its seed and the list of actions.
+//!
+class RandomEngine
+{
+ public:
+    using EngineType = std::mt19937;
+    using SeedType = EngineType::result_type;
+
+    //! Constructs random engine with a non-deterministic seed.
+    RandomEngine();
+
+    //! Constructs random engine with given \p seed.
+    //! \param seed The seed of random engine.
+    explicit RandomEngine(SeedType seed);
+
+    //! Reseeds the random engine.
+    //! \param seed The seed of random engine.
+    void Seed(SeedType seed);
+
+    //! Returns the seed of random engine.
+    //! \return The seed of random engine.
+    SeedType GetSeed() const;
+
+    //! Returns the underlying engine.
+    //! \return The underlying engine.
+    EngineType& GetEngine()
+    {
+        return m_engine;
+    }
+
+    //! Returns a random number in the closed interval [\p from, \p to].
+    //! \param from The lower bound of the interval.
+    //! \param to The upper bound of the interval.
+    //! \return A random number in the closed interval.
+    template <typename T>
+    std::enable_if_t<std::is_integral_v<T>, T> Get(T from, T to)
+    {
+        if (from > to)
+        {
+            std::swap(from, to);
+        }
+
+        return std::uniform_int_distribution<T>{ from, to }(m_engine);
+    }
+
+    //! Returns a random number in the half-open interval [\p from, \p to).
+    //! \param from The lower bound of the interval.
+    //! \param to The upper bound of the interval.
+    //! \return A random number in the half-open interval.
+    template <typename T>
+    std::enable_if_t<std::is_floating_point_v<T>, T> Get(T from, T to)
+    {
+        if (from > to)
+        {
+            std::swap(from, to);
+        }
+
+        return std::uniform_real_distribution<T>{ from, to }(m_engine);
+    }
+
+    //! Returns an iterator to a random element of \p container.
+    //! \param container The container to choose an element.
+    //! \return An iterator to a random element, or end iterator if
+    //! \p container is empty.
+    template <typename Container>
+    auto Get(Container& container) -> decltype(std::begin(container))
+    {
+        using DiffType = typename std::iterator_traits<decltype(
+            std::begin(container))>::difference_type;
+
+        auto iter = std::begin(container);
+        const DiffType size =
+            std::distance(std::begin(container), std::end(container));
+        if (size == 0)
+        {
+            return std::end(container);
+        }
+
+        std::advance(iter, Get<DiffType>(0, size - 1));
+        return iter;
+    }
+
+    //! Shuffles the elements in the range [\p first, \p last).
+    //! \param first The beginning of the range.
+    //! \param last The end of the range.
+    template <typename Iterator>
+    void Shuffle(Iterator first, Iterator last)
+    {
+        std::shuffle(first, last, m_engine);
+    }
+
+ private:
+    EngineType m_engine;
+    SeedType m_seed = 0;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_RANDOM_ENGINE_HPP
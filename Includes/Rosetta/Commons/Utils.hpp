@@ -7,15 +7,13 @@
 #ifndef ROSETTASTONE_UTILS_HPP
 #define ROSETTASTONE_UTILS_HPP
 
-#include <effolkronium/random.hpp>
+#include <Rosetta/Commons/RandomEngine.hpp>
 
 #include <cstddef>
 #include <functional>
 #include <string>
 #include <vector>
 
-using Random = effolkronium::random_static;
-
 //! Checks all conditions are true.
 //! \param t A value to check that it is true.
 //! \return true if all conditions are true, false otherwise.
@@ -70,9 +68,12 @@ void EraseIf(ContainerT& items, const PredicateT& predicate)
 //! equality comparer. The source list must not have any repeated elements.
 //! \param list A list of distinct elements to choose.
 //! \param amount The number of elements to choose.
+//! \param random The random engine to choose elements.
 //! \return A list of N distinct elements.
 template <typename T, std::size_t N>
-std::vector<T*> ChooseNElements(const std::array<T*, N>& list, std::size_t amount)
+std::vector<T*> ChooseNElements(const std::array<T*, N>& list,
+                                std::size_t amount,
+                                RosettaStone::RandomEngine& random)
 {
     if (amount > list.size())
     {
@@ -92,7 +93,7 @@ std::vector<T*> ChooseNElements(const std::array<T*, N>& list, std::size_t amoun
 
         do
         {
-            idx = Random::get<std::size_t>(0, list.size() - 1);
+            idx = random.Get<std::size_t>(0, list.size() - 1);
             flag = false;
 
             for (std::size_t j = 0; j < i; ++j)
@@ -116,9 +117,11 @@ std::vector<T*> ChooseNElements(const std::array<T*, N>& list, std::size_t amoun
 //! equality comparer. The source list must not have any repeated elements.
 //! \param list A list of distinct elements to choose.
 //! \param amount The number of elements to choose.
+//! \param random The random engine to choose elements.
 //! \return A list of N distinct elements.
 template <typename T>
-std::vector<T*> ChooseNElements(const std::vector<T*>& list, std::size_t amount)
+std::vector<T*> ChooseNElements(const std::vector<T*>& list, std::size_t amount,
+                                RosettaStone::RandomEngine& random)
 {
     if (amount > list.size())
     {
@@ -138,7 +141,7 @@ std::vector<T*> ChooseNElements(const std::vector<T*>& list, std::size_t amount)
 
         do
         {
-            idx = Random::get<std::size_t>(0, list.size() - 1);
+            idx = random.Get<std::size_t>(0, list.size() - 1);
             flag = false;
 
             for (std::size_t j = 0; j < i; ++j)
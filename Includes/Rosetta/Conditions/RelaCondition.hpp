@@ -6,6 +6,7 @@
 #ifndef ROSETTASTONE_RELA_CONDITION_HPP
 #define ROSETTASTONE_RELA_CONDITION_HPP
 
+#include <cstdint>
 #include <functional>
 
 namespace RosettaStone
@@ -16,7 +17,8 @@ class Playable;
 //! \brief RelaCondition class.
 //!
 //! This class is a container for all conditions about the relation
-//! between 2 entities.
+//! between 2 entities. Like SelfCondition, the common conditions are compiled
+//! into an operation and the rest run a custom function.
 //!
 class RelaCondition
 {
@@ -40,7 +42,20 @@ class RelaCondition
     bool Evaluate(Playable* owner, Playable* affected) const;
 
  private:
+    //! \brief An enumerator for identifying the compiled operation.
+    enum class Op : std::uint8_t
+    {
+        CUSTOM,
+        IS_FRIENDLY,
+        IS_SIDE_BY_SIDE,
+    };
+
+    //! Constructs compiled condition with given \p op.
+    //! \param op The operation to run.
+    explicit RelaCondition(Op op);
+
     std::function<bool(Playable*, Playable*)> m_func;
+    Op m_op = Op::CUSTOM;
 };
 }  // namespace RosettaStone
 
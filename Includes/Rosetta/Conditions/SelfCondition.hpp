@@ -9,7 +9,9 @@
 #include <Rosetta/Enums/CardEnums.hpp>
 #include <Rosetta/Enums/TaskEnums.hpp>
 
+#include <cstdint>
 #include <functional>
+#include <string>
 
 namespace RosettaStone
 {
@@ -19,6 +21,10 @@ class Playable;
 //! \brief SelfCondition class.
 //!
 //! This class is a container for all conditions about the subject entity.
+//! The common conditions are compiled into an operation and its arguments
+//! that Evaluate() runs with a switch, so they don't pay for the call
+//! through std::function. The conditions that are made from a custom
+//! function run the function.
 //!
 class SelfCondition
 {
@@ -348,7 +354,65 @@ class SelfCondition
     bool Evaluate(Playable* owner) const;
 
  private:
+    //! \brief An enumerator for identifying the compiled operation.
+    enum class Op : std::uint8_t
+    {
+        CUSTOM,
+        IS_CURRENT_PLAYER,
+        IS_DECK_EMPTY,
+        IS_GALAKROND_HERO,
+        IS_HERO_POWER_CARD,
+        IS_BATTLECRY_CARD,
+        IS_DEAD,
+        IS_NOT_DEAD,
+        IS_NOT_IMMUNE,
+        IS_NOT_UNTOUCHABLE,
+        IS_FIELD_FULL,
+        IS_FIELD_NOT_FULL,
+        IS_FIELD_NOT_EMPTY,
+        IS_OP_FIELD_NOT_FULL,
+        IS_DAMAGED,
+        IS_UNDAMAGED,
+        IS_WEAPON_EQUIPPED,
+        IS_RACE,
+        IS_CONTROLLING_SECRET,
+        IS_CARD_ID,
+        IS_MINION,
+        IS_SPELL,
+        IS_WEAPON,
+        IS_SECRET,
+        IS_CHOOSE_ONE_CARD,
+        IS_FROZEN,
+        IS_RUSH,
+        HAS_DEATHRATTLE,
+        HAS_NOT_STEALTH,
+        HAS_WINDFURY,
+        HAS_REBORN,
+        HAS_SPELL_POWER,
+        IS_OVERLOAD_CARD,
+        IS_ATTACK_THIS_TURN,
+        IS_COST,
+        IS_TAG_VALUE,
+        IS_HEALTH,
+        HAS_TARGET,
+        IS_IN_ZONE,
+        IS_ENEMY_TURN,
+    };
+
+    //! Constructs compiled condition with given \p op and its arguments.
+    //! \param op The operation to run.
+    //! \param arg The argument of the operation, e.g. race or game tag.
+    //! \param value The value to compare.
+    //! \param relaSign The comparer to compare the value.
+    explicit SelfCondition(Op op, int arg = 0, int value = 0,
+                           RelaSign relaSign = RelaSign::EQ);
+
     std::function<bool(Playable*)> m_func;
+    Op m_op = Op::CUSTOM;
+    RelaSign m_relaSign = RelaSign::EQ;
+    int m_arg = 0;
+    int m_value = 0;
+    std::string m_cardID;
 };
 }  // namespace RosettaStone
 
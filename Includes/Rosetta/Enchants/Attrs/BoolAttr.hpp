@@ -57,12 +57,7 @@ class BoolAttr : public Attr<T>
     void ApplyAura(T* entity, [[maybe_unused]] EffectOperator effectOp,
                    [[maybe_unused]] int value) override
     {
-        AuraEffects* auraEffects = entity->auraEffects;
-        if (auraEffects == nullptr)
-        {
-            auraEffects = new AuraEffects(entity->card->GetCardType());
-            entity->auraEffects = auraEffects;
-        }
+        AuraEffects* auraEffects = entity->GetOrCreateAuraEffects();
 
         const int target = Attr<T>::GetAuraValue(auraEffects);
         Attr<T>::SetAuraValue(auraEffects, target + 1);
@@ -75,8 +70,10 @@ class BoolAttr : public Attr<T>
     void RemoveAura(T* entity, [[maybe_unused]] EffectOperator effectOp,
                     [[maybe_unused]] int value) override
     {
-        const int target = Attr<T>::GetAuraValue(entity->auraEffects);
-        Attr<T>::SetAuraValue(entity->auraEffects, target - 1);
+        AuraEffects* auraEffects = entity->GetOrCreateAuraEffects();
+
+        const int target = Attr<T>::GetAuraValue(auraEffects);
+        Attr<T>::SetAuraValue(auraEffects, target - 1);
     }
 
  protected:
@@ -40,9 +40,10 @@ class Cost : public SelfContainedIntAttr<Cost, Entity>
 
         const auto playable = dynamic_cast<Playable*>(entity);
 
-        if (auto* costManager = playable->costManager; costManager)
+        if (playable->costManager != nullptr)
         {
-            costManager->AddCostEnchantment(effectOp, value);
+            playable->GetOrCreateCostManager()->AddCostEnchantment(effectOp,
+                                                                   value);
         }
     }
 
@@ -54,14 +55,7 @@ class Cost : public SelfContainedIntAttr<Cost, Entity>
     {
         const auto playable = dynamic_cast<Playable*>(entity);
 
-        CostManager* costManager = playable->costManager;
-        if (costManager == nullptr)
-        {
-            costManager = new CostManager();
-            playable->costManager = costManager;
-        }
-
-        costManager->AddCostAura(effectOp, value);
+        playable->GetOrCreateCostManager()->AddCostAura(effectOp, value);
     }
 
     //! Removes the aura that affects the attribute.
@@ -72,9 +66,9 @@ class Cost : public SelfContainedIntAttr<Cost, Entity>
     {
         const auto playable = dynamic_cast<Playable*>(entity);
 
-        if (auto* costManager = playable->costManager; costManager)
+        if (playable->costManager != nullptr)
         {
-            costManager->RemoveCostAura(effectOp, value);
+            playable->GetOrCreateCostManager()->RemoveCostAura(effectOp, value);
         }
     }
 
@@ -78,12 +78,7 @@ class IntAttr : public Attr<T>
     //! \param value The value to change the attribute.
     void ApplyAura(T* entity, EffectOperator effectOp, int value) override
     {
-        AuraEffects* auraEffects = entity->auraEffects;
-        if (auraEffects == nullptr)
-        {
-            auraEffects = new AuraEffects(entity->card->GetCardType());
-            entity->auraEffects = auraEffects;
-        }
+        AuraEffects* auraEffects = entity->GetOrCreateAuraEffects();
 
         const int target = GetAuraValue(auraEffects);
 
@@ -111,18 +106,20 @@ class IntAttr : public Attr<T>
     //! \param value The value to change the attribute.
     void RemoveAura(T* entity, EffectOperator effectOp, int value) override
     {
-        const int target = GetAuraValue(entity->auraEffects);
+        AuraEffects* auraEffects = entity->GetOrCreateAuraEffects();
+
+        const int target = GetAuraValue(auraEffects);
 
         switch (effectOp)
         {
             case EffectOperator::ADD:
-                SetAuraValue(entity->auraEffects, target - value);
+                SetAuraValue(auraEffects, target - value);
                 break;
             case EffectOperator::SUB:
-                SetAuraValue(entity->auraEffects, target + value);
+                SetAuraValue(auraEffects, target + value);
                 break;
             case EffectOperator::SET:
-                SetAuraValue(entity->auraEffects, target - value);
+                SetAuraValue(auraEffects, target - value);
                 break;
             default:
                 throw std::invalid_argument(
@@ -8,6 +8,8 @@
 
 #include <Rosetta/Enums/CardEnums.hpp>
 
+#include <array>
+
 namespace RosettaStone
 {
 class Entity;
@@ -16,7 +18,7 @@ constexpr int AURA_EFFECT_CARD_SIZE = 0;
 constexpr int AURA_EFFECT_WEAPON_SIZE = AURA_EFFECT_CARD_SIZE + 1;
 constexpr int AURA_EFFECT_CHARACTER_SIZE = AURA_EFFECT_CARD_SIZE + 2;
 constexpr int AURA_EFFECT_HERO_SIZE = AURA_EFFECT_CHARACTER_SIZE + 3;
-constexpr int AURA_EFFECT_MINION_SIZE = AURA_EFFECT_CHARACTER_SIZE + 5;
+constexpr int AURA_EFFECT_MINION_SIZE = AURA_EFFECT_CHARACTER_SIZE + 6;
 
 //!
 //! \brief AuraEffects class.
@@ -31,17 +33,17 @@ class AuraEffects
     //! \param type The type of the card.
     explicit AuraEffects(CardType type);
 
-    //! Destructor.
-    ~AuraEffects();
+    //! Default destructor.
+    ~AuraEffects() = default;
 
-    //! Deleted copy constructor.
-    AuraEffects(const AuraEffects&) = delete;
+    //! Default copy constructor.
+    AuraEffects(const AuraEffects&) = default;
 
     //! Deleted move constructor.
     AuraEffects(AuraEffects&&) noexcept = delete;
 
-    //! Deleted copy assignment operator.
-    AuraEffects& operator=(const AuraEffects&) = delete;
+    //! Default copy assignment operator.
+    AuraEffects& operator=(const AuraEffects&) = default;
 
     //! Deleted move assignment operator.
     AuraEffects& operator=(AuraEffects&&) noexcept = delete;
@@ -161,7 +163,9 @@ class AuraEffects
     // 5 : TAUNT
     // 6 : LIFESTEAL
     // 7 : CANT_ATTACK
-    int* m_data = nullptr;
+    // NOTE: The values are stored inline so that aura effects are trivially
+    // destructible and can be allocated in the arena of game.
+    std::array<int, AURA_EFFECT_MINION_SIZE> m_data{};
 };
 }  // namespace RosettaStone
 
@@ -43,6 +43,10 @@ class OngoingEnchant : public Enchant, public IAura
     //! Updates this effect to apply the effect to recently modified entities.
     void Update() override;
 
+    //! Returns a value indicating whether this effect has nothing to update.
+    //! \return true if this effect has nothing to update, false otherwise.
+    bool IsUpToDate() const override;
+
     //! Removes this effect from the game to stop affecting entities.
     void Remove() override;
 
@@ -62,9 +66,15 @@ class OngoingEnchant : public Enchant, public IAura
     Playable* target = nullptr;
 
  private:
+    //! Records the count of ongoing enchants before it is changed.
+    void SaveState();
+
     std::size_t m_count = 1;
     std::size_t m_lastCount = 1;
     bool m_toBeUpdated = false;
+
+    //! The epoch of journal when the count was last recorded.
+    std::uint64_t m_stateEpoch = 0;
 };
 }  // namespace RosettaStone
 
@@ -31,8 +31,8 @@ class PlayerAuraEffects
     //! Deleted move constructor.
     PlayerAuraEffects(PlayerAuraEffects&&) noexcept = delete;
 
-    //! Deleted copy assignment operator.
-    PlayerAuraEffects& operator=(const PlayerAuraEffects&) = delete;
+    //! Default copy assignment operator.
+    PlayerAuraEffects& operator=(const PlayerAuraEffects&) = default;
 
     //! Deleted move assignment operator.
     PlayerAuraEffects& operator=(PlayerAuraEffects&&) noexcept = delete;
@@ -29,39 +29,39 @@ class Power
 {
  public:
     //! Returns aura.
-    IAura* GetAura();
+    IAura* GetAura() const;
 
     //! Returns enchant.
     //! \return A reference to enchant.
-    Enchant* GetEnchant();
+    Enchant* GetEnchant() const;
 
     //! Returns trigger.
     //! \return A reference to trigger.
-    Trigger* GetTrigger();
+    Trigger* GetTrigger() const;
 
     //! Returns a list of power tasks.
     //! \return A list of power tasks.
-    std::vector<std::shared_ptr<ITask>>& GetPowerTask();
+    const std::vector<std::shared_ptr<ITask>>& GetPowerTask() const;
 
     //! Returns a list of deathrattle tasks.
     //! \return A list of deathrattle tasks.
-    std::vector<std::shared_ptr<ITask>>& GetDeathrattleTask();
+    const std::vector<std::shared_ptr<ITask>>& GetDeathrattleTask() const;
 
     //! Returns a list of combo tasks.
     //! \return A list of combo tasks.
-    std::vector<std::shared_ptr<ITask>>& GetComboTask();
+    const std::vector<std::shared_ptr<ITask>>& GetComboTask() const;
 
     //! Returns a list of topdeck tasks.
     //! \return A list of topdeck tasks.
-    std::vector<std::shared_ptr<ITask>>& GetTopdeckTask();
+    const std::vector<std::shared_ptr<ITask>>& GetTopdeckTask() const;
 
     //! Returns a list of after choose tasks.
     //! \return A list of after choose tasks.
-    std::vector<std::shared_ptr<ITask>>& GetAfterChooseTask();
+    const std::vector<std::shared_ptr<ITask>>& GetAfterChooseTask() const;
 
     //! Returns a list of outcast tasks.
     //! \return A list of outcast tasks.
-    std::vector<std::shared_ptr<ITask>>& GetOutcastTask();
+    const std::vector<std::shared_ptr<ITask>>& GetOutcastTask() const;
 
     //! Clears power task and enchant.
     void ClearData();
@@ -10,6 +10,8 @@
 #ifndef ROSETTASTONE_ACTION_ENUMS_HPP
 #define ROSETTASTONE_ACTION_ENUMS_HPP
 
+#include <string>
+
 namespace RosettaStone
 {
 //! \brief An enumerator for identifying main operation type.
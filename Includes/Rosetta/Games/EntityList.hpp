@@ -0,0 +1,95 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_ENTITY_LIST_HPP
+#define ROSETTASTONE_ENTITY_LIST_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace RosettaStone
+{
+class Playable;
+
+//!
+//! \brief EntityList class.
+//!
+//! This class is a table that maps entity ID to the entity of game. Entity IDs
+//! are issued by Game::GetNextID() and are nearly dense, so entities are
+//! stored in a vector indexed by entity ID. Lookup is a bounds check and
+//! a single indexed load, and iteration visits entities in order of ID.
+//!
+class EntityList
+{
+ public:
+    //! Returns the entity that has given \p id.
+    //! \param id The entity ID to find.
+    //! \return The entity if it exists, nullptr otherwise.
+    Playable* Get(int id) const
+    {
+        if (id < 0 || static_cast<std::size_t>(id) >= m_entities.size())
+        {
+            return nullptr;
+        }
+
+        return m_entities[id];
+    }
+
+    //! Returns the entity that has given \p id with bounds checking.
+    //! \param id The entity ID to find.
+    //! \return The entity that has given \p id.
+    Playable* At(int id) const;
+
+    //! Checks if this list has the entity that has given \p id.
+    //! \param id The entity ID to check.
+    //! \return true if this list has the entity, false otherwise.
+    bool Contains(int id) const
+    {
+        return Get(id) != nullptr;
+    }
+
+    //! Sets the entity that has given \p id. The existing entity is replaced.
+    //! \param id The entity ID to set.
+    //! \param entity The entity to set.
+    void Set(int id, Playable* entity);
+
+    //! Removes the entity that has given \p id.
+    //! \param id The entity ID to remove.
+    //! \return true if the entity is removed, false otherwise.
+    bool Erase(int id);
+
+    //! Removes all entities.
+    void Clear();
+
+    //! Returns the number of entities.
+    //! \return The number of entities.
+    std::size_t GetCount() const;
+
+    //! Checks if this list has no entities.
+    //! \return true if this list has no entities, false otherwise.
+    bool IsEmpty() const;
+
+    //! Runs \p functor on each entity in order of ID.
+    //! \param functor A function to run for each entity.
+    template <typename Functor>
+    void ForEach(Functor&& functor) const
+    {
+        for (Playable* entity : m_entities)
+        {
+            if (entity != nullptr)
+            {
+                functor(entity);
+            }
+        }
+    }
+
+ private:
+    std::vector<Playable*> m_entities;
+    std::size_t m_count = 0;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_ENTITY_LIST_HPP
@@ -6,8 +6,13 @@
 #ifndef ROSETTASTONE_GAME_HPP
 #define ROSETTASTONE_GAME_HPP
 
+#include <Rosetta/Commons/Arena.hpp>
+#include <Rosetta/Commons/RandomEngine.hpp>
 #include <Rosetta/Enums/CardEnums.hpp>
+#include <Rosetta/Games/EntityList.hpp>
+#include <Rosetta/Games/GameJournal.hpp>
 #include <Rosetta/Games/GameConfig.hpp>
+#include <Rosetta/Games/ZobristHash.hpp>
 #include <Rosetta/Managers/TriggerManager.hpp>
 #include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Tasks/EventMetaData.hpp>
@@ -15,11 +20,14 @@
 #include <Rosetta/Tasks/TaskStack.hpp>
 #include <Rosetta/Views/ReducedBoardView.hpp>
 
+#include <cstdint>
+#include <limits>
 #include <map>
 
 namespace RosettaStone
 {
 class ActionParams;
+struct Move;
 
 //!
 //! \brief Game class.
@@ -29,6 +37,8 @@ class ActionParams;
 //!
 class Game
 {
+    friend class GameBatch;
+
  public:
     //! Constructs game with default values.
     Game();
@@ -59,6 +69,27 @@ class Game
     //! \param rhs The source to copy the content.
     void RefCopyFrom(const Game& rhs);
 
+    //! Creates a deep copy of the game. All entities, zones, enchantments,
+    //! auras, triggers and pending tasks are duplicated and every pointer in
+    //! the copy refers to the entities of the copy.
+    //! \return The copy of the game.
+    std::unique_ptr<Game> Clone() const;
+
+    //! Starts recording mutations of the game into the journal and returns
+    //! a checkpoint that can be passed to Rollback(). Checkpoints can be
+    //! nested, e.g. to explore sibling actions from the same state.
+    //! \return The checkpoint of the current state.
+    std::size_t Checkpoint();
+
+    //! Undoes all mutations of the game made after \p checkpoint. The journal
+    //! keeps recording, so the checkpoint can be rolled back again.
+    //! \param checkpoint The checkpoint returned by Checkpoint().
+    void Rollback(std::size_t checkpoint);
+
+    //! Stops recording mutations of the game and discards the journal.
+    //! All checkpoints are invalidated.
+    void StopJournal();
+
     //! Gets player's deck.
     //! \param type The player type to get deck.
     std::array<Card*, START_DECK_SIZE> GetPlayerDeck(PlayerType type);
@@ -179,9 +210,15 @@ class Game
     //! Processes graveyard.
     void ProcessGraveyard();
 
-    //! Updates aura.
+    //! Updates aura. It does nothing if the state of game is not changed since
+    //! auras were last updated, and it skips each aura whose entities are not
+    //! changed since the aura was last updated.
     void UpdateAura();
 
+    //! Returns the number of aura updates that are skipped by UpdateAura().
+    //! \return The number of aura updates that are skipped.
+    std::size_t GetNumSkippedAuraUpdates() const;
+
     //! Process the specified task.
     //! \param player A player to run task.
     //! \param task The game task to execute.
@@ -204,16 +241,37 @@ class Game
     //! \return The result of the game (player1 and player2).
     std::tuple<PlayState, PlayState> PerformAction(ActionParams& params);
 
+    //! Performs \p move of the current player that is generated by
+    //! MoveGenerator.
+    //! \param move The move to perform.
+    //! \return The result of the game (player1 and player2).
+    std::tuple<PlayState, PlayState> ApplyMove(const Move& move);
+
     //! Creates board view.
     //! \return The reduced board view.
     ReducedBoardView CreateView();
 
+    //! Returns the hash of game state that \p side can see. The hash is
+    //! maintained incrementally, so it is cheap to call after each action.
+    //! \param side The player who sees the game state.
+    //! \return The hash of game state.
+    std::uint64_t GetHash(PlayerType side) const;
+
+    // NOTE: The arena owns entities, enchantments and aura effects of this
+    // game. It is declared first so that it is destroyed after all other
+    // members that refer to them.
+    Arena arena;
+
+    GameJournal journal;
+    ZobristHash zobrist;
+    RandomEngine random;
+
     State state = State::INVALID;
 
     Step step = Step::INVALID;
     Step nextStep = Step::INVALID;
 
-    std::map<int, Playable*> entityList;
+    EntityList entityList;
     std::vector<Minion*> summonedMinions;
     std::map<std::size_t, Minion*> deadMinions;
     std::vector<int> rushMinions;
@@ -241,6 +299,9 @@ class Game
 
     std::size_t m_entityID = 0;
     std::size_t m_oopIndex = 0;
+    std::uint64_t m_auraMutationCount =
+        std::numeric_limits<std::uint64_t>::max();
+    std::size_t m_numSkippedAuraUpdates = 0;
 
     PlayerType m_currentPlayer = PlayerType::INVALID;
 };
@@ -0,0 +1,140 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_GAME_BATCH_HPP
+#define ROSETTASTONE_GAME_BATCH_HPP
+
+#include <Rosetta/Actions/MoveGenerator.hpp>
+#include <Rosetta/Games/Game.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief GameBatch class.
+//!
+//! This class owns a batch of independent games of the same config and runs
+//! them side by side, e.g. for self-play or a vectorized environment. The
+//! games are constructed in place in one contiguous array of slots. A
+//! finished game can be reset in its slot, which destroys it and constructs
+//! a new game there, so the slot isn't allocated again but the players, zones
+//! and entities of the new game are. The lists of moves and results are owned
+//! by the batch and reused by every step.
+//!
+//! The games don't run the steps of a turn by themselves. After the moves are
+//! applied, the batch advances all games whose turn is over one step at a
+//! time, and the games at the same step run it back to back, so the games
+//! that ended the turn together go through MainReady, MainDraw, ... in
+//! lockstep until they reach MainAction again.
+//!
+class GameBatch
+{
+ public:
+    //! The result of a game after a step.
+    struct Result
+    {
+        PlayState player1 = PlayState::INVALID;
+        PlayState player2 = PlayState::INVALID;
+        bool isComplete = false;
+    };
+
+    //! Constructs game batch with given \p gameConfig and \p size.
+    //! The mulligan is skipped and the steps are run by the batch, so
+    //! skipMulligan and autoRun of \p gameConfig are ignored. If the seed is
+    //! set, the games are seeded with the consecutive numbers from it.
+    //! \param gameConfig The game config of all games.
+    //! \param size The number of games.
+    GameBatch(const GameConfig& gameConfig, std::size_t size);
+
+    //! Default destructor.
+    ~GameBatch() = default;
+
+    //! Deleted copy constructor.
+    GameBatch(const GameBatch&) = delete;
+
+    //! Deleted move constructor.
+    GameBatch(GameBatch&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    GameBatch& operator=(const GameBatch&) = delete;
+
+    //! Deleted move assignment operator.
+    GameBatch& operator=(GameBatch&&) noexcept = delete;
+
+    //! Returns the number of games.
+    //! \return The number of games.
+    std::size_t GetSize() const;
+
+    //! Returns the number of games that are not complete.
+    //! \return The number of games that are not complete.
+    std::size_t GetNumRunning() const;
+
+    //! Returns the game at \p idx.
+    //! \param idx The index of game.
+    //! \return The game at \p idx.
+    Game& GetGame(std::size_t idx);
+
+    //! Returns the game at \p idx.
+    //! \param idx The index of game.
+    //! \return The game at \p idx.
+    const Game& GetGame(std::size_t idx) const;
+
+    //! Starts all games and advances them to the first main action.
+    void Start();
+
+    //! Destroys the game at \p idx and constructs a new game in the same slot,
+    //! and starts it. It is intended to restart a game that is complete. The
+    //! new game is built from scratch like the one that the constructor
+    //! makes, and only the storage of the slot is reused. If the
+    //! construction of the new game throws, the slot is left empty and
+    //! GetGame() throws std::bad_optional_access until it is reset again.
+    //! \param idx The index of game.
+    void Reset(std::size_t idx);
+
+    //! Generates the moves of the current players of all games. The moves of
+    //! the games that are complete are empty.
+    void GenerateMoves();
+
+    //! Returns the moves of the game at \p idx that are generated by the last
+    //! call of GenerateMoves().
+    //! \param idx The index of game.
+    //! \return The moves of the game at \p idx.
+    const std::vector<Move>& GetMoves(std::size_t idx) const;
+
+    //! Applies \p moves to the games and advances the games whose turn is over
+    //! to the next main action. The move of a game that is complete is
+    //! ignored.
+    //! \param moves The moves to apply, one per game.
+    //! \return The results of the games, one per game. It is valid until the
+    //! next call of Step().
+    const std::vector<Result>& Step(const std::vector<Move>& moves);
+
+ private:
+    //! Constructs a new game in the slot at \p idx.
+    //! \param idx The index of game.
+    void CreateGame(std::size_t idx);
+
+    //! Advances the games that are not at the main action until all of them
+    //! reach it, running the games at the same step together.
+    void AdvanceToAction();
+
+    GameConfig m_gameConfig;
+    std::optional<RandomEngine::SeedType> m_nextSeed;
+
+    std::size_t m_size = 0;
+    std::unique_ptr<std::optional<Game>[]> m_games;
+
+    std::vector<std::vector<Move>> m_moves;
+    std::vector<Result> m_results;
+    std::vector<std::size_t> m_pending;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_GAME_BATCH_HPP
@@ -8,9 +8,11 @@
 
 #include <Rosetta/Cards/Card.hpp>
 #include <Rosetta/Commons/Constants.hpp>
+#include <Rosetta/Commons/RandomEngine.hpp>
 #include <Rosetta/Models/Player.hpp>
 
 #include <array>
+#include <optional>
 
 namespace RosettaStone
 {
@@ -44,6 +46,10 @@ struct GameConfig
         "UNG_920", "UNG_940", "UNG_942", "UNG_954"
     };
 
+    //! The seed of random engine of the game. If it is not set,
+    //! a non-deterministic seed is used.
+    std::optional<RandomEngine::SeedType> seed;
+
     bool doFillDecks = false;
     bool doShuffle = true;
     bool skipMulligan = true;
@@ -0,0 +1,241 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_GAME_JOURNAL_HPP
+#define ROSETTASTONE_GAME_JOURNAL_HPP
+
+#include <Rosetta/Enums/CardEnums.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace RosettaStone
+{
+class EntityList;
+class Game;
+class GameTagStore;
+
+//!
+//! \brief GameJournal class.
+//!
+//! This class records the mutations of game state while recording is enabled,
+//! so that they can be undone in reverse order. Frequent mutations such as
+//! game tag writes and zone moves are stored as plain entries that hold an
+//! undo function and its arguments, and rare structural mutations such as
+//! aura and trigger registration are stored as closures. It also counts all
+//! mutations whether recording is enabled or not, so that the game can tell
+//! whether its state is changed since a given point, e.g. to skip updating
+//! auras when nothing is changed.
+//!
+class GameJournal
+{
+ public:
+    //!
+    //! \brief Entry struct.
+    //!
+    //! This struct stores a mutation. \p undo is called with the entry itself
+    //! to restore the state before the mutation.
+    //!
+    struct Entry
+    {
+        void (*undo)(const Entry& entry) = nullptr;
+        void* target = nullptr;
+        void* object = nullptr;
+        int key = 0;
+        int value = 0;
+        bool exists = false;
+    };
+
+    using UndoFunc = void (*)(const Entry& entry);
+
+    //! Returns the flag that indicates whether mutations are recorded.
+    //! \return The flag that indicates whether mutations are recorded.
+    bool IsRecording() const
+    {
+        return m_isRecording;
+    }
+
+    //! Starts recording mutations.
+    void Start();
+
+    //! Stops recording mutations and discards all recorded entries.
+    void Stop();
+
+    //! Returns the number of recorded entries.
+    //! \return The number of recorded entries.
+    std::size_t GetSize() const;
+
+    //! Returns the number of mutations that are made so far. It is increased
+    //! by every mutation, including the ones that are not recorded and undone.
+    //! \return The number of mutations that are made so far.
+    std::uint64_t GetMutationCount() const
+    {
+        return m_mutationCount;
+    }
+
+    //! Returns the mutation count when the journal was last rolled back.
+    //! Rollback() restores states without marking entities as changed, so
+    //! the states derived before it must not be regarded as up to date.
+    //! \return The mutation count when the journal was last rolled back.
+    std::uint64_t GetLastRollback() const
+    {
+        return m_lastRollback;
+    }
+
+    //! Returns the epoch of the journal. It is increased whenever recording
+    //! starts or the journal is rolled back, so that the objects whose state
+    //! is recorded at once can tell whether it is recorded since then.
+    //! \return The epoch of the journal.
+    std::uint64_t GetEpoch() const
+    {
+        return m_epoch;
+    }
+
+    //! Counts a mutation that is not recorded by the journal, e.g. the change
+    //! of state that is rebuilt on rollback.
+    void NotifyMutation()
+    {
+        ++m_mutationCount;
+    }
+
+    //! Records a mutation if recording is enabled.
+    //! \param undo The function to undo the mutation.
+    //! \param target The object that is mutated.
+    //! \param object The object that is related to the mutation.
+    //! \param key The key of the mutation.
+    //! \param value The old value of the mutation.
+    //! \param exists The flag that indicates whether the old value exists.
+    void Record(UndoFunc undo, void* target, void* object = nullptr,
+                int key = 0, int value = 0, bool exists = false)
+    {
+        ++m_mutationCount;
+
+        if (m_isRecording)
+        {
+            m_entries.push_back(Entry{ undo, target, object, key, value,
+                                       exists });
+        }
+    }
+
+    //! Records the write of game tag in \p tags.
+    //! \param tags The game tag store to write.
+    //! \param tag The game tag to write.
+    void RecordGameTag(GameTagStore& tags, GameTag tag);
+
+    //! Records the write of game tag in \p tags.
+    //! \param tags The map of game tags to write.
+    //! \param tag The game tag to write.
+    void RecordGameTag(std::map<GameTag, int>& tags, GameTag tag);
+
+    //! Records the write of entity that has given \p id in \p entities.
+    //! \param entities The list of entities to write.
+    //! \param id The entity ID to write.
+    void RecordEntity(EntityList& entities, int id);
+
+    //! Records the write of pointer \p slot.
+    //! \param slot The pointer to write.
+    template <typename T>
+    void RecordPointer(T*& slot)
+    {
+        Record(
+            [](const Entry& entry) {
+                *static_cast<T**>(entry.target) = static_cast<T*>(entry.object);
+            },
+            &slot, slot);
+    }
+
+    //! Records the write of integer \p value.
+    //! \param value The integer to write.
+    void RecordInt(int& value)
+    {
+        Record(
+            [](const Entry& entry) {
+                *static_cast<int*>(entry.target) = entry.value;
+            },
+            &value, nullptr, 0, value);
+    }
+
+    //! Records the write of flag \p value.
+    //! \param value The flag to write.
+    void RecordBool(bool& value)
+    {
+        Record(
+            [](const Entry& entry) {
+                *static_cast<bool*>(entry.target) = entry.exists;
+            },
+            &value, nullptr, 0, 0, value);
+    }
+
+    //! Records the write of \p value. The current value is copied, so it is
+    //! intended for rare mutations of containers and smart pointers.
+    //! \param value The value to write.
+    template <typename T>
+    void RecordValue(T& value)
+    {
+        ++m_mutationCount;
+
+        if (m_isRecording)
+        {
+            RecordUndo([&value, saved = value]() { value = saved; });
+        }
+    }
+
+    //! Records a closure that undoes a mutation if recording is enabled.
+    //! \param undo The closure to undo the mutation.
+    void RecordUndo(std::function<void()> undo);
+
+    //! Records the state of an object once per epoch, before its first
+    //! mutation since recording started or the journal was rolled back. It is
+    //! intended for objects that have many fields mutated in many places,
+    //! e.g. auras.
+    //! \param epoch The epoch when the state of the object was last recorded.
+    //! \param save The function that copies the state of the object and
+    //! returns the closure that restores it.
+    template <typename Save>
+    void RecordState(std::uint64_t& epoch, Save&& save)
+    {
+        if (!m_isRecording || epoch == m_epoch)
+        {
+            return;
+        }
+
+        epoch = m_epoch;
+        m_closures.emplace_back(save());
+        Record(UndoClosure, this, nullptr,
+               static_cast<int>(m_closures.size() - 1));
+    }
+
+    //! Undoes all entries that are recorded after \p size entries in reverse
+    //! order. The mutations made by undoing are not recorded.
+    //! \param size The number of entries to keep.
+    void Rollback(std::size_t size);
+
+ private:
+    //! Runs the closure of \p entry.
+    //! \param entry The entry that refers to the closure.
+    static void UndoClosure(const Entry& entry);
+
+    std::vector<Entry> m_entries;
+    std::vector<std::function<void()>> m_closures;
+
+    std::uint64_t m_mutationCount = 0;
+    std::uint64_t m_lastRollback = 0;
+    std::uint64_t m_epoch = 0;
+    bool m_isRecording = false;
+};
+
+//! Returns the journal of \p game. It is used in the headers where Game is
+//! an incomplete type.
+//! \param game The game.
+//! \return The journal of \p game.
+GameJournal& GetJournal(Game* game);
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_GAME_JOURNAL_HPP
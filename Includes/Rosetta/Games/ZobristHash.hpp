@@ -0,0 +1,122 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_ZOBRIST_HASH_HPP
+#define ROSETTASTONE_ZOBRIST_HASH_HPP
+
+#include <Rosetta/Enums/CardEnums.hpp>
+#include <Rosetta/Enums/GameEnums.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace RosettaStone
+{
+class Entity;
+class Game;
+class Player;
+
+//!
+//! \brief ZobristHash class.
+//!
+//! This class keeps Zobrist-style 64-bit hashes of the state of a game, so
+//! that the same state reached by different orders of actions can be found
+//! in O(1) without building a board view. Each game tag of an entity whose
+//! value differs from its card contributes a key made of the entity ID, the
+//! game tag and the value, and the keys are XORed in and out as game tags are
+//! written and entities move between zones.
+//!
+//! The entities in play and the game tags of players are kept in the public
+//! hash. The cards in hand and the secrets are kept in the hash of their
+//! owner, and only the numbers of them and the number of cards in deck are
+//! public, so the hash in the view of a player doesn't depend on the cards
+//! that are hidden from the player.
+//!
+class ZobristHash
+{
+ public:
+    //! The hash that keeps the keys of an entity.
+    enum class Bucket : std::uint8_t
+    {
+        NONE,
+        PUBLIC,
+        PLAYER1,
+        PLAYER2,
+    };
+
+    //!
+    //! \brief EntityState struct.
+    //!
+    //! This struct stores where the keys of an entity are kept, so that they
+    //! can be removed even if the owner of the entity is changed.
+    //!
+    struct EntityState
+    {
+        ZoneType zone = ZoneType::INVALID;
+        PlayerType owner = PlayerType::INVALID;
+        Bucket bucket = Bucket::NONE;
+    };
+
+    //! Returns the hash of the game state in the view of \p side.
+    //! \param side The player that sees the game state.
+    //! \param turn The current turn of the game.
+    //! \param currentPlayer The player controlling the current turn.
+    //! \return The hash of the game state in the view of \p side.
+    std::uint64_t Get(PlayerType side, std::size_t turn,
+                      PlayerType currentPlayer) const;
+
+    //! Adds the keys of \p entity by its zone and owner.
+    //! \param entity The entity to add.
+    void AddEntity(Entity& entity);
+
+    //! Removes the keys of \p entity that are added by AddEntity().
+    //! \param entity The entity to remove.
+    void RemoveEntity(Entity& entity);
+
+    //! Updates the key of game tag of \p entity before the game tag is
+    //! written. It must be called only if the entity is added.
+    //! \param entity The entity to write.
+    //! \param tag The game tag to write.
+    //! \param value The value to write.
+    void UpdateGameTag(const Entity& entity, GameTag tag, int value);
+
+    //! Updates the key of game tag of \p player.
+    //! \param player The player to write.
+    //! \param tag The game tag to write.
+    //! \param oldValue The value before writing.
+    //! \param value The value to write.
+    void UpdatePlayerTag(const Player& player, GameTag tag, int oldValue,
+                         int value);
+
+    //! Computes the hashes from scratch, e.g. after the game tags are
+    //! restored by rolling back the journal.
+    //! \param game The game to compute.
+    void Rebuild(Game& game);
+
+ private:
+    //! Returns the hash of \p bucket.
+    //! \param bucket The bucket of the hash.
+    //! \return The hash of \p bucket.
+    std::uint64_t& GetHash(Bucket bucket);
+
+    //! Adds \p delta to the number of entities of \p owner in \p zone.
+    //! \param owner The owner of the entities.
+    //! \param zone The zone of the entities.
+    //! \param delta The number to add.
+    void UpdateCount(PlayerType owner, ZoneType zone, int delta);
+
+    //! Adds or removes all keys of \p entity to the hash of \p bucket.
+    //! \param entity The entity to toggle.
+    //! \param bucket The bucket of the hash.
+    void ToggleEntity(const Entity& entity, Bucket bucket);
+
+    std::array<std::uint64_t, 3> m_hashes{};
+    std::array<std::array<int, 3>, 2> m_counts{};
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_ZOBRIST_HASH_HPP
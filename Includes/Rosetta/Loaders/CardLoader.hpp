@@ -11,6 +11,7 @@
 
 #include <json/json.hpp>
 
+#include <string>
 #include <vector>
 
 namespace RosettaStone
@@ -18,14 +19,38 @@ namespace RosettaStone
 //!
 //! \brief CardLoader class.
 //!
-//! This class loads card data from cards.json.
+//! This class loads card data from cards.bin, the binary card database that
+//! RosettaTool generates in the build directory, or from cards.json if the
+//! database doesn't exist or is outdated. The database stores fixed-layout
+//! records, interned strings and game tags that are already resolved from
+//! their names, and it is mapped into memory instead of parsed. Its header
+//! keeps the size and the hash of cards.json and the hash of the enum names,
+//! so the database is rejected when either of them is changed.
 //!
 class CardLoader
 {
  public:
-    //! Loads card data from cards.json.
+    //! Loads card data from cards.bin, or from cards.json if it fails.
     //! \param cards Data storage to store added cards with power.
     static void Load(std::vector<Card*>& cards);
+
+    //! Loads card data from cards.json.
+    //! \param cards Data storage to store added cards with power.
+    static void LoadFromJSON(std::vector<Card*>& cards);
+
+    //! Loads card data from the binary card database of \p path.
+    //! \param path The path of the binary card database.
+    //! \param cards Data storage to store added cards with power.
+    //! \return true if the cards are loaded, false if the database doesn't
+    //! exist or is invalid. In this case, \p cards is not changed.
+    static bool LoadFromBinary(const std::string& path,
+                               std::vector<Card*>& cards);
+
+    //! Saves card data to the binary card database of \p path.
+    //! \param cards A list of cards to save.
+    //! \param path The path of the binary card database.
+    static void SaveToBinary(const std::vector<Card*>& cards,
+                             const std::string& path);
 };
 }  // namespace RosettaStone
 
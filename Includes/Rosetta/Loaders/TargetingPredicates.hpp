@@ -9,6 +9,7 @@
 
 #include <Rosetta/Enums/CardEnums.hpp>
 
+#include <cstdint>
 #include <functional>
 
 namespace RosettaStone
@@ -17,8 +18,85 @@ class Card;
 class Player;
 class Character;
 
-using TargetingPredicate = std::function<bool(Character*)>;
-using AvailabilityPredicate = std::function<bool(Player*, Card*)>;
+//!
+//! \brief TargetingPredicate class.
+//!
+//! This class checks whether a character is a valid target. The predicates
+//! that TargetingPredicates makes are compiled into an operation and its
+//! value that operator() runs with a switch, and a predicate that is made
+//! from a custom function runs the function.
+//!
+class TargetingPredicate
+{
+ public:
+    //! \brief An enumerator for identifying the compiled operation.
+    enum class Op : std::uint8_t
+    {
+        CUSTOM,
+        ANY,
+        RACE,
+        DEATHRATTLE,
+        DAMAGED,
+        UNDAMAGED,
+        MAX_ATTACK,
+        MIN_ATTACK,
+        TAUNT,
+    };
+
+    //! Constructs predicate with given \p func.
+    //! \param func The function to check the target.
+    explicit TargetingPredicate(std::function<bool(Character*)> func);
+
+    //! Constructs compiled predicate with given \p op and \p value.
+    //! \param op The operation to run.
+    //! \param value The value of the operation, e.g. race or attack.
+    explicit TargetingPredicate(Op op, int value = 0);
+
+    //! Checks whether \p character is a valid target.
+    //! \param character The character to check.
+    //! \return true if \p character is a valid target, false otherwise.
+    bool operator()(Character* character) const;
+
+ private:
+    std::function<bool(Character*)> m_func;
+    Op m_op = Op::CUSTOM;
+    int m_value = 0;
+};
+
+//!
+//! \brief AvailabilityPredicate class.
+//!
+//! This class checks whether a card can choose its target at all. It is
+//! compiled like TargetingPredicate.
+//!
+class AvailabilityPredicate
+{
+ public:
+    //! \brief An enumerator for identifying the compiled operation.
+    enum class Op : std::uint8_t
+    {
+        CUSTOM,
+        COMBO_ACTIVE,
+    };
+
+    //! Constructs predicate with given \p func.
+    //! \param func The function to check the availability.
+    explicit AvailabilityPredicate(std::function<bool(Player*, Card*)> func);
+
+    //! Constructs compiled predicate with given \p op.
+    //! \param op The operation to run.
+    explicit AvailabilityPredicate(Op op);
+
+    //! Checks whether \p card of \p player can choose its target.
+    //! \param player The player of the card.
+    //! \param card The card to check.
+    //! \return true if the card can choose its target, false otherwise.
+    bool operator()(Player* player, Card* card) const;
+
+ private:
+    std::function<bool(Player*, Card*)> m_func;
+    Op m_op = Op::CUSTOM;
+};
 
 //!
 //! \brief TargetingPredicates class.
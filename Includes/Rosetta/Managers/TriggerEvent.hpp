@@ -9,7 +9,8 @@
 
 #include <Rosetta/Managers/TriggerEventHandler.hpp>
 
-#include <memory>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace RosettaStone
@@ -19,39 +20,107 @@ class Entity;
 //!
 //! \brief TriggerEvent class.
 //!
-//! This is an event class for trigger.
+//! This is an event class for trigger. The handlers are stored in a contiguous
+//! array in order of subscription and are addressed by generational handles,
+//! so adding and removing a handler takes constant time. A handle refers to a
+//! slot that stores the position of its handler in the array, and the slot
+//! gets a new generation when the handler is removed so that stale handles are
+//! ignored. Removed handlers are skipped and compacted later, and the handlers
+//! that are added while notifying are run from the next notification. The
+//! handlers that are removed while notifying are still run for the event
+//! being notified, and they are removed after the notification is finished.
 //!
 class TriggerEvent
 {
  public:
+    //!
+    //! \brief Handle struct.
+    //!
+    //! This struct refers to a handler that is added to the event.
+    //!
+    struct Handle
+    {
+        std::uint32_t index = 0;
+        std::uint32_t generation = 0;
+    };
+
     //! Adds a trigger event handler.
     //! \param handler A trigger event handler to add.
-    void AddHandler(const TriggerEventHandler& handler);
+    //! \return The handle of the added handler.
+    Handle AddHandler(const TriggerEventHandler& handler);
+
+    //! Removes a trigger event handler. It does nothing if \p handle refers to
+    //! the handler that is already removed. While notifying, the handler is
+    //! removed after the notification is finished.
+    //! \param handle The handle of trigger event handler to remove.
+    void RemoveHandler(Handle handle);
+
+    //! Returns a value indicating whether \p handle refers to a handler.
+    //! \param handle The handle of trigger event handler.
+    //! \return true if \p handle refers to a handler, false otherwise.
+    bool Contains(Handle handle) const;
 
-    //! Removes a trigger event handler.
-    //! \param handler A trigger event handler to remove.
-    void RemoveHandler(const TriggerEventHandler& handler);
+    //! Returns the number of handlers.
+    //! \return The number of handlers.
+    std::size_t GetCount() const;
 
     //! Operator overloading: operator().
     //! \param entity The argument of functor.
     void operator()(Entity* entity);
 
-    //! Operator overloading: operator+=.
-    //! \param handler A trigger event handler to add.
-    TriggerEvent& operator+=(const TriggerEventHandler& handler);
+ private:
+    //!
+    //! \brief Entry struct.
+    //!
+    //! This struct stores a handler and the index of its slot.
+    //!
+    struct Entry
+    {
+        TriggerEventHandler handler;
+        std::uint32_t slot = 0;
+        bool isRemoved = false;
+    };
 
-    //! Operator overloading: operator-=.
-    //! \param handler A trigger event handler to remove.
-    TriggerEvent& operator-=(const TriggerEventHandler& handler);
+    //!
+    //! \brief Slot struct.
+    //!
+    //! This struct stores the position of a handler and its generation.
+    //!
+    struct Slot
+    {
+        std::uint32_t index = 0;
+        std::uint32_t generation = 1;
+        bool isPending = false;
+    };
 
- private:
     //! Notifies a list of trigger handlers to run.
     //! \param entity The argument of functor.
     void NotifyHandlers(Entity* entity);
 
-    std::vector<std::unique_ptr<TriggerEventHandler>> m_handlers;
-    bool m_isNotifying = false;
+    //! Returns the entry that \p slot refers to.
+    //! \param slot The slot of entry.
+    //! \return The entry that \p slot refers to.
+    Entry& GetEntry(const Slot& slot);
+
+    //! Removes the handler that \p slotIdx refers to.
+    //! \param slotIdx The index of slot of the handler.
+    void Remove(std::uint32_t slotIdx);
+
+    //! Removes the handlers that are removed while notifying.
+    void RemoveDeferred();
+
+    //! Removes the removed handlers and appends the pending handlers.
+    void Compact();
+
+    std::vector<Entry> m_entries;
+    std::vector<Entry> m_pendingEntries;
+    std::vector<Slot> m_slots;
+    std::vector<std::uint32_t> m_freeSlots;
+    std::vector<std::uint32_t> m_deferredSlots;
+
+    std::size_t m_numRemoved = 0;
+    int m_notifyDepth = 0;
 };
 }  // namespace RosettaStone
 
-#endif  // ROSETTASTONE_TRIGGER_EVENT_HPP
\ No newline at end of file
+#endif  // ROSETTASTONE_TRIGGER_EVENT_HPP
@@ -39,13 +39,13 @@ class TriggerEventHandler
     //! Default move constructor.
     TriggerEventHandler(TriggerEventHandler&& handler) noexcept = default;
 
-    //! Copy assignment operator.
-    //! \param handler A trigger event handler to assign.
-    TriggerEventHandler& operator=(const TriggerEventHandler& handler);
+    //! Default copy assignment operator.
+    TriggerEventHandler& operator=(const TriggerEventHandler& handler) =
+        default;
 
-    //! Move assignment operator.
-    //! \param handler A trigger event handler to assign.
-    TriggerEventHandler& operator=(TriggerEventHandler&& handler) noexcept;
+    //! Default move assignment operator.
+    TriggerEventHandler& operator=(TriggerEventHandler&& handler) noexcept =
+        default;
 
     //! Operator overloading: operator().
     //! \param entity The argument of functor.
@@ -60,7 +60,6 @@ class TriggerEventHandler
 
     int id;
     static int counter;
-    bool toBeRemoved = false;
 
  private:
     Func m_func;
@@ -8,6 +8,7 @@
 
 #include <Rosetta/Managers/TriggerEvent.hpp>
 #include <Rosetta/Models/Playable.hpp>
+#include <Rosetta/Models/TargetMask.hpp>
 
 namespace RosettaStone
 {
@@ -27,7 +28,7 @@ class Character : public Playable
     //! \param card The card.
     //! \param tags The game tags.
     //! \param id The ID.
-    Character(Player* player, Card* card, std::map<GameTag, int> tags, int id);
+    Character(Player* player, Card* card, GameTagStore tags, int id);
 
     //! Default destructor.
     ~Character() = default;
@@ -160,6 +161,17 @@ class Character : public Playable
     //! \return A list of pointer to valid target.
     std::vector<Character*> GetValidAttackTargets(Player* opponent) const;
 
+    //! Returns the mask of valid target in attack.
+    //! \param opponent The opponent player.
+    //! \return The mask of valid target in the view of the owner.
+    TargetMask GetValidAttackTargetMask(Player* opponent) const;
+
+    //! Returns the mask of valid target in attack with the masks of the
+    //! characters of the opponent that are already built.
+    //! \param enemy The masks of the characters of the opponent.
+    //! \return The mask of valid target in the view of the owner.
+    TargetMask GetValidAttackTargetMask(const CharacterMasks& enemy) const;
+
     //! Takes damage from a certain other entity.
     //! \param source An entity to give damage.
     //! \param damage The value of damage.
@@ -0,0 +1,61 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_CHARACTER_MASKS_HPP
+#define ROSETTASTONE_CHARACTER_MASKS_HPP
+
+#include <Rosetta/Commons/Constants.hpp>
+
+#include <cstdint>
+
+namespace RosettaStone
+{
+class Player;
+
+//! The mask of characters of a player. Bit i (0 <= i < MAX_FIELD_SIZE) is
+//! the minion at zone position i of the field, and bit HERO_BIT is the hero.
+using SideMask = std::uint8_t;
+
+//! The bit of the hero in SideMask.
+constexpr int HERO_BIT = MAX_FIELD_SIZE;
+
+//! The bits of all minions in SideMask.
+constexpr SideMask MINION_BITS = (1 << MAX_FIELD_SIZE) - 1;
+
+//! The bits of all characters in SideMask.
+constexpr SideMask ALL_CHARACTER_BITS = MINION_BITS | (1 << HERO_BIT);
+
+static_assert(MAX_FIELD_SIZE + 1 <= 8,
+              "The characters of a player must fit in SideMask.");
+
+//!
+//! \brief CharacterMasks struct.
+//!
+//! This struct stores the states of the characters of a player that decide
+//! targeting and attacking as bitmasks, so that the valid targets and the
+//! attackers are computed with bitwise operations. The masks are built from
+//! the game tags in a single pass, and they are a snapshot: they must be
+//! built again after the game state changes.
+//!
+struct CharacterMasks
+{
+    //! Builds the masks of the characters of \p player.
+    //! \param player The player that owns the characters.
+    //! \return The masks of the characters of \p player.
+    static CharacterMasks Build(const Player* player);
+
+    SideMask occupied = 0;
+    SideMask untouchable = 0;
+    SideMask taunt = 0;
+    SideMask stealth = 0;
+    SideMask immune = 0;
+    SideMask cantBeTargetedBySpells = 0;
+    SideMask cantBeTargetedByHeroPowers = 0;
+    SideMask canAttack = 0;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_CHARACTER_MASKS_HPP
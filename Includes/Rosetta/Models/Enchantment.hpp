@@ -28,7 +28,7 @@ class Enchantment : public Playable
     //! \param tags The game tags.
     //! \param target A target of enchantment.
     //! \param id The ID.
-    Enchantment(Player* player, Card* card, std::map<GameTag, int> tags,
+    Enchantment(Player* player, Card* card, GameTagStore tags,
                 Entity* target, int id);
 
     //! Default destructor.
@@ -84,6 +84,11 @@ class Enchantment : public Playable
     //! Removes enchantment.
     void Remove();
 
+    //! Copies the states of \p rhs that is an entity of other game.
+    //! The pointers to other entities are not copied.
+    //! \param rhs The entity to copy the states.
+    void CopyStatesFrom(const Entity& rhs) override;
+
  private:
     Entity* m_target = nullptr;
     Card* m_capturedCard = nullptr;
@@ -8,11 +8,13 @@
 #define ROSETTASTONE_ENTITY_HPP
 
 #include <Rosetta/Cards/Card.hpp>
+#include <Rosetta/Commons/GameTagStore.hpp>
 #include <Rosetta/Enchants/AuraEffects.hpp>
+#include <Rosetta/Games/ZobristHash.hpp>
 #include <Rosetta/Managers/CostManager.hpp>
 #include <Rosetta/Zones/IZone.hpp>
 
-#include <map>
+#include <cstdint>
 #include <optional>
 
 namespace RosettaStone
@@ -31,6 +33,8 @@ class Enchantment;
 //!
 class Entity
 {
+    friend class ZobristHash;
+
  public:
     //! Default constructor.
     Entity() = default;
@@ -40,8 +44,7 @@ class Entity
     //! \param _card The card.
     //! \param _tags The game tags.
     //! \param _id The ID.
-    Entity(Game* _game, Card* _card, std::map<GameTag, int> _tags,
-           int _id = -1);
+    Entity(Game* _game, Card* _card, GameTagStore _tags, int _id = -1);
 
     //! Destructor.
     virtual ~Entity();
@@ -60,7 +63,7 @@ class Entity
 
     //! Returns a list of game tag.
     //! \return A list of game tag.
-    std::map<GameTag, int> GetGameTags() const;
+    GameTagStore GetGameTags() const;
 
     //! Returns the value of game tag.
     //! \param tag The game tag of card.
@@ -84,16 +87,41 @@ class Entity
     //! Any enchants and trigger is removed.
     virtual void Reset();
 
+    //! Copies the states of \p rhs that is an entity of other game.
+    //! The pointers to other entities are not copied.
+    //! \param rhs The entity to copy the states.
+    virtual void CopyStatesFrom(const Entity& rhs);
+
+    //! Returns the mutation count of the game when this entity was last
+    //! changed. An aura compares it with the mutation count when the aura was
+    //! last updated, to skip the entities that are not changed since then.
+    //! \return The mutation count of the game when this entity was changed.
+    std::uint64_t GetLastMutation() const
+    {
+        return m_lastMutation;
+    }
+
+    //! Marks this entity as changed by a mutation that is not a game tag
+    //! write, e.g. the change of aura effects.
+    void NotifyMutation();
+
+    //! Returns aura effects of this entity to write. If this entity has no
+    //! aura effects, they are created in the arena of the game. Their state
+    //! is recorded by the journal before the first write since the last
+    //! checkpoint.
+    //! \return The aura effects of this entity.
+    AuraEffects* GetOrCreateAuraEffects();
+
     //! Builds a new entity that can be added to a game.
     //! \param player An owner of the entity.
     //! \param card The card from which the entity must be derived.
     //! \param cardTags The tags preset of card for the entity.
     //! \param zone The zone in which the entity must spawn.
     //! \param id An entity ID to assign to the newly created entity.
-    //! \return A pointer to entity that is allocated dynamically.
+    //! \return A pointer to entity that is allocated in the arena of game.
     static Playable* GetFromCard(
         Player* player, Card* card,
-        std::optional<std::map<GameTag, int>> cardTags = std::nullopt,
+        std::optional<GameTagStore> cardTags = std::nullopt,
         IZone* zone = nullptr, int id = -1);
 
     Game* game = nullptr;
@@ -104,8 +132,13 @@ class Entity
     AuraEffects* auraEffects = nullptr;
     std::vector<std::shared_ptr<Enchantment>> appliedEnchantments;
 
+    //! The state of the keys of the entity in the hash of game.
+    ZobristHash::EntityState hashState;
+
  protected:
-    std::map<GameTag, int> m_gameTags;
+    GameTagStore m_gameTags;
+    std::uint64_t m_lastMutation = 0;
+    std::uint64_t m_auraEffectsEpoch = 0;
 };
 }  // namespace RosettaStone
 
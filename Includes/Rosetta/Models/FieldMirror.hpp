@@ -0,0 +1,104 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_FIELD_MIRROR_HPP
+#define ROSETTASTONE_FIELD_MIRROR_HPP
+
+#include <Rosetta/Enums/CardEnums.hpp>
+#include <Rosetta/Models/CharacterMasks.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace RosettaStone
+{
+class Player;
+
+//!
+//! \brief FieldMirror struct.
+//!
+//! This struct mirrors the combat stats of the characters of a player as a
+//! structure of arrays. Lane i of each array is the character at bit i of
+//! SideMask, so the minions are in lanes 0 to MAX_FIELD_SIZE - 1 and the hero
+//! is in lane HERO_BIT. The lanes that are not occupied are always zero, so
+//! the queries are fixed-length loops without branches over contiguous
+//! memory, which the compiler can vectorize. A mirror is a value: it can be
+//! copied and modified to look ahead, e.g. by DamageAllMinions().
+//!
+struct FieldMirror
+{
+    //! The number of lanes of each array.
+    static constexpr int NUM_LANES = HERO_BIT + 1;
+
+    //! The values of the characters of a player, one per lane.
+    using Lanes = std::array<std::int32_t, NUM_LANES>;
+
+    //! The keywords of a character.
+    enum Keyword : std::uint32_t
+    {
+        TAUNT = 1 << 0,
+        DIVINE_SHIELD = 1 << 1,
+        STEALTH = 1 << 2,
+        IMMUNE = 1 << 3,
+        FROZEN = 1 << 4,
+        WINDFURY = 1 << 5,
+        MEGA_WINDFURY = 1 << 6,
+        POISONOUS = 1 << 7,
+        LIFESTEAL = 1 << 8,
+        CHARGE = 1 << 9,
+        RUSH = 1 << 10,
+        REBORN = 1 << 11,
+        CAN_ATTACK = 1 << 12,
+        CANT_ATTACK_HEROES = 1 << 13,
+    };
+
+    //! Builds the mirror of the characters of \p player.
+    //! \param player The player that owns the characters.
+    //! \return The mirror of the characters of \p player.
+    static FieldMirror Build(const Player* player);
+
+    //! Returns the sum of attack of the characters in \p mask.
+    //! \param mask The mask of characters to sum.
+    //! \return The sum of attack of the characters in \p mask.
+    int GetTotalAttack(SideMask mask = ALL_CHARACTER_BITS) const;
+
+    //! Returns the damage that the characters can deal to the enemy hero this
+    //! turn, counting the attacks left of windfury.
+    //! \return The damage that the characters can deal to the enemy hero.
+    int GetFaceDamage() const;
+
+    //! Checks whether the characters can kill the hero of \p enemy by
+    //! attacking this turn. It is conservative: it is false if the enemy has a
+    //! minion that has taunt, or the enemy hero can't be attacked.
+    //! \param enemy The mirror of the enemy characters.
+    //! \return true if the characters have lethal, false otherwise.
+    bool HasLethal(const FieldMirror& enemy) const;
+
+    //! Deals \p amount of damage to all minions in the mirror. The minions that
+    //! have divine shield lose it instead, and the immune minions are not
+    //! damaged. It doesn't change the game.
+    //! \param amount The amount of damage.
+    //! \return The mask of the minions whose health is 0 or less.
+    SideMask DamageAllMinions(int amount);
+
+    //! Returns the number of minions of \p race.
+    //! \param race The race of minions to count.
+    //! \return The number of minions of \p race.
+    int CountRace(Race race) const;
+
+    SideMask occupied = 0;
+    Lanes attack{};
+    Lanes health{};
+    Lanes damage{};
+    Lanes armor{};
+    Lanes spellPower{};
+    Lanes attacksLeft{};
+    Lanes race{};
+    std::array<std::uint32_t, NUM_LANES> keywords{};
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_FIELD_MIRROR_HPP
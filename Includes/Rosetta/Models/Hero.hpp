@@ -27,10 +27,10 @@ class Hero : public Character
     //! \param card The card.
     //! \param tags The game tags.
     //! \param id The ID.
-    Hero(Player* player, Card* card, std::map<GameTag, int> tags, int id = -1);
+    Hero(Player* player, Card* card, GameTagStore tags, int id = -1);
 
     //! Default destructor.
-    ~Hero();
+    ~Hero() = default;
 
     //! Deleted copy constructor.
     Hero(const Hero&) = delete;
@@ -75,6 +75,11 @@ class Hero : public Character
     //! \return The flag that indicates whether it has lifesteal.
     bool HasLifesteal() const override;
 
+    //! Copies the states of \p rhs that is an entity of other game.
+    //! The pointers to other entities are not copied.
+    //! \param rhs The entity to copy the states.
+    void CopyStatesFrom(const Entity& rhs) override;
+
     HeroPower* heroPower = nullptr;
     Weapon* weapon = nullptr;
 
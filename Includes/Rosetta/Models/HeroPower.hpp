@@ -24,8 +24,7 @@ class HeroPower : public Playable
     //! \param card The card.
     //! \param tags The game tags.
     //! \param id The ID.
-    HeroPower(Player* player, Card* card, std::map<GameTag, int> tags,
-              int id = -1);
+    HeroPower(Player* player, Card* card, GameTagStore tags, int id = -1);
 
     //! Default destructor.
     ~HeroPower() = default;
@@ -48,6 +47,12 @@ class HeroPower : public Playable
     //! \param target The proposed target.
     //! \return true if the proposed target is valid, false otherwise.
     bool TargetingRequirements(Card* card, Character* target) const override;
+
+    //! Returns the mask of characters that this entity can't target by the
+    //! state of the characters.
+    //! \param masks The masks of the characters.
+    //! \return The mask of characters that this entity can't target.
+    SideMask GetUntargetableMask(const CharacterMasks& masks) const override;
 };
 }  // namespace RosettaStone
 
@@ -24,8 +24,7 @@ class Minion : public Character
     //! \param card The card.
     //! \param tags The game tags.
     //! \param id The ID.
-    Minion(Player* player, Card* card, std::map<GameTag, int> tags,
-           int id = -1);
+    Minion(Player* player, Card* card, GameTagStore tags, int id = -1);
 
     //! Default destructor.
     ~Minion() = default;
@@ -8,6 +8,7 @@
 #define ROSETTASTONE_PLAYABLE_HPP
 
 #include <Rosetta/Models/Entity.hpp>
+#include <Rosetta/Models/TargetMask.hpp>
 
 #include <array>
 
@@ -29,8 +30,7 @@ class Playable : public Entity
     //! \param _card The card.
     //! \param _tags The game tags.
     //! \param _id The ID.
-    Playable(Player* _player, Card* _card, std::map<GameTag, int> _tags,
-             int _id);
+    Playable(Player* _player, Card* _card, GameTagStore _tags, int _id);
 
     //! Destructor.
     virtual ~Playable();
@@ -102,6 +102,11 @@ class Playable : public Entity
     //! Resets the value of the cost.
     void ResetCost();
 
+    //! Copies the states of \p rhs that is an entity of other game.
+    //! The pointers to other entities are not copied.
+    //! \param rhs The entity to copy the states.
+    void CopyStatesFrom(const Entity& rhs) override;
+
     //! Destroys entity.
     virtual void Destroy();
 
@@ -119,6 +124,13 @@ class Playable : public Entity
     //! \return true if the proposed target is valid, false otherwise.
     virtual bool TargetingRequirements(Card* card, Character* target) const;
 
+    //! Returns the mask of characters that this entity can't target by the
+    //! state of the characters, the same as the hardcoded requirements of
+    //! TargetingRequirements() as bitwise operations.
+    //! \param masks The masks of the characters.
+    //! \return The mask of characters that this entity can't target.
+    virtual SideMask GetUntargetableMask(const CharacterMasks& masks) const;
+
     //! Gets a value indicating whether source entity is playable by player.
     //! Dynamic requirements are checked, eg: If a spell costs health instead of
     //! mana, this method will return false if the health cost would be higher
@@ -136,6 +148,19 @@ class Playable : public Entity
     //! \return A list of valid play targets.
     std::vector<Character*> GetValidPlayTargets() const;
 
+    //! Gets the mask of valid play targets.
+    //! This method defaults to targeting in the context of spells/hero powers.
+    //! \return The mask of valid play targets in the view of the owner.
+    TargetMask GetValidPlayTargetMask() const;
+
+    //! Gets the mask of valid play targets with the masks of characters that
+    //! are already built, e.g. to check all cards in hand at once.
+    //! \param friendly The masks of the characters of the owner.
+    //! \param enemy The masks of the characters of the opponent.
+    //! \return The mask of valid play targets in the view of the owner.
+    TargetMask GetValidPlayTargetMask(const CharacterMasks& friendly,
+                                      const CharacterMasks& enemy) const;
+
     //! Gets a random valid target in valid play targets.
     //! \return A randomly selected valid target.
     Character* GetRandomValidTarget();
@@ -167,12 +192,21 @@ class Playable : public Entity
     void ActivateTask(PowerType type, Character* target = nullptr,
                       int chooseOne = 0, Playable* chooseBase = nullptr);
 
+    //! Returns the cost manager of this playable to write. If this playable
+    //! has no cost manager, it is created. Its state is recorded by the
+    //! journal before the first write since the last checkpoint.
+    //! \return The cost manager of this playable.
+    CostManager* GetOrCreateCostManager();
+
     CostManager* costManager = nullptr;
     IAura* ongoingEffect = nullptr;
     std::shared_ptr<Trigger> activatedTrigger;
 
     int orderOfPlay = 0;
     bool isDestroyed = false;
+
+ private:
+    std::uint64_t m_costManagerEpoch = 0;
 };
 }  // namespace RosettaStone
 
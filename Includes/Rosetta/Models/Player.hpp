@@ -11,8 +11,10 @@
 #include <Rosetta/Enums/GameEnums.hpp>
 #include <Rosetta/Models/Choice.hpp>
 #include <Rosetta/Models/Entity.hpp>
+#include <Rosetta/Models/FieldMirror.hpp>
 #include <Rosetta/Models/Hero.hpp>
 
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -35,6 +37,8 @@ class SetasideZone;
 //!
 class Player : public Entity
 {
+    friend class ZobristHash;
+
  public:
     static constexpr std::size_t USER_INVALID = 255;
 
@@ -60,6 +64,11 @@ class Player : public Entity
     //! \param rhs The source to copy the content.
     void RefCopy(const Player& rhs);
 
+    //! Copies the states of \p rhs that is a player of other game.
+    //! The hero, the zones and the choice are not copied.
+    //! \param rhs The player to copy the states.
+    void CopyStatesFrom(const Entity& rhs) override;
+
     //! Returns player's field zone.
     //! \return Player's field zone.
     FieldZone* GetFieldZone() const;
@@ -92,6 +101,11 @@ class Player : public Entity
     //! \param hero The hero of the player.
     void SetHero(Hero* hero);
 
+    //! Returns the mirror of the characters of the player. It is built again
+    //! only if the game state is changed since it was last built.
+    //! \return The mirror of the characters of the player.
+    const FieldMirror& GetFieldMirror() const;
+
     //! Returns player's hero power.
     //! \return Player's hero power.
     HeroPower& GetHeroPower() const;
@@ -303,6 +317,10 @@ class Player : public Entity
     std::unique_ptr<SetasideZone> m_setasideZone;
 
     std::map<GameTag, int> m_gameTags;
+
+    mutable FieldMirror m_fieldMirror;
+    mutable std::uint64_t m_fieldMirrorMutationCount =
+        std::numeric_limits<std::uint64_t>::max();
 };
 }  // namespace RosettaStone
 
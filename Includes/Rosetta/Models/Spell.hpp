@@ -24,7 +24,7 @@ class Spell : public Playable
     //! \param card The card.
     //! \param tags The game tags.
     //! \param id The card ID.
-    Spell(Player* player, Card* card, std::map<GameTag, int> tags, int id = -1);
+    Spell(Player* player, Card* card, GameTagStore tags, int id = -1);
 
     //! Default destructor.
     ~Spell() = default;
@@ -79,6 +79,12 @@ class Spell : public Playable
     //! \return true if the proposed target is valid, false otherwise.
     bool TargetingRequirements(Card* card, Character* target) const override;
 
+    //! Returns the mask of characters that this entity can't target by the
+    //! state of the characters.
+    //! \param masks The masks of the characters.
+    //! \return The mask of characters that this entity can't target.
+    SideMask GetUntargetableMask(const CharacterMasks& masks) const override;
+
     //! Gets a value indicating whether source entity is playable by player.
     //! Dynamic requirements are checked, eg: If a spell costs health instead of
     //! mana, this method will return false if the health cost would be higher
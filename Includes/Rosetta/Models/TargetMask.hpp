@@ -0,0 +1,77 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_TARGET_MASK_HPP
+#define ROSETTASTONE_TARGET_MASK_HPP
+
+#include <Rosetta/Models/CharacterMasks.hpp>
+
+#include <vector>
+
+namespace RosettaStone
+{
+class Character;
+class Player;
+
+//!
+//! \brief TargetMask class.
+//!
+//! This class is a compact set of characters in the view of a player. It
+//! stores a SideMask of the friendly characters and a SideMask of the enemy
+//! characters, so it can be kept and compared without making a list.
+//!
+class TargetMask
+{
+ public:
+    //! Default constructor.
+    TargetMask() = default;
+
+    //! Constructs target mask with given \p friendly and \p enemy.
+    //! \param friendly The mask of the friendly characters.
+    //! \param enemy The mask of the enemy characters.
+    TargetMask(SideMask friendly, SideMask enemy);
+
+    //! Returns the mask of the friendly characters.
+    //! \return The mask of the friendly characters.
+    SideMask GetFriendly() const;
+
+    //! Returns the mask of the enemy characters.
+    //! \return The mask of the enemy characters.
+    SideMask GetEnemy() const;
+
+    //! Returns a value indicating whether the mask has no characters.
+    //! \return true if the mask has no characters, false otherwise.
+    bool IsEmpty() const;
+
+    //! Returns the number of characters in the mask.
+    //! \return The number of characters in the mask.
+    int GetCount() const;
+
+    //! Returns a value indicating whether the mask has \p character.
+    //! \param player The player that sees the mask.
+    //! \param character The character to check.
+    //! \return true if the mask has \p character, false otherwise.
+    bool Has(Player* player, Character* character) const;
+
+    //! Returns a list of characters in the mask. The friendly minions come
+    //! first, then the enemy minions, the friendly hero and the enemy hero.
+    //! \param player The player that sees the mask.
+    //! \return A list of characters in the mask.
+    std::vector<Character*> GetCharacters(Player* player) const;
+
+    //! Operator overloading for operator==.
+    bool operator==(const TargetMask& rhs) const;
+
+    //! Operator overloading for operator!=.
+    bool operator!=(const TargetMask& rhs) const;
+
+ private:
+    SideMask m_friendly = 0;
+    SideMask m_enemy = 0;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_TARGET_MASK_HPP
@@ -26,11 +26,10 @@ class Weapon : public Playable
     //! \param card The card.
     //! \param tags The game tags.
     //! \param id The ID.
-    Weapon(Player* player, Card* card, std::map<GameTag, int> tags,
-           int id = -1);
+    Weapon(Player* player, Card* card, GameTagStore tags, int id = -1);
 
-    //! Destructor.
-    ~Weapon();
+    //! Default destructor.
+    ~Weapon() = default;
 
     //! Deleted copy constructor.
     Weapon(const Weapon&) = delete;
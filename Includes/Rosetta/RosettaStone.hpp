@@ -24,6 +24,7 @@
 #include <Rosetta/Actions/Copy.hpp>
 #include <Rosetta/Actions/Draw.hpp>
 #include <Rosetta/Actions/Generic.hpp>
+#include <Rosetta/Actions/MoveGenerator.hpp>
 #include <Rosetta/Actions/PlayCard.hpp>
 #include <Rosetta/Actions/Summon.hpp>
 #include <Rosetta/Auras/AdaptiveCostEffect.hpp>
@@ -48,14 +49,23 @@
 #include <Rosetta/CardSets/UldumCardsGen.hpp>
 #include <Rosetta/CardSets/YoDCardsGen.hpp>
 #include <Rosetta/Cards/Card.hpp>
+#include <Rosetta/Cards/CardBitset.hpp>
 #include <Rosetta/Cards/CardDef.hpp>
 #include <Rosetta/Cards/CardDefs.hpp>
+#include <Rosetta/Cards/CardHandle.hpp>
+#include <Rosetta/Cards/CardHotData.hpp>
+#include <Rosetta/Cards/CardQuery.hpp>
 #include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Commons/Arena.hpp>
 #include <Rosetta/Commons/Constants.hpp>
 #include <Rosetta/Commons/DeckCode.hpp>
+#include <Rosetta/Commons/FixedPriorityQueue.hpp>
+#include <Rosetta/Commons/GameTagStore.hpp>
 #include <Rosetta/Commons/JSONSerializer.hpp>
 #include <Rosetta/Commons/Macros.hpp>
+#include <Rosetta/Commons/MappedFile.hpp>
 #include <Rosetta/Commons/PriorityQueue.hpp>
+#include <Rosetta/Commons/RandomEngine.hpp>
 #include <Rosetta/Commons/SpinLocks.hpp>
 #include <Rosetta/Commons/Utils.hpp>
 #include <Rosetta/Conditions/RelaCondition.hpp>
@@ -87,9 +97,13 @@
 #include <Rosetta/Enums/TargetingEnums.hpp>
 #include <Rosetta/Enums/TaskEnums.hpp>
 #include <Rosetta/Enums/TriggerEnums.hpp>
+#include <Rosetta/Games/EntityList.hpp>
 #include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Games/GameBatch.hpp>
 #include <Rosetta/Games/GameConfig.hpp>
+#include <Rosetta/Games/GameJournal.hpp>
 #include <Rosetta/Games/GameRestorer.hpp>
+#include <Rosetta/Games/ZobristHash.hpp>
 #include <Rosetta/Loaders/AccountLoader.hpp>
 #include <Rosetta/Loaders/CardLoader.hpp>
 #include <Rosetta/Loaders/InternalCardLoader.hpp>
@@ -100,15 +114,18 @@
 #include <Rosetta/Managers/TriggerEventHandler.hpp>
 #include <Rosetta/Managers/TriggerManager.hpp>
 #include <Rosetta/Models/Character.hpp>
+#include <Rosetta/Models/CharacterMasks.hpp>
 #include <Rosetta/Models/Choice.hpp>
 #include <Rosetta/Models/Enchantment.hpp>
 #include <Rosetta/Models/Entity.hpp>
+#include <Rosetta/Models/FieldMirror.hpp>
 #include <Rosetta/Models/Hero.hpp>
 #include <Rosetta/Models/HeroPower.hpp>
 #include <Rosetta/Models/Minion.hpp>
 #include <Rosetta/Models/Playable.hpp>
 #include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Models/Spell.hpp>
+#include <Rosetta/Models/TargetMask.hpp>
 #include <Rosetta/Models/Weapon.hpp>
 #include <Rosetta/RosettaStone.hpp>
 #include <Rosetta/Tasks/EventMetaData.hpp>
@@ -215,6 +232,7 @@
 #include <Rosetta/Views/Board.hpp>
 #include <Rosetta/Views/BoardRefView.hpp>
 #include <Rosetta/Views/BoardView.hpp>
+#include <Rosetta/Views/PackedBoardView.hpp>
 #include <Rosetta/Views/ReducedBoardView.hpp>
 #include <Rosetta/Views/Types/CardInfo.hpp>
 #include <Rosetta/Views/Types/Player.hpp>
@@ -228,5 +246,6 @@
 #include <Rosetta/Zones/SecretZone.hpp>
 #include <Rosetta/Zones/SetasideZone.hpp>
 #include <Rosetta/Zones/Zone.hpp>
+#include <Rosetta/Zones/ZoneView.hpp>
 
 #endif  // ROSSETASTONE_ROSETTA_HPP
@@ -12,11 +12,27 @@
 
 namespace RosettaStone
 {
+//!
+//! \brief TaskFrame struct.
+//!
+//! This struct holds the runtime state of a task execution. Tasks are
+//! immutable programs that are shared by all games, so the player, the source
+//! and the target are passed to each execution through this frame.
+//!
+struct TaskFrame
+{
+    Player* player = nullptr;
+    Entity* source = nullptr;
+    Playable* target = nullptr;
+};
+
 //!
 //! \brief ITask class.
 //!
 //! This class is interface of various task classes.
-//! All classes that inherit from it must implement GetTaskID and Impl methods.
+//! All classes that inherit from it must implement Impl method.
+//! A task doesn't change its state while it runs, so the tasks of card power
+//! can be run or enqueued without copying them.
 //!
 class ITask
 {
@@ -62,43 +78,53 @@ class ITask
     //! \return Entity type.
     EntityType GetEntityType() const;
 
+    //! Returns the player.
+    //! \return The player to run task.
+    Player* GetPlayer() const;
+
     //! Sets the player.
     //! \param player The player to run task.
     void SetPlayer(Player* player);
 
+    //! Returns the source.
+    //! \return The source.
+    Entity* GetSource() const;
+
     //! Sets the source.
     //! \param source The source.
     void SetSource(Entity* source);
 
+    //! Returns the target.
+    //! \return The target.
+    Playable* GetTarget() const;
+
     //! Sets the target.
     //! \param target The target.
     void SetTarget(Playable* target);
 
-    //! Calls Impl method and returns meta data.
+    //! Calls Impl method with the frame that is set by SetPlayer(),
+    //! SetSource() and SetTarget() and returns meta data.
     //! \return The result of task processing.
-    TaskStatus Run();
+    TaskStatus Run() const;
 
-    //! Returns the cloned task.
-    //! \return The cloned task.
-    //! \note This will be used for solving multi-thread issue.
-    //! Not to access same elements at same time.
-    std::unique_ptr<ITask> Clone();
+    //! Calls Impl method with given \p frame and returns meta data.
+    //! \param frame The runtime state of task execution.
+    //! \return The result of task processing.
+    TaskStatus Run(const TaskFrame& frame) const;
 
  protected:
     EntityType m_entityType = EntityType::INVALID;
-    Player* m_player = nullptr;
-    Entity* m_source = nullptr;
-    Playable* m_target = nullptr;
 
  private:
     //! Processes task logic internally and returns meta data.
     //! \param player The player to run task.
+    //! \param source The source entity of task.
+    //! \param target The target entity of task.
     //! \return The result of task processing.
-    virtual TaskStatus Impl(Player* player) = 0;
+    virtual TaskStatus Impl(Player* player, Entity* source,
+                            Playable* target) const = 0;
 
-    //! Internal method of Clone().
-    //! \return The cloned task.
-    virtual std::unique_ptr<ITask> CloneImpl() = 0;
+    TaskFrame m_frame;
 };
 
 namespace Task
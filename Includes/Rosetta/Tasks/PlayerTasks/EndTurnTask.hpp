@@ -20,13 +20,11 @@ class EndTurnTask : public ITask
  private:
     //! Processes task logic internally and returns meta data.
     //! \param player The player to run task.
+    //! \param source The source entity of task.
+    //! \param target The target entity of task.
     //! \return The result of task processing.
-    TaskStatus Impl(Player* player) override;
-
-    //! Returns Clone Of Object (pure virtual).
-    //! \returns clone of object.
-    //! \this uses for thread safe. not to access same task in multiple threads
-    std::unique_ptr<ITask> CloneImpl() override;
+    TaskStatus Impl(Player* player, Entity* source,
+                    Playable* target) const override;
 };
 }  // namespace RosettaStone::PlayerTasks
 
@@ -20,12 +20,11 @@ class ActivateCapturedDeathrattleTask : public ITask
  private:
     //! Processes task logic internally and returns meta data.
     //! \param player The player to run task.
+    //! \param source The source entity of task.
+    //! \param target The target entity of task.
     //! \return The result of task processing.
-    TaskStatus Impl(Player* player) override;
-
-    //! Internal method of Clone().
-    //! \return The cloned task.
-    std::unique_ptr<ITask> CloneImpl() override;
+    TaskStatus Impl(Player* player, Entity* source,
+                    Playable* target) const override;
 };
 }  // namespace RosettaStone::SimpleTasks
 
@@ -19,7 +19,7 @@ class DiscoverCriteria
     explicit DiscoverCriteria(CardType _cardType, CardClass _cardClass,
                               Race _race, Rarity _rarity);
 
-    bool Evaluate(Card* card) const;
+    bool Evaluate(const Card* card) const;
 
     CardType cardType = CardType::INVALID;
     CardClass cardClass = CardClass::INVALID;
@@ -89,40 +89,54 @@ class DiscoverTask : public ITask
                           int repeat = 1, bool keepAll = false);
 
     //! Gets cards to choose from the sets.
+    //! \param game The game to use its random engine.
     //! \param cardsToDiscover A list of cards to discover.
     //! \param numberOfChoices The number of choices.
     //! \param doShuffle The flag that indicates it does shuffle.
-    static std::vector<Card*> GetChoices(std::vector<Card*> cardsToDiscover,
-                                         int numberOfChoices,
-                                         bool doShuffle = true);
+    static std::vector<Card*> GetChoices(
+        Game* game, const std::vector<Card*>& cardsToDiscover,
+        int numberOfChoices, bool doShuffle = true);
+
+    //! Returns the cached pool of cards to discover by the discover type.
+    //! The pool is built on the first request and shared by all games.
+    //! \param discoverType The type of discover that doesn't depend on the
+    //! game state.
+    //! \param baseClass The base class of the player.
+    //! \param format The format of the game.
+    //! \return The pool of cards to discover.
+    static const std::vector<Card*>& GetDiscoverPool(DiscoverType discoverType,
+                                                     CardClass baseClass,
+                                                     FormatType format);
+
+    //! Returns the cached pool of cards to discover by the discover criteria.
+    //! The pool is built on the first request and shared by all games.
+    //! \param criteria The discover criteria.
+    //! \param heroClass The class of the hero of the player.
+    //! \param format The format of the game.
+    //! \return The pool of cards to discover.
+    static const std::vector<Card*>& GetDiscoverPool(
+        const DiscoverCriteria& criteria, CardClass heroClass,
+        FormatType format);
 
  private:
     //! Processes task logic internally and returns meta data.
     //! \param player The player to run task.
+    //! \param source The source entity of task.
+    //! \param target The target entity of task.
     //! \return The result of task processing.
-    TaskStatus Impl(Player* player) override;
-
-    //! Internal method of Clone().
-    //! \return The cloned task.
-    std::unique_ptr<ITask> CloneImpl() override;
+    TaskStatus Impl(Player* player, Entity* source,
+                    Playable* target) const override;
 
     //! Evaluates a list of cards by the discover type.
-    //! \param game The game context.
     //! \param player The player context.
     //! \param discoverType The type of discover.
     //! \param choiceAction The choice action of discover effect.
+    //! \param cards The list to store the cards that depend on the game state.
     //! \return A list of cards to discover.
-    std::vector<Card*> Discover(Game* game, Player* player,
-                                DiscoverType discoverType,
-                                ChoiceAction& choiceAction) const;
-
-    //! Evaluates a list of cards by the discover criteria.
-    //! \param game The game context.
-    //! \param player The player context.
-    //! \param criteria The discover criteria.
-    //! \return A list of cards to discover.
-    std::vector<Card*> Discover(Game* game, Player* player,
-                                DiscoverCriteria criteria) const;
+    static const std::vector<Card*>& Discover(Player* player,
+                                              DiscoverType discoverType,
+                                              ChoiceAction& choiceAction,
+                                              std::vector<Card*>& cards);
 
     std::vector<Card*> m_cards;
     DiscoverType m_discoverType = DiscoverType::INVALID;
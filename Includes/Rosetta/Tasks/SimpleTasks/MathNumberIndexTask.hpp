@@ -39,18 +39,17 @@ class MathNumberIndexTask : public ITask
  private:
     //! Processes task logic internally and returns meta data.
     //! \param player The player to run task.
+    //! \param source The source entity of task.
+    //! \param target The target entity of task.
     //! \return The result of task processing.
-    TaskStatus Impl(Player* player) override;
-
-    //! Internal method of Clone().
-    //! \return The cloned task.
-    std::unique_ptr<ITask> CloneImpl() override;
+    TaskStatus Impl(Player* player, Entity* source,
+                    Playable* target) const override;
 
     //! Returns the number of index from task stack.
     //! \param index The index to get number.
     //! \param taskStack The task stack.
     //! \return The number of index.
-    int GetNumber(int index, const TaskStack& taskStack);
+    int GetNumber(int index, const TaskStack& taskStack) const;
 
     int m_indexA = 0;
     int m_indexB = 0;
@@ -27,17 +27,17 @@ class RandomSpellTask : public ITask
  private:
     //! Processes task logic internally and returns meta data.
     //! \param player The player to run task.
+    //! \param source The source entity of task.
+    //! \param target The target entity of task.
     //! \return The result of task processing.
-    TaskStatus Impl(Player* player) override;
+    TaskStatus Impl(Player* player, Entity* source,
+                    Playable* target) const override;
 
-    //! Internal method of Clone().
-    //! \return The cloned task.
-    std::unique_ptr<ITask> CloneImpl() override;
-
-    //! Evaluates condition using relation sign and game tags.
+    //! Evaluates condition using relation sign and game tags. The type of
+    //! card is filtered by the query of cards.
     //! \param card The card to evaluate condition.
     //! \return true if the condition is satisfied, false otherwise.
-    bool Evaluate(Card* card) const;
+    bool Evaluate(const Card* card) const;
 
     CardClass m_cardClass = CardClass::INVALID;
     GameTag m_gameTag = GameTag::INVALID;
@@ -8,29 +8,51 @@
 
 #include <Rosetta/Tasks/ITask.hpp>
 
-#include <queue>
-#include <stack>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
 
 namespace RosettaStone
 {
 //!
 //! \brief TaskQueue class.
 //!
-//! This class stores several tasks into stack to run in order.
+//! This class stores several tasks into stack to run in order. The tasks are
+//! shared with card powers and triggers, so each entry stores the frame to run
+//! its task instead of a copy of the task.
+//!
+//! The queues of nested events are stored in one contiguous buffer. An event
+//! only enqueues tasks to the queue on top, so each queue is a segment at the
+//! end of the buffer that is described by the offsets of its first entry and
+//! its next entry to process. A segment is rewound when all of its entries are
+//! processed and removed when its event ends, so the buffer is reused without
+//! allocations once it has grown to the deepest chain of events.
 //!
 class TaskQueue
 {
  public:
+    //!
+    //! \brief Entry struct.
+    //!
+    //! This struct stores a pending task and the frame to run it.
+    //!
+    struct Entry
+    {
+        std::shared_ptr<ITask> task;
+        TaskFrame frame;
+    };
+
     //! Default constructor.
     TaskQueue() = default;
 
-    //! Returns the current queue.
-    //! \return The current queue.
-    std::queue<std::unique_ptr<ITask>>& GetCurrentQueue();
+    //! Returns the number of pending tasks in the current queue.
+    //! \return The number of pending tasks in the current queue.
+    std::size_t GetCount() const;
 
     //! Returns flag that indicates task queue is empty.
     //! \return Flag that indicates task queue is empty.
-    bool IsEmpty();
+    bool IsEmpty() const;
 
     //! Starts the event.
     void StartEvent();
@@ -40,15 +62,33 @@ class TaskQueue
 
     //! Enqueues the task.
     //! \param task The task to enqueue.
-    void Enqueue(std::unique_ptr<ITask> task);
+    //! \param frame The frame to run the task.
+    void Enqueue(std::shared_ptr<ITask> task, const TaskFrame& frame);
 
     //! Processes the task.
     //! \return The result of task processing.
     TaskStatus Process();
 
+    //! Copies the pending tasks of \p rhs in order. The tasks are shared.
+    //! \param rhs The task queue to copy.
+    //! \param copyFrame The function that makes a copy of each frame.
+    void CopyFrom(const TaskQueue& rhs,
+                  const std::function<TaskFrame(const TaskFrame&)>& copyFrame);
+
  private:
-    std::stack<std::queue<std::unique_ptr<ITask>>> m_eventStack;
-    std::queue<std::unique_ptr<ITask>> m_baseQueue;
+    //!
+    //! \brief Segment struct.
+    //!
+    //! This struct stores the offsets of the queue of an event in the buffer.
+    //!
+    struct Segment
+    {
+        std::size_t begin = 0;
+        std::size_t head = 0;
+    };
+
+    std::vector<Entry> m_entries;
+    std::vector<Segment> m_segments{ Segment{} };
 
     bool m_eventFlag = false;
 };
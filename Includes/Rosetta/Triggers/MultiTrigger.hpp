@@ -41,7 +41,11 @@ class MultiTrigger : public Trigger
         bool cloning = false) override;
 
     //! Removes this object from game and unsubscribe from the related event.
-    void Remove() const override;
+    void Remove() override;
+
+    //! Returns the flag that indicates whether all triggers are removed.
+    //! \return The flag that indicates whether all triggers are removed.
+    bool IsRemoved() const override;
 
     std::vector<std::shared_ptr<Trigger>> m_triggers;
 };
@@ -8,7 +8,7 @@
 
 #include <Rosetta/Conditions/SelfCondition.hpp>
 #include <Rosetta/Enums/TriggerEnums.hpp>
-#include <Rosetta/Managers/TriggerEventHandler.hpp>
+#include <Rosetta/Managers/TriggerEvent.hpp>
 
 #include <memory>
 #include <vector>
@@ -52,7 +52,11 @@ class Trigger
         bool cloning = false);
 
     //! Removes this object from game and unsubscribe from the related event.
-    virtual void Remove() const;
+    virtual void Remove();
+
+    //! Returns the flag that indicates whether it is removed.
+    //! \return The flag that indicates whether it is removed.
+    virtual bool IsRemoved() const;
 
     //! Checks triggers related to the current Sequence at once before sequence
     //! starts.
@@ -92,12 +96,22 @@ class Trigger
     //! \param source The source of trigger.
     void Validate(Entity* source);
 
+    //! Subscribes the handler to the event related to the trigger type.
+    void Subscribe();
+
+    //! Unsubscribes the handler from the event related to the trigger type.
+    void Unsubscribe();
+
     Playable* m_owner = nullptr;
 
+    TriggerEvent* m_event = nullptr;
+    TriggerEvent::Handle m_handle;
+
     TriggerType m_triggerType = TriggerType::NONE;
     SequenceType m_sequenceType = SequenceType::NONE;
 
     bool m_isValidated = false;
+    bool m_isRemoved = false;
 };
 }  // namespace RosettaStone
 
@@ -12,6 +12,7 @@
 
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Views/BoardRefView.hpp>
+#include <Rosetta/Views/PackedBoardView.hpp>
 
 namespace RosettaStone
 {
@@ -45,6 +46,14 @@ class Board
     //! \return The reduced board view that is created for the player type.
     ReducedBoardView CreateView() const;
 
+    //! Creates the packed board view for the player type.
+    //! \return The packed board view that is created for the player type.
+    PackedBoardView CreatePackedView() const;
+
+    //! Returns the hash of game state that the player type can see.
+    //! \return The hash of game state that the player type can see.
+    std::uint64_t GetHash() const;
+
     //! Returns the board ref view for the current player.
     //! \return The board ref view for the current player.
     CurrentPlayerBoardRefView GetCurPlayerStateRefView() const;
@@ -11,6 +11,7 @@
 #define ROSETTASTONE_BOARD_REF_VIEW_HPP
 
 #include <Rosetta/Actions/ActionValidGetter.hpp>
+#include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Games/Game.hpp>
 
 namespace RosettaStone
@@ -137,9 +138,24 @@ class BoardRefView
                              ? m_game.GetPlayer1()->GetFieldZone()
                              : m_game.GetPlayer2()->GetFieldZone();
 
-        for (auto& minion : fieldZone->GetAll())
+        for (int i = 0; i < fieldZone->GetCount(); ++i)
         {
-            functor(minion);
+            functor((*fieldZone)[i]);
+        }
+    }
+
+    //! Runs \p functor on each card in the hand of the side of the view.
+    //! \param functor A function to run for each card.
+    template <typename Functor>
+    void ForEachHandCard(Functor&& functor) const
+    {
+        auto handZone = (m_playerType == PlayerType::PLAYER1)
+                            ? m_game.GetPlayer1()->GetHandZone()
+                            : m_game.GetPlayer2()->GetHandZone();
+
+        for (int i = 0; i < handZone->GetCount(); ++i)
+        {
+            functor((*handZone)[i]);
         }
     }
 
@@ -154,7 +170,7 @@ class BoardRefView
 
         for (auto& entity : handZone->GetAll())
         {
-            functor(entity->card->id);
+            functor(entity->card->handle);
         }
     }
 
@@ -167,19 +183,22 @@ class BoardRefView
                             ? m_game.GetPlayer2()->GetHandZone()
                             : m_game.GetPlayer1()->GetHandZone();
 
+        // NOTE: The Coin is the only card that is revealed to opponent.
+        const CardHandle coin = Cards::GetHandle("GAME_005");
+
         for (auto& entity : handZone->GetAll())
         {
-            std::string cardID = entity->card->id;
-            if (cardID == "GAME_005")
+            CardHandle card = entity->card->handle;
+            if (card == coin)
             {
                 // Do nothing
             }
             else
             {
-                cardID = INVALID_CARD_ID;
+                card = CardHandle();
             }
 
-            functor(cardID);
+            functor(card);
         }
     }
 
@@ -0,0 +1,182 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_PACKED_BOARD_VIEW_HPP
+#define ROSETTASTONE_PACKED_BOARD_VIEW_HPP
+
+#include <Rosetta/Commons/Constants.hpp>
+#include <Rosetta/Enums/GameEnums.hpp>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace RosettaStone
+{
+class BoardRefView;
+
+//!
+//! \brief PackedBoardView class.
+//!
+//! This class stores the same information as ReducedBoardView in a packed,
+//! fixed-size and trivially copyable form. Minions and hand cards are kept in
+//! inline arrays bounded by MAX_FIELD_SIZE and MAX_HAND_SIZE, and cards are
+//! identified by their handles, so constructing, copying and storing a view
+//! doesn't allocate. Unused slots and paddings are always zero, so two views
+//! are equal if and only if their bytes are equal.
+//!
+class PackedBoardView
+{
+ public:
+    //! The flags of hero and minion.
+    enum Flag : std::uint8_t
+    {
+        STEALTH = 1 << 0,
+        IMMUNE = 1 << 1,
+        ATTACKABLE = 1 << 2,
+        SILENCED = 1 << 3,
+        TAUNT = 1 << 4,
+        CANT_ATTACK_HEROES = 1 << 5,
+    };
+
+    //! The packed hero.
+    struct Hero
+    {
+        std::int16_t attack;
+        std::int16_t health;
+        std::int16_t armor;
+        std::uint8_t flags;
+        std::uint8_t padding;
+    };
+
+    //! The packed hero power.
+    struct HeroPower
+    {
+        std::uint32_t card;
+        std::uint8_t isExhausted;
+        std::array<std::uint8_t, 3> padding;
+    };
+
+    //! The packed weapon. The card of weapon that isn't equipped is
+    //! CardHandle::INVALID.
+    struct Weapon
+    {
+        std::uint32_t card;
+        std::int16_t attack;
+        std::int16_t durability;
+    };
+
+    //! The packed mana crystals.
+    struct ManaCrystal
+    {
+        std::int8_t remaining;
+        std::int8_t total;
+        std::int8_t overloadOwed;
+        std::int8_t overloadLocked;
+    };
+
+    //! The packed minion.
+    struct Minion
+    {
+        std::uint32_t card;
+        std::int16_t attack;
+        std::int16_t health;
+        std::uint8_t flags;
+        std::array<std::uint8_t, 3> padding;
+    };
+
+    //! The packed card in hand.
+    struct HandCard
+    {
+        std::uint32_t card;
+        std::int16_t cost;
+        std::int16_t attack;
+        std::int16_t health;
+        std::int16_t padding;
+    };
+
+    //! The packed side of a player.
+    struct Side
+    {
+        Hero hero;
+        HeroPower heroPower;
+        Weapon weapon;
+        ManaCrystal manaCrystal;
+        std::array<Minion, MAX_FIELD_SIZE> minions;
+        std::uint8_t minionCount;
+        std::uint8_t handCount;
+        std::int16_t deckCount;
+    };
+
+    //! Default constructor.
+    PackedBoardView() = default;
+
+    //! Constructs packed board view with given \p view.
+    //! \param view The board ref view.
+    explicit PackedBoardView(const BoardRefView& view);
+
+    //! Operator overloading: operator==.
+    bool operator==(const PackedBoardView& rhs) const;
+
+    //! Operator overloading: operator!=.
+    bool operator!=(const PackedBoardView& rhs) const;
+
+    //! Returns the hash of the bytes of the view.
+    //! \return The hash of the view.
+    std::size_t GetHash() const;
+
+    //! Returns the current turn of the game.
+    //! \return The current turn of the game.
+    int GetTurn() const;
+
+    //! Returns the side of the view.
+    //! \return the side of the view.
+    PlayerType GetSide() const;
+
+    //! Returns the side of the current player.
+    //! \return The side of the current player.
+    const Side& GetMySide() const;
+
+    //! Returns the side of the opponent player.
+    //! \return The side of the opponent player.
+    const Side& GetOpSide() const;
+
+    //! Returns a list of cards in the hand of the current player.
+    //! \return A list of cards in the hand of the current player.
+    const std::array<HandCard, MAX_HAND_SIZE>& GetMyHand() const;
+
+ private:
+    Side m_my{};
+    Side m_op{};
+    std::array<HandCard, MAX_HAND_SIZE> m_myHand{};
+    std::int32_t m_turn = 0;
+    std::int32_t m_side = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<PackedBoardView>,
+              "The packed board view must be trivially copyable.");
+static_assert(std::has_unique_object_representations_v<PackedBoardView>,
+              "The packed board view must not have implicit paddings.");
+static_assert(sizeof(PackedBoardView) % sizeof(std::uint64_t) == 0,
+              "The packed board view is hashed in 64-bit words.");
+}  // namespace RosettaStone
+
+namespace std
+{
+//! \brief Template specialization of std::hash for PackedBoardView.
+template <>
+struct hash<RosettaStone::PackedBoardView>
+{
+    std::size_t operator()(const RosettaStone::PackedBoardView& rhs) const
+        noexcept
+    {
+        return rhs.GetHash();
+    }
+};
+}  // namespace std
+
+#endif  // ROSETTASTONE_PACKED_BOARD_VIEW_HPP
@@ -17,26 +17,26 @@ namespace RosettaStone::Views::Types
 //!
 //! \brief CardInfo struct.
 //!
-//! This struct stores the card ID, the ID and card index of the card set.
+//! This struct stores the handle of the card, the ID and card index of the
+//! card set. The handle is invalid if the card is hidden.
 //!
 struct CardInfo
 {
     //! Sets that the card as revealed.
-    //! \param _cardID The card ID to set.
-    void SetAsRevealedCard(std::string _cardID);
+    //! \param _card The handle of the card to set.
+    void SetAsRevealedCard(CardHandle _card);
 
     //! Sets that the card as hidden.
     //! \param setID The ID of the card set.
     //! \param cardIdx The card index of the card set.
     void SetAsHiddenCard(size_t setID, size_t cardIdx);
 
-    //! Returns the card ID considering whether it is valid.
+    //! Returns the handle of the card considering whether it is valid.
     //! \param unknownCardsManager The manager of unknown cards.
-    //! \return the card ID considering whether it is valid.
-    std::string GetCardID(
-        const UnknownCardsSetsManager& unknownCardsManager) const;
+    //! \return the handle of the card considering whether it is valid.
+    CardHandle GetCard(const UnknownCardsSetsManager& unknownCardsManager) const;
 
-    std::string cardID;
+    CardHandle card;
     std::size_t unknownCardsSetID = 0;
     std::size_t unknownCardsSetCardIdx = 0;
 };
@@ -138,11 +138,11 @@ struct Player
 
  private:
     //! Parse the information of the card.
-    //! \param cardID The card ID.
+    //! \param card The handle of the card, or an invalid handle if hidden.
     //! \param blockID The constant ID to block information.
     //! \param unknownCardsInfo The information of unknown cards.
     //! \return The parsed information of the card.
-    CardInfo ParseCardInfo(const std::string& cardID, int blockID,
+    CardInfo ParseCardInfo(CardHandle card, int blockID,
                            UnknownCardsInfo& unknownCardsInfo);
 
     //! Returns the unknown card set ID.
@@ -10,8 +10,10 @@
 #ifndef ROSETTASTONE_VIEWS_TYPES_UNKNOWN_CARDS_HPP
 #define ROSETTASTONE_VIEWS_TYPES_UNKNOWN_CARDS_HPP
 
+#include <Rosetta/Cards/CardHandle.hpp>
+#include <Rosetta/Commons/RandomEngine.hpp>
+
 #include <map>
-#include <string>
 #include <vector>
 
 namespace RosettaStone::Views::Types
@@ -27,15 +29,15 @@ class UnknownCardsSet
  public:
     //! Constructs unknown cards set with given \p cards.
     //! \param cards A list of unknown card.
-    explicit UnknownCardsSet(std::vector<std::string> cards);
+    explicit UnknownCardsSet(std::vector<CardHandle> cards);
 
     //! Adds a card to a list of unknown card.
-    //! \param cardID The card ID to add.
-    void Add(const std::string& cardID);
+    //! \param card The handle of the card to add.
+    void Add(CardHandle card);
 
     //! Removes a card to a list of unknown card.
-    //! \param cardID The card ID to remove.
-    void Remove(const std::string& cardID);
+    //! \param card The handle of the card to remove.
+    void Remove(CardHandle card);
 
     //! Resets a list of unknown card.
     void ResetState();
@@ -52,7 +54,7 @@ class UnknownCardsSet
     }
 
  private:
-    std::vector<std::string> m_cards;
+    std::vector<CardHandle> m_cards;
     size_t m_cardsSize;
 };
 
@@ -67,7 +69,7 @@ class UnknownCardsSets
  public:
     //! Adds a list of cards to a list of unknown cards set.
     //! \param cards A list of cards to add.
-    std::size_t AddCardsSet(const std::vector<std::string>& cards);
+    std::size_t AddCardsSet(const std::vector<CardHandle>& cards);
 
     //! Returns the index after reference count is increased.
     //! \param setIdx The index of unknown cards set.
@@ -75,8 +77,8 @@ class UnknownCardsSets
 
     //! Removes a card from a specified unknown cards set.
     //! \param setIdx The index of unknown cards set.
-    //! \param cardID The card ID to remove.
-    void RemoveCardFromSet(size_t setIdx, const std::string& cardID);
+    //! \param card The handle of the card to remove.
+    void RemoveCardFromSet(size_t setIdx, CardHandle card);
 
     //! Resets a list of unknown cards set.
     void ResetState();
@@ -95,7 +97,7 @@ class UnknownCardsSets
  private:
     struct SetItem
     {
-        explicit SetItem(const std::vector<std::string>& _cards)
+        explicit SetItem(const std::vector<CardHandle>& _cards)
             : cards(_cards), refCards()
         {
             // Do nothing
@@ -117,7 +119,7 @@ struct UnknownCardsInfo
 {
     constexpr static int DECK_BLOCK_ID = -1;
 
-    std::vector<std::string> deckCards;
+    std::vector<CardHandle> deckCards;
     UnknownCardsSets unknownCardsSets;
     std::map<int, std::size_t> setsIndices;
 };
@@ -155,17 +157,18 @@ class UnknownCardsSetsManager
     void Setup(UnknownCardsSets& data);
 
     //! Prepares the unknown cards sets manager.
-    void Prepare();
+    //! \param random The random engine to pick unknown cards.
+    void Prepare(RandomEngine& random);
 
-    //! Returns the card ID in a set of unknown cards.
+    //! Returns the handle of the card in a set of unknown cards.
     //! \param setIdx The index of unknown cards set.
     //! \param cardIdx The index of card in unknown cards set.
-    //! \return The card ID in a set of unknown cards.
-    std::string GetCardID(size_t setIdx, size_t cardIdx) const;
+    //! \return The handle of the card in a set of unknown cards.
+    CardHandle GetCard(size_t setIdx, size_t cardIdx) const;
 
  private:
     UnknownCardsSets* m_data;
-    std::vector<std::vector<std::string>> m_shuffledCards;
+    std::vector<std::vector<CardHandle>> m_shuffledCards;
 };
 }  // namespace RosettaStone::Views::Types
 
@@ -46,7 +46,7 @@ class DeckZone : public LimitedZone<Playable>
     void ChangeEntity(Playable* oldEntity, Playable* newEntity) override;
 
     //! Shuffles cards in deck.
-    void Shuffle() const;
+    void Shuffle();
 
     //! Sets an new entity.
     //! \param index The position of entity.
@@ -57,7 +57,7 @@ class DeckZone : public LimitedZone<Playable>
     //! Both entities must be contained by this zone.
     //! \param entity1 The one entity.
     //! \param entity2 The other entity.
-    void Swap(Playable* entity1, Playable* entity2) const;
+    void Swap(Playable* entity1, Playable* entity2);
 };
 }  // namespace RosettaStone
 
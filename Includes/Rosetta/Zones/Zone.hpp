@@ -7,8 +7,10 @@
 #define ROSETTASTONE_ZONE_HPP
 
 #include <Rosetta/Auras/Aura.hpp>
+#include <Rosetta/Games/GameJournal.hpp>
 #include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Zones/IZone.hpp>
+#include <Rosetta/Zones/ZoneView.hpp>
 
 #include <algorithm>
 #include <stdexcept>
@@ -99,16 +101,9 @@ class UnlimitedZone : public Zone<Playable>
         m_player = player;
     }
 
-    //! Destructor.
-    ~UnlimitedZone()
-    {
-        for (auto& entity : m_entities)
-        {
-            delete entity;
-        }
-
-        m_entities.clear();
-    }
+    //! Default destructor.
+    //! The entities are owned by the arena of game.
+    ~UnlimitedZone() = default;
 
     //! Deleted copy constructor.
     UnlimitedZone(const UnlimitedZone&) = delete;
@@ -154,9 +149,15 @@ class UnlimitedZone : public Zone<Playable>
             throw std::logic_error("Couldn't remove entity from zone.");
         }
 
-        m_entities.erase(
-            std::remove(m_entities.begin(), m_entities.end(), entity),
-            m_entities.end());
+        const auto iter =
+            std::find(m_entities.begin(), m_entities.end(), entity);
+        if (iter != m_entities.end())
+        {
+            GetJournal(m_player->game)
+                .Record(UndoRemove, this, entity,
+                        static_cast<int>(iter - m_entities.begin()));
+            m_entities.erase(iter);
+        }
 
         return entity;
     }
@@ -176,6 +177,11 @@ class UnlimitedZone : public Zone<Playable>
             }
         }
 
+        GameJournal& journal = GetJournal(m_player->game);
+        journal.Record(UndoSetAt, this, m_entities[pos],
+                       static_cast<int>(pos));
+        journal.RecordPointer(newEntity->zone);
+
         m_entities[pos] = newEntity;
         newEntity->zone = this;
     }
@@ -185,6 +191,10 @@ class UnlimitedZone : public Zone<Playable>
     //! \param zonePos The zone position of entity.
     void MoveTo(Playable* entity, [[maybe_unused]] int zonePos) override
     {
+        GameJournal& journal = GetJournal(m_player->game);
+        journal.Record(UndoMoveTo, this);
+        journal.RecordPointer(entity->zone);
+
         m_entities.emplace_back(entity);
         entity->zone = this;
         entity->SetZoneType(m_type);
@@ -211,6 +221,14 @@ class UnlimitedZone : public Zone<Playable>
         return m_entities;
     }
 
+    //! Returns a view of all entities in this zone without copying them.
+    //! \return A view of all entities in this zone.
+    ZoneView<Playable> GetView() const
+    {
+        return ZoneView<Playable>(
+            m_entities.data(), m_entities.data() + m_entities.size(), false);
+    }
+
     //! Runs \p functor on each entity of the zone.
     //! \param functor A function to run for each entity.
     template <typename Functor>
@@ -224,6 +242,31 @@ class UnlimitedZone : public Zone<Playable>
 
  protected:
     std::vector<Playable*> m_entities;
+
+ private:
+    //! Undoes MoveTo() recorded in the journal.
+    //! \param entry The journal entry of MoveTo().
+    static void UndoMoveTo(const GameJournal::Entry& entry)
+    {
+        static_cast<UnlimitedZone*>(entry.target)->m_entities.pop_back();
+    }
+
+    //! Undoes Remove() recorded in the journal.
+    //! \param entry The journal entry of Remove().
+    static void UndoRemove(const GameJournal::Entry& entry)
+    {
+        auto& entities = static_cast<UnlimitedZone*>(entry.target)->m_entities;
+        entities.insert(entities.begin() + entry.key,
+                        static_cast<Playable*>(entry.object));
+    }
+
+    //! Undoes ChangeEntity() recorded in the journal.
+    //! \param entry The journal entry of ChangeEntity().
+    static void UndoSetAt(const GameJournal::Entry& entry)
+    {
+        static_cast<UnlimitedZone*>(entry.target)->m_entities[entry.key] =
+            static_cast<Playable*>(entry.object);
+    }
 };
 
 //!
@@ -250,13 +293,9 @@ class LimitedZone : public Zone<T>
     }
 
     //! Destructor.
+    //! The entities are owned by the arena of game.
     ~LimitedZone()
     {
-        for (int i = 0; i < m_count; ++i)
-        {
-            delete m_entities[i];
-        }
-
         delete[] m_entities;
     }
 
@@ -318,15 +357,11 @@ class LimitedZone : public Zone<T>
             }
         }
 
-        if (pos < --m_count)
-        {
-            for (int i = pos + 1; i < m_maxSize; ++i)
-            {
-                m_entities[i - 1] = m_entities[i];
-            }
+        GameJournal& journal = GetJournal(Zone<T>::m_player->game);
+        journal.Record(UndoRemove, this, m_entities[pos], pos);
+        journal.RecordPointer(entity->zone);
 
-            m_entities[m_maxSize - 1] = nullptr;
-        }
+        EraseAt(pos);
 
         entity->zone = nullptr;
 
@@ -353,21 +388,12 @@ class LimitedZone : public Zone<T>
             return;
         }
 
-        if (zonePos < 0 || zonePos == m_count)
-        {
-            m_entities[m_count] = entity;
-        }
-        else
-        {
-            for (int i = m_count - 1; i >= zonePos; --i)
-            {
-                m_entities[i + 1] = m_entities[i];
-            }
+        const int pos = zonePos < 0 ? m_count : zonePos;
+        InsertAt(entity, pos);
 
-            m_entities[zonePos] = entity;
-        }
-
-        ++m_count;
+        GameJournal& journal = GetJournal(Zone<T>::m_player->game);
+        journal.Record(UndoMoveTo, this, nullptr, pos);
+        journal.RecordPointer(dynamic_cast<Playable*>(entity)->zone);
 
         dynamic_cast<Playable*>(entity)->zone = this;
         dynamic_cast<Playable*>(entity)->SetZoneType(Zone<T>::m_type);
@@ -436,6 +462,14 @@ class LimitedZone : public Zone<T>
         return result;
     }
 
+    //! Returns a view of all entities in this zone without copying them.
+    //! The entities that are destroyed are skipped, as GetAll() does.
+    //! \return A view of all entities in this zone.
+    ZoneView<T> GetView() const
+    {
+        return ZoneView<T>(m_entities, m_entities + m_count, true);
+    }
+
     //! Runs \p functor on each entity of the zone.
     //! \param functor A function to run for each entity.
     template <typename Functor>
@@ -448,6 +482,66 @@ class LimitedZone : public Zone<T>
     }
 
  protected:
+    //! Sets \p entity at \p zonePos without updating the entity, and records
+    //! the entity that was there to the journal.
+    //! \param entity The entity to set.
+    //! \param zonePos The zone position to set.
+    void SetAt(T* entity, int zonePos)
+    {
+        GetJournal(Zone<T>::m_player->game)
+            .Record(UndoSetAt, this, m_entities[zonePos], zonePos);
+        m_entities[zonePos] = entity;
+    }
+
+    //! Inserts \p entity at \p zonePos without updating the entity.
+    //! \param entity The entity to insert.
+    //! \param zonePos The zone position to insert.
+    void InsertAt(T* entity, int zonePos)
+    {
+        for (int i = m_count - 1; i >= zonePos; --i)
+        {
+            m_entities[i + 1] = m_entities[i];
+        }
+
+        m_entities[zonePos] = entity;
+        ++m_count;
+    }
+
+    //! Removes the entity at \p zonePos without updating the entity.
+    //! \param zonePos The zone position to remove.
+    void EraseAt(int zonePos)
+    {
+        for (int i = zonePos + 1; i < m_count; ++i)
+        {
+            m_entities[i - 1] = m_entities[i];
+        }
+
+        m_entities[--m_count] = nullptr;
+    }
+
+    //! Undoes MoveTo() recorded in the journal.
+    //! \param entry The journal entry of MoveTo().
+    static void UndoMoveTo(const GameJournal::Entry& entry)
+    {
+        static_cast<LimitedZone*>(entry.target)->EraseAt(entry.key);
+    }
+
+    //! Undoes Remove() recorded in the journal.
+    //! \param entry The journal entry of Remove().
+    static void UndoRemove(const GameJournal::Entry& entry)
+    {
+        static_cast<LimitedZone*>(entry.target)
+            ->InsertAt(static_cast<T*>(entry.object), entry.key);
+    }
+
+    //! Undoes SetAt() recorded in the journal.
+    //! \param entry The journal entry of SetAt().
+    static void UndoSetAt(const GameJournal::Entry& entry)
+    {
+        static_cast<LimitedZone*>(entry.target)->m_entities[entry.key] =
+            static_cast<T*>(entry.object);
+    }
+
     T** m_entities;
 
     int m_count = 0;
@@ -499,20 +593,14 @@ class PositioningZone : public LimitedZone<T>
         }
 
         const int pos = entity->GetZonePosition();
-        int count = LimitedZone<T>::m_count;
 
-        if (pos < --count)
-        {
-            for (int i = pos + 1; i < LimitedZone<T>::m_maxSize; ++i)
-            {
-                LimitedZone<T>::m_entities[i - 1] =
-                    LimitedZone<T>::m_entities[i];
-            }
-
-            LimitedZone<T>::m_entities[LimitedZone<T>::m_maxSize - 1] = nullptr;
-        }
+        GameJournal& journal = GetJournal(Zone<T>::m_player->game);
+        journal.Record(LimitedZone<T>::UndoRemove,
+                       static_cast<LimitedZone<T>*>(this),
+                       LimitedZone<T>::m_entities[pos], pos);
+        journal.RecordPointer(entity->zone);
 
-        LimitedZone<T>::m_count = count;
+        LimitedZone<T>::EraseAt(pos);
 
         Reposition(pos);
 
@@ -537,8 +625,9 @@ class PositioningZone : public LimitedZone<T>
     void ChangeEntity(Playable* oldEntity, Playable* newEntity) override
     {
         int pos = oldEntity->GetZonePosition();
-        LimitedZone<T>::m_entities[pos] = dynamic_cast<T*>(newEntity);
+        LimitedZone<T>::SetAt(dynamic_cast<T*>(newEntity), pos);
         newEntity->SetZonePosition(pos);
+        GetJournal(Zone<T>::m_player->game).RecordPointer(newEntity->zone);
         newEntity->zone = this;
     }
 
@@ -558,8 +647,8 @@ class PositioningZone : public LimitedZone<T>
         int newPos = newEntity->GetZonePosition();
         newEntity->SetZonePosition(oldPos);
         oldEntity->SetZonePosition(newPos);
-        LimitedZone<T>::m_entities[newPos] = oldEntity;
-        LimitedZone<T>::m_entities[oldPos] = newEntity;
+        LimitedZone<T>::SetAt(oldEntity, newPos);
+        LimitedZone<T>::SetAt(newEntity, oldPos);
     }
 
     std::vector<Aura*> auras;
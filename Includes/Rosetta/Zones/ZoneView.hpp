@@ -0,0 +1,169 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_ZONE_VIEW_HPP
+#define ROSETTASTONE_ZONE_VIEW_HPP
+
+#include <cstddef>
+#include <iterator>
+
+namespace RosettaStone
+{
+//!
+//! \brief ZoneView class.
+//!
+//! This class is a non-owning range over the entities of a zone. It iterates
+//! the storage of the zone in place instead of copying entities to a vector
+//! like GetAll(). A view of a limited zone skips the entities that are
+//! destroyed, as GetAll() does. The view is invalidated when the zone is
+//! modified, so entities must not be added to or removed from the zone while
+//! it is iterated.
+//!
+template <typename T>
+class ZoneView
+{
+ public:
+    //!
+    //! \brief Iterator class.
+    //!
+    //! This class is a forward iterator over the entities of a zone.
+    //!
+    class Iterator
+    {
+     public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T* const*;
+        using reference = T* const&;
+
+        //! Constructs iterator with given \p cur, \p last and
+        //! \p skipDestroyed.
+        //! \param cur The current position of storage.
+        //! \param last The end position of storage.
+        //! \param skipDestroyed The flag that indicates whether destroyed
+        //! entities are skipped.
+        Iterator(T* const* cur, T* const* last, bool skipDestroyed)
+            : m_cur(cur), m_last(last), m_skipDestroyed(skipDestroyed)
+        {
+            SkipInvalid();
+        }
+
+        //! Operator overloading for operator*.
+        //! \return The entity at the current position.
+        reference operator*() const
+        {
+            return *m_cur;
+        }
+
+        //! Operator overloading for prefix operator++.
+        //! \return The iterator that points to the next entity.
+        Iterator& operator++()
+        {
+            ++m_cur;
+            SkipInvalid();
+
+            return *this;
+        }
+
+        //! Operator overloading for postfix operator++.
+        //! \return The iterator before it is advanced.
+        Iterator operator++(int)
+        {
+            Iterator iter = *this;
+            ++(*this);
+
+            return iter;
+        }
+
+        //! Operator overloading for operator==.
+        //! \param rhs The iterator to compare.
+        //! \return true if both iterators point to same position,
+        //! false otherwise.
+        bool operator==(const Iterator& rhs) const
+        {
+            return m_cur == rhs.m_cur;
+        }
+
+        //! Operator overloading for operator!=.
+        //! \param rhs The iterator to compare.
+        //! \return true if both iterators point to different position,
+        //! false otherwise.
+        bool operator!=(const Iterator& rhs) const
+        {
+            return m_cur != rhs.m_cur;
+        }
+
+     private:
+        //! Advances the current position until it points to a valid entity.
+        void SkipInvalid()
+        {
+            if (!m_skipDestroyed)
+            {
+                return;
+            }
+
+            while (m_cur != m_last &&
+                   (*m_cur == nullptr ||
+                    static_cast<bool>((*m_cur)->isDestroyed)))
+            {
+                ++m_cur;
+            }
+        }
+
+        T* const* m_cur = nullptr;
+        T* const* m_last = nullptr;
+        bool m_skipDestroyed = false;
+    };
+
+    //! Constructs zone view with given \p first, \p last and
+    //! \p skipDestroyed.
+    //! \param first The beginning position of storage.
+    //! \param last The end position of storage.
+    //! \param skipDestroyed The flag that indicates whether destroyed entities
+    //! are skipped.
+    ZoneView(T* const* first, T* const* last, bool skipDestroyed)
+        : m_first(first), m_last(last), m_skipDestroyed(skipDestroyed)
+    {
+        // Do nothing
+    }
+
+    //! Returns an iterator to the first entity.
+    //! \return An iterator to the first entity.
+    Iterator begin() const
+    {
+        return Iterator(m_first, m_last, m_skipDestroyed);
+    }
+
+    //! Returns an iterator past the last entity.
+    //! \return An iterator past the last entity.
+    Iterator end() const
+    {
+        return Iterator(m_last, m_last, m_skipDestroyed);
+    }
+
+    //! Returns the number of entities that are visited by this view.
+    //! \return The number of entities that are visited by this view.
+    int GetCount() const
+    {
+        return static_cast<int>(std::distance(begin(), end()));
+    }
+
+    //! Returns a value indicating whether this view has no entities.
+    //! \return true if this view has no entities, false otherwise.
+    bool IsEmpty() const
+    {
+        return begin() == end();
+    }
+
+ private:
+    T* const* m_first = nullptr;
+    T* const* m_last = nullptr;
+    bool m_skipDestroyed = false;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_ZONE_VIEW_HPP
@@ -181,4 +181,22 @@ std::vector<std::string> DeckInfo::GetCardIDs()
 
     return ret;
 }
+
+std::vector<CardHandle> DeckInfo::GetCardHandles()
+{
+    std::vector<CardHandle> ret;
+    ret.reserve(m_numOfCards);
+
+    for (const auto& card : m_cards)
+    {
+        const CardHandle handle = Cards::GetHandle(card.first);
+
+        for (std::size_t i = 0; i < card.second; ++i)
+        {
+            ret.emplace_back(handle);
+        }
+    }
+
+    return ret;
+}
 }  // namespace RosettaStone
@@ -28,6 +28,11 @@ Hero* ActionValidGetter::GetHero(PlayerType playerType) const
     return hero;
 }
 
+SideMask ActionValidGetter::GetAttackerMask() const
+{
+    return CharacterMasks::Build(m_game.GetCurrentPlayer()).canAttack;
+}
+
 bool ActionValidGetter::CanUseHeroPower()
 {
     auto& heroPower = m_game.GetCurrentPlayer()->GetHeroPower();
@@ -45,8 +50,9 @@ bool ActionValidGetter::CanUseHeroPower()
     return true;
 }
 
-bool ActionValidGetter::IsPlayable([[maybe_unused]] const Player* player,
-                                   Playable* entity) const
+bool ActionValidGetter::IsPlayable(
+    const Player* player, Playable* entity,
+    std::optional<std::array<CharacterMasks, 2>>& masks) const
 {
     if (entity->card->GetCardType() == CardType::MINION)
     {
@@ -69,11 +75,20 @@ bool ActionValidGetter::IsPlayable([[maybe_unused]] const Player* player,
         return false;
     }
 
-    if (auto playReqs = entity->card->playRequirements;
-        (playReqs.find(PlayReq::REQ_TARGET_TO_PLAY) != playReqs.end()) &&
-        entity->GetValidPlayTargets().empty())
+    if (const auto& playReqs = entity->card->playRequirements;
+        playReqs.find(PlayReq::REQ_TARGET_TO_PLAY) != playReqs.end())
     {
-        return false;
+        if (!masks.has_value())
+        {
+            masks = { CharacterMasks::Build(player),
+                      CharacterMasks::Build(player->opponent) };
+        }
+
+        if (entity->GetValidPlayTargetMask((*masks)[0], (*masks)[1])
+                .IsEmpty())
+        {
+            return false;
+        }
     }
 
     return true;
@@ -20,9 +20,9 @@ void CastSpell(Player* player, Spell* spell, Character* target, int chooseOne)
     if (spell->IsSecret() || spell->IsQuest() || spell->IsSidequest())
     {
         // Process trigger
-        if (spell->card->power.GetTrigger())
+        if (spell->card->GetPower().GetTrigger())
         {
-            spell->card->power.GetTrigger()->Activate(spell);
+            spell->card->GetPower().GetTrigger()->Activate(spell);
         }
 
         player->GetSecretZone()->Add(spell);
@@ -31,15 +31,15 @@ void CastSpell(Player* player, Spell* spell, Character* target, int chooseOne)
     else
     {
         // Process trigger
-        if (spell->card->power.GetTrigger())
+        if (spell->card->GetPower().GetTrigger())
         {
-            spell->card->power.GetTrigger()->Activate(spell);
+            spell->card->GetPower().GetTrigger()->Activate(spell);
         }
 
         // Process aura
-        if (spell->card->power.GetAura())
+        if (spell->card->GetPower().GetAura())
         {
-            spell->card->power.GetAura()->Activate(spell);
+            spell->card->GetPower().GetAura()->Activate(spell);
         }
 
         // Process power or combo tasks
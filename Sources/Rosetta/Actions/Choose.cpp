@@ -7,6 +7,7 @@
 #include <Rosetta/Actions/Choose.hpp>
 #include <Rosetta/Actions/Generic.hpp>
 #include <Rosetta/Actions/Summon.hpp>
+#include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/ITask.hpp>
 #include <Rosetta/Zones/DeckZone.hpp>
@@ -54,6 +55,7 @@ void ChoiceMulligan(Player* player, const std::vector<int>& choices)
             auto deck = player->GetDeckZone();
 
             // Collect cards to redraw
+            const CardHandle coin = Cards::GetHandle("GAME_005");
             std::vector<Playable*> mulliganList;
             for (const auto entity : hand->GetAll())
             {
@@ -61,7 +63,7 @@ void ChoiceMulligan(Player* player, const std::vector<int>& choices)
                     std::find(choices.begin(), choices.end(),
                               entity->GetGameTag(GameTag::ENTITY_ID)) ==
                     choices.end();
-                if (isExist && entity->card->id != "GAME_005")
+                if (isExist && !entity->card->IsCard(coin, "GAME_005"))
                 {
                     mulliganList.push_back(entity);
                 }
@@ -113,7 +115,7 @@ bool ChoicePick(Player* player, int choice)
     }
 
     // Get picked card using entity ID
-    Playable* playable = player->game->entityList[choice];
+    Playable* playable = player->game->entityList.Get(choice);
     // Block it if player tries to pick a card that doesn't exist
     if (playable == nullptr)
     {
@@ -159,7 +161,7 @@ bool ChoicePick(Player* player, int choice)
                 const int sourceID =
                     player->choice->source->GetGameTag(GameTag::ENTITY_ID);
                 Summon(dynamic_cast<Minion*>(playable), -1,
-                       player->game->entityList[sourceID]);
+                       player->game->entityList.Get(sourceID));
             }
             break;
         }
@@ -172,7 +174,7 @@ bool ChoicePick(Player* player, int choice)
         {
             for (auto& handCard : player->opponent->GetHandZone()->GetAll())
             {
-                if (handCard->card->id == playable->card->id)
+                if (handCard->card->IsCard(*playable->card))
                 {
                     player->GetSetasideZone()->Remove(playable);
                     AddCardToHand(player, playable);
@@ -209,7 +211,8 @@ bool ChoicePick(Player* player, int choice)
     // Process after choose tasks
     if (choiceVal->source != nullptr)
     {
-        auto tasks = choiceVal->source->card->power.GetAfterChooseTask();
+        const auto& tasks =
+            choiceVal->source->card->GetPower().GetAfterChooseTask();
 
         if (!choiceVal->entityStack.empty())
         {
@@ -217,7 +220,7 @@ bool ChoicePick(Player* player, int choice)
 
             for (auto& entityID : choiceVal->entityStack)
             {
-                playables.emplace_back(player->game->entityList[entityID]);
+                playables.emplace_back(player->game->entityList.Get(entityID));
             }
 
             player->game->taskStack.playables = playables;
@@ -225,13 +228,7 @@ bool ChoicePick(Player* player, int choice)
 
         for (auto& task : tasks)
         {
-            std::unique_ptr<ITask> clonedTask = task->Clone();
-
-            clonedTask->SetPlayer(player);
-            clonedTask->SetSource(choiceVal->source);
-            clonedTask->SetTarget(playable);
-
-            clonedTask->Run();
+            task->Run(TaskFrame{ player, choiceVal->source, playable });
         }
     }
 
@@ -274,11 +271,10 @@ void CreateChoiceCards(Player* player, Entity* source, ChoiceType type,
 
     for (auto& card : choices)
     {
-        std::map<GameTag, int> cardTags;
-        cardTags.emplace(GameTag::CREATOR,
-                         source->GetGameTag(GameTag::ENTITY_ID));
-        cardTags.emplace(GameTag::DISPLAYED_CREATOR,
-                         source->GetGameTag(GameTag::ENTITY_ID));
+        GameTagStore cardTags;
+        cardTags.Set(GameTag::CREATOR, source->GetGameTag(GameTag::ENTITY_ID));
+        cardTags.Set(GameTag::DISPLAYED_CREATOR,
+                     source->GetGameTag(GameTag::ENTITY_ID));
 
         Playable* choiceEntity = Entity::GetFromCard(player, card, cardTags,
                                                      player->GetSetasideZone());
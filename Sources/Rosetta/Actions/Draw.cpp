@@ -41,20 +41,14 @@ Playable* Draw(Player* player, Playable* cardToDraw)
             player->game->taskQueue.EndEvent();
         }
 
-        auto tasks = playable->card->power.GetTopdeckTask();
+        const auto& tasks = playable->card->GetPower().GetTopdeckTask();
 
         // Process topdeck tasks
         if (!tasks.empty())
         {
             for (auto& task : tasks)
             {
-                std::unique_ptr<ITask> clonedTask = task->Clone();
-
-                clonedTask->SetPlayer(player);
-                clonedTask->SetSource(playable);
-                clonedTask->SetTarget(nullptr);
-
-                clonedTask->Run();
+                task->Run(TaskFrame{ player, playable, nullptr });
             }
 
             // If the text of card contains 'Casts When Drawn',
@@ -54,7 +54,7 @@ bool AddCardToHand(Player* player, Playable* entity)
 void AddEnchantment(Card* enchantmentCard, Playable* creator, Entity* target,
                     int num1, int num2, int entityID)
 {
-    Power& power = enchantmentCard->power;
+    const Power& power = enchantmentCard->GetPower();
 
     const auto playable = dynamic_cast<Playable*>(target);
     if (playable)
@@ -91,7 +91,7 @@ void AddEnchantment(Card* enchantmentCard, Playable* creator, Entity* target,
         if (entityID > 0)
         {
             enchantment->SetCapturedCard(
-                creator->game->entityList[entityID]->card);
+                creator->game->entityList.Get(entityID)->card);
         }
     }
 
@@ -150,11 +150,16 @@ void ChangeEntity(Player* player, Playable* playable, Card* newCard,
 
     if (playable->card->GetCardType() == newCard->GetCardType())
     {
+        player->game->zobrist.RemoveEntity(*playable);
+        player->game->journal.RecordPointer(playable->card);
         playable->card = newCard;
+        playable->NotifyMutation();
+        player->game->zobrist.AddEntity(*playable);
 
         if (playable->costManager != nullptr)
         {
-            playable->costManager->EntityChanged(newCard->GetCost());
+            playable->GetOrCreateCostManager()->EntityChanged(
+                newCard->GetCost());
         }
     }
     else
@@ -164,20 +169,20 @@ void ChangeEntity(Player* player, Playable* playable, Card* newCard,
         switch (newCard->GetCardType())
         {
             case CardType::HERO:
-                entity =
-                    new Hero(player, newCard, playable->card->gameTags, id);
+                entity = player->game->arena.Create<Hero>(
+                    player, newCard, playable->card->gameTags, id);
                 break;
             case CardType::MINION:
-                entity =
-                    new Minion(player, newCard, playable->card->gameTags, id);
+                entity = player->game->arena.Create<Minion>(
+                    player, newCard, playable->card->gameTags, id);
                 break;
             case CardType::SPELL:
-                entity =
-                    new Spell(player, newCard, playable->card->gameTags, id);
+                entity = player->game->arena.Create<Spell>(
+                    player, newCard, playable->card->gameTags, id);
                 break;
             case CardType::WEAPON:
-                entity =
-                    new Weapon(player, newCard, playable->card->gameTags, id);
+                entity = player->game->arena.Create<Weapon>(
+                    player, newCard, playable->card->gameTags, id);
                 break;
             default:
                 throw std::invalid_argument(
@@ -197,11 +202,16 @@ void ChangeEntity(Player* player, Playable* playable, Card* newCard,
             deck->ChangeEntity(playable, entity);
         }
 
-        player->game->entityList[id] = entity;
+        player->game->zobrist.RemoveEntity(*playable);
+        entity->SetZoneType(playable->GetZoneType());
+
+        player->game->journal.RecordEntity(player->game->entityList, id);
+        player->game->entityList.Set(id, entity);
 
         if (playable->costManager != nullptr)
         {
-            playable->costManager->EntityChanged(newCard->GetCost());
+            playable->GetOrCreateCostManager()->EntityChanged(
+                newCard->GetCost());
         }
 
         entity->costManager = playable->costManager;
@@ -211,13 +221,13 @@ void ChangeEntity(Player* player, Playable* playable, Card* newCard,
     // Replay auras
     if (hand != nullptr)
     {
-        if (auto trigger = playable->card->power.GetTrigger(); trigger)
+        if (auto trigger = playable->card->GetPower().GetTrigger(); trigger)
         {
             trigger->Activate(playable, TriggerActivation::HAND);
         }
 
         if (auto effect = dynamic_cast<AdaptiveCostEffect*>(
-                playable->card->power.GetAura());
+                playable->card->GetPower().GetAura());
             effect)
         {
             effect->Activate(playable);
@@ -271,7 +281,7 @@ void ChangeEntity(Player* player, Playable* playable, Card* newCard,
     }
     else if (auto deck = dynamic_cast<DeckZone*>(playable->zone); deck)
     {
-        if (auto trigger = playable->card->power.GetTrigger(); trigger)
+        if (auto trigger = playable->card->GetPower().GetTrigger(); trigger)
         {
             trigger->Activate(playable, TriggerActivation::DECK);
         }
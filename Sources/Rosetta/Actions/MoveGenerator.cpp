@@ -0,0 +1,171 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Actions/ActionValidGetter.hpp>
+#include <Rosetta/Actions/MoveGenerator.hpp>
+#include <Rosetta/Models/TargetMask.hpp>
+
+namespace RosettaStone
+{
+namespace
+{
+//! Runs \p functor on the index of each character in \p targets.
+//! \param targets The mask of targets.
+//! \param functor A function to run for each index.
+template <typename Functor>
+void ForEachTarget(const TargetMask& targets, Functor&& functor)
+{
+    for (int bit = 0; bit <= HERO_BIT; ++bit)
+    {
+        if (targets.GetFriendly() & (1 << bit))
+        {
+            functor(bit);
+        }
+    }
+
+    for (int bit = 0; bit <= HERO_BIT; ++bit)
+    {
+        if (targets.GetEnemy() & (1 << bit))
+        {
+            functor(bit + Move::ENEMY_OFFSET);
+        }
+    }
+}
+
+//! Adds \p move for each target in \p targets, or \p move without target
+//! if \p targets is empty.
+//! \param moves The list to store the moves.
+//! \param move The move to add, whose target is filled.
+//! \param targets The mask of targets.
+void AddTargetMoves(std::vector<Move>& moves, Move move,
+                    const TargetMask& targets)
+{
+    if (targets.IsEmpty())
+    {
+        moves.emplace_back(move);
+        return;
+    }
+
+    ForEachTarget(targets, [&](int target) {
+        move.target = static_cast<std::int8_t>(target);
+        moves.emplace_back(move);
+    });
+}
+}  // namespace
+
+Character* Move::GetCharacter(Player* player, int index)
+{
+    if (index == NO_TARGET)
+    {
+        return nullptr;
+    }
+
+    if (index >= ENEMY_OFFSET)
+    {
+        player = player->opponent;
+        index -= ENEMY_OFFSET;
+    }
+
+    if (index == HERO_BIT)
+    {
+        return player->GetHero();
+    }
+
+    return (*player->GetFieldZone())[index];
+}
+
+bool Move::operator==(const Move& rhs) const
+{
+    return op == rhs.op && source == rhs.source && target == rhs.target &&
+           position == rhs.position && chooseOne == rhs.chooseOne;
+}
+
+bool Move::operator!=(const Move& rhs) const
+{
+    return !(*this == rhs);
+}
+
+MoveGenerator::MoveGenerator(const Game& game) : m_game(game)
+{
+    // Do nothing
+}
+
+void MoveGenerator::Generate(std::vector<Move>& moves) const
+{
+    moves.clear();
+
+    const Player* player = m_game.GetCurrentPlayer();
+    const CharacterMasks friendly = CharacterMasks::Build(player);
+    const CharacterMasks enemy = CharacterMasks::Build(player->opponent);
+    const int fieldCount = player->GetFieldZone()->GetCount();
+
+    ActionValidGetter getter(m_game);
+
+    // NOTE: The target of a card is chosen from its valid targets even if it
+    // doesn't require a target, and the minion is put in every position,
+    // as Game::PerformAction() does.
+    getter.ForEachPlayableCard([&](Playable* card) {
+        const TargetMask targets =
+            card->GetValidPlayTargetMask(friendly, enemy);
+        const bool isMinion = card->card->GetCardType() == CardType::MINION;
+        const int firstPos = isMinion ? 0 : -1;
+        const int lastPos = isMinion ? fieldCount : -1;
+        const int numChooseOne =
+            card->HasChooseOne()
+                ? static_cast<int>(card->card->chooseCardIDs.size())
+                : 0;
+
+        Move move;
+        move.op = MainOpType::PLAY_CARD;
+        move.source = static_cast<std::int8_t>(card->GetZonePosition());
+
+        for (int chooseOne = numChooseOne > 0 ? 1 : 0;
+             chooseOne <= numChooseOne; ++chooseOne)
+        {
+            move.chooseOne = static_cast<std::int8_t>(chooseOne);
+
+            for (int pos = firstPos; pos <= lastPos; ++pos)
+            {
+                move.position = static_cast<std::int8_t>(pos);
+                AddTargetMoves(moves, move, targets);
+            }
+        }
+
+        return true;
+    });
+
+    getter.ForEachAttacker([&](Character* character) {
+        const TargetMask targets = character->GetValidAttackTargetMask(enemy);
+        if (targets.IsEmpty())
+        {
+            return true;
+        }
+
+        Move move;
+        move.op = MainOpType::ATTACK;
+        move.source = static_cast<std::int8_t>(
+            character == player->GetHero() ? HERO_BIT
+                                           : character->GetZonePosition());
+
+        AddTargetMoves(moves, move, targets);
+        return true;
+    });
+
+    if (getter.CanUseHeroPower())
+    {
+        Move move;
+        move.op = MainOpType::USE_HERO_POWER;
+
+        AddTargetMoves(
+            moves, move,
+            player->GetHeroPower().GetValidPlayTargetMask(friendly, enemy));
+    }
+
+    Move endTurn;
+    endTurn.op = MainOpType::END_TURN;
+    moves.emplace_back(endTurn);
+}
+}  // namespace RosettaStone
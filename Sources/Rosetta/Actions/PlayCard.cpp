@@ -76,6 +76,7 @@ void PlayCard(Player* player, Playable* source, Character* target, int fieldPos,
     }
 
     // Set card's owner
+    player->game->journal.RecordPointer(source->player);
     source->player = player;
 
     // Set card target and validate target trigger
@@ -132,8 +133,8 @@ void PlayCard(Player* player, Playable* source, Character* target, int fieldPos,
         if (const auto spell = dynamic_cast<Spell*>(source);
             spell == nullptr || !spell->IsCountered())
         {
-            std::map<GameTag, int> tags;
-            tags.emplace(GameTag::GHOSTLY, 1);
+            GameTagStore tags;
+            tags.Set(GameTag::GHOSTLY, 1);
 
             Playable* playable = Entity::GetFromCard(player, source->card, tags,
                                                      player->GetHandZone());
@@ -161,17 +162,20 @@ void PlayHero(Player* player, Hero* hero, Character* target, int chooseOne)
     hero->SetExhausted(oldHero->IsExhausted());
 
     player->GetSetasideZone()->Add(oldHero);
+    player->game->journal.RecordPointer(hero->weapon);
     hero->weapon = oldHero->weapon;
     player->GetSetasideZone()->Add(oldHero->heroPower);
+    player->game->journal.RecordPointer(hero->heroPower);
     hero->heroPower = dynamic_cast<HeroPower*>(Entity::GetFromCard(
         player, Cards::FindCardByDbfID(hero->GetGameTag(GameTag::HERO_POWER))));
-    if (auto trigger = hero->heroPower->card->power.GetTrigger(); trigger)
+    hero->heroPower->SetZoneType(ZoneType::PLAY);
+    if (auto trigger = hero->heroPower->card->GetPower().GetTrigger(); trigger)
     {
         trigger->Activate(hero->heroPower);
     }
 
     player->SetHero(hero);
-    if (auto trigger = hero->card->power.GetTrigger(); trigger)
+    if (auto trigger = hero->card->GetPower().GetTrigger(); trigger)
     {
         trigger->Activate(hero);
     }
@@ -242,7 +246,7 @@ void PlayMinion(Player* player, Minion* minion, Character* target, int fieldPos,
         if (minion->GetCardTarget() != target->GetGameTag(GameTag::ENTITY_ID))
         {
             target = dynamic_cast<Character*>(
-                minion->game->entityList[minion->GetCardTarget()]);
+                minion->game->entityList.Get(minion->GetCardTarget()));
         }
     }
 
@@ -325,7 +329,7 @@ void PlaySpell(Player* player, Spell* spell, Character* target, int chooseOne)
                 target->GetGameTag(GameTag::ENTITY_ID))
             {
                 target = dynamic_cast<Character*>(
-                    spell->game->entityList[spell->GetCardTarget()]);
+                    spell->game->entityList.Get(spell->GetCardTarget()));
             }
         }
 
@@ -352,15 +356,15 @@ void PlayWeapon(Player* player, Weapon* weapon, Character* target)
     player->game->triggerManager.OnPlayCardTrigger(weapon);
 
     // Process trigger
-    if (weapon->card->power.GetTrigger())
+    if (weapon->card->GetPower().GetTrigger())
     {
-        weapon->card->power.GetTrigger()->Activate(weapon);
+        weapon->card->GetPower().GetTrigger()->Activate(weapon);
     }
 
     // Process aura
-    if (weapon->card->power.GetAura())
+    if (weapon->card->GetPower().GetAura())
     {
-        weapon->card->power.GetAura()->Activate(weapon);
+        weapon->card->GetPower().GetAura()->Activate(weapon);
     }
 
     // Process target trigger
@@ -374,7 +378,7 @@ void PlayWeapon(Player* player, Weapon* weapon, Character* target)
         if (weapon->GetCardTarget() != target->GetGameTag(GameTag::ENTITY_ID))
         {
             target = dynamic_cast<Character*>(
-                weapon->game->entityList[weapon->GetCardTarget()]);
+                weapon->game->entityList.Get(weapon->GetCardTarget()));
         }
     }
 
@@ -30,13 +30,10 @@ void AdaptiveCostEffect::Activate(Playable* owner, bool cloning)
 
     auto instance = new AdaptiveCostEffect(*this, *owner);
 
-    if (owner->costManager == nullptr)
-    {
-        owner->costManager = new CostManager();
-    }
-
-    owner->costManager->ActivateAdaptiveEffect(instance);
+    owner->GetOrCreateCostManager()->ActivateAdaptiveEffect(instance);
+    owner->game->journal.RecordPointer(owner->ongoingEffect);
     owner->ongoingEffect = instance;
+    owner->game->journal.RecordValue(owner->game->auras);
     owner->game->auras.emplace_back(instance);
 }
 
@@ -71,18 +68,20 @@ int AdaptiveCostEffect::Apply(int value) const
 
 void AdaptiveCostEffect::Update()
 {
-    m_owner->costManager->UpdateAdaptiveEffect();
+    m_owner->GetOrCreateCostManager()->UpdateAdaptiveEffect();
 }
 
 void AdaptiveCostEffect::Remove()
 {
+    m_owner->game->journal.RecordPointer(m_owner->ongoingEffect);
     m_owner->ongoingEffect = nullptr;
 
+    m_owner->game->journal.RecordValue(m_owner->game->auras);
     EraseIf(m_owner->game->auras, [this](IAura* aura) { return aura == this; });
 
-    if (const auto costManager = m_owner->costManager; costManager)
+    if (m_owner->costManager != nullptr)
     {
-        costManager->DeactivateAdaptiveEffect();
+        m_owner->GetOrCreateCostManager()->DeactivateAdaptiveEffect();
     }
 }
 
@@ -37,19 +37,25 @@ void AdaptiveEffect::Activate(Playable* owner, [[maybe_unused]] bool cloning)
     {
         if (const auto weapon = dynamic_cast<Weapon*>(owner); weapon)
         {
-            if (weapon->player->GetHero()->auraEffects != nullptr)
+            if (weapon->player->GetHero()->auraEffects == nullptr)
             {
+                owner->game->journal.RecordPointer(
+                    weapon->player->GetHero()->auraEffects);
                 weapon->player->GetHero()->auraEffects =
-                    new AuraEffects(CardType::HERO);
+                    owner->game->arena.Create<AuraEffects>(CardType::HERO);
             }
         }
         else if (owner->auraEffects == nullptr)
         {
-            owner->auraEffects = new AuraEffects(CardType::MINION);
+            owner->game->journal.RecordPointer(owner->auraEffects);
+            owner->auraEffects =
+                owner->game->arena.Create<AuraEffects>(CardType::MINION);
         }
     }
 
+    owner->game->journal.RecordValue(owner->game->auras);
     owner->game->auras.emplace_back(instance);
+    owner->game->journal.RecordPointer(owner->ongoingEffect);
     owner->ongoingEffect = instance;
 }
 
@@ -75,10 +81,18 @@ void AdaptiveEffect::Update()
         {
             value = m_valueFunc(m_owner);
 
+            // NOTE: Removing and applying the same amount is a no-op only for
+            // the effect that adds the value.
+            if (value == m_lastValue && m_operator == EffectOperator::ADD)
+            {
+                return;
+            }
+
             Effect(m_tag, m_operator, m_lastValue).RemoveFrom(m_owner);
             Effect(m_tag, m_operator, value).ApplyTo(m_owner);
         }
 
+        m_owner->game->journal.RecordInt(m_lastValue);
         m_lastValue = value;
     }
     else
@@ -92,6 +106,7 @@ void AdaptiveEffect::Update()
             Effect(m_tag, m_operator, m_lastValue).RemoveAuraFrom(m_owner);
         }
 
+        m_owner->game->journal.RecordValue(m_owner->game->auras);
         EraseIf(m_owner->game->auras,
                 [this](IAura* aura) { return aura == this; });
     }
@@ -99,7 +114,9 @@ void AdaptiveEffect::Update()
 
 void AdaptiveEffect::Remove()
 {
+    m_owner->game->journal.RecordPointer(m_owner->ongoingEffect);
     m_owner->ongoingEffect = nullptr;
+    m_owner->game->journal.RecordBool(m_turnOn);
     m_turnOn = false;
 }
 
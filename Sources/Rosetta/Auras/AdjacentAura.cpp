@@ -38,7 +38,9 @@ void AdjacentAura::Update()
             Disapply(m_right);
         }
 
+        m_owner->game->journal.RecordPointer(m_owner->ongoingEffect);
         m_owner->ongoingEffect = nullptr;
+        m_owner->game->journal.RecordValue(m_owner->game->auras);
         EraseIf(m_owner->game->auras,
                 [this](IAura* aura) { return aura == this; });
 
@@ -59,6 +61,7 @@ void AdjacentAura::Update()
             m_left->GetZonePosition() != pos - 1)
         {
             Disapply(m_left);
+            m_owner->game->journal.RecordPointer(m_left);
             m_left = nullptr;
         }
     }
@@ -70,6 +73,7 @@ void AdjacentAura::Update()
         if (!left->GetGameTag(GameTag::UNTOUCHABLE))
         {
             Apply(left);
+            m_owner->game->journal.RecordPointer(m_left);
             m_left = left;
         }
     }
@@ -81,6 +85,7 @@ void AdjacentAura::Update()
             m_right->GetZonePosition() != pos + 1)
         {
             Disapply(m_right);
+            m_owner->game->journal.RecordPointer(m_right);
             m_right = nullptr;
         }
     }
@@ -92,15 +97,23 @@ void AdjacentAura::Update()
         if (!right->GetGameTag(GameTag::UNTOUCHABLE))
         {
             Apply(right);
+            m_owner->game->journal.RecordPointer(m_right);
             m_right = right;
         }
     }
 
+    m_owner->game->journal.RecordBool(m_isFieldChanged);
     m_isFieldChanged = false;
 }
 
+bool AdjacentAura::IsUpToDate() const
+{
+    return !m_toBeRemoved && !m_isFieldChanged;
+}
+
 void AdjacentAura::Remove()
 {
+    m_owner->game->journal.RecordBool(m_toBeRemoved);
     m_toBeRemoved = true;
 }
 
@@ -111,6 +124,7 @@ void AdjacentAura::Clone(Playable* clone)
 
 void AdjacentAura::SetIsFieldChanged(bool isFieldChanged)
 {
+    m_owner->game->journal.RecordBool(m_isFieldChanged);
     m_isFieldChanged = isFieldChanged;
 }
 
@@ -135,14 +149,13 @@ void AdjacentAura::Disapply(Minion* minion)
     }
 
     if (m_enchantmentCard != nullptr &&
-        m_enchantmentCard->power.GetTrigger() != nullptr)
+        m_enchantmentCard->GetPower().GetTrigger() != nullptr)
     {
-        const std::string cardID = m_enchantmentCard->id;
         auto enchantments = minion->appliedEnchantments;
 
         for (int i = static_cast<int>(enchantments.size()) - 1; i >= 0; --i)
         {
-            if (enchantments[i]->card->id == cardID)
+            if (enchantments[i]->card->IsCard(*m_enchantmentCard))
             {
                 enchantments.erase(enchantments.begin() + i);
                 break;
@@ -157,30 +170,37 @@ AdjacentAura::AdjacentAura(AdjacentAura& prototype, Minion& owner, bool cloning)
     m_enchantmentCard = prototype.m_enchantmentCard;
     if (prototype.m_effects.empty())
     {
-        m_effects = m_enchantmentCard->power.GetEnchant()->effects;
+        m_effects = m_enchantmentCard->GetPower().GetEnchant()->effects;
     }
     else
     {
         m_effects = prototype.m_effects;
     }
 
+    owner.game->journal.RecordPointer(owner.ongoingEffect);
     owner.ongoingEffect = this;
+    owner.game->journal.RecordValue(owner.game->auras);
     owner.game->auras.emplace_back(this);
 
     m_fieldZone = owner.player->GetFieldZone();
+    owner.game->journal.RecordValue(m_fieldZone->adjacentAuras);
     m_fieldZone->adjacentAuras.emplace_back(this);
 
     if (cloning)
     {
-        if (prototype.m_left != nullptr)
-        {
-            m_left = prototype.m_left;
-        }
+        // Finds the minion in the game of owner when it is cloned to other game
+        const auto findMinion = [&owner](Minion* minion) -> Minion* {
+            if (minion == nullptr || minion->game == owner.game)
+            {
+                return minion;
+            }
 
-        if (prototype.m_right != nullptr)
-        {
-            m_right = prototype.m_right;
-        }
+            return dynamic_cast<Minion*>(owner.game->entityList.At(
+                minion->GetGameTag(GameTag::ENTITY_ID)));
+        };
+
+        m_left = findMinion(prototype.m_left);
+        m_right = findMinion(prototype.m_right);
     }
 }
 }  // namespace RosettaStone
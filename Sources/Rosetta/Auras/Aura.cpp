@@ -16,6 +16,28 @@
 
 namespace RosettaStone
 {
+namespace
+{
+//! Records the auras of the zones that an aura can be registered to.
+//! \param owner The owner of the aura.
+void RecordZoneAuras(Playable& owner)
+{
+    GameJournal& journal = owner.game->journal;
+    journal.NotifyMutation();
+
+    if (!journal.IsRecording())
+    {
+        return;
+    }
+
+    journal.RecordPointer(owner.ongoingEffect);
+    journal.RecordValue(owner.game->auras);
+    journal.RecordValue(owner.player->GetFieldZone()->auras);
+    journal.RecordValue(owner.player->GetHandZone()->auras);
+    journal.RecordValue(owner.player->opponent->GetHandZone()->auras);
+}
+}  // namespace
+
 Aura::Aura(AuraType type, std::vector<std::shared_ptr<IEffect>> effects)
     : m_type(type), m_effects(std::move(effects))
 {
@@ -37,37 +59,49 @@ void Aura::Activate(Playable* owner, bool cloning)
 {
     if (m_effects.empty())
     {
-        m_effects = m_enchantmentCard->power.GetEnchant()->effects;
+        m_effects = m_enchantmentCard->GetPower().GetEnchant()->effects;
     }
 
     auto instance = new Aura(*this, *owner);
 
     AddToGame(*owner, *instance);
 
+    TriggerEvent* removeEvent = nullptr;
     switch (removeTrigger.first)
     {
         case TriggerType::NONE:
             break;
         case TriggerType::TURN_END:
-            owner->game->triggerManager.endTurnTrigger +=
-                instance->m_removeHandler;
+            removeEvent = &owner->game->triggerManager.endTurnTrigger;
             break;
         case TriggerType::CAST_SPELL:
-            owner->game->triggerManager.castSpellTrigger +=
-                instance->m_removeHandler;
+            removeEvent = &owner->game->triggerManager.castSpellTrigger;
             break;
         case TriggerType::PLAY_MINION:
-            owner->game->triggerManager.playMinionTrigger +=
-                instance->m_removeHandler;
+            removeEvent = &owner->game->triggerManager.playMinionTrigger;
             break;
         case TriggerType::USE_HERO_POWER:
-            owner->game->triggerManager.useHeroPowerTrigger +=
-                instance->m_removeHandler;
+            removeEvent = &owner->game->triggerManager.useHeroPowerTrigger;
             break;
         default:
             break;
     }
 
+    if (removeEvent != nullptr)
+    {
+        instance->m_removeEvent = removeEvent;
+        instance->m_removeHandle =
+            removeEvent->AddHandler(instance->m_removeHandler);
+
+        if (owner->game->journal.IsRecording())
+        {
+            owner->game->journal.RecordUndo([instance]() {
+                instance->m_removeEvent->RemoveHandler(
+                    instance->m_removeHandle);
+            });
+        }
+    }
+
     if (!cloning && !restless)
     {
         instance->m_auraUpdateInstQueue.Push(
@@ -77,6 +111,8 @@ void Aura::Activate(Playable* owner, bool cloning)
 
 void Aura::Update()
 {
+    SaveState();
+
     bool addAllProcessed = false;
 
     if (restless)
@@ -114,8 +150,17 @@ void Aura::Update()
     }
 }
 
+bool Aura::IsUpToDate() const
+{
+    // NOTE: The restless aura renews the changed entities in RenewAll().
+    return !restless && m_auraUpdateInstQueue.IsEmpty();
+}
+
 void Aura::Remove()
 {
+    RecordZoneAuras(*m_owner);
+    SaveState();
+
     m_turnOn = false;
     m_auraUpdateInstQueue.Push(
         AuraUpdateInstruction(AuraInstruction::REMOVE_ALL), 0);
@@ -165,22 +210,20 @@ void Aura::Remove()
         }
     }
 
-    switch (removeTrigger.first)
+    if (m_removeEvent != nullptr)
     {
-        case TriggerType::NONE:
-            break;
-        case TriggerType::TURN_END:
-            m_owner->game->triggerManager.endTurnTrigger -= m_removeHandler;
-            break;
-        case TriggerType::CAST_SPELL:
-            m_owner->game->triggerManager.castSpellTrigger -= m_removeHandler;
-            break;
-        case TriggerType::USE_HERO_POWER:
-            m_owner->game->triggerManager.useHeroPowerTrigger -=
-                m_removeHandler;
-            break;
-        default:
-            break;
+        m_removeEvent->RemoveHandler(m_removeHandle);
+
+        if (m_owner->game->journal.IsRecording())
+        {
+            m_owner->game->journal.RecordUndo(
+                [this, removeEvent = m_removeEvent]() {
+                    m_removeEvent = removeEvent;
+                    m_removeHandle = removeEvent->AddHandler(m_removeHandler);
+                });
+        }
+
+        m_removeEvent = nullptr;
     }
 
     if (auto enchantment = dynamic_cast<Enchantment*>(m_owner))
@@ -196,6 +239,8 @@ void Aura::Clone(Playable* clone)
 
 void Aura::Apply(Playable* entity)
 {
+    SaveState();
+
     if (condition != nullptr)
     {
         if (!condition->Evaluate(entity))
@@ -210,12 +255,12 @@ void Aura::Apply(Playable* entity)
     }
 
     if (m_enchantmentCard != nullptr &&
-        m_enchantmentCard->power.GetTrigger() != nullptr)
+        m_enchantmentCard->GetPower().GetTrigger() != nullptr)
     {
         const auto instance =
             Enchantment::GetInstance(entity->player, m_enchantmentCard, entity);
 
-        if (auto trigger = m_enchantmentCard->power.GetTrigger();
+        if (auto trigger = m_enchantmentCard->GetPower().GetTrigger();
             trigger != nullptr)
         {
             trigger->Activate(instance.get());
@@ -227,6 +272,8 @@ void Aura::Apply(Playable* entity)
 
 void Aura::Disapply(Playable* entity)
 {
+    SaveState();
+
     const auto iter =
         std::find(m_appliedEntities.begin(), m_appliedEntities.end(), entity);
 
@@ -245,14 +292,13 @@ void Aura::Disapply(Playable* entity)
     }
 
     if (m_enchantmentCard != nullptr &&
-        m_enchantmentCard->power.GetTrigger() != nullptr)
+        m_enchantmentCard->GetPower().GetTrigger() != nullptr)
     {
-        const std::string cardID = m_enchantmentCard->id;
         auto enchantments = entity->appliedEnchantments;
 
         for (int i = static_cast<int>(enchantments.size()) - 1; i >= 0; --i)
         {
-            if (enchantments[i]->card->id == cardID)
+            if (enchantments[i]->card->IsCard(*m_enchantmentCard))
             {
                 enchantments.erase(enchantments.begin() + i);
                 break;
@@ -273,7 +319,9 @@ void Aura::NotifyEntityAdded(Playable* entity)
 
     if (!m_auraUpdateInstQueue.IsExist(instruction))
     {
+        SaveState();
         m_auraUpdateInstQueue.Push(instruction, 2);
+        m_owner->game->journal.NotifyMutation();
     }
 }
 
@@ -289,8 +337,10 @@ void Aura::NotifyEntityRemoved(Playable* entity)
         return;
     }
 
+    SaveState();
     m_auraUpdateInstQueue.Push(
         AuraUpdateInstruction(entity, AuraInstruction::REMOVE), 1);
+    m_owner->game->journal.NotifyMutation();
 }
 
 Aura::Aura(Aura& prototype, Playable& owner)
@@ -308,6 +358,18 @@ Aura::Aura(Aura& prototype, Playable& owner)
         m_auraUpdateInstQueue = prototype.m_auraUpdateInstQueue;
     }
 
+    // Remap applied entities if the aura is cloned to other game
+    if (prototype.m_owner != nullptr && prototype.m_owner->game != owner.game)
+    {
+        m_appliedEntities.reserve(prototype.m_appliedEntities.size());
+
+        for (auto& entity : prototype.m_appliedEntities)
+        {
+            m_appliedEntities.emplace_back(owner.game->entityList.At(
+                entity->GetGameTag(GameTag::ENTITY_ID)));
+        }
+    }
+
     auto removeFunc = [this](Entity* source) {
         if (removeTrigger.second != nullptr)
         {
@@ -329,8 +391,26 @@ Aura::Aura(Aura& prototype, Playable& owner)
     m_removeHandler = TriggerEventHandler(removeFunc);
 }
 
+void Aura::SaveState()
+{
+    // NOTE: The handler of remove trigger is recorded by Activate() and
+    // Remove(), because it is registered to the trigger event.
+    m_owner->game->journal.RecordState(m_stateEpoch, [this]() {
+        return [this, queue = m_auraUpdateInstQueue,
+                appliedEntities = m_appliedEntities, turnOn = m_turnOn,
+                lastUpdate = m_lastUpdate]() {
+            m_auraUpdateInstQueue = queue;
+            m_appliedEntities = appliedEntities;
+            m_turnOn = turnOn;
+            m_lastUpdate = lastUpdate;
+        };
+    });
+}
+
 void Aura::AddToGame(Playable& owner, Aura& aura)
 {
+    RecordZoneAuras(owner);
+
     owner.game->auras.emplace_back(&aura);
     owner.ongoingEffect = &aura;
 
@@ -360,6 +440,16 @@ void Aura::AddToGame(Playable& owner, Aura& aura)
     }
 }
 
+bool Aura::IsChanged(const Entity* entity) const
+{
+    // NOTE: Every entity is marked when it is created, so all entities are
+    // changed since the aura that is never updated. GameJournal::Rollback()
+    // restores entities without marking them, so all entities are regarded
+    // as changed after rollback.
+    return entity->GetLastMutation() > m_lastUpdate ||
+           m_lastUpdate < m_owner->game->journal.GetLastRollback();
+}
+
 void Aura::UpdateInternal()
 {
     if (!m_turnOn)
@@ -390,14 +480,14 @@ void Aura::UpdateInternal()
             break;
         }
         case AuraType::FIELD:
-            for (auto& minion : m_owner->player->GetFieldZone()->GetAll())
+            for (auto& minion : m_owner->player->GetFieldZone()->GetView())
             {
                 Apply(minion);
             }
             break;
         case AuraType::FIELD_EXCEPT_SOURCE:
         {
-            for (auto& minion : m_owner->player->GetFieldZone()->GetAll())
+            for (auto& minion : m_owner->player->GetFieldZone()->GetView())
             {
                 if (minion != m_owner)
                 {
@@ -413,7 +503,7 @@ void Aura::UpdateInternal()
         }
         case AuraType::HAND:
         {
-            for (auto& card : m_owner->player->GetHandZone()->GetAll())
+            for (auto& card : m_owner->player->GetHandZone()->GetView())
             {
                 Apply(card);
             }
@@ -422,7 +512,7 @@ void Aura::UpdateInternal()
         case AuraType::ENEMY_HAND:
         {
             for (auto& card :
-                 m_owner->player->opponent->GetHandZone()->GetAll())
+                 m_owner->player->opponent->GetHandZone()->GetView())
             {
                 Apply(card);
             }
@@ -430,12 +520,12 @@ void Aura::UpdateInternal()
         }
         case AuraType::HANDS:
         {
-            for (auto& card : m_owner->player->GetHandZone()->GetAll())
+            for (auto& card : m_owner->player->GetHandZone()->GetView())
             {
                 Apply(card);
             }
             for (auto& card :
-                 m_owner->player->opponent->GetHandZone()->GetAll())
+                 m_owner->player->opponent->GetHandZone()->GetView())
             {
                 Apply(card);
             }
@@ -443,11 +533,11 @@ void Aura::UpdateInternal()
         }
         case AuraType::FIELD_AND_HAND:
         {
-            for (auto& card : m_owner->player->GetHandZone()->GetAll())
+            for (auto& card : m_owner->player->GetHandZone()->GetView())
             {
                 Apply(card);
             }
-            for (auto& minion : m_owner->player->GetFieldZone()->GetAll())
+            for (auto& minion : m_owner->player->GetFieldZone()->GetView())
             {
                 Apply(minion);
             }
@@ -472,7 +562,7 @@ void Aura::UpdateInternal()
                     }
 
                     for (auto& minion :
-                         m_owner->player->GetFieldZone()->GetAll())
+                         m_owner->player->GetFieldZone()->GetView())
                     {
                         if (minion->IsFrozen())
                         {
@@ -483,7 +573,7 @@ void Aura::UpdateInternal()
                 else if (effectPtr->GetGameTag() == GameTag::MEGA_WINDFURY)
                 {
                     for (auto& minion :
-                         m_owner->player->GetFieldZone()->GetAll())
+                         m_owner->player->GetFieldZone()->GetView())
                     {
                         // A minion can't attack at first turn in play.
                         if (minion->GetNumAttacksThisTurn() == 0 &&
@@ -530,6 +620,9 @@ void Aura::UpdateInternal()
             throw std::invalid_argument(
                 "Aura::UpdateInternal() - Invalid aura type!");
     }
+
+    // NOTE: The aura effects of players are not recorded by the journal.
+    m_owner->game->journal.NotifyMutation();
 }
 
 void Aura::RemoveInternal()
@@ -570,10 +663,11 @@ void Aura::RemoveInternal()
         }
     }
 
+    m_owner->game->journal.RecordValue(m_owner->game->auras);
     EraseIf(m_owner->game->auras, [this](IAura* aura) { return aura == this; });
 
     if (m_enchantmentCard != nullptr &&
-        m_enchantmentCard->power.GetTrigger() != nullptr)
+        m_enchantmentCard->GetPower().GetTrigger() != nullptr)
     {
         for (auto& entity : m_appliedEntities)
         {
@@ -589,7 +683,18 @@ void Aura::RemoveInternal()
 
 void Aura::RenewAll()
 {
+    // NOTE: The entities changed by renewing are regarded as changed, so that
+    // they are renewed again by the next update.
+    const std::uint64_t mutationCount =
+        m_owner->game->journal.GetMutationCount();
+
     auto Renew = [this](Playable* playable) {
+        // The condition of entity that is not changed can't be changed
+        if (!IsChanged(playable))
+        {
+            return;
+        }
+
         const auto iter = std::find(m_appliedEntities.begin(),
                                     m_appliedEntities.end(), playable);
 
@@ -635,5 +740,7 @@ void Aura::RenewAll()
             throw std::invalid_argument(
                 "Aura::RenewAll() - Invalid aura type!");
     }
+
+    m_lastUpdate = mutationCount;
 }
 }  // namespace RosettaStone
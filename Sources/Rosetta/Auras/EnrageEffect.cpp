@@ -22,16 +22,22 @@ void EnrageEffect::Activate(Playable* owner, [[maybe_unused]] bool cloning)
 {
     auto instance = new EnrageEffect(*this, *owner);
 
+    owner->game->journal.RecordValue(owner->game->auras);
     owner->game->auras.emplace_back(instance);
+    owner->game->journal.RecordPointer(owner->ongoingEffect);
     owner->ongoingEffect = instance;
 }
 
 void EnrageEffect::Update()
 {
+    SaveState();
+
     const auto minion = dynamic_cast<Minion*>(m_owner);
+    m_lastUpdate = m_owner->game->journal.GetMutationCount();
 
     if (!m_turnOn)
     {
+        m_owner->game->journal.RecordValue(m_owner->game->auras);
         EraseIf(m_owner->game->auras,
                 [this](IAura* aura) { return aura == this; });
 
@@ -53,7 +59,7 @@ void EnrageEffect::Update()
             }
         }
 
-        for (auto& effect : m_enchantmentCard->power.GetEnchant()->effects)
+        for (auto& effect : m_enchantmentCard->GetPower().GetEnchant()->effects)
         {
             effect->RemoveFrom(m_target);
         }
@@ -101,7 +107,7 @@ void EnrageEffect::Update()
             return;
         }
 
-        for (auto& effect : m_enchantmentCard->power.GetEnchant()->effects)
+        for (auto& effect : m_enchantmentCard->GetPower().GetEnchant()->effects)
         {
             effect->RemoveFrom(minion);
         }
@@ -115,11 +121,32 @@ void EnrageEffect::Update()
     }
 }
 
+bool EnrageEffect::IsUpToDate() const
+{
+    // NOTE: The enrage effect of weapon depends on the weapon of hero, so only
+    // the effect that depends on the damage of owner is skipped.
+    return m_turnOn && m_type == AuraType::SELF && !IsChanged(m_owner);
+}
+
 void EnrageEffect::Clone(Playable* clone)
 {
     Activate(clone, true);
 }
 
+void EnrageEffect::SaveState()
+{
+    Aura::SaveState();
+
+    m_owner->game->journal.RecordState(m_enrageEpoch, [this]() {
+        return [this, curInstance = m_curInstance, target = m_target,
+                enraged = m_enraged]() {
+            m_curInstance = curInstance;
+            m_target = target;
+            m_enraged = enraged;
+        };
+    });
+}
+
 EnrageEffect::EnrageEffect(EnrageEffect& prototype, Playable& owner)
     : Aura(prototype, owner)
 {
@@ -20,8 +20,11 @@ SummoningPortalAura::SummoningPortalAura()
 void SummoningPortalAura::Activate(Playable* owner, bool cloning)
 {
     auto instance = new SummoningPortalAura(*this, *owner);
+    owner->game->journal.RecordPointer(owner->ongoingEffect);
     owner->ongoingEffect = instance;
+    owner->game->journal.RecordValue(owner->player->GetHandZone()->auras);
     owner->player->GetHandZone()->auras.emplace_back(instance);
+    owner->game->journal.RecordValue(owner->game->auras);
     owner->game->auras.emplace_back(instance);
 
     if (!cloning)
@@ -33,6 +36,8 @@ void SummoningPortalAura::Activate(Playable* owner, bool cloning)
 
 void SummoningPortalAura::Update()
 {
+    SaveState();
+
     bool isAddAllProcessed = false;
 
     while (m_auraUpdateInstQueue.GetCount() > 0)
@@ -122,6 +127,7 @@ void SummoningPortalAura::AddAll()
 
 void SummoningPortalAura::RemoveAll()
 {
+    m_owner->game->journal.RecordValue(m_owner->game->auras);
     EraseIf(m_owner->game->auras, [this](IAura* aura) { return aura == this; });
 
     for (auto& entity : m_appliedEntities)
@@ -158,9 +164,9 @@ void SummoningPortalAura::CalculateCost(Playable* playable) const
 
     minion->SetCost(cost);
 
-    if (auto costManager = playable->costManager; costManager)
+    if (playable->costManager != nullptr)
     {
-        costManager->QueueUpdate();
+        playable->GetOrCreateCostManager()->QueueUpdate();
     }
 }
 }  // namespace RosettaStone
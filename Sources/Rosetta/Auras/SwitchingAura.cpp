@@ -33,24 +33,34 @@ void SwitchingAura::Activate(Playable* owner, bool cloning)
 
     AddToGame(*owner, *instance);
 
-    owner->game->triggerManager.startTurnTrigger += instance->m_onHandler;
-    owner->game->triggerManager.endTurnTrigger += instance->m_offHandler;
-
+    TriggerManager& triggerManager = owner->game->triggerManager;
     switch (m_offTrigger)
     {
         case TriggerType::PLAY_MINION:
-            owner->game->triggerManager.playMinionTrigger +=
-                instance->m_offHandler;
+            instance->m_offEvent = &triggerManager.playMinionTrigger;
             break;
         case TriggerType::CAST_SPELL:
-            owner->game->triggerManager.castSpellTrigger +=
-                instance->m_offHandler;
+            instance->m_offEvent = &triggerManager.castSpellTrigger;
             break;
         default:
             throw std::invalid_argument(
                 "SwitchingAura::Activate() - Invalid trigger type!");
     }
 
+    instance->m_onHandle =
+        triggerManager.startTurnTrigger.AddHandler(instance->m_onHandler);
+    instance->m_turnEndHandle =
+        triggerManager.endTurnTrigger.AddHandler(instance->m_offHandler);
+    instance->m_offHandle =
+        instance->m_offEvent->AddHandler(instance->m_offHandler);
+
+    if (owner->game->journal.IsRecording())
+    {
+        owner->game->journal.RecordUndo([instance]() {
+            instance->RemoveHandlers();
+        });
+    }
+
     if (!cloning)
     {
         if (!instance->m_initCondition.Evaluate(owner))
@@ -69,23 +79,27 @@ void SwitchingAura::Remove()
 {
     Aura::Remove();
 
-    m_isRemoved = true;
-
-    m_owner->game->triggerManager.startTurnTrigger -= m_onHandler;
-    m_owner->game->triggerManager.endTurnTrigger -= m_offHandler;
-
-    switch (m_offTrigger)
+    // NOTE: The handlers of removed aura are added again on rollback.
+    if (m_owner->game->journal.IsRecording())
     {
-        case TriggerType::PLAY_MINION:
-            m_owner->game->triggerManager.playMinionTrigger -= m_offHandler;
-            break;
-        case TriggerType::CAST_SPELL:
-            m_owner->game->triggerManager.castSpellTrigger -= m_offHandler;
-            break;
-        default:
-            throw std::invalid_argument(
-                "SwitchingAura::Activate() - Invalid trigger type!");
+        m_owner->game->journal.RecordUndo([this, isRemoved = m_isRemoved]() {
+            if (!isRemoved)
+            {
+                TriggerManager& triggerManager = m_owner->game->triggerManager;
+                m_onHandle = triggerManager.startTurnTrigger.AddHandler(
+                    m_onHandler);
+                m_turnEndHandle =
+                    triggerManager.endTurnTrigger.AddHandler(m_offHandler);
+                m_offHandle = m_offEvent->AddHandler(m_offHandler);
+            }
+
+            m_isRemoved = isRemoved;
+        });
     }
+
+    m_isRemoved = true;
+
+    RemoveHandlers();
 }
 
 void SwitchingAura::RemoveInternal()
@@ -102,11 +116,20 @@ void SwitchingAura::RemoveInternal()
 
     if (m_isRemoved)
     {
+        m_owner->game->journal.RecordValue(m_owner->game->auras);
         EraseIf(m_owner->game->auras,
                 [this](IAura* aura) { return aura == this; });
     }
 }
 
+void SwitchingAura::RemoveHandlers()
+{
+    TriggerManager& triggerManager = m_owner->game->triggerManager;
+    triggerManager.startTurnTrigger.RemoveHandler(m_onHandle);
+    triggerManager.endTurnTrigger.RemoveHandler(m_turnEndHandle);
+    m_offEvent->RemoveHandler(m_offHandle);
+}
+
 SwitchingAura::SwitchingAura(SwitchingAura& prototype, Playable& owner)
     : Aura(prototype, owner),
       m_initCondition(prototype.m_initCondition),
@@ -118,10 +141,12 @@ SwitchingAura::SwitchingAura(SwitchingAura& prototype, Playable& owner)
             return;
         }
 
+        SaveState();
         m_turnOn = true;
 
         m_auraUpdateInstQueue.Push(
             AuraUpdateInstruction(AuraInstruction::ADD_ALL), 1);
+        m_owner->game->journal.NotifyMutation();
     };
 
     auto offFunc = [this](Entity*) {
@@ -130,10 +155,12 @@ SwitchingAura::SwitchingAura(SwitchingAura& prototype, Playable& owner)
             return;
         }
 
+        SaveState();
         m_turnOn = false;
 
         m_auraUpdateInstQueue.Push(
             AuraUpdateInstruction(AuraInstruction::REMOVE_ALL), 0);
+        m_owner->game->journal.NotifyMutation();
     };
 
     m_onHandler = TriggerEventHandler(onFunc);
@@ -40,10 +40,6 @@
 #include <Rosetta/Zones/FieldZone.hpp>
 #include <Rosetta/Zones/SetasideZone.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 using namespace RosettaStone::SimpleTasks;
 
 namespace RosettaStone
@@ -258,7 +254,8 @@ void CoreCardsGen::AddHeroPowers(std::map<std::string, CardDef>& cards)
             return 0;
         }
 
-        const auto idx = Random::get<int>(0, totemCards.size() - 1);
+        const auto idx =
+            playable->game->random.Get<int>(0, totemCards.size() - 1);
         Playable* totem =
             Entity::GetFromCard(playable->player, totemCards[idx]);
         playable->player->GetFieldZone()->Add(dynamic_cast<Minion*>(totem));
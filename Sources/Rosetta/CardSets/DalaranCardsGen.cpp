@@ -839,8 +839,8 @@ void DalaranCardsGen::AddMage(std::map<std::string, CardDef>& cards)
                 return;
             }
 
-            std::map<GameTag, int> gameTags;
-            gameTags.emplace(GameTag::COPIED_BY_KHADGAR, 1);
+            GameTagStore gameTags;
+            gameTags.Set(GameTag::COPIED_BY_KHADGAR, 1);
 
             const auto entity = Entity::GetFromCard(
                 target->player, target->card, gameTags, player->GetFieldZone());
@@ -1112,7 +1112,8 @@ void DalaranCardsGen::AddPaladin(std::map<std::string, CardDef>& cards)
                 }
             }
 
-            const auto idx = Random::get<std::size_t>(0, secrets.size() - 1);
+            const auto idx =
+                player->game->random.Get<std::size_t>(0, secrets.size() - 1);
             Playable* playable = Entity::GetFromCard(player, secrets.at(idx));
             Generic::CastSpell(player, dynamic_cast<Spell*>(playable), nullptr,
                                0);
@@ -1349,7 +1350,8 @@ void DalaranCardsGen::AddPaladinNonCollect(
                 }
             }
 
-            const auto idx = Random::get<std::size_t>(0, secrets.size() - 1);
+            const auto idx =
+                player->game->random.Get<std::size_t>(0, secrets.size() - 1);
             Playable* playable = Entity::GetFromCard(player, secrets.at(idx));
             Generic::CastSpell(player, dynamic_cast<Spell*>(playable), nullptr,
                                0);
@@ -3153,8 +3155,8 @@ void DalaranCardsGen::AddNeutral(std::map<std::string, CardDef>& cards)
                 return;
             }
 
-            auto idx =
-                Random::get<std::size_t>(0, spellsPlayedThisTurn.size() - 1);
+            auto idx = player->game->random.Get<std::size_t>(
+                0, spellsPlayedThisTurn.size() - 1);
             Card* randSpellCard = spellsPlayedThisTurn[idx];
 
             if (!randSpellCard->IsPlayableByCardReq(player) ||
@@ -3175,7 +3177,8 @@ void DalaranCardsGen::AddNeutral(std::map<std::string, CardDef>& cards)
             }
             else
             {
-                idx = Random::get<std::size_t>(0, validTargets.size() - 1);
+                idx = player->game->random.Get<std::size_t>(
+                    0, validTargets.size() - 1);
                 randTarget = validTargets[idx];
             }
 
@@ -3186,13 +3189,13 @@ void DalaranCardsGen::AddNeutral(std::map<std::string, CardDef>& cards)
 
             Spell* spellToCast = dynamic_cast<Spell*>(
                 Entity::GetFromCard(player, randSpellCard));
-            const int randChooseOne = Random::get<int>(1, 2);
+            const int randChooseOne = player->game->random.Get<int>(1, 2);
 
             Generic::CastSpell(player, spellToCast, randTarget, randChooseOne);
 
             while (player->choice != nullptr)
             {
-                idx = Random::get<std::size_t>(
+                idx = player->game->random.Get<std::size_t>(
                     0, player->choice->choices.size() - 1);
                 Generic::ChoicePick(player, static_cast<int>(idx));
             }
@@ -72,10 +72,6 @@
 #include <Rosetta/Zones/HandZone.hpp>
 #include <Rosetta/Zones/SecretZone.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 using namespace RosettaStone::SimpleTasks;
 
 namespace RosettaStone
@@ -926,11 +922,11 @@ void DragonsCardsGen::AddHunter(std::map<std::string, CardDef>& cards)
                     return std::vector<Playable*>{};
                 }
 
-                auto pick = *Random::get(playables);
+                auto pick = *player->game->random.Get(playables);
 
                 // Remove it from deck zone
                 player->GetDeckZone()->Remove(pick);
-                if (auto trigger = pick->card->power.GetTrigger(); trigger)
+                if (auto trigger = pick->card->GetPower().GetTrigger(); trigger)
                 {
                     trigger->Activate(pick);
                 }
@@ -1311,7 +1307,8 @@ void DragonsCardsGen::AddMage(std::map<std::string, CardDef>& cards)
 
                     if (count == 2)
                     {
-                        const auto direction = Random::get<int>(0, 1);
+                        const auto direction =
+                            source->game->random.Get<int>(0, 1);
                         if (direction == 0)
                         {
                             continueFunc(fieldZone, realSource, left,
@@ -1906,8 +1903,8 @@ void DragonsCardsGen::AddPriest(std::map<std::string, CardDef>& cards)
                                       [[maybe_unused]] Entity* source,
                                       [[maybe_unused]] Playable* target) {
         auto cardsOpPlayedLastTurn = player->opponent->cardsPlayedThisTurn;
-        Random::shuffle(cardsOpPlayedLastTurn.begin(),
-                        cardsOpPlayedLastTurn.end());
+        player->game->random.Shuffle(cardsOpPlayedLastTurn.begin(),
+                                     cardsOpPlayedLastTurn.end());
 
         for (auto& card : cardsOpPlayedLastTurn)
         {
@@ -1917,11 +1914,11 @@ void DragonsCardsGen::AddPriest(std::map<std::string, CardDef>& cards)
                 continue;
             }
 
-            const auto targetIdx =
-                Random::get<std::size_t>(0, validTargets.size() - 1);
+            const auto targetIdx = player->game->random.Get<std::size_t>(
+                0, validTargets.size() - 1);
             const auto randTarget =
                 validTargets.empty() ? nullptr : validTargets[targetIdx];
-            const auto chooseOneIdx = Random::get<int>(1, 2);
+            const auto chooseOneIdx = player->game->random.Get<int>(1, 2);
 
             Entity* entity = Entity::GetFromCard(player, card);
 
@@ -1952,8 +1949,8 @@ void DragonsCardsGen::AddPriest(std::map<std::string, CardDef>& cards)
 
                     while (player->choice != nullptr)
                     {
-                        const auto choiceIdx =
-                            Random::get<int>(0, player->choice->choices.size());
+                        const auto choiceIdx = player->game->random.Get<int>(
+                            0, player->choice->choices.size());
                         Generic::ChoicePick(player, choiceIdx);
                     }
 
@@ -1964,12 +1961,12 @@ void DragonsCardsGen::AddPriest(std::map<std::string, CardDef>& cards)
                 {
                     auto weapon = dynamic_cast<Weapon*>(entity);
 
-                    if (auto aura = weapon->card->power.GetAura(); aura)
+                    if (auto aura = weapon->card->GetPower().GetAura(); aura)
                     {
                         aura->Activate(weapon);
                     }
 
-                    if (auto trigger = weapon->card->power.GetTrigger();
+                    if (auto trigger = weapon->card->GetPower().GetTrigger();
                         trigger)
                     {
                         trigger->Activate(weapon);
@@ -2128,8 +2125,8 @@ void DragonsCardsGen::AddPriest(std::map<std::string, CardDef>& cards)
             // For the one card in the opponent's hand:
             // The card being shown in the opponent's hand does not have
             // to be a card that started in the opponent's deck.
-            const auto idx =
-                Random::get<std::size_t>(0, opHandCards.size() - 1);
+            const auto idx = player->game->random.Get<std::size_t>(
+                0, opHandCards.size() - 1);
             result.emplace_back(opHandCards[idx]->card);
 
             // For the two cards not in the opponent's hand:
@@ -2180,18 +2177,20 @@ void DragonsCardsGen::AddPriest(std::map<std::string, CardDef>& cards)
             {
                 const auto startDeck =
                     player->game->GetPlayerDeck(player->opponent->playerType);
-                auto twoCards = ChooseNElements(startDeck, 2);
+                auto twoCards =
+                    ChooseNElements(startDeck, 2, player->game->random);
                 result.emplace_back(twoCards[0]);
                 result.emplace_back(twoCards[1]);
             }
             else
             {
-                auto twoCards = ChooseNElements(opDeckCards, 2);
+                auto twoCards =
+                    ChooseNElements(opDeckCards, 2, player->game->random);
                 result.emplace_back(twoCards[0]);
                 result.emplace_back(twoCards[1]);
             }
 
-            Random::shuffle(result.begin(), result.end());
+            player->game->random.Shuffle(result.begin(), result.end());
             Generic::CreateChoiceCards(player, source, ChoiceType::GENERAL,
                                        ChoiceAction::ENVOY_OF_LAZUL, result);
         }));
@@ -3320,7 +3319,8 @@ void DragonsCardsGen::AddWarrior(std::map<std::string, CardDef>& cards)
         [](Player* player, [[maybe_unused]] Entity* source,
            [[maybe_unused]] Playable* target) {
             auto enemyMinions = player->opponent->GetFieldZone()->GetAll();
-            Random::shuffle(enemyMinions.begin(), enemyMinions.end());
+            player->game->random.Shuffle(enemyMinions.begin(),
+                                         enemyMinions.end());
 
             auto& curField = *(player->GetFieldZone());
             const auto deathwing =
@@ -3610,8 +3610,8 @@ void DragonsCardsGen::AddNeutral(std::map<std::string, CardDef>& cards)
                     continue;
                 }
 
-                const auto idx =
-                    Random::get<std::size_t>(0, legendaryCards.size() - 1);
+                const auto idx = player->game->random.Get<std::size_t>(
+                    0, legendaryCards.size() - 1);
                 Generic::ChangeEntity(player, card, legendaryCards[idx], false);
             }
         }));
@@ -3969,9 +3969,12 @@ void DragonsCardsGen::AddNeutral(std::map<std::string, CardDef>& cards)
            [[maybe_unused]] Playable* target) {
             if (player->opponent->GetHero()->HasWeapon())
             {
+                GameJournal& journal = player->game->journal;
                 player->GetHero()->AddWeapon(
                     *player->opponent->GetHero()->weapon);
+                journal.RecordPointer(player->GetHero()->weapon->player);
                 player->GetHero()->weapon->player = player;
+                journal.RecordPointer(player->opponent->GetHero()->weapon);
                 player->opponent->GetHero()->weapon = nullptr;
             }
         }));
@@ -5,6 +5,7 @@
 // property of any third parties.
 
 #include <Rosetta/Cards/Card.hpp>
+#include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Commons/Constants.hpp>
 #include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Zones/FieldZone.hpp>
@@ -12,9 +13,227 @@
 #include <Rosetta/Zones/SecretZone.hpp>
 
 #include <iostream>
+#include <limits>
+#include <utility>
 
 namespace RosettaStone
 {
+namespace
+{
+//! Finds out if the card is in one of \p cardSets.
+//! \param cardSet The card set of the card.
+//! \param cardSets A list of card sets.
+//! \return true if the card is in one of \p cardSets, false otherwise.
+template <std::size_t N>
+bool IsInCardSets(CardSet cardSet, const std::array<CardSet, N>& cardSets)
+{
+    for (auto& set : cardSets)
+    {
+        if (cardSet == set)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//! Finds out if the play requirement is met.
+//! \param card The card to play.
+//! \param player The player of the card.
+//! \param req The play requirement.
+//! \param value The value of the play requirement.
+//! \return true if the play requirement is met, false otherwise.
+bool IsPlayReqMet(const Card& card, Player* player, PlayReq req, int value)
+{
+    switch (req)
+    {
+        case PlayReq::REQ_NUM_MINION_SLOTS:
+            if (player->GetFieldZone()->IsFull())
+            {
+                return false;
+            }
+            break;
+        case PlayReq::REQ_WEAPON_EQUIPPED:
+            if (!player->GetHero()->HasWeapon())
+            {
+                return false;
+            }
+            break;
+        case PlayReq::REQ_MINIMUM_ENEMY_MINIONS:
+        {
+            const auto opField = player->opponent->GetFieldZone();
+            if (opField->GetCount() < value)
+            {
+                return false;
+            }
+            break;
+        }
+        case PlayReq::REQ_ENTIRE_ENTOURAGE_NOT_IN_PLAY:
+        {
+            auto curField = player->GetFieldZone();
+            std::size_t entourageCount = 0;
+
+            for (auto& entourage : card.entourages)
+            {
+                const CardHandle handle = Cards::GetHandle(entourage);
+
+                for (auto& minion : curField->GetAll())
+                {
+                    if (minion->card->IsCard(handle, entourage))
+                    {
+                        ++entourageCount;
+                    }
+                }
+            }
+
+            if (entourageCount == card.entourages.size())
+            {
+                return false;
+            }
+
+            break;
+        }
+        case PlayReq::REQ_MINIMUM_TOTAL_MINIONS:
+        {
+            const int fieldCount =
+                player->GetFieldZone()->GetCount() +
+                player->opponent->GetFieldZone()->GetCount();
+            if (fieldCount < value)
+            {
+                return false;
+            }
+            break;
+        }
+        case PlayReq::REQ_FRIENDLY_MINION_DIED_THIS_GAME:
+        {
+            bool isExist = false;
+            for (auto& playable : player->GetGraveyardZone()->GetAll())
+            {
+                if (const auto minion = dynamic_cast<Minion*>(playable);
+                    minion && minion->isDestroyed)
+                {
+                    isExist = true;
+                    break;
+                }
+            }
+
+            if (!isExist)
+            {
+                return false;
+            }
+            break;
+        }
+        case PlayReq::REQ_SECRET_ZONE_CAP_FOR_NON_SECRET:
+        {
+            if (player->GetSecretZone()->IsFull())
+            {
+                return false;
+            }
+            break;
+        }
+        case PlayReq::REQ_FRIENDLY_DEATHRATTLE_MINION_DIED_THIS_GAME:
+        {
+            bool isExist = false;
+
+            for (auto& playable : player->GetGraveyardZone()->GetAll())
+            {
+                if (playable->card->GetCardType() == CardType::MINION &&
+                    playable->HasDeathrattle() == true &&
+                    playable->isDestroyed)
+                {
+                    isExist = true;
+                    break;
+                }
+            }
+
+            if (!isExist)
+            {
+                return false;
+            }
+            break;
+        }
+        case PlayReq::REQ_MINION_TARGET:
+        case PlayReq::REQ_ENEMY_TARGET:
+        case PlayReq::REQ_NONSELF_TARGET:
+            break;
+        default:
+            break;
+    }
+
+    return true;
+}
+
+//! Returns the masks of the characters that \p targetingType can target.
+//! \param targetingType The targeting type of the card.
+//! \return The masks of the friendly and the enemy characters.
+std::pair<SideMask, SideMask> GetTargetingTypeMasks(
+    TargetingType targetingType)
+{
+    constexpr SideMask HERO = 1 << HERO_BIT;
+
+    switch (targetingType)
+    {
+        case TargetingType::NONE:
+            return { 0, 0 };
+        case TargetingType::ALL:
+            return { ALL_CHARACTER_BITS, ALL_CHARACTER_BITS };
+        case TargetingType::CHARACTERS_EXCEPT_HERO:
+            return { MINION_BITS, ALL_CHARACTER_BITS };
+        case TargetingType::FRIENDLY_CHARACTERS:
+            return { ALL_CHARACTER_BITS, 0 };
+        case TargetingType::ENEMY_CHARACTERS:
+            return { 0, ALL_CHARACTER_BITS };
+        case TargetingType::ALL_MINIONS:
+            return { MINION_BITS, MINION_BITS };
+        case TargetingType::FRIENDLY_MINIONS:
+            return { MINION_BITS, 0 };
+        case TargetingType::ENEMY_MINIONS:
+            return { 0, MINION_BITS };
+        case TargetingType::HEROES:
+            return { HERO, HERO };
+    }
+
+    return { 0, 0 };
+}
+
+//! Clears the bits of the characters in \p mask that don't satisfy all of
+//! \p predicates.
+//! \param predicates The targeting predicates of the card.
+//! \param owner The player that owns the characters.
+//! \param mask The mask of the characters of \p owner.
+//! \return The mask of the characters that satisfy all of \p predicates.
+SideMask FilterByPredicates(const std::vector<TargetingPredicate>& predicates,
+                            Player* owner, SideMask mask)
+{
+    SideMask result = mask;
+
+    for (int bit = 0; bit <= HERO_BIT; ++bit)
+    {
+        if (!(mask & (1 << bit)))
+        {
+            continue;
+        }
+
+        Character* character =
+            bit == HERO_BIT
+                ? static_cast<Character*>(owner->GetHero())
+                : static_cast<Character*>((*owner->GetFieldZone())[bit]);
+
+        for (auto& predicate : predicates)
+        {
+            if (!predicate(character))
+            {
+                result &= static_cast<SideMask>(~(1 << bit));
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+}  // namespace
+
 void Card::Initialize()
 {
     maxAllowedInDeck = (GetRarity() == Rarity::LEGENDARY) ? 1 : 2;
@@ -143,53 +362,80 @@ void Card::Initialize()
     }
 }
 
-CardClass Card::GetCardClass() const
-{
-    return static_cast<CardClass>(gameTags.at(GameTag::CLASS));
-}
-
-CardSet Card::GetCardSet() const
-{
-    return static_cast<CardSet>(gameTags.at(GameTag::CARD_SET));
-}
-
-CardType Card::GetCardType() const
+CardHotData Card::MakeHotData() const
 {
-    return static_cast<CardType>(gameTags.at(GameTag::CARDTYPE));
-}
-
-Faction Card::GetFaction() const
-{
-    return static_cast<Faction>(gameTags.at(GameTag::FACTION));
-}
+    CardHotData data;
+    data.cost = GetCost();
+    data.cardClass = GetCardClass();
+    data.cardSet = GetCardSet();
+    data.cardType = GetCardType();
+    data.faction = GetFaction();
+    data.race = GetRace();
+    data.rarity = GetRarity();
+    data.targetingType = targetingType;
+    data.maxAllowedInDeck = static_cast<std::uint8_t>(maxAllowedInDeck);
+
+    const std::pair<bool, CardHotData::Flag> flags[] = {
+        { IsCollectible(), CardHotData::COLLECTIBLE },
+        { IsUntouchable(), CardHotData::UNTOUCHABLE },
+        { IsSecret(), CardHotData::SECRET },
+        { IsQuest(), CardHotData::QUEST },
+        { IsLackey(), CardHotData::LACKEY },
+        { IsGalakrond(), CardHotData::GALAKROND },
+        { IsStandardSet(), CardHotData::STANDARD_SET },
+        { IsWildSet(), CardHotData::WILD_SET },
+        { mustHaveToTargetToPlay, CardHotData::MUST_HAVE_TARGET_TO_PLAY },
+    };
+
+    for (const auto& [hasFlag, flag] : flags)
+    {
+        if (hasFlag)
+        {
+            data.flags |= flag;
+        }
+    }
 
-Race Card::GetRace() const
-{
-    return static_cast<Race>(gameTags.at(GameTag::CARDRACE));
-}
+    for (const auto& [req, value] : playRequirements)
+    {
+        if (data.numPlayReqs == CardHotData::MAX_PLAY_REQS ||
+            value < std::numeric_limits<std::int16_t>::min() ||
+            value > std::numeric_limits<std::int16_t>::max())
+        {
+            data.flags |= CardHotData::PLAY_REQS_OVERFLOW;
+            data.numPlayReqs = 0;
+            break;
+        }
 
-Rarity Card::GetRarity() const
-{
-    return static_cast<Rarity>(gameTags.at(GameTag::RARITY));
-}
+        data.playReqs[data.numPlayReqs] = static_cast<std::uint8_t>(req);
+        data.playReqValues[data.numPlayReqs] = static_cast<std::int16_t>(value);
+        ++data.numPlayReqs;
+    }
 
-int Card::GetCost() const
-{
-    return gameTags.at(GameTag::COST);
+    return data;
 }
 
 bool Card::HasGameTag(GameTag gameTag) const
 {
-    return gameTags.find(gameTag) != gameTags.end();
+    return gameTags.Contains(gameTag);
 }
 
 bool Card::IsQuest() const
 {
+    if (hotData != nullptr)
+    {
+        return hotData->HasFlag(CardHotData::QUEST);
+    }
+
     return HasGameTag(GameTag::QUEST);
 }
 
 bool Card::IsLackey() const
 {
+    if (hotData != nullptr)
+    {
+        return hotData->HasFlag(CardHotData::LACKEY);
+    }
+
     if (id == "DAL_613" ||  // DAL_613: Faceless Lackey
         id == "DAL_614" ||  // DAL_614: Kobold Lackey
         id == "DAL_615" ||  // DAL_615: Witchy Lackey
@@ -206,6 +452,11 @@ bool Card::IsLackey() const
 
 bool Card::IsGalakrond() const
 {
+    if (hotData != nullptr)
+    {
+        return hotData->HasFlag(CardHotData::GALAKROND);
+    }
+
     // NOTE: Galakrond hero card list
     // DRG_600: Galakrond, the Wretched
     // DRG_610: Galakrond, the Nightmare
@@ -224,47 +475,24 @@ bool Card::IsGalakrond() const
     return false;
 }
 
-bool Card::IsUntouchable() const
-{
-    return HasGameTag(GameTag::UNTOUCHABLE) &&
-           static_cast<bool>(gameTags.at(GameTag::UNTOUCHABLE));
-}
-
-bool Card::IsSecret() const
-{
-    return HasGameTag(GameTag::SECRET) &&
-           static_cast<bool>(gameTags.at(GameTag::SECRET));
-}
-
-bool Card::IsCollectible() const
-{
-    return static_cast<bool>(gameTags.at(GameTag::COLLECTIBLE));
-}
-
 bool Card::IsStandardSet() const
 {
-    for (auto& cardSet : STANDARD_CARD_SETS)
+    if (hotData != nullptr)
     {
-        if (GetCardSet() == cardSet)
-        {
-            return true;
-        }
+        return hotData->HasFlag(CardHotData::STANDARD_SET);
     }
 
-    return false;
+    return IsInCardSets(GetCardSet(), STANDARD_CARD_SETS);
 }
 
 bool Card::IsWildSet() const
 {
-    for (auto& cardSet : WILD_CARD_SETS)
+    if (hotData != nullptr)
     {
-        if (GetCardSet() == cardSet)
-        {
-            return true;
-        }
+        return hotData->HasFlag(CardHotData::WILD_SET);
     }
 
-    return false;
+    return IsInCardSets(GetCardSet(), WILD_CARD_SETS);
 }
 
 std::size_t Card::GetMaxAllowedInDeck() const
@@ -274,119 +502,27 @@ std::size_t Card::GetMaxAllowedInDeck() const
 
 bool Card::IsPlayableByCardReq(Player* player) const
 {
-    for (auto& requirement : playRequirements)
+    if (hotData != nullptr &&
+        !hotData->HasFlag(CardHotData::PLAY_REQS_OVERFLOW))
     {
-        switch (requirement.first)
+        for (std::size_t i = 0; i < hotData->numPlayReqs; ++i)
         {
-            case PlayReq::REQ_NUM_MINION_SLOTS:
-                if (player->GetFieldZone()->IsFull())
-                {
-                    return false;
-                }
-                break;
-            case PlayReq::REQ_WEAPON_EQUIPPED:
-                if (!player->GetHero()->HasWeapon())
-                {
-                    return false;
-                }
-                break;
-            case PlayReq::REQ_MINIMUM_ENEMY_MINIONS:
+            if (!IsPlayReqMet(*this, player,
+                              static_cast<PlayReq>(hotData->playReqs[i]),
+                              hotData->playReqValues[i]))
             {
-                const auto opField = player->opponent->GetFieldZone();
-                if (opField->GetCount() < requirement.second)
-                {
-                    return false;
-                }
-                break;
-            }
-            case PlayReq::REQ_ENTIRE_ENTOURAGE_NOT_IN_PLAY:
-            {
-                auto curField = player->GetFieldZone();
-                std::size_t entourageCount = 0;
-
-                for (auto& minion : curField->GetAll())
-                {
-                    for (auto& entourage : entourages)
-                    {
-                        if (minion->card->id == entourage)
-                        {
-                            ++entourageCount;
-                        }
-                    }
-                }
-
-                if (entourageCount == entourages.size())
-                {
-                    return false;
-                }
-
-                break;
-            }
-            case PlayReq::REQ_MINIMUM_TOTAL_MINIONS:
-            {
-                const int fieldCount =
-                    player->GetFieldZone()->GetCount() +
-                    player->opponent->GetFieldZone()->GetCount();
-                if (fieldCount < requirement.second)
-                {
-                    return false;
-                }
-                break;
-            }
-            case PlayReq::REQ_FRIENDLY_MINION_DIED_THIS_GAME:
-            {
-                bool isExist = false;
-                for (auto& playable : player->GetGraveyardZone()->GetAll())
-                {
-                    if (const auto minion = dynamic_cast<Minion*>(playable);
-                        minion && minion->isDestroyed)
-                    {
-                        isExist = true;
-                        break;
-                    }
-                }
-
-                if (!isExist)
-                {
-                    return false;
-                }
-                break;
-            }
-            case PlayReq::REQ_SECRET_ZONE_CAP_FOR_NON_SECRET:
-            {
-                if (player->GetSecretZone()->IsFull())
-                {
-                    return false;
-                }
-                break;
+                return false;
             }
-            case PlayReq::REQ_FRIENDLY_DEATHRATTLE_MINION_DIED_THIS_GAME:
-            {
-                bool isExist = false;
+        }
 
-                for (auto& playable : player->GetGraveyardZone()->GetAll())
-                {
-                    if (playable->card->GetCardType() == CardType::MINION &&
-                        playable->HasDeathrattle() == true &&
-                        playable->isDestroyed)
-                    {
-                        isExist = true;
-                        break;
-                    }
-                }
+        return true;
+    }
 
-                if (!isExist)
-                {
-                    return false;
-                }
-                break;    
-            }
-            case PlayReq::REQ_MINION_TARGET:
-            case PlayReq::REQ_ENEMY_TARGET:
-            case PlayReq::REQ_NONSELF_TARGET:
-                break;
-            default:
-                break;
+    for (auto& requirement : playRequirements)
+    {
+        if (!IsPlayReqMet(*this, player, requirement.first, requirement.second))
+        {
+            return false;
         }
     }
 
@@ -422,101 +558,51 @@ bool Card::TargetingRequirements(Player* player, Character* target)
 
 std::vector<Character*> Card::GetValidPlayTargets(Player* player)
 {
-    std::vector<Character*> ret;
+    return GetValidPlayTargetMask(player).GetCharacters(player);
+}
 
-    if (!targetingAvailabilityPredicate.empty())
+TargetMask Card::GetValidPlayTargetMask(Player* player)
+{
+    if (targetingType == TargetingType::NONE)
     {
-        for (auto& predicate : targetingAvailabilityPredicate)
-        {
-            if (!predicate(player, this))
-            {
-                return ret;
-            }
-        }
+        return TargetMask();
     }
 
-    bool friendlyMinions = false, enemyMinions = false;
-    bool hero = false, enemyHero = false;
-
-    switch (targetingType)
-    {
-        case TargetingType::NONE:
-            // If this is a non-targeting card, return an empty list
-            return ret;
-        case TargetingType::ALL:
-            friendlyMinions = true;
-            enemyMinions = true;
-            hero = true;
-            enemyHero = true;
-            break;
-        case TargetingType::CHARACTERS_EXCEPT_HERO:
-            friendlyMinions = true;
-            enemyMinions = true;
-            enemyHero = true;
-            break;
-        case TargetingType::FRIENDLY_CHARACTERS:
-            friendlyMinions = true;
-            hero = true;
-            break;
-        case TargetingType::ENEMY_CHARACTERS:
-            enemyMinions = true;
-            enemyHero = true;
-            break;
-        case TargetingType::ALL_MINIONS:
-            friendlyMinions = true;
-            enemyMinions = true;
-            break;
-        case TargetingType::FRIENDLY_MINIONS:
-            friendlyMinions = true;
-            break;
-        case TargetingType::ENEMY_MINIONS:
-            enemyMinions = true;
-            break;
-        case TargetingType::HEROES:
-            hero = true;
-            enemyHero = true;
-            break;
-    }
+    return GetValidPlayTargetMask(player, CharacterMasks::Build(player),
+                                  CharacterMasks::Build(player->opponent));
+}
 
-    if (friendlyMinions)
+TargetMask Card::GetValidPlayTargetMask(Player* player,
+                                        const CharacterMasks& friendly,
+                                        const CharacterMasks& enemy)
+{
+    if (!targetingAvailabilityPredicate.empty())
     {
-        for (auto& minion : player->GetFieldZone()->GetAll())
+        for (auto& predicate : targetingAvailabilityPredicate)
         {
-            if (TargetingRequirements(player, minion))
+            if (!predicate(player, this))
             {
-                ret.emplace_back(minion);
+                return TargetMask();
             }
         }
     }
 
-    if (enemyMinions)
-    {
-        for (auto& minion : player->opponent->GetFieldZone()->GetAll())
-        {
-            if (TargetingRequirements(player, minion))
-            {
-                ret.emplace_back(minion);
-            }
-        }
-    }
+    auto [friendlyMask, enemyMask] = GetTargetingTypeMasks(targetingType);
 
-    if (hero)
-    {
-        if (TargetingRequirements(player, player->GetHero()))
-        {
-            ret.emplace_back(player->GetHero());
-        }
-    }
+    // Same as TargetingRequirements(), as bitwise operations
+    friendlyMask &= friendly.occupied & ~friendly.untouchable;
+    enemyMask &= enemy.occupied & ~enemy.untouchable & ~enemy.stealth &
+                 ~enemy.immune;
 
-    if (enemyHero)
+    if (!targetingPredicate.empty())
     {
-        if (TargetingRequirements(player, player->opponent->GetHero()))
-        {
-            ret.emplace_back(player->opponent->GetHero());
-        }
+        friendlyMask = FilterByPredicates(targetingPredicate, player,
+                                          friendlyMask);
+        enemyMask = FilterByPredicates(targetingPredicate, player->opponent,
+                                       enemyMask);
     }
 
-    return ret;
+    return TargetMask(friendlyMask, enemyMask);
 }
 
 void Card::ShowBriefInfo() const
@@ -0,0 +1,139 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Cards/CardBitset.hpp>
+
+#include <algorithm>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace RosettaStone
+{
+namespace
+{
+//! Returns the number of bits that are 1 in \p word.
+//! \param word The word to count.
+//! \return The number of bits that are 1 in \p word.
+std::size_t PopCount(std::uint64_t word)
+{
+#if defined(_MSC_VER)
+    return static_cast<std::size_t>(__popcnt64(word));
+#else
+    return static_cast<std::size_t>(__builtin_popcountll(word));
+#endif
+}
+}  // namespace
+
+CardBitset::CardBitset(std::size_t size)
+    : m_words((size + WORD_BITS - 1) / WORD_BITS, 0), m_size(size)
+{
+    // Do nothing
+}
+
+std::size_t CardBitset::GetSize() const
+{
+    return m_size;
+}
+
+void CardBitset::Set(std::size_t idx)
+{
+    m_words[idx / WORD_BITS] |= std::uint64_t{ 1 } << (idx % WORD_BITS);
+}
+
+void CardBitset::Reset(std::size_t idx)
+{
+    m_words[idx / WORD_BITS] &= ~(std::uint64_t{ 1 } << (idx % WORD_BITS));
+}
+
+bool CardBitset::Test(std::size_t idx) const
+{
+    if (idx >= m_size)
+    {
+        return false;
+    }
+
+    return (m_words[idx / WORD_BITS] >> (idx % WORD_BITS)) & 1;
+}
+
+std::size_t CardBitset::Count() const
+{
+    std::size_t count = 0;
+
+    for (const auto word : m_words)
+    {
+        count += PopCount(word);
+    }
+
+    return count;
+}
+
+std::size_t CardBitset::FindNth(std::size_t n) const
+{
+    for (std::size_t i = 0; i < m_words.size(); ++i)
+    {
+        std::uint64_t word = m_words[i];
+        const std::size_t count = PopCount(word);
+
+        if (n >= count)
+        {
+            n -= count;
+            continue;
+        }
+
+        for (; n > 0; --n)
+        {
+            word &= word - 1;
+        }
+
+        return i * WORD_BITS + CountTrailingZeros(word);
+    }
+
+    return m_size;
+}
+
+CardBitset& CardBitset::operator&=(const CardBitset& rhs)
+{
+    const std::size_t size = std::min(m_words.size(), rhs.m_words.size());
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        m_words[i] &= rhs.m_words[i];
+    }
+
+    std::fill(m_words.begin() + size, m_words.end(), 0);
+
+    return *this;
+}
+
+CardBitset& CardBitset::operator|=(const CardBitset& rhs)
+{
+    if (m_words.size() < rhs.m_words.size())
+    {
+        m_words.resize(rhs.m_words.size(), 0);
+        m_size = rhs.m_size;
+    }
+
+    for (std::size_t i = 0; i < rhs.m_words.size(); ++i)
+    {
+        m_words[i] |= rhs.m_words[i];
+    }
+
+    return *this;
+}
+
+std::size_t CardBitset::CountTrailingZeros(std::uint64_t word)
+{
+#if defined(_MSC_VER)
+    unsigned long idx = 0;
+    _BitScanForward64(&idx, word);
+    return static_cast<std::size_t>(idx);
+#else
+    return static_cast<std::size_t>(__builtin_ctzll(word));
+#endif
+}
+}  // namespace RosettaStone
@@ -48,16 +48,9 @@ CardDefs& CardDefs::GetInstance()
     return instance;
 }
 
-CardDef CardDefs::FindCardDefByCardID(const std::string_view& cardID)
+const CardDef* CardDefs::FindCardDefByCardID(const std::string_view& cardID)
 {
-    for (auto& data : m_data)
-    {
-        if (data.first == cardID)
-        {
-            return data.second;
-        }
-    }
-
-    return CardDef();
+    const auto iter = m_data.find(std::string(cardID));
+    return iter != m_data.end() ? &iter->second : nullptr;
 }
 }  // namespace RosettaStone
@@ -0,0 +1,141 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Cards/CardQuery.hpp>
+
+#include <algorithm>
+
+namespace RosettaStone
+{
+namespace
+{
+//! Returns the bitset of \p key, or an empty bitset if no cards have it.
+//! \param bits The list of bitsets that is indexed by key.
+//! \param key The key of the cards.
+//! \return The bitset of \p key.
+const CardBitset& GetBits(const std::vector<CardBitset>& bits, int key)
+{
+    static const CardBitset emptyBits;
+
+    if (key < 0 || static_cast<std::size_t>(key) >= bits.size())
+    {
+        return emptyBits;
+    }
+
+    return bits[key];
+}
+}  // namespace
+
+CardQuery::CardQuery() : m_baseBits(&Cards::m_allCardBits)
+{
+    // Do nothing
+}
+
+CardQuery::CardQuery(FormatType format)
+    : m_baseBits(format == FormatType::STANDARD ? &Cards::m_standardCardBits
+                                                : &Cards::m_wildCardBits)
+{
+    // Do nothing
+}
+
+CardQuery& CardQuery::WithClass(CardClass cardClass)
+{
+    GetOwnedBits() &= GetBits(Cards::m_classBits, static_cast<int>(cardClass));
+    return *this;
+}
+
+CardQuery& CardQuery::WithType(CardType cardType)
+{
+    GetOwnedBits() &= GetBits(Cards::m_typeBits, static_cast<int>(cardType));
+    return *this;
+}
+
+CardQuery& CardQuery::WithRace(Race race)
+{
+    GetOwnedBits() &= GetBits(Cards::m_raceBits, static_cast<int>(race));
+    return *this;
+}
+
+CardQuery& CardQuery::WithRarity(Rarity rarity)
+{
+    GetOwnedBits() &= GetBits(Cards::m_rarityBits, static_cast<int>(rarity));
+    return *this;
+}
+
+CardQuery& CardQuery::WithCost(int cost)
+{
+    GetOwnedBits() &= GetBits(Cards::m_costBits, cost);
+    return *this;
+}
+
+CardQuery& CardQuery::WithCost(int minVal, int maxVal)
+{
+    const int maxCost = static_cast<int>(Cards::m_costBits.size()) - 1;
+
+    CardBitset costBits;
+    for (int cost = std::max(minVal, 0); cost <= std::min(maxVal, maxCost);
+         ++cost)
+    {
+        costBits |= Cards::m_costBits[cost];
+    }
+
+    GetOwnedBits() &= costBits;
+    return *this;
+}
+
+std::size_t CardQuery::GetCount() const
+{
+    return GetMatchedBits().Count();
+}
+
+bool CardQuery::IsEmpty() const
+{
+    return GetCount() == 0;
+}
+
+Card* CardQuery::GetNth(std::size_t n) const
+{
+    const CardBitset& bits = GetMatchedBits();
+
+    const std::size_t idx = bits.FindNth(n);
+    if (idx >= bits.GetSize())
+    {
+        return nullptr;
+    }
+
+    return Cards::GetAllCards()[idx];
+}
+
+std::vector<Card*> CardQuery::GetCards() const
+{
+    const auto& cards = Cards::GetAllCards();
+
+    const CardBitset& bits = GetMatchedBits();
+
+    std::vector<Card*> result;
+    result.reserve(bits.Count());
+
+    bits.ForEach([&](std::size_t idx) { result.emplace_back(cards[idx]); });
+
+    return result;
+}
+
+const CardBitset& CardQuery::GetMatchedBits() const
+{
+    return m_baseBits != nullptr ? *m_baseBits : m_bits;
+}
+
+CardBitset& CardQuery::GetOwnedBits()
+{
+    if (m_baseBits != nullptr)
+    {
+        m_bits = *m_baseBits;
+        m_baseBits = nullptr;
+    }
+
+    return m_bits;
+}
+}  // namespace RosettaStone
@@ -5,6 +5,7 @@
 // property of any third parties.
 
 #include <Rosetta/Cards/Card.hpp>
+#include <Rosetta/Cards/CardQuery.hpp>
 #include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Commons/Constants.hpp>
 #include <Rosetta/Loaders/CardLoader.hpp>
@@ -15,22 +16,84 @@ namespace RosettaStone
 Card emptyCard;
 
 std::vector<Card*> Cards::m_cards;
+std::vector<CardHotData> Cards::m_hotData;
 std::array<std::vector<Card*>, NUM_PLAYER_CLASS> Cards::m_standardCards;
 std::array<std::vector<Card*>, NUM_PLAYER_CLASS> Cards::m_wildCards;
 std::vector<Card*> Cards::m_allStandardCards;
 std::vector<Card*> Cards::m_allWildCards;
 std::vector<Card*> Cards::m_lackeys;
 
+std::unordered_map<std::string_view, Card*> Cards::m_cardsByID;
+std::unordered_map<int, Card*> Cards::m_cardsByDbfID;
+std::unordered_map<std::string_view, Card*> Cards::m_cardsByName;
+
+CardBitset Cards::m_allCardBits;
+CardBitset Cards::m_standardCardBits;
+CardBitset Cards::m_wildCardBits;
+std::vector<CardBitset> Cards::m_classBits;
+std::vector<CardBitset> Cards::m_typeBits;
+std::vector<CardBitset> Cards::m_raceBits;
+std::vector<CardBitset> Cards::m_rarityBits;
+std::vector<CardBitset> Cards::m_costBits;
+
+namespace
+{
+//! Sets the bit of card \p idx in the bitset of \p key, adding the bitsets
+//! up to \p key if they don't exist.
+//! \param bits The list of bitsets that is indexed by key.
+//! \param key The key of the card, e.g. the value of its race.
+//! \param numCards The number of all cards.
+//! \param idx The ordinal of the card.
+void AddToIndex(std::vector<CardBitset>& bits, int key, std::size_t numCards,
+                std::size_t idx)
+{
+    const auto pos = static_cast<std::size_t>(key < 0 ? 0 : key);
+    if (pos >= bits.size())
+    {
+        bits.resize(pos + 1, CardBitset(numCards));
+    }
+
+    bits[pos].Set(idx);
+}
+}  // namespace
+
 Cards::Cards()
 {
     m_cards.reserve(NUM_ALL_CARDS);
 
     CardLoader::Load(m_cards);
+
+    // NOTE: The powers of cards look up cards by ID and handle while they
+    // are loaded, so the handles and the hash maps must be built before
+    // loading them.
+    for (std::size_t i = 0; i < m_cards.size(); ++i)
+    {
+        Card* card = m_cards[i];
+        card->handle = CardHandle(static_cast<std::uint32_t>(i));
+
+        m_cardsByID.emplace(card->id, card);
+        m_cardsByDbfID.emplace(card->dbfID, card);
+
+        if (card->IsCollectible())
+        {
+            m_cardsByName.emplace(card->name, card);
+        }
+    }
+
     InternalCardLoader::Load(m_cards);
 
+    m_hotData.reserve(m_cards.size());
+
     for (Card* card : m_cards)
     {
         card->Initialize();
+        m_hotData.emplace_back(card->MakeHotData());
+    }
+
+    // NOTE: The hot data must not be reallocated after the cards point to it.
+    for (std::size_t i = 0; i < m_cards.size(); ++i)
+    {
+        m_cards[i]->hotData = &m_hotData[i];
     }
 
     for (Card* card : m_cards)
@@ -66,6 +129,40 @@ Cards::Cards()
             m_lackeys.emplace_back(card);
         }
     }
+
+    const std::size_t numCards = m_cards.size();
+    m_allCardBits = CardBitset(numCards);
+    m_standardCardBits = CardBitset(numCards);
+    m_wildCardBits = CardBitset(numCards);
+
+    for (std::size_t i = 0; i < numCards; ++i)
+    {
+        const Card* card = m_cards[i];
+
+        m_allCardBits.Set(i);
+
+        if (card->IsCollectible() && card->GetCardType() != CardType::HERO)
+        {
+            if (card->IsStandardSet())
+            {
+                m_standardCardBits.Set(i);
+            }
+
+            if (card->IsWildSet())
+            {
+                m_wildCardBits.Set(i);
+            }
+        }
+
+        AddToIndex(m_classBits, static_cast<int>(card->GetCardClass()),
+                   numCards, i);
+        AddToIndex(m_typeBits, static_cast<int>(card->GetCardType()), numCards,
+                   i);
+        AddToIndex(m_raceBits, static_cast<int>(card->GetRace()), numCards, i);
+        AddToIndex(m_rarityBits, static_cast<int>(card->GetRarity()), numCards,
+                   i);
+        AddToIndex(m_costBits, card->gameTags.Get(GameTag::COST), numCards, i);
+    }
 }
 
 Cards::~Cards()
@@ -89,6 +186,11 @@ const std::vector<Card*>& Cards::GetAllCards()
     return m_cards;
 }
 
+const std::vector<CardHotData>& Cards::GetAllHotData()
+{
+    return m_hotData;
+}
+
 const std::vector<Card*>& Cards::GetStandardCards(CardClass cardClass)
 {
     // NOTE: Subtract 2 because of CardClass::DRUID = 2
@@ -118,58 +220,35 @@ std::vector<Card*> Cards::GetLackeys()
 
 Card* Cards::FindCardByID(const std::string_view& id)
 {
-    for (Card* card : m_cards)
-    {
-        if (card->id == id)
-        {
-            return card;
-        }
-    }
-
-    return &emptyCard;
+    const auto iter = m_cardsByID.find(id);
+    return iter != m_cardsByID.end() ? iter->second : &emptyCard;
 }
 
 Card* Cards::FindCardByDbfID(int dbfID)
 {
-    for (Card* card : m_cards)
-    {
-        if (card->dbfID == dbfID)
-        {
-            return card;
-        }
-    }
-
-    return &emptyCard;
+    const auto iter = m_cardsByDbfID.find(dbfID);
+    return iter != m_cardsByDbfID.end() ? iter->second : &emptyCard;
 }
 
-std::vector<Card*> Cards::FindCardByRarity(Rarity rarity)
+Card* Cards::FindCardByHandle(CardHandle handle)
 {
-    std::vector<Card*> result;
+    return handle.GetOrdinal() < m_cards.size() ? m_cards[handle.GetOrdinal()]
+                                                : &emptyCard;
+}
 
-    for (Card* card : m_cards)
-    {
-        if (card->GetRarity() == rarity)
-        {
-            result.emplace_back(card);
-        }
-    }
+CardHandle Cards::GetHandle(const std::string_view& id)
+{
+    return FindCardByID(id)->handle;
+}
 
-    return result;
+std::vector<Card*> Cards::FindCardByRarity(Rarity rarity)
+{
+    return CardQuery().WithRarity(rarity).GetCards();
 }
 
 std::vector<Card*> Cards::FindCardByClass(CardClass cardClass)
 {
-    std::vector<Card*> result;
-
-    for (Card* card : m_cards)
-    {
-        if (card->GetCardClass() == cardClass)
-        {
-            result.emplace_back(card);
-        }
-    }
-
-    return result;
+    return CardQuery().WithClass(cardClass).GetCards();
 }
 
 std::vector<Card*> Cards::FindCardBySet(CardSet cardSet)
@@ -189,61 +268,23 @@ std::vector<Card*> Cards::FindCardBySet(CardSet cardSet)
 
 std::vector<Card*> Cards::FindCardByType(CardType cardType)
 {
-    std::vector<Card*> result;
-
-    for (Card* card : m_cards)
-    {
-        if (card->GetCardType() == cardType)
-        {
-            result.emplace_back(card);
-        }
-    }
-
-    return result;
+    return CardQuery().WithType(cardType).GetCards();
 }
 
 std::vector<Card*> Cards::FindCardByRace(Race race)
 {
-    std::vector<Card*> result;
-
-    for (Card* card : m_cards)
-    {
-        if (card->GetRace() == race)
-        {
-            result.emplace_back(card);
-        }
-    }
-
-    return result;
+    return CardQuery().WithRace(race).GetCards();
 }
 
 Card* Cards::FindCardByName(const std::string_view& name)
 {
-    for (Card* card : m_cards)
-    {
-        if (card->name == name && card->IsCollectible())
-        {
-            return card;
-        }
-    }
-
-    return &emptyCard;
+    const auto iter = m_cardsByName.find(name);
+    return iter != m_cardsByName.end() ? iter->second : &emptyCard;
 }
 
 std::vector<Card*> Cards::FindCardByCost(int minVal, int maxVal)
 {
-    std::vector<Card*> result;
-
-    for (Card* card : m_cards)
-    {
-        if (card->gameTags.at(GameTag::COST) >= minVal &&
-            card->gameTags.at(GameTag::COST) <= maxVal)
-        {
-            result.emplace_back(card);
-        }
-    }
-
-    return result;
+    return CardQuery().WithCost(minVal, maxVal).GetCards();
 }
 
 std::vector<Card*> Cards::FindCardByAttack(int minVal, int maxVal)
@@ -258,8 +299,8 @@ std::vector<Card*> Cards::FindCardByAttack(int minVal, int maxVal)
             continue;
         }
 
-        if (card->gameTags.at(GameTag::ATK) >= minVal &&
-            card->gameTags.at(GameTag::ATK) <= maxVal)
+        if (card->gameTags.At(GameTag::ATK) >= minVal &&
+            card->gameTags.At(GameTag::ATK) <= maxVal)
         {
             result.emplace_back(card);
         }
@@ -280,8 +321,8 @@ std::vector<Card*> Cards::FindCardByHealth(int minVal, int maxVal)
             continue;
         }
 
-        if (card->gameTags.at(GameTag::HEALTH) >= minVal &&
-            card->gameTags.at(GameTag::HEALTH) <= maxVal)
+        if (card->gameTags.At(GameTag::HEALTH) >= minVal &&
+            card->gameTags.At(GameTag::HEALTH) <= maxVal)
         {
             result.emplace_back(card);
         }
@@ -296,13 +337,13 @@ std::vector<Card*> Cards::FindCardBySpellPower(int minVal, int maxVal)
 
     for (Card* card : m_cards)
     {
-        if (card->gameTags.find(GameTag::SPELLPOWER) == card->gameTags.end())
+        if (!card->gameTags.Contains(GameTag::SPELLPOWER))
         {
             continue;
         }
 
-        if (card->gameTags.at(GameTag::SPELLPOWER) >= minVal &&
-            card->gameTags.at(GameTag::SPELLPOWER) <= maxVal)
+        if (card->gameTags.At(GameTag::SPELLPOWER) >= minVal &&
+            card->gameTags.At(GameTag::SPELLPOWER) <= maxVal)
         {
             result.emplace_back(card);
         }
@@ -313,22 +354,19 @@ std::vector<Card*> Cards::FindCardBySpellPower(int minVal, int maxVal)
 
 std::vector<Card*> Cards::FindCardByGameTag(std::vector<GameTag> gameTags)
 {
-    std::vector<Card*> result;
-
-    for (auto& card : m_cards)
-    {
-        auto cardGameTags = card->gameTags;
-
-        for (const auto gameTag : gameTags)
-        {
-            if (cardGameTags.find(gameTag) != cardGameTags.end())
+    return CardQuery()
+        .Where([&gameTags](const Card* card) {
+            for (const auto gameTag : gameTags)
             {
-                result.emplace_back(card);
+                if (card->gameTags.Contains(gameTag))
+                {
+                    return true;
+                }
             }
-        }
-    }
 
-    return result;
+            return false;
+        })
+        .GetCards();
 }
 
 Card* Cards::GetHeroCard(CardClass cardClass)
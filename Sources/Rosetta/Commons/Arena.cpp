@@ -0,0 +1,100 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Commons/Arena.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace RosettaStone
+{
+namespace
+{
+//! The offset of the usable memory from the beginning of block.
+constexpr std::size_t BLOCK_HEADER_SIZE =
+    (sizeof(void*) * 2 + alignof(std::max_align_t) - 1) &
+    ~(alignof(std::max_align_t) - 1);
+}  // namespace
+
+Arena::Arena(std::size_t blockSize) : m_blockSize(blockSize)
+{
+    // Do nothing
+}
+
+Arena::~Arena()
+{
+    Release();
+}
+
+void* Arena::Allocate(std::size_t size, std::size_t alignment)
+{
+    auto address = reinterpret_cast<std::uintptr_t>(m_cur);
+    address = (address + alignment - 1) & ~(alignment - 1);
+
+    if (m_cur == nullptr ||
+        address + size > reinterpret_cast<std::uintptr_t>(m_end))
+    {
+        AddBlock(size + alignment);
+
+        address = reinterpret_cast<std::uintptr_t>(m_cur);
+        address = (address + alignment - 1) & ~(alignment - 1);
+    }
+
+    m_cur = reinterpret_cast<std::byte*>(address + size);
+
+    return reinterpret_cast<void*>(address);
+}
+
+void Arena::Release()
+{
+    while (m_destructors != nullptr)
+    {
+        // NOTE: The destructor of object can create other objects in this
+        // arena, so the head of list is popped before calling it.
+        Destructor* destructor = m_destructors;
+        m_destructors = destructor->next;
+
+        destructor->destroy(destructor->object);
+    }
+
+    while (m_blocks != nullptr)
+    {
+        Block* block = m_blocks;
+        m_blocks = block->next;
+
+        ::operator delete(block);
+    }
+
+    m_reservedSize = 0;
+    m_cur = nullptr;
+    m_end = nullptr;
+}
+
+std::size_t Arena::GetReservedSize() const
+{
+    return m_reservedSize;
+}
+
+void Arena::AddDestructor(void* object, void (*destroy)(void*))
+{
+    auto destructor = new (Allocate(sizeof(Destructor), alignof(Destructor)))
+        Destructor{ destroy, object, m_destructors };
+    m_destructors = destructor;
+}
+
+void Arena::AddBlock(std::size_t size)
+{
+    const std::size_t blockSize =
+        BLOCK_HEADER_SIZE + std::max(size, m_blockSize);
+
+    auto block = new (::operator new(blockSize)) Block{ m_blocks, blockSize };
+    m_blocks = block;
+    m_reservedSize += blockSize;
+
+    m_cur = reinterpret_cast<std::byte*>(block) + BLOCK_HEADER_SIZE;
+    m_end = reinterpret_cast<std::byte*>(block) + blockSize;
+}
+}  // namespace RosettaStone
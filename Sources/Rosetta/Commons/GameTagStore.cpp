@@ -0,0 +1,226 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Commons/GameTagStore.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace RosettaStone
+{
+namespace
+{
+bool CompareTag(const GameTagStore::ValueType& lhs, GameTag rhs)
+{
+    return lhs.first < rhs;
+}
+}  // namespace
+
+GameTagStore::ConstIterator::ConstIterator(const GameTagStore* store,
+                                           std::size_t pos)
+    : m_store(store), m_pos(pos)
+{
+    SkipEmptySlots();
+}
+
+GameTagStore::ValueType GameTagStore::ConstIterator::operator*() const
+{
+    if (m_pos < NUM_HOT_GAME_TAGS)
+    {
+        return { HOT_GAME_TAGS[m_pos], m_store->m_hotValues[m_pos] };
+    }
+
+    return m_store->m_overflow[m_pos - NUM_HOT_GAME_TAGS];
+}
+
+GameTagStore::ConstIterator& GameTagStore::ConstIterator::operator++()
+{
+    ++m_pos;
+    SkipEmptySlots();
+
+    return *this;
+}
+
+bool GameTagStore::ConstIterator::operator==(const ConstIterator& rhs) const
+{
+    return m_store == rhs.m_store && m_pos == rhs.m_pos;
+}
+
+bool GameTagStore::ConstIterator::operator!=(const ConstIterator& rhs) const
+{
+    return !(*this == rhs);
+}
+
+void GameTagStore::ConstIterator::SkipEmptySlots()
+{
+    while (m_pos < NUM_HOT_GAME_TAGS && !((m_store->m_hotMask >> m_pos) & 1))
+    {
+        ++m_pos;
+    }
+}
+
+GameTagStore::GameTagStore(const std::map<GameTag, int>& tags)
+{
+    for (const auto& [tag, value] : tags)
+    {
+        Set(tag, value);
+    }
+}
+
+int GameTagStore::At(GameTag tag) const
+{
+    const int* value = Find(tag);
+    if (value == nullptr)
+    {
+        throw std::out_of_range("GameTagStore::At() - Invalid game tag!");
+    }
+
+    return *value;
+}
+
+int& GameTagStore::operator[](GameTag tag)
+{
+    const std::uint8_t slot = GAME_TAG_SLOTS[static_cast<std::size_t>(tag)];
+    if (slot != INVALID_GAME_TAG_SLOT)
+    {
+        m_hotMask |= std::uint64_t{ 1 } << slot;
+        return m_hotValues[slot];
+    }
+
+    auto iter =
+        std::lower_bound(m_overflow.begin(), m_overflow.end(), tag, CompareTag);
+    if (iter == m_overflow.end() || iter->first != tag)
+    {
+        iter = m_overflow.emplace(iter, tag, 0);
+    }
+
+    return iter->second;
+}
+
+bool GameTagStore::Erase(GameTag tag)
+{
+    const std::uint8_t slot = GAME_TAG_SLOTS[static_cast<std::size_t>(tag)];
+    if (slot != INVALID_GAME_TAG_SLOT)
+    {
+        const std::uint64_t bit = std::uint64_t{ 1 } << slot;
+        const bool isExist = (m_hotMask & bit) != 0;
+
+        m_hotMask &= ~bit;
+        m_hotValues[slot] = 0;
+
+        return isExist;
+    }
+
+    const auto iter =
+        std::lower_bound(m_overflow.begin(), m_overflow.end(), tag, CompareTag);
+    if (iter == m_overflow.end() || iter->first != tag)
+    {
+        return false;
+    }
+
+    m_overflow.erase(iter);
+    return true;
+}
+
+void GameTagStore::Merge(const GameTagStore& rhs)
+{
+    for (std::size_t slot = 0; slot < NUM_HOT_GAME_TAGS; ++slot)
+    {
+        if ((rhs.m_hotMask >> slot) & 1)
+        {
+            m_hotValues[slot] = rhs.m_hotValues[slot];
+        }
+    }
+    m_hotMask |= rhs.m_hotMask;
+
+    for (const auto& [tag, value] : rhs.m_overflow)
+    {
+        SetOverflow(tag, value);
+    }
+}
+
+void GameTagStore::Clear()
+{
+    m_hotMask = 0;
+    m_hotValues.fill(0);
+    m_overflow.clear();
+}
+
+std::size_t GameTagStore::GetCount() const
+{
+    std::size_t count = m_overflow.size();
+
+    for (std::uint64_t mask = m_hotMask; mask != 0; mask &= mask - 1)
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+bool GameTagStore::IsEmpty() const
+{
+    return m_hotMask == 0 && m_overflow.empty();
+}
+
+std::map<GameTag, int> GameTagStore::ToMap() const
+{
+    std::map<GameTag, int> tags;
+
+    for (const auto& [tag, value] : *this)
+    {
+        tags.emplace(tag, value);
+    }
+
+    return tags;
+}
+
+GameTagStore::ConstIterator GameTagStore::begin() const
+{
+    return ConstIterator(this, 0);
+}
+
+GameTagStore::ConstIterator GameTagStore::end() const
+{
+    return ConstIterator(this, NUM_HOT_GAME_TAGS + m_overflow.size());
+}
+
+bool GameTagStore::operator==(const GameTagStore& rhs) const
+{
+    return m_hotMask == rhs.m_hotMask && m_hotValues == rhs.m_hotValues &&
+           m_overflow == rhs.m_overflow;
+}
+
+bool GameTagStore::operator!=(const GameTagStore& rhs) const
+{
+    return !(*this == rhs);
+}
+
+const int* GameTagStore::FindOverflow(GameTag tag) const
+{
+    const auto iter =
+        std::lower_bound(m_overflow.begin(), m_overflow.end(), tag, CompareTag);
+    if (iter == m_overflow.end() || iter->first != tag)
+    {
+        return nullptr;
+    }
+
+    return &iter->second;
+}
+
+void GameTagStore::SetOverflow(GameTag tag, int value)
+{
+    auto iter =
+        std::lower_bound(m_overflow.begin(), m_overflow.end(), tag, CompareTag);
+    if (iter == m_overflow.end() || iter->first != tag)
+    {
+        m_overflow.emplace(iter, tag, value);
+        return;
+    }
+
+    iter->second = value;
+}
+}  // namespace RosettaStone
@@ -0,0 +1,31 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Commons/RandomEngine.hpp>
+
+namespace RosettaStone
+{
+RandomEngine::RandomEngine() : RandomEngine(std::random_device{}())
+{
+    // Do nothing
+}
+
+RandomEngine::RandomEngine(SeedType seed) : m_engine(seed), m_seed(seed)
+{
+    // Do nothing
+}
+
+void RandomEngine::Seed(SeedType seed)
+{
+    m_engine.seed(seed);
+    m_seed = seed;
+}
+
+RandomEngine::SeedType RandomEngine::GetSeed() const
+{
+    return m_seed;
+}
+}  // namespace RosettaStone
@@ -16,23 +16,35 @@ RelaCondition::RelaCondition(std::function<bool(Playable*, Playable*)> func)
     // Do nothing
 }
 
+RelaCondition::RelaCondition(Op op) : m_op(op)
+{
+    // Do nothing
+}
+
 RelaCondition RelaCondition::IsFriendly()
 {
-    return RelaCondition([=](Playable* me, Playable* other) -> bool {
-        return me->player == other->player;
-    });
+    return RelaCondition(Op::IS_FRIENDLY);
 }
 
 RelaCondition RelaCondition::IsSideBySide()
 {
-    return RelaCondition([=](Playable* me, Playable* other) -> bool {
-        return me->GetZoneType() == other->GetZoneType() &&
-               std::abs(me->GetZonePosition() - other->GetZonePosition()) == 1;
-    });
+    return RelaCondition(Op::IS_SIDE_BY_SIDE);
 }
 
 bool RelaCondition::Evaluate(Playable* owner, Playable* affected) const
 {
-    return m_func(owner, affected);
+    switch (m_op)
+    {
+        case Op::CUSTOM:
+            return m_func(owner, affected);
+        case Op::IS_FRIENDLY:
+            return owner->player == affected->player;
+        case Op::IS_SIDE_BY_SIDE:
+            return owner->GetZoneType() == affected->GetZoneType() &&
+                   std::abs(owner->GetZonePosition() -
+                            affected->GetZonePosition()) == 1;
+    }
+
+    return false;
 }
 }  // namespace RosettaStone
@@ -3,6 +3,7 @@
 // RosettaStone is hearthstone simulator using C++ with reinforcement learning.
 // Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
 
+#include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Conditions/SelfCondition.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Zones/DeckZone.hpp>
@@ -10,22 +11,51 @@
 #include <Rosetta/Zones/HandZone.hpp>
 #include <Rosetta/Zones/SecretZone.hpp>
 
+#include <map>
 #include <string>
+#include <string_view>
 #include <utility>
 
 namespace RosettaStone
 {
+namespace
+{
+//! Compares \p lhs with \p rhs using \p relaSign.
+//! \param lhs The value to compare.
+//! \param rhs The value to compare with.
+//! \param relaSign The comparer.
+//! \return The result of comparison.
+bool Compare(int lhs, int rhs, RelaSign relaSign)
+{
+    switch (relaSign)
+    {
+        case RelaSign::EQ:
+            return lhs == rhs;
+        case RelaSign::GEQ:
+            return lhs >= rhs;
+        case RelaSign::LEQ:
+            return lhs <= rhs;
+    }
+
+    return false;
+}
+}  // namespace
+
 SelfCondition::SelfCondition(std::function<bool(Playable*)> func)
     : m_func(std::move(func))
 {
     // Do nothing
 }
 
+SelfCondition::SelfCondition(Op op, int arg, int value, RelaSign relaSign)
+    : m_op(op), m_relaSign(relaSign), m_arg(arg), m_value(value)
+{
+    // Do nothing
+}
+
 SelfCondition SelfCondition::IsCurrentPlayer()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return playable->game->GetCurrentPlayer() == playable->player;
-    });
+    return SelfCondition(Op::IS_CURRENT_PLAYER);
 }
 
 SelfCondition SelfCondition::IsNotStartInDeck()
@@ -41,123 +71,83 @@ SelfCondition SelfCondition::IsNotStartInDeck()
 
 SelfCondition SelfCondition::IsDeckEmpty()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return playable->player->GetDeckZone()->IsEmpty();
-    });
+    return SelfCondition(Op::IS_DECK_EMPTY);
 }
 
 SelfCondition SelfCondition::IsHeroPowerCard(const std::string& cardID)
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return playable->player->GetHero()->heroPower->card->id == cardID;
-    });
+    const CardHandle handle = Cards::GetHandle(cardID);
+
+    SelfCondition condition(Op::IS_HERO_POWER_CARD,
+                            static_cast<int>(handle.GetOrdinal()));
+    condition.m_cardID = cardID;
+
+    return condition;
 }
 
 SelfCondition SelfCondition::IsBattlecryCard()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return playable->GetGameTag(GameTag::BATTLECRY) == 1;
-    });
+    return SelfCondition(Op::IS_BATTLECRY_CARD);
 }
 
 SelfCondition SelfCondition::IsGalakrondHero()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return playable->card->IsGalakrond();
-    });
+    return SelfCondition(Op::IS_GALAKROND_HERO);
 }
 
 SelfCondition SelfCondition::IsDead()
 {
-    return SelfCondition(
-        [=](Playable* playable) -> bool { return playable->isDestroyed; });
+    return SelfCondition(Op::IS_DEAD);
 }
 
 SelfCondition SelfCondition::IsNotDead()
 {
-    return SelfCondition(
-        [=](Playable* playable) -> bool { return !playable->isDestroyed; });
+    return SelfCondition(Op::IS_NOT_DEAD);
 }
 
 SelfCondition SelfCondition::IsNotImmune()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        const auto character = dynamic_cast<Character*>(playable);
-        if (!character)
-        {
-            return false;
-        }
-
-        return !character->IsImmune();
-    });
+    return SelfCondition(Op::IS_NOT_IMMUNE);
 }
 
 SelfCondition SelfCondition::IsNotUntouchable()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return !playable->card->IsUntouchable();
-    });
+    return SelfCondition(Op::IS_NOT_UNTOUCHABLE);
 }
 
 SelfCondition SelfCondition::IsFieldFull()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return playable->player->GetFieldZone()->IsFull();
-    });
+    return SelfCondition(Op::IS_FIELD_FULL);
 }
 
 SelfCondition SelfCondition::IsFieldNotFull()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return !playable->player->GetFieldZone()->IsFull();
-    });
+    return SelfCondition(Op::IS_FIELD_NOT_FULL);
 }
 
 SelfCondition SelfCondition::IsOpFieldNotFull()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return !playable->player->opponent->GetFieldZone()->IsFull();
-    });
+    return SelfCondition(Op::IS_OP_FIELD_NOT_FULL);
 }
 
 SelfCondition SelfCondition::IsFieldNotEmpty()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return !playable->player->GetFieldZone()->IsEmpty();
-    });
+    return SelfCondition(Op::IS_FIELD_NOT_EMPTY);
 }
 
 SelfCondition SelfCondition::IsDamaged()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        const auto character = dynamic_cast<Character*>(playable);
-        if (!character)
-        {
-            return false;
-        }
-
-        return character->GetDamage() > 0;
-    });
+    return SelfCondition(Op::IS_DAMAGED);
 }
 
 SelfCondition SelfCondition::IsUndamaged()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        const auto character = dynamic_cast<Character*>(playable);
-        if (!character)
-        {
-            return false;
-        }
-
-        return character->GetDamage() == 0;
-    });
+    return SelfCondition(Op::IS_UNDAMAGED);
 }
 
 SelfCondition SelfCondition::IsWeaponEquipped()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return playable->player->GetHero()->HasWeapon();
-    });
+    return SelfCondition(Op::IS_WEAPON_EQUIPPED);
 }
 
 SelfCondition SelfCondition::IsTreant()
@@ -169,9 +159,7 @@ SelfCondition SelfCondition::IsTreant()
 
 SelfCondition SelfCondition::IsRace(Race race)
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return playable->card->GetRace() == race;
-    });
+    return SelfCondition(Op::IS_RACE, static_cast<int>(race));
 }
 
 SelfCondition SelfCondition::IsControllingRace(Race race)
@@ -207,9 +195,7 @@ SelfCondition SelfCondition::IsOpControllingRace(Race race)
 
 SelfCondition SelfCondition::IsControllingSecret()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return !playable->player->GetSecretZone()->IsEmpty();
-    });
+    return SelfCondition(Op::IS_CONTROLLING_SECRET);
 }
 
 SelfCondition SelfCondition::IsControllingLackey()
@@ -261,129 +247,73 @@ SelfCondition SelfCondition::IsHoldingAnotherClassCard()
 
 SelfCondition SelfCondition::IsCardID(std::string_view cardID)
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return playable->card->id == cardID;
-    });
+    const CardHandle handle = Cards::GetHandle(cardID);
+
+    SelfCondition condition(Op::IS_CARD_ID,
+                            static_cast<int>(handle.GetOrdinal()));
+    condition.m_cardID = cardID;
+
+    return condition;
 }
 
 SelfCondition SelfCondition::IsMinion()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return dynamic_cast<Minion*>(playable) != nullptr;
-    });
+    return SelfCondition(Op::IS_MINION);
 }
 
 SelfCondition SelfCondition::IsSpell()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return dynamic_cast<Spell*>(playable) != nullptr;
-    });
+    return SelfCondition(Op::IS_SPELL);
 }
 
 SelfCondition SelfCondition::IsWeapon()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return dynamic_cast<Weapon*>(playable) != nullptr;
-    });
+    return SelfCondition(Op::IS_WEAPON);
 }
 
 SelfCondition SelfCondition::IsSecret()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return dynamic_cast<Spell*>(playable) != nullptr &&
-               playable->GetGameTag(GameTag::SECRET) == 1;
-    });
+    return SelfCondition(Op::IS_SECRET);
 }
 
 SelfCondition SelfCondition::IsChooseOneCard()
 {
-    return SelfCondition(
-        [=](Playable* playable) -> bool { return playable->HasChooseOne(); });
+    return SelfCondition(Op::IS_CHOOSE_ONE_CARD);
 }
 
 SelfCondition SelfCondition::IsFrozen()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        const auto character = dynamic_cast<Character*>(playable);
-        if (!character)
-        {
-            return false;
-        }
-
-        return character->IsFrozen();
-    });
+    return SelfCondition(Op::IS_FROZEN);
 }
 
 SelfCondition SelfCondition::IsRush()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        const auto minion = dynamic_cast<Minion*>(playable);
-        if (!minion)
-        {
-            return false;
-        }
-
-        return minion->IsRush();
-    });
+    return SelfCondition(Op::IS_RUSH);
 }
 
 SelfCondition SelfCondition::HasDeathrattle()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        const auto minion = dynamic_cast<Minion*>(playable);
-        if (!minion)
-        {
-            return false;
-        }
-
-        return minion->HasDeathrattle();
-    });
+    return SelfCondition(Op::HAS_DEATHRATTLE);
 }
 
 SelfCondition SelfCondition::HasNotStealth()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        const auto minion = dynamic_cast<Minion*>(playable);
-        if (!minion)
-        {
-            return false;
-        }
-
-        return !minion->HasStealth();
-    });
+    return SelfCondition(Op::HAS_NOT_STEALTH);
 }
 
 SelfCondition SelfCondition::HasWindfury()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        const auto character = dynamic_cast<Character*>(playable);
-        if (!character)
-        {
-            return false;
-        }
-
-        return character->HasWindfury();
-    });
+    return SelfCondition(Op::HAS_WINDFURY);
 }
 
 SelfCondition SelfCondition::HasReborn()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        const auto minion = dynamic_cast<Minion*>(playable);
-        if (!minion)
-        {
-            return false;
-        }
-
-        return minion->HasReborn();
-    });
+    return SelfCondition(Op::HAS_REBORN);
 }
 
 SelfCondition SelfCondition::HasSpellPower()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return playable->player->GetCurrentSpellPower() > 0;
-    });
+    return SelfCondition(Op::HAS_SPELL_POWER);
 }
 
 SelfCondition SelfCondition::HasInvokedTwice()
@@ -410,21 +340,12 @@ SelfCondition SelfCondition::HasMinionInHand()
 
 SelfCondition SelfCondition::IsOverloadCard()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        if (playable->GetGameTag(GameTag::OVERLOAD) >= 1)
-        {
-            return true;
-        }
-
-        return false;
-    });
+    return SelfCondition(Op::IS_OVERLOAD_CARD);
 }
 
 SelfCondition SelfCondition::IsAttackThisTurn()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return playable->GetGameTag(GameTag::NUM_ATTACKS_THIS_TURN) > 0;
-    });
+    return SelfCondition(Op::IS_ATTACK_THIS_TURN);
 }
 
 SelfCondition SelfCondition::MinionsPlayedThisTurn(int num)
@@ -450,26 +371,14 @@ SelfCondition SelfCondition::IsNotPlayElementalMinionThisTurn()
 
 SelfCondition SelfCondition::IsCost(int value, RelaSign relaSign)
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        const int val = playable->GetCost();
-
-        return (relaSign == RelaSign::EQ && val == value) ||
-               (relaSign == RelaSign::GEQ && val >= value) ||
-               (relaSign == RelaSign::LEQ && val <= value);
-    });
+    return SelfCondition(Op::IS_COST, 0, value, relaSign);
 }
 
 SelfCondition SelfCondition::IsTagValue(GameTag tag, int value,
                                         RelaSign relaSign)
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return (relaSign == RelaSign::EQ &&
-                playable->GetGameTag(tag) == value) ||
-               (relaSign == RelaSign::GEQ &&
-                playable->GetGameTag(tag) >= value) ||
-               (relaSign == RelaSign::LEQ &&
-                playable->GetGameTag(tag) <= value);
-    });
+    return SelfCondition(Op::IS_TAG_VALUE, static_cast<int>(tag), value,
+                         relaSign);
 }
 
 SelfCondition SelfCondition::IsName(const std::string& name, bool isEqual)
@@ -493,24 +402,12 @@ SelfCondition SelfCondition::IsStackNum(int value, RelaSign relaSign, int index)
 
 SelfCondition SelfCondition::IsHealth(int value, RelaSign relaSign)
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        const auto character = dynamic_cast<Character*>(playable);
-        if (character == nullptr)
-        {
-            return false;
-        }
-
-        return (relaSign == RelaSign::EQ && character->GetHealth() == value) ||
-               (relaSign == RelaSign::GEQ && character->GetHealth() >= value) ||
-               (relaSign == RelaSign::LEQ && character->GetHealth() <= value);
-    });
+    return SelfCondition(Op::IS_HEALTH, 0, value, relaSign);
 }
 
 SelfCondition SelfCondition::HasTarget()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return playable->GetCardTarget() > 0;
-    });
+    return SelfCondition(Op::HAS_TARGET);
 }
 
 SelfCondition SelfCondition::IsProposedDefender(CardType cardType)
@@ -559,26 +456,22 @@ SelfCondition SelfCondition::IsEventTargetIs(CardType cardType)
 SelfCondition SelfCondition::IsSpellTargetingMinion()
 {
     return SelfCondition([=](Playable* playable) -> bool {
-        const auto iter =
-            playable->game->entityList.find(playable->GetCardTarget());
+        const Playable* target =
+            playable->game->entityList.Get(playable->GetCardTarget());
 
         return playable->card->GetCardType() == CardType::SPELL &&
-               iter->second->card->GetCardType() == CardType::MINION;
+               target->card->GetCardType() == CardType::MINION;
     });
 }
 
 SelfCondition SelfCondition::IsInZone(ZoneType zone)
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return playable->GetZoneType() == zone;
-    });
+    return SelfCondition(Op::IS_IN_ZONE, static_cast<int>(zone));
 }
 
 SelfCondition SelfCondition::IsEnemyTurn()
 {
-    return SelfCondition([=](Playable* playable) -> bool {
-        return playable->player != playable->game->GetCurrentPlayer();
-    });
+    return SelfCondition(Op::IS_ENEMY_TURN);
 }
 
 SelfCondition SelfCondition::IsMyHeroUndamagedEnemyTurn()
@@ -615,10 +508,15 @@ SelfCondition SelfCondition::IsNoDuplicateInDeck()
 {
     return SelfCondition([=](Playable* playable) -> bool {
         auto cards = playable->player->GetDeckZone()->GetAll();
-        std::map<std::string, int> result;
+        std::map<std::pair<CardHandle, std::string_view>, int> result;
 
-        std::for_each(cards.begin(), cards.end(),
-                      [&result](Playable* val) { result[val->card->id]++; });
+        // The cards that have invalid handles are told apart by their IDs
+        std::for_each(cards.begin(), cards.end(), [&result](Playable* val) {
+            const Card* card = val->card;
+            result[{ card->handle,
+                     card->handle.IsValid() ? std::string_view()
+                                            : std::string_view(card->id) }]++;
+        });
 
         for (auto& res : result)
         {
@@ -711,6 +609,125 @@ SelfCondition SelfCondition::CheckThreshold(RelaSign relaSign)
 
 bool SelfCondition::Evaluate(Playable* owner) const
 {
-    return m_func(owner);
+    switch (m_op)
+    {
+        case Op::CUSTOM:
+            return m_func(owner);
+        case Op::IS_CURRENT_PLAYER:
+            return owner->game->GetCurrentPlayer() == owner->player;
+        case Op::IS_DECK_EMPTY:
+            return owner->player->GetDeckZone()->IsEmpty();
+        case Op::IS_GALAKROND_HERO:
+            return owner->card->IsGalakrond();
+        case Op::IS_HERO_POWER_CARD:
+            return owner->player->GetHero()->heroPower->card->IsCard(
+                CardHandle(static_cast<std::uint32_t>(m_arg)), m_cardID);
+        case Op::IS_BATTLECRY_CARD:
+            return owner->GetGameTag(GameTag::BATTLECRY) == 1;
+        case Op::IS_DEAD:
+            return owner->isDestroyed;
+        case Op::IS_NOT_DEAD:
+            return !owner->isDestroyed;
+        case Op::IS_NOT_IMMUNE:
+        {
+            const auto character = dynamic_cast<Character*>(owner);
+            return character != nullptr && !character->IsImmune();
+        }
+        case Op::IS_NOT_UNTOUCHABLE:
+            return !owner->card->IsUntouchable();
+        case Op::IS_FIELD_FULL:
+            return owner->player->GetFieldZone()->IsFull();
+        case Op::IS_FIELD_NOT_FULL:
+            return !owner->player->GetFieldZone()->IsFull();
+        case Op::IS_FIELD_NOT_EMPTY:
+            return !owner->player->GetFieldZone()->IsEmpty();
+        case Op::IS_OP_FIELD_NOT_FULL:
+            return !owner->player->opponent->GetFieldZone()->IsFull();
+        case Op::IS_DAMAGED:
+        {
+            const auto character = dynamic_cast<Character*>(owner);
+            return character != nullptr && character->GetDamage() > 0;
+        }
+        case Op::IS_UNDAMAGED:
+        {
+            const auto character = dynamic_cast<Character*>(owner);
+            return character != nullptr && character->GetDamage() == 0;
+        }
+        case Op::IS_WEAPON_EQUIPPED:
+            return owner->player->GetHero()->HasWeapon();
+        case Op::IS_RACE:
+            return owner->card->GetRace() == static_cast<Race>(m_arg);
+        case Op::IS_CONTROLLING_SECRET:
+            return !owner->player->GetSecretZone()->IsEmpty();
+        case Op::IS_CARD_ID:
+            return owner->card->IsCard(
+                CardHandle(static_cast<std::uint32_t>(m_arg)), m_cardID);
+        case Op::IS_MINION:
+            return dynamic_cast<Minion*>(owner) != nullptr;
+        case Op::IS_SPELL:
+            return dynamic_cast<Spell*>(owner) != nullptr;
+        case Op::IS_WEAPON:
+            return dynamic_cast<Weapon*>(owner) != nullptr;
+        case Op::IS_SECRET:
+            return dynamic_cast<Spell*>(owner) != nullptr &&
+                   owner->GetGameTag(GameTag::SECRET) == 1;
+        case Op::IS_CHOOSE_ONE_CARD:
+            return owner->HasChooseOne();
+        case Op::IS_FROZEN:
+        {
+            const auto character = dynamic_cast<Character*>(owner);
+            return character != nullptr && character->IsFrozen();
+        }
+        case Op::IS_RUSH:
+        {
+            const auto minion = dynamic_cast<Minion*>(owner);
+            return minion != nullptr && minion->IsRush();
+        }
+        case Op::HAS_DEATHRATTLE:
+        {
+            const auto minion = dynamic_cast<Minion*>(owner);
+            return minion != nullptr && minion->HasDeathrattle();
+        }
+        case Op::HAS_NOT_STEALTH:
+        {
+            const auto minion = dynamic_cast<Minion*>(owner);
+            return minion != nullptr && !minion->HasStealth();
+        }
+        case Op::HAS_WINDFURY:
+        {
+            const auto character = dynamic_cast<Character*>(owner);
+            return character != nullptr && character->HasWindfury();
+        }
+        case Op::HAS_REBORN:
+        {
+            const auto minion = dynamic_cast<Minion*>(owner);
+            return minion != nullptr && minion->HasReborn();
+        }
+        case Op::HAS_SPELL_POWER:
+            return owner->player->GetCurrentSpellPower() > 0;
+        case Op::IS_OVERLOAD_CARD:
+            return owner->GetGameTag(GameTag::OVERLOAD) >= 1;
+        case Op::IS_ATTACK_THIS_TURN:
+            return owner->GetGameTag(GameTag::NUM_ATTACKS_THIS_TURN) > 0;
+        case Op::IS_COST:
+            return Compare(owner->GetCost(), m_value, m_relaSign);
+        case Op::IS_TAG_VALUE:
+            return Compare(owner->GetGameTag(static_cast<GameTag>(m_arg)),
+                           m_value, m_relaSign);
+        case Op::IS_HEALTH:
+        {
+            const auto character = dynamic_cast<Character*>(owner);
+            return character != nullptr &&
+                   Compare(character->GetHealth(), m_value, m_relaSign);
+        }
+        case Op::HAS_TARGET:
+            return owner->GetCardTarget() > 0;
+        case Op::IS_IN_ZONE:
+            return owner->GetZoneType() == static_cast<ZoneType>(m_arg);
+        case Op::IS_ENEMY_TURN:
+            return owner->player != owner->game->GetCurrentPlayer();
+    }
+
+    return false;
 }
 }  // namespace RosettaStone
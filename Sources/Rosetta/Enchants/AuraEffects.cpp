@@ -14,16 +14,9 @@ AuraEffects::AuraEffects(CardType type) : m_type(type)
     switch (type)
     {
         case CardType::HERO:
-            m_data = new int[AURA_EFFECT_HERO_SIZE]();
-            break;
         case CardType::MINION:
-            m_data = new int[AURA_EFFECT_MINION_SIZE]();
-            break;
         case CardType::WEAPON:
-            m_data = new int[AURA_EFFECT_WEAPON_SIZE]();
-            break;
         case CardType::SPELL:
-            m_data = new int[AURA_EFFECT_CARD_SIZE]();
             break;
         default:
             throw std::invalid_argument(
@@ -31,11 +24,6 @@ AuraEffects::AuraEffects(CardType type) : m_type(type)
     }
 }
 
-AuraEffects::~AuraEffects()
-{
-    delete[] m_data;
-}
-
 int AuraEffects::GetGameTag(GameTag tag) const
 {
     switch (tag)
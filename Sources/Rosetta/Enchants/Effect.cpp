@@ -76,12 +76,7 @@ void Effect::ApplyTo(PlayerAuraEffects& auraEffects) const
 
 void Effect::ApplyAuraTo(Entity* entity) const
 {
-    AuraEffects* auraEffects = entity->auraEffects;
-    if (auraEffects == nullptr)
-    {
-        auraEffects = new AuraEffects(entity->card->GetCardType());
-        entity->auraEffects = auraEffects;
-    }
+    AuraEffects* auraEffects = entity->GetOrCreateAuraEffects();
 
     const int prevValue = auraEffects->GetGameTag(m_gameTag);
 
@@ -109,6 +104,8 @@ void Effect::ApplyAuraTo(Entity* entity) const
             throw std::invalid_argument(
                 "Effect::ApplyAuraTo() - Invalid effect operator!");
     }
+
+    entity->NotifyMutation();
 }
 
 void Effect::RemoveFrom(Entity* entity) const
@@ -122,7 +119,7 @@ void Effect::RemoveFrom(Entity* entity) const
             break;
         case EffectOperator::SUB:
             entity->SetGameTag(m_gameTag,
-                               entity->card->gameTags.at(m_gameTag) + m_value);
+                               entity->card->gameTags.At(m_gameTag) + m_value);
             break;
         case EffectOperator::SET:
             entity->SetGameTag(m_gameTag, 0);
@@ -163,7 +160,7 @@ void Effect::RemoveFrom(PlayerAuraEffects& auraEffects) const
 
 void Effect::RemoveAuraFrom(Entity* entity) const
 {
-    AuraEffects* auraEffects = entity->auraEffects;
+    AuraEffects* auraEffects = entity->GetOrCreateAuraEffects();
     const int prevValue = auraEffects->GetGameTag(m_gameTag);
 
     switch (m_effectOperator)
@@ -190,6 +187,8 @@ void Effect::RemoveAuraFrom(Entity* entity) const
             throw std::invalid_argument(
                 "Effect::RemoveAuraFrom() - Invalid effect operator!");
     }
+
+    entity->NotifyMutation();
 }
 
 IEffect* Effect::ChangeValue(int newValue) const
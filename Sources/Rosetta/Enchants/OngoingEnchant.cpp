@@ -43,13 +43,22 @@ void OngoingEnchant::Update()
         Enchant::ActivateTo(target);
     }
 
+    SaveState();
+
     m_lastCount = m_count;
     m_toBeUpdated = false;
 }
 
+bool OngoingEnchant::IsUpToDate() const
+{
+    return !m_toBeUpdated;
+}
+
 void OngoingEnchant::Remove()
 {
+    target->game->journal.RecordPointer(target->ongoingEffect);
     target->ongoingEffect = nullptr;
+    target->game->journal.RecordValue(target->game->auras);
     EraseIf(target->game->auras, [this](IAura* aura) { return aura == this; });
 }
 
@@ -60,7 +69,17 @@ void OngoingEnchant::Clone(Playable* clone)
     copy->target = clone;
     copy->isOneTurnEffect = isOneTurnEffect;
 
+    // Keep the number of stacks if it is cloned to other game
+    if (clone->game != game)
+    {
+        copy->m_count = m_count;
+        copy->m_lastCount = m_lastCount;
+        copy->m_toBeUpdated = m_toBeUpdated;
+    }
+
+    clone->game->journal.RecordPointer(clone->ongoingEffect);
     clone->ongoingEffect = copy;
+    copy->game->journal.RecordValue(copy->game->auras);
     copy->game->auras.emplace_back(copy);
 }
 
@@ -71,7 +90,21 @@ std::size_t OngoingEnchant::GetCount() const
 
 void OngoingEnchant::SetCount(std::size_t value)
 {
+    SaveState();
+
     m_count = value;
     m_toBeUpdated = true;
 }
+
+void OngoingEnchant::SaveState()
+{
+    target->game->journal.RecordState(m_stateEpoch, [this]() {
+        return [this, count = m_count, lastCount = m_lastCount,
+                toBeUpdated = m_toBeUpdated]() {
+            m_count = count;
+            m_lastCount = lastCount;
+            m_toBeUpdated = toBeUpdated;
+        };
+    });
+}
 }  // namespace RosettaStone
@@ -10,47 +10,47 @@
 
 namespace RosettaStone
 {
-IAura* Power::GetAura()
+IAura* Power::GetAura() const
 {
     return m_aura.get();
 }
 
-Enchant* Power::GetEnchant()
+Enchant* Power::GetEnchant() const
 {
     return m_enchant.get();
 }
 
-Trigger* Power::GetTrigger()
+Trigger* Power::GetTrigger() const
 {
     return m_trigger.get();
 }
 
-std::vector<std::shared_ptr<ITask>>& Power::GetPowerTask()
+const std::vector<std::shared_ptr<ITask>>& Power::GetPowerTask() const
 {
     return m_powerTask;
 }
 
-std::vector<std::shared_ptr<ITask>>& Power::GetDeathrattleTask()
+const std::vector<std::shared_ptr<ITask>>& Power::GetDeathrattleTask() const
 {
     return m_deathrattleTask;
 }
 
-std::vector<std::shared_ptr<ITask>>& Power::GetComboTask()
+const std::vector<std::shared_ptr<ITask>>& Power::GetComboTask() const
 {
     return m_comboTask;
 }
 
-std::vector<std::shared_ptr<ITask>>& Power::GetTopdeckTask()
+const std::vector<std::shared_ptr<ITask>>& Power::GetTopdeckTask() const
 {
     return m_topdeckTask;
 }
 
-std::vector<std::shared_ptr<ITask>>& Power::GetAfterChooseTask()
+const std::vector<std::shared_ptr<ITask>>& Power::GetAfterChooseTask() const
 {
     return m_afterChooseTask;
 }
 
-std::vector<std::shared_ptr<ITask>>& Power::GetOutcastTask()
+const std::vector<std::shared_ptr<ITask>>& Power::GetOutcastTask() const
 {
     return m_outcastTask;
 }
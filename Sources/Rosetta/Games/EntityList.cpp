@@ -0,0 +1,75 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Games/EntityList.hpp>
+
+#include <stdexcept>
+
+namespace RosettaStone
+{
+Playable* EntityList::At(int id) const
+{
+    Playable* entity = Get(id);
+    if (entity == nullptr)
+    {
+        throw std::out_of_range("EntityList::At() - Invalid entity ID!");
+    }
+
+    return entity;
+}
+
+void EntityList::Set(int id, Playable* entity)
+{
+    if (id < 0)
+    {
+        throw std::out_of_range("EntityList::Set() - Invalid entity ID!");
+    }
+
+    if (static_cast<std::size_t>(id) >= m_entities.size())
+    {
+        m_entities.resize(id + 1, nullptr);
+    }
+
+    Playable*& slot = m_entities[id];
+    if (slot == nullptr && entity != nullptr)
+    {
+        ++m_count;
+    }
+    else if (slot != nullptr && entity == nullptr)
+    {
+        --m_count;
+    }
+
+    slot = entity;
+}
+
+bool EntityList::Erase(int id)
+{
+    if (!Contains(id))
+    {
+        return false;
+    }
+
+    Set(id, nullptr);
+    return true;
+}
+
+void EntityList::Clear()
+{
+    m_entities.clear();
+    m_count = 0;
+}
+
+std::size_t EntityList::GetCount() const
+{
+    return m_count;
+}
+
+bool EntityList::IsEmpty() const
+{
+    return m_count == 0;
+}
+}  // namespace RosettaStone
@@ -7,11 +7,13 @@
 #include <Rosetta/Actions/Choose.hpp>
 #include <Rosetta/Actions/Draw.hpp>
 #include <Rosetta/Actions/Generic.hpp>
+#include <Rosetta/Actions/MoveGenerator.hpp>
 #include <Rosetta/Actions/Summon.hpp>
 #include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Enchants/Power.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Managers/GameManager.hpp>
+#include <Rosetta/Models/Choice.hpp>
 #include <Rosetta/Models/Enchantment.hpp>
 #include <Rosetta/Tasks/ITask.hpp>
 #include <Rosetta/Tasks/PlayerTasks/AttackTask.hpp>
@@ -19,19 +21,68 @@
 #include <Rosetta/Tasks/PlayerTasks/HeroPowerTask.hpp>
 #include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
 #include <Rosetta/Views/BoardRefView.hpp>
+#include <Rosetta/Triggers/Trigger.hpp>
 #include <Rosetta/Zones/DeckZone.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
 #include <Rosetta/Zones/GraveyardZone.hpp>
+#include <Rosetta/Zones/HandZone.hpp>
+#include <Rosetta/Zones/SecretZone.hpp>
 #include <Rosetta/Zones/SetasideZone.hpp>
 
-#include <effolkronium/random.hpp>
-
 #include <algorithm>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
 
-using Random = effolkronium::random_static;
 using namespace RosettaStone::PlayerTasks;
 
 namespace RosettaStone
 {
+namespace
+{
+//! Copies the chain of choices that starts from \p choice.
+//! \param choice The first choice of the chain.
+//! \return The copies of choices in the order of the chain.
+std::vector<Choice> CopyChoices(const Choice* choice)
+{
+    std::vector<Choice> result;
+    for (; choice != nullptr; choice = choice->nextChoice)
+    {
+        result.emplace_back(*choice);
+    }
+
+    return result;
+}
+
+//! Makes the chain of choices from the copies of choices.
+//! \param choices The copies of choices in the order of the chain.
+//! \return The first choice of the chain.
+Choice* MakeChoices(const std::vector<Choice>& choices)
+{
+    Choice* result = nullptr;
+    for (auto iter = choices.rbegin(); iter != choices.rend(); ++iter)
+    {
+        const auto choice = new Choice(*iter);
+        choice->nextChoice = result;
+        result = choice;
+    }
+
+    return result;
+}
+
+//! Deletes the chain of choices that starts from \p choice.
+//! \param choice The first choice of the chain.
+void DeleteChoices(Choice* choice)
+{
+    while (choice != nullptr)
+    {
+        Choice* nextChoice = choice->nextChoice;
+        delete choice;
+        choice = nextChoice;
+    }
+}
+}  // namespace
+
 Game::Game()
 {
     Initialize();
@@ -45,6 +96,11 @@ Game::Game(const GameConfig& gameConfig) : m_gameConfig(gameConfig)
 {
     Initialize();
 
+    if (gameConfig.seed.has_value())
+    {
+        random.Seed(gameConfig.seed.value());
+    }
+
     // Add hero and hero power
     GetPlayer1()->AddHeroAndPower(
         Cards::GetHeroCard(gameConfig.player1Class),
@@ -122,7 +178,7 @@ Game::Game(const GameConfig& gameConfig) : m_gameConfig(gameConfig)
     {
         case PlayerType::RANDOM:
         {
-            const auto val = Random::get(0, 1);
+            const auto val = random.Get(0, 1);
             m_currentPlayer =
                 (val == 0) ? PlayerType::PLAYER1 : PlayerType::PLAYER2;
             break;
@@ -181,6 +237,7 @@ void Game::RefCopyFrom(const Game& rhs)
     deadMinions = rhs.deadMinions;
 
     m_gameConfig = rhs.m_gameConfig;
+    random = rhs.random;
 
     m_players[0].RefCopy(rhs.m_players[0]);
     m_players[1].RefCopy(rhs.m_players[1]);
@@ -188,6 +245,344 @@ void Game::RefCopyFrom(const Game& rhs)
 
     m_entityID = rhs.m_entityID;
     m_oopIndex = rhs.m_oopIndex;
+
+    zobrist.Rebuild(*this);
+    journal.NotifyMutation();
+}
+
+std::unique_ptr<Game> Game::Clone() const
+{
+    auto game = std::make_unique<Game>();
+
+    game->state = state;
+
+    game->step = step;
+    game->nextStep = nextStep;
+
+    game->m_gameConfig = m_gameConfig;
+    game->m_turn = m_turn;
+
+    game->random = random;
+
+    game->m_entityID = m_entityID;
+    game->m_oopIndex = m_oopIndex;
+
+    game->m_currentPlayer = m_currentPlayer;
+
+    // A table that maps the entities of this game to the entities of the copy
+    std::unordered_map<const Entity*, Entity*> entities;
+    std::unordered_map<const Enchantment*, std::shared_ptr<Enchantment>>
+        enchantments;
+
+    const auto findCopy = [&entities](auto* entity) {
+        using EntityType = std::remove_const_t<
+            std::remove_pointer_t<decltype(entity)>>;
+
+        const auto iter = entities.find(entity);
+        return iter != entities.end() ? static_cast<EntityType*>(iter->second)
+                                      : nullptr;
+    };
+
+    const auto copyZone = [&findCopy](const auto& zone, auto& copiedZone) {
+        zone.ForEach(
+            [&](auto* entity) { copiedZone.MoveTo(findCopy(entity), -1); });
+    };
+
+    const auto copyEnchantments = [&](const Entity& entity) {
+        for (auto& enchantment : entity.appliedEnchantments)
+        {
+            auto copy = std::allocate_shared<Enchantment>(
+                ArenaAllocator<Enchantment>(game->arena),
+                findCopy(enchantment->player), enchantment->card,
+                GameTagStore{}, findCopy(enchantment->GetTarget()),
+                enchantment->GetGameTag(GameTag::ENTITY_ID));
+            copy->CopyStatesFrom(*enchantment);
+
+            findCopy(&entity)->appliedEnchantments.emplace_back(copy);
+            entities.emplace(enchantment.get(), copy.get());
+            enchantments.emplace(enchantment.get(), copy);
+        }
+    };
+
+    // 1. Copy the states of players
+    for (std::size_t i = 0; i < m_players.size(); ++i)
+    {
+        game->m_players[i].CopyStatesFrom(m_players[i]);
+        entities.emplace(&m_players[i], &game->m_players[i]);
+    }
+
+    // 2. Copy entities with the same entity ID
+    entityList.ForEach([&](Playable* entity) {
+        Playable* copy = Entity::GetFromCard(
+            findCopy(entity->player), entity->card, std::nullopt, nullptr,
+            entity->GetGameTag(GameTag::ENTITY_ID));
+        copy->CopyStatesFrom(*entity);
+
+        entities.emplace(entity, copy);
+    });
+
+    // 3. Copy enchantments and the links between entities
+    for (auto& player : m_players)
+    {
+        copyEnchantments(player);
+    }
+
+    entityList.ForEach([&](Playable* entity) {
+        copyEnchantments(*entity);
+
+        if (const auto hero = dynamic_cast<const Hero*>(entity); hero)
+        {
+            Hero* copy = findCopy(hero);
+            copy->heroPower = findCopy(hero->heroPower);
+            copy->weapon = findCopy(hero->weapon);
+        }
+    });
+
+    // 4. Copy zones and choices of players
+    for (std::size_t i = 0; i < m_players.size(); ++i)
+    {
+        const Player& player = m_players[i];
+        Player& copy = game->m_players[i];
+
+        copy.SetHero(findCopy(player.GetHero()));
+        copy.galakrond = findCopy(player.galakrond);
+
+        copyZone(*player.GetDeckZone(), *copy.GetDeckZone());
+        copyZone(*player.GetHandZone(), *copy.GetHandZone());
+        copyZone(*player.GetFieldZone(), *copy.GetFieldZone());
+        copyZone(*player.GetGraveyardZone(), *copy.GetGraveyardZone());
+        copyZone(*player.GetSecretZone(), *copy.GetSecretZone());
+        copyZone(*player.GetSetasideZone(), *copy.GetSetasideZone());
+        copy.GetSecretZone()->quest = findCopy(player.GetSecretZone()->quest);
+
+        Choice** copiedChoice = &copy.choice;
+        for (const Choice* choice = player.choice; choice != nullptr;
+             choice = choice->nextChoice)
+        {
+            auto newChoice = new Choice(&copy, choice->cardSets);
+            newChoice->choiceType = choice->choiceType;
+            newChoice->choiceAction = choice->choiceAction;
+            newChoice->source = findCopy(choice->source);
+            newChoice->choices = choice->choices;
+            newChoice->entityStack = choice->entityStack;
+            newChoice->depth = choice->depth;
+            newChoice->lastChoice = choice->lastChoice;
+
+            *copiedChoice = newChoice;
+            copiedChoice = &newChoice->nextChoice;
+        }
+    }
+
+    // 5. Clone auras in the order of the aura list
+    std::unordered_map<const IAura*, const Playable*> auraOwners;
+    std::vector<const Playable*> triggerOwners;
+
+    for (const auto& [entity, copy] : entities)
+    {
+        const auto playable = dynamic_cast<const Playable*>(entity);
+        if (playable == nullptr)
+        {
+            continue;
+        }
+
+        if (playable->ongoingEffect != nullptr)
+        {
+            auraOwners.emplace(playable->ongoingEffect, playable);
+        }
+
+        if (playable->activatedTrigger != nullptr &&
+            !playable->activatedTrigger->IsRemoved())
+        {
+            triggerOwners.emplace_back(playable);
+        }
+    }
+
+    for (auto& aura : auras)
+    {
+        if (const auto iter = auraOwners.find(aura); iter != auraOwners.end())
+        {
+            aura->Clone(findCopy(iter->second));
+        }
+    }
+
+    // 6. Activate triggers in the order of play
+    std::sort(triggerOwners.begin(), triggerOwners.end(),
+              [](const Playable* lhs, const Playable* rhs) {
+                  if (lhs->orderOfPlay != rhs->orderOfPlay)
+                  {
+                      return lhs->orderOfPlay < rhs->orderOfPlay;
+                  }
+
+                  return lhs->GetGameTag(GameTag::ENTITY_ID) <
+                         rhs->GetGameTag(GameTag::ENTITY_ID);
+              });
+
+    for (auto& owner : triggerOwners)
+    {
+        const auto& trigger = owner->activatedTrigger;
+        trigger->Activate(findCopy(owner), trigger->triggerActivation, true);
+    }
+
+    // 7. Copy the states of game
+    for (auto& minion : summonedMinions)
+    {
+        game->summonedMinions.emplace_back(findCopy(minion));
+    }
+
+    for (auto& [orderOfPlay, minion] : deadMinions)
+    {
+        game->deadMinions.emplace(orderOfPlay, findCopy(minion));
+    }
+
+    game->rushMinions = rushMinions;
+    game->ghostlyCards = ghostlyCards;
+
+    for (auto& [entity, effect] : oneTurnEffects)
+    {
+        if (Entity* copy = findCopy(entity); copy != nullptr)
+        {
+            game->oneTurnEffects.emplace_back(copy, effect);
+        }
+    }
+
+    for (auto& enchantment : oneTurnEffectEnchantments)
+    {
+        if (const auto iter = enchantments.find(enchantment.get());
+            iter != enchantments.end())
+        {
+            game->oneTurnEffectEnchantments.emplace_back(iter->second);
+        }
+    }
+
+    if (currentEventData != nullptr)
+    {
+        game->currentEventData = std::make_unique<EventMetaData>(
+            findCopy(currentEventData->eventSource),
+            findCopy(currentEventData->eventTarget),
+            currentEventData->eventNumber);
+    }
+
+    for (auto& playable : taskStack.playables)
+    {
+        game->taskStack.playables.emplace_back(findCopy(playable));
+    }
+    game->taskStack.num = taskStack.num;
+    game->taskStack.flag = taskStack.flag;
+
+    game->taskQueue.CopyFrom(taskQueue, [&findCopy](const TaskFrame& frame) {
+        return TaskFrame{ findCopy(frame.player), findCopy(frame.source),
+                          findCopy(frame.target) };
+    });
+
+    game->zobrist.Rebuild(*game);
+
+    return game;
+}
+
+std::size_t Game::Checkpoint()
+{
+    journal.Start();
+
+    const std::size_t checkpoint = journal.GetSize();
+
+    // NOTE: The scalar states and the lists of game are restored at once
+    // instead of recording each write.
+    journal.RecordUndo(
+        [this, state = state, step = step, nextStep = nextStep,
+         summonedMinions = summonedMinions, deadMinions = deadMinions,
+         rushMinions = rushMinions, ghostlyCards = ghostlyCards,
+         turn = m_turn, entityID = m_entityID, oopIndex = m_oopIndex,
+         currentPlayer = m_currentPlayer,
+         playStates = std::array<PlayState, 2>{ m_players[0].playState,
+                                                m_players[1].playState },
+         cardsPlayedThisTurn =
+             std::array<std::vector<Card*>, 2>{
+                 m_players[0].cardsPlayedThisTurn,
+                 m_players[1].cardsPlayedThisTurn }]() {
+            this->state = state;
+            this->step = step;
+            this->nextStep = nextStep;
+            this->summonedMinions = summonedMinions;
+            this->deadMinions = deadMinions;
+            this->rushMinions = rushMinions;
+            this->ghostlyCards = ghostlyCards;
+            m_turn = turn;
+            m_entityID = entityID;
+            m_oopIndex = oopIndex;
+            m_currentPlayer = currentPlayer;
+
+            for (std::size_t i = 0; i < 2; ++i)
+            {
+                m_players[i].playState = playStates[i];
+                m_players[i].cardsPlayedThisTurn = cardsPlayedThisTurn[i];
+            }
+        });
+
+    // NOTE: The pending tasks, the random engine and the effects that last
+    // for a turn are restored at once as well.
+    std::optional<EventMetaData> eventData;
+    if (currentEventData != nullptr)
+    {
+        eventData = *currentEventData;
+    }
+
+    auto playerAuraEffects =
+        std::make_shared<std::array<PlayerAuraEffects, 2>>();
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        (*playerAuraEffects)[i] = m_players[i].playerAuraEffects;
+    }
+
+    journal.RecordUndo(
+        [this, random = random, taskQueue = taskQueue, taskStack = taskStack,
+         eventData, oneTurnEffects = oneTurnEffects,
+         oneTurnEffectEnchantments = oneTurnEffectEnchantments,
+         playerAuraEffects,
+         mulliganStates = std::array<Mulligan, 2>{ m_players[0].mulliganState,
+                                                   m_players[1].mulliganState },
+         choices = std::array<std::vector<Choice>, 2>{
+             CopyChoices(m_players[0].choice),
+             CopyChoices(m_players[1].choice) }]() {
+            this->random = random;
+            this->taskQueue = taskQueue;
+            this->taskStack = taskStack;
+            currentEventData =
+                eventData.has_value()
+                    ? std::make_unique<EventMetaData>(eventData.value())
+                    : nullptr;
+            this->oneTurnEffects = oneTurnEffects;
+            this->oneTurnEffectEnchantments = oneTurnEffectEnchantments;
+
+            for (std::size_t i = 0; i < 2; ++i)
+            {
+                Player& player = m_players[i];
+                player.playerAuraEffects = (*playerAuraEffects)[i];
+                player.mulliganState = mulliganStates[i];
+
+                DeleteChoices(player.choice);
+                player.choice = MakeChoices(choices[i]);
+            }
+        });
+
+    return checkpoint;
+}
+
+void Game::Rollback(std::size_t checkpoint)
+{
+    journal.Rollback(checkpoint);
+
+    // NOTE: The journal restores game tags without SetGameTag(),
+    // so the hash is rebuilt from the restored states.
+    zobrist.Rebuild(*this);
+
+    // NOTE: The closure that restores the scalar states was undone, so it is
+    // recorded again for the next rollback to the same checkpoint.
+    Checkpoint();
+}
+
+void Game::StopJournal()
+{
+    journal.Stop();
 }
 
 std::array<Card*, START_DECK_SIZE> Game::GetPlayerDeck(PlayerType type)
@@ -244,6 +639,7 @@ const Player* Game::GetCurrentPlayer() const
 void Game::SetCurrentPlayer(PlayerType playerType)
 {
     m_currentPlayer = playerType;
+    journal.NotifyMutation();
 }
 
 Player* Game::GetOpponentPlayer()
@@ -274,6 +670,7 @@ int Game::GetTurn() const
 void Game::SetTurn(int turn)
 {
     m_turn = turn;
+    journal.NotifyMutation();
 }
 
 std::size_t Game::GetNextID()
@@ -394,7 +791,7 @@ void Game::MainReady()
         player.GetHero()->SetNumAttacksThisTurn(0);
 
         // Field
-        for (auto& minion : player.GetFieldZone()->GetAll())
+        for (auto& minion : player.GetFieldZone()->GetView())
         {
             minion->SetNumAttacksThisTurn(0);
         }
@@ -422,7 +819,7 @@ void Game::MainReady()
     }
 
     // Field
-    for (auto& m : curPlayer->GetFieldZone()->GetAll())
+    for (auto& m : curPlayer->GetFieldZone()->GetView())
     {
         m->SetExhausted(false);
     }
@@ -524,12 +921,13 @@ void Game::MainEnd()
     {
         for (auto& minion : rushMinions)
         {
-            entityList[minion]->SetGameTag(GameTag::ATTACKABLE_BY_RUSH, 0);
+            entityList.Get(minion)->SetGameTag(GameTag::ATTACKABLE_BY_RUSH, 0);
         }
 
         rushMinions.clear();
     }
 
+    journal.RecordInt(GetCurrentPlayer()->GetHero()->damageTakenThisTurn);
     GetCurrentPlayer()->GetHero()->damageTakenThisTurn = 0;
 
     // Set next step
@@ -547,7 +945,7 @@ void Game::MainCleanUp()
     // Remove ghostly cards
     for (auto& id : ghostlyCards)
     {
-        Playable* playable = entityList[id];
+        Playable* playable = entityList.Get(id);
 
         if (playable->GetZoneType() != ZoneType::HAND)
         {
@@ -586,7 +984,7 @@ void Game::MainCleanUp()
         curPlayer->GetHero()->SetGameTag(GameTag::FROZEN, 0);
     }
     // Field
-    for (auto& minion : curPlayer->GetFieldZone()->GetAll())
+    for (auto& minion : curPlayer->GetFieldZone()->GetView())
     {
         if (minion->IsFrozen() && minion->GetNumAttacksThisTurn() == 0 &&
             !minion->IsExhausted())
@@ -749,10 +1147,33 @@ void Game::UpdateAura()
         return;
     }
 
+    // Skips updating if nothing is changed since auras were last updated
+    const std::uint64_t mutationCount = journal.GetMutationCount();
+    if (mutationCount == m_auraMutationCount)
+    {
+        m_numSkippedAuraUpdates += static_cast<std::size_t>(auraSize);
+        return;
+    }
+
     for (int i = auraSize - 1; i >= 0; --i)
     {
+        if (auras[i]->IsUpToDate())
+        {
+            ++m_numSkippedAuraUpdates;
+            continue;
+        }
+
         auras[i]->Update();
     }
+
+    // NOTE: The mutations made by updating auras are not regarded as updated,
+    // so that auras that depend on each other are updated again.
+    m_auraMutationCount = mutationCount;
+}
+
+std::size_t Game::GetNumSkippedAuraUpdates() const
+{
+    return m_numSkippedAuraUpdates;
 }
 
 std::tuple<PlayState, PlayState> Game::Process(Player* player,
@@ -849,6 +1270,30 @@ std::tuple<PlayState, PlayState> Game::PerformAction(ActionParams& params)
     return Process(GetCurrentPlayer(), std::move(task));
 }
 
+std::tuple<PlayState, PlayState> Game::ApplyMove(const Move& move)
+{
+    Player* player = GetCurrentPlayer();
+    Character* target = Move::GetCharacter(player, move.target);
+
+    switch (move.op)
+    {
+        case MainOpType::PLAY_CARD:
+            return Process(player,
+                           PlayCardTask((*player->GetHandZone())[move.source],
+                                        target, move.position, move.chooseOne));
+        case MainOpType::ATTACK:
+            return Process(player,
+                           AttackTask(Move::GetCharacter(player, move.source),
+                                      target));
+        case MainOpType::USE_HERO_POWER:
+            return Process(player, HeroPowerTask(target));
+        case MainOpType::END_TURN:
+            return Process(player, EndTurnTask());
+        default:
+            throw std::runtime_error("Invalid main op type");
+    }
+}
+
 ReducedBoardView Game::CreateView()
 {
     if (m_currentPlayer == PlayerType::PLAYER1)
@@ -861,6 +1306,11 @@ ReducedBoardView Game::CreateView()
     }
 }
 
+std::uint64_t Game::GetHash(PlayerType side) const
+{
+    return zobrist.Get(side, m_turn, m_currentPlayer);
+}
+
 std::tuple<PlayState, PlayState> Game::CheckGameOver()
 {
     // Check hero of two players is destroyed
@@ -891,4 +1341,9 @@ std::tuple<PlayState, PlayState> Game::CheckGameOver()
 
     return { GetPlayer1()->playState, GetPlayer2()->playState };
 }
+
+GameJournal& GetJournal(Game* game)
+{
+    return game->journal;
+}
 }  // namespace RosettaStone
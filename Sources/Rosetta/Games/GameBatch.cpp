@@ -0,0 +1,195 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Games/GameBatch.hpp>
+#include <Rosetta/Managers/GameManager.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace RosettaStone
+{
+GameBatch::GameBatch(const GameConfig& gameConfig, std::size_t size)
+    : m_gameConfig(gameConfig),
+      m_nextSeed(gameConfig.seed),
+      m_size(size),
+      m_games(std::make_unique<std::optional<Game>[]>(size)),
+      m_moves(size),
+      m_results(size)
+{
+    m_gameConfig.skipMulligan = true;
+    m_gameConfig.autoRun = false;
+
+    m_pending.reserve(size);
+
+    for (std::size_t i = 0; i < m_size; ++i)
+    {
+        CreateGame(i);
+    }
+}
+
+std::size_t GameBatch::GetSize() const
+{
+    return m_size;
+}
+
+std::size_t GameBatch::GetNumRunning() const
+{
+    std::size_t result = 0;
+
+    for (std::size_t i = 0; i < m_size; ++i)
+    {
+        if (GetGame(i).state != State::COMPLETE)
+        {
+            ++result;
+        }
+    }
+
+    return result;
+}
+
+Game& GameBatch::GetGame(std::size_t idx)
+{
+    return m_games[idx].value();
+}
+
+const Game& GameBatch::GetGame(std::size_t idx) const
+{
+    return m_games[idx].value();
+}
+
+void GameBatch::Start()
+{
+    for (std::size_t i = 0; i < m_size; ++i)
+    {
+        GetGame(i).Start();
+    }
+
+    AdvanceToAction();
+}
+
+void GameBatch::Reset(std::size_t idx)
+{
+    m_games[idx].reset();
+    CreateGame(idx);
+
+    m_moves[idx].clear();
+    m_results[idx] = Result();
+
+    GetGame(idx).Start();
+    AdvanceToAction();
+}
+
+void GameBatch::GenerateMoves()
+{
+    for (std::size_t i = 0; i < m_size; ++i)
+    {
+        const Game& game = GetGame(i);
+
+        if (game.state == State::COMPLETE)
+        {
+            m_moves[i].clear();
+            continue;
+        }
+
+        MoveGenerator(game).Generate(m_moves[i]);
+    }
+}
+
+const std::vector<Move>& GameBatch::GetMoves(std::size_t idx) const
+{
+    return m_moves[idx];
+}
+
+const std::vector<GameBatch::Result>& GameBatch::Step(
+    const std::vector<Move>& moves)
+{
+    if (moves.size() != m_size)
+    {
+        throw std::invalid_argument(
+            "GameBatch::Step() - The number of moves must be the same as the "
+            "number of games.");
+    }
+
+    for (std::size_t i = 0; i < m_size; ++i)
+    {
+        Game& game = GetGame(i);
+
+        if (game.state != State::COMPLETE)
+        {
+            game.ApplyMove(moves[i]);
+        }
+    }
+
+    AdvanceToAction();
+
+    for (std::size_t i = 0; i < m_size; ++i)
+    {
+        const Game& game = GetGame(i);
+
+        m_results[i].player1 = game.GetPlayer1()->playState;
+        m_results[i].player2 = game.GetPlayer2()->playState;
+        m_results[i].isComplete = game.state == State::COMPLETE;
+    }
+
+    return m_results;
+}
+
+void GameBatch::CreateGame(std::size_t idx)
+{
+    GameConfig config = m_gameConfig;
+    if (m_nextSeed.has_value())
+    {
+        config.seed = m_nextSeed.value()++;
+    }
+
+    m_games[idx].emplace(config);
+}
+
+void GameBatch::AdvanceToAction()
+{
+    while (true)
+    {
+        m_pending.clear();
+
+        for (std::size_t i = 0; i < m_size; ++i)
+        {
+            const Game& game = GetGame(i);
+
+            if (game.state != State::COMPLETE &&
+                game.step != Step::MAIN_ACTION)
+            {
+                m_pending.emplace_back(i);
+            }
+        }
+
+        if (m_pending.empty())
+        {
+            break;
+        }
+
+        // Runs the games at the same step back to back
+        std::stable_sort(m_pending.begin(), m_pending.end(),
+                         [this](std::size_t lhs, std::size_t rhs) {
+                             return GetGame(lhs).nextStep <
+                                    GetGame(rhs).nextStep;
+                         });
+
+        for (const std::size_t idx : m_pending)
+        {
+            Game& game = GetGame(idx);
+            GameManager::ProcessNextStep(game, game.nextStep);
+
+            // Same as Game::Process() after the steps are run by a task
+            if (game.step == Step::MAIN_ACTION)
+            {
+                game.taskStack.Reset();
+                game.CheckGameOver();
+            }
+        }
+    }
+}
+}  // namespace RosettaStone
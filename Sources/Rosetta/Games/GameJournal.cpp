@@ -0,0 +1,143 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Commons/GameTagStore.hpp>
+#include <Rosetta/Games/EntityList.hpp>
+#include <Rosetta/Games/GameJournal.hpp>
+
+namespace RosettaStone
+{
+void GameJournal::Start()
+{
+    m_isRecording = true;
+    ++m_epoch;
+}
+
+void GameJournal::Stop()
+{
+    m_isRecording = false;
+
+    m_entries.clear();
+    m_closures.clear();
+}
+
+std::size_t GameJournal::GetSize() const
+{
+    return m_entries.size();
+}
+
+void GameJournal::RecordGameTag(GameTagStore& tags, GameTag tag)
+{
+    ++m_mutationCount;
+
+    if (!m_isRecording)
+    {
+        return;
+    }
+
+    const int* value = tags.Find(tag);
+    Record(
+        [](const Entry& entry) {
+            auto& store = *static_cast<GameTagStore*>(entry.target);
+            const auto gameTag = static_cast<GameTag>(entry.key);
+
+            if (entry.exists)
+            {
+                store.Set(gameTag, entry.value);
+            }
+            else
+            {
+                store.Erase(gameTag);
+            }
+        },
+        &tags, nullptr, static_cast<int>(tag), value != nullptr ? *value : 0,
+        value != nullptr);
+}
+
+void GameJournal::RecordGameTag(std::map<GameTag, int>& tags, GameTag tag)
+{
+    ++m_mutationCount;
+
+    if (!m_isRecording)
+    {
+        return;
+    }
+
+    const auto iter = tags.find(tag);
+    Record(
+        [](const Entry& entry) {
+            auto& map = *static_cast<std::map<GameTag, int>*>(entry.target);
+            const auto gameTag = static_cast<GameTag>(entry.key);
+
+            if (entry.exists)
+            {
+                map.insert_or_assign(gameTag, entry.value);
+            }
+            else
+            {
+                map.erase(gameTag);
+            }
+        },
+        &tags, nullptr, static_cast<int>(tag),
+        iter != tags.end() ? iter->second : 0, iter != tags.end());
+}
+
+void GameJournal::RecordEntity(EntityList& entities, int id)
+{
+    Record(
+        [](const Entry& entry) {
+            static_cast<EntityList*>(entry.target)
+                ->Set(entry.key, static_cast<Playable*>(entry.object));
+        },
+        &entities, entities.Get(id), id);
+}
+
+void GameJournal::RecordUndo(std::function<void()> undo)
+{
+    ++m_mutationCount;
+
+    if (!m_isRecording)
+    {
+        return;
+    }
+
+    m_closures.emplace_back(std::move(undo));
+    Record(UndoClosure, this, nullptr, static_cast<int>(m_closures.size() - 1));
+}
+
+void GameJournal::Rollback(std::size_t size)
+{
+    // NOTE: The mutations made by undoing must not be recorded.
+    const bool isRecording = m_isRecording;
+    m_isRecording = false;
+
+    while (m_entries.size() > size)
+    {
+        const Entry entry = m_entries.back();
+        m_entries.pop_back();
+
+        entry.undo(entry);
+        ++m_mutationCount;
+    }
+
+    m_lastRollback = m_mutationCount;
+    ++m_epoch;
+
+    m_isRecording = isRecording;
+}
+
+void GameJournal::UndoClosure(const Entry& entry)
+{
+    auto journal = static_cast<GameJournal*>(entry.target);
+
+    // NOTE: The closures are undone in reverse order, so the closure of entry
+    // is always the last one.
+    const auto undo = std::move(journal->m_closures[entry.key]);
+    journal->m_closures.pop_back();
+
+    undo();
+}
+}  // namespace RosettaStone
@@ -33,10 +33,11 @@ GameRestorer GameRestorer::Prepare(BoardView& view,
 
 std::unique_ptr<Game> GameRestorer::RestoreGame()
 {
-    p1UnknownCardsManager.Prepare();
-    p2UnknownCardsManager.Prepare();
-
     std::unique_ptr<Game> game = std::make_unique<Game>();
+
+    p1UnknownCardsManager.Prepare(game->random);
+    p2UnknownCardsManager.Prepare(game->random);
+
     MakePlayer(PlayerType::PLAYER1, *game, m_view.GetPlayer1(),
                p1UnknownCardsManager);
     MakePlayer(PlayerType::PLAYER2, *game, m_view.GetPlayer2(),
@@ -93,9 +94,9 @@ void GameRestorer::MakeDeck(
 
     for (const auto& card : cards)
     {
-        const std::string cardID = card.GetCardID(unknownCardsSetsManager);
+        const CardHandle handle = card.GetCard(unknownCardsSetsManager);
         Playable* playable =
-            Entity::GetFromCard(player, Cards::FindCardByID(cardID),
+            Entity::GetFromCard(player, Cards::FindCardByHandle(handle),
                                 std::nullopt, player->GetDeckZone());
 
         player->GetDeckZone()->Add(playable);
@@ -112,9 +113,9 @@ void GameRestorer::MakeHand(
 
     for (const auto& card : cards)
     {
-        const std::string cardID = card.GetCardID(unknownCardsSetsManager);
+        const CardHandle handle = card.GetCard(unknownCardsSetsManager);
         Playable* playable =
-            Entity::GetFromCard(player, Cards::FindCardByID(cardID),
+            Entity::GetFromCard(player, Cards::FindCardByHandle(handle),
                                 std::nullopt, player->GetHandZone());
 
         player->GetHandZone()->Add(playable);
@@ -0,0 +1,266 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Games/ZobristHash.hpp>
+
+namespace RosettaStone
+{
+namespace
+{
+//! The seeds of the keys that aren't made of game tags.
+constexpr std::uint64_t PRESENCE_SEED = 0x5A0B'4F3C'8E21'D697;
+constexpr std::uint64_t COUNT_SEED = 0x2C6E'91B5'07D3'A84F;
+constexpr std::uint64_t PLAYER_SEED = 0x7F4A'7C15'9E37'79B9;
+constexpr std::uint64_t SIDE_SEED = 0x3D1B'58A2'C6E9'0F47;
+constexpr std::uint64_t TURN_SEED = 0x94D0'49BB'1331'11EB;
+constexpr std::uint64_t CURRENT_PLAYER_SEED = 0xBF58'476D'1CE4'E5B9;
+
+//! Mixes the bits of \p value into a well distributed 64-bit key.
+//! It is the finalizer of SplitMix64.
+//! \param value The value to mix.
+//! \return The mixed key.
+constexpr std::uint64_t Mix(std::uint64_t value)
+{
+    value += 0x9E37'79B9'7F4A'7C15;
+    value = (value ^ (value >> 30)) * 0xBF58'476D'1CE4'E5B9;
+    value = (value ^ (value >> 27)) * 0x94D0'49BB'1331'11EB;
+    return value ^ (value >> 31);
+}
+
+//! Returns the key of game tag of an object.
+//! \param object The key of the object that has the game tag.
+//! \param tag The game tag.
+//! \param value The value of game tag.
+//! \return The key of game tag.
+std::uint64_t GetTagKey(std::uint64_t object, GameTag tag, int value)
+{
+    return Mix(Mix(object ^ static_cast<std::uint64_t>(tag)) ^
+               static_cast<std::uint32_t>(value));
+}
+
+//! Returns the key of \p entity that is mixed into the keys of its game tags.
+//! \param id The entity ID.
+//! \return The key of the entity.
+std::uint64_t GetEntityKey(int id)
+{
+    return Mix(static_cast<std::uint64_t>(static_cast<std::uint32_t>(id))
+               << 16);
+}
+
+//! Returns the index of \p type in the arrays of players.
+//! \param type The player type.
+//! \return The index of \p type.
+std::size_t GetPlayerIndex(PlayerType type)
+{
+    return type == PlayerType::PLAYER1 ? 0 : 1;
+}
+
+//! Returns the index of \p zone in the arrays of counts, or -1 if the number
+//! of entities in \p zone isn't counted.
+//! \param zone The zone type.
+//! \return The index of \p zone.
+int GetCountIndex(ZoneType zone)
+{
+    switch (zone)
+    {
+        case ZoneType::DECK:
+            return 0;
+        case ZoneType::HAND:
+            return 1;
+        case ZoneType::SECRET:
+            return 2;
+        default:
+            return -1;
+    }
+}
+}  // namespace
+
+std::uint64_t ZobristHash::Get(PlayerType side, std::size_t turn,
+                               PlayerType currentPlayer) const
+{
+    const std::size_t idx = GetPlayerIndex(side);
+
+    return m_hashes[0] ^ m_hashes[idx + 1] ^ Mix(SIDE_SEED + idx) ^
+           Mix(TURN_SEED + turn) ^
+           Mix(CURRENT_PLAYER_SEED + static_cast<int>(currentPlayer));
+}
+
+void ZobristHash::AddEntity(Entity& entity)
+{
+    EntityState& state = entity.hashState;
+    state.zone = static_cast<ZoneType>(entity.m_gameTags.Get(GameTag::ZONE));
+    state.owner = entity.player != nullptr ? entity.player->playerType
+                                           : PlayerType::INVALID;
+
+    switch (state.zone)
+    {
+        case ZoneType::PLAY:
+            state.bucket = Bucket::PUBLIC;
+            break;
+        case ZoneType::HAND:
+        case ZoneType::SECRET:
+            state.bucket = state.owner == PlayerType::PLAYER1
+                               ? Bucket::PLAYER1
+                               : Bucket::PLAYER2;
+            break;
+        default:
+            state.bucket = Bucket::NONE;
+            break;
+    }
+
+    UpdateCount(state.owner, state.zone, 1);
+    ToggleEntity(entity, state.bucket);
+}
+
+void ZobristHash::RemoveEntity(Entity& entity)
+{
+    EntityState& state = entity.hashState;
+
+    UpdateCount(state.owner, state.zone, -1);
+    ToggleEntity(entity, state.bucket);
+
+    state = EntityState();
+}
+
+void ZobristHash::UpdateGameTag(const Entity& entity, GameTag tag, int value)
+{
+    const int base =
+        entity.card != nullptr ? entity.card->gameTags.Get(tag) : 0;
+    const int* oldValue = entity.m_gameTags.Find(tag);
+
+    if (oldValue != nullptr ? *oldValue == value : base == value)
+    {
+        return;
+    }
+
+    const std::uint64_t object =
+        GetEntityKey(entity.m_gameTags.Get(GameTag::ENTITY_ID));
+    std::uint64_t& hash = GetHash(entity.hashState.bucket);
+
+    // The game tag whose value is the same as its card contributes nothing
+    if (oldValue != nullptr && *oldValue != base)
+    {
+        hash ^= GetTagKey(object, tag, *oldValue);
+    }
+
+    if (value != base)
+    {
+        hash ^= GetTagKey(object, tag, value);
+    }
+}
+
+void ZobristHash::UpdatePlayerTag(const Player& player, GameTag tag,
+                                  int oldValue, int value)
+{
+    if (oldValue == value)
+    {
+        return;
+    }
+
+    const std::uint64_t object =
+        Mix(PLAYER_SEED + static_cast<int>(player.playerType));
+
+    if (oldValue != 0)
+    {
+        m_hashes[0] ^= GetTagKey(object, tag, oldValue);
+    }
+
+    if (value != 0)
+    {
+        m_hashes[0] ^= GetTagKey(object, tag, value);
+    }
+}
+
+void ZobristHash::Rebuild(Game& game)
+{
+    m_hashes.fill(0);
+    m_counts = {};
+
+    game.entityList.ForEach([this](Playable* entity) {
+        entity->hashState = EntityState();
+
+        if (entity->player != nullptr)
+        {
+            AddEntity(*entity);
+        }
+    });
+
+    for (const Player* player : { game.GetPlayer1(), game.GetPlayer2() })
+    {
+        for (const auto& [tag, value] : player->m_gameTags)
+        {
+            UpdatePlayerTag(*player, tag, 0, value);
+        }
+    }
+}
+
+std::uint64_t& ZobristHash::GetHash(Bucket bucket)
+{
+    switch (bucket)
+    {
+        case Bucket::PLAYER1:
+            return m_hashes[1];
+        case Bucket::PLAYER2:
+            return m_hashes[2];
+        default:
+            return m_hashes[0];
+    }
+}
+
+void ZobristHash::UpdateCount(PlayerType owner, ZoneType zone, int delta)
+{
+    const int zoneIdx = GetCountIndex(zone);
+    if (zoneIdx < 0 || owner == PlayerType::INVALID)
+    {
+        return;
+    }
+
+    const std::size_t playerIdx = GetPlayerIndex(owner);
+    int& count = m_counts[playerIdx][zoneIdx];
+    const std::uint64_t object =
+        Mix(COUNT_SEED + playerIdx * 4 + static_cast<std::size_t>(zoneIdx));
+
+    // The count of 0 contributes nothing, as the initial hash
+    if (count != 0)
+    {
+        m_hashes[0] ^= GetTagKey(object, GameTag::INVALID, count);
+    }
+
+    count += delta;
+
+    if (count != 0)
+    {
+        m_hashes[0] ^= GetTagKey(object, GameTag::INVALID, count);
+    }
+}
+
+void ZobristHash::ToggleEntity(const Entity& entity, Bucket bucket)
+{
+    if (bucket == Bucket::NONE)
+    {
+        return;
+    }
+
+    const std::uint64_t object =
+        GetEntityKey(entity.m_gameTags.Get(GameTag::ENTITY_ID));
+    std::uint64_t& hash = GetHash(bucket);
+
+    const std::uint64_t ordinal =
+        entity.card != nullptr ? entity.card->handle.GetOrdinal() : 0;
+    hash ^= Mix(object ^ PRESENCE_SEED ^ ordinal);
+
+    for (const auto& [tag, value] : entity.m_gameTags)
+    {
+        const int base =
+            entity.card != nullptr ? entity.card->gameTags.Get(tag) : 0;
+        if (value != base)
+        {
+            hash ^= GetTagKey(object, tag, value);
+        }
+    }
+}
+}  // namespace RosettaStone
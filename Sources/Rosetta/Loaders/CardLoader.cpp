@@ -4,13 +4,172 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Rosetta/Commons/MappedFile.hpp>
 #include <Rosetta/Loaders/CardLoader.hpp>
 
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <unordered_map>
+#include <utility>
 
 namespace RosettaStone
 {
+namespace
+{
+//! The magic number of the binary card database, "RSCD".
+constexpr std::uint32_t CARD_DATABASE_MAGIC = 0x44435352;
+
+//! The version of the binary card database. Increase it when the layout of
+//! records is changed. The changes of cards.json and the values of enums are
+//! detected by their hashes in the header.
+constexpr std::uint32_t CARD_DATABASE_VERSION = 2;
+
+//! The offset basis of 64-bit FNV-1a hash.
+constexpr std::uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325;
+
+//! The prime of 64-bit FNV-1a hash.
+constexpr std::uint64_t FNV_PRIME = 0x100000001b3;
+
+//!
+//! \brief CardDatabaseHeader struct.
+//!
+//! This struct is the header of the binary card database. The header is
+//! followed by the card records, the game tag records and the strings.
+//!
+struct CardDatabaseHeader
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t numGameTags;
+    std::uint32_t numCards;
+    std::uint32_t numTags;
+    std::uint32_t stringSize;
+    std::uint64_t enumHash;
+    std::uint64_t sourceSize;
+    std::uint64_t sourceHash;
+};
+
+//!
+//! \brief CardRecord struct.
+//!
+//! This struct is the record of a card in the binary card database. Strings
+//! are offsets into the interned string area, and game tags are a range of
+//! the game tag records.
+//!
+struct CardRecord
+{
+    std::int32_t dbfID;
+    std::uint32_t idOffset;
+    std::uint32_t idLength;
+    std::uint32_t nameOffset;
+    std::uint32_t nameLength;
+    std::uint32_t textOffset;
+    std::uint32_t textLength;
+    std::uint32_t tagOffset;
+    std::uint32_t tagCount;
+};
+
+//!
+//! \brief TagRecord struct.
+//!
+//! This struct is the record of a game tag in the binary card database.
+//!
+struct TagRecord
+{
+    std::int32_t tag;
+    std::int32_t value;
+};
+
+//! Reads a record of type \p T at \p offset of \p data.
+//! \param data The contents of the binary card database.
+//! \param offset The offset of the record.
+//! \return The record.
+template <typename T>
+T ReadRecord(const char* data, std::size_t offset)
+{
+    T record;
+    std::memcpy(&record, data + offset, sizeof(T));
+    return record;
+}
+
+//! Continues 64-bit FNV-1a hash \p hash with \p size bytes of \p data.
+//! \param hash The hash to continue.
+//! \param data The bytes to hash.
+//! \param size The number of bytes.
+//! \return The hash that is continued with the bytes.
+std::uint64_t HashBytes(std::uint64_t hash, const char* data, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+//! Continues \p hash with the names of an enum in order of their values.
+//! \param hash The hash to continue.
+//! \param names The names of the enum.
+//! \return The hash that is continued with the names.
+template <std::size_t N>
+std::uint64_t HashNames(std::uint64_t hash, const std::string (&names)[N])
+{
+    for (const auto& name : names)
+    {
+        // Includes the null character to separate the names
+        hash = HashBytes(hash, name.c_str(), name.size() + 1);
+    }
+
+    return HashBytes(hash, "", 1);
+}
+
+//! Returns the hash of the enums whose values are stored in the database.
+//! It is changed if their values are added, removed or reordered.
+//! \return The hash of the enums.
+std::uint64_t HashEnums()
+{
+    std::uint64_t hash = FNV_OFFSET_BASIS;
+    hash = HashNames(hash, CARD_CLASS_STR);
+    hash = HashNames(hash, CARD_SET_STR);
+    hash = HashNames(hash, CARD_TYPE_STR);
+    hash = HashNames(hash, FACTION_STR);
+    hash = HashNames(hash, GAME_TAG_STR);
+    hash = HashNames(hash, RACE_STR);
+    hash = HashNames(hash, RARITY_STR);
+
+    return hash;
+}
+
+//! Reads the size and the hash of cards.json that the database is made from.
+//! \param size The size of cards.json.
+//! \param hash The hash of cards.json.
+//! \return true if cards.json is read, false otherwise.
+bool HashSource(std::uint64_t& size, std::uint64_t& hash)
+{
+    MappedFile file;
+    if (!file.Open(RESOURCES_DIR "cards.json"))
+    {
+        return false;
+    }
+
+    size = file.GetSize();
+    hash = HashBytes(FNV_OFFSET_BASIS, file.GetData(), file.GetSize());
+
+    return true;
+}
+}  // namespace
+
 void CardLoader::Load(std::vector<Card*>& cards)
+{
+    if (!LoadFromBinary(CARD_DATABASE_PATH, cards))
+    {
+        LoadFromJSON(cards);
+    }
+}
+
+void CardLoader::LoadFromJSON(std::vector<Card*>& cards)
 {
     // Read card data from JSON file
     std::ifstream cardFile(RESOURCES_DIR "cards.json");
@@ -90,7 +249,7 @@ void CardLoader::Load(std::vector<Card*>& cards)
                                  ? 0
                                  : cardData["overload"].get<int>();
 
-        std::map<GameTag, int> gameTags;
+        GameTagStore gameTags;
         for (auto& mechanic : cardData["mechanics"])
         {
             GameTag gameTag = StrToEnum<GameTag>(mechanic.get<std::string>());
@@ -101,7 +260,7 @@ void CardLoader::Load(std::vector<Card*>& cards)
                 continue;
             }
 
-            gameTags.emplace(gameTag, 1);
+            gameTags.Set(gameTag, 1);
         }
 
         Card* card = new Card();
@@ -110,7 +269,7 @@ void CardLoader::Load(std::vector<Card*>& cards)
         card->name = name;
         card->text = text;
 
-        card->gameTags = gameTags;
+        card->gameTags = std::move(gameTags);
         card->gameTags[GameTag::ATK] = attack;
         card->gameTags[GameTag::CARDRACE] = cardRace;
         card->gameTags[GameTag::CARD_SET] = cardSet;
@@ -139,4 +298,181 @@ void CardLoader::Load(std::vector<Card*>& cards)
 
     cardFile.close();
 }
+
+bool CardLoader::LoadFromBinary(const std::string& path,
+                                std::vector<Card*>& cards)
+{
+    MappedFile file;
+    if (!file.Open(path) || file.GetSize() < sizeof(CardDatabaseHeader))
+    {
+        return false;
+    }
+
+    const char* data = file.GetData();
+    const auto header = ReadRecord<CardDatabaseHeader>(data, 0);
+
+    if (header.magic != CARD_DATABASE_MAGIC ||
+        header.version != CARD_DATABASE_VERSION ||
+        header.numGameTags != NUM_GAME_TAGS || header.enumHash != HashEnums())
+    {
+        return false;
+    }
+
+    // The database is outdated if cards.json is changed after it is made
+    std::uint64_t sourceSize = 0;
+    std::uint64_t sourceHash = 0;
+    if (!HashSource(sourceSize, sourceHash) ||
+        header.sourceSize != sourceSize || header.sourceHash != sourceHash)
+    {
+        return false;
+    }
+
+    const std::size_t cardsOffset = sizeof(CardDatabaseHeader);
+    const std::size_t tagsOffset =
+        cardsOffset + header.numCards * sizeof(CardRecord);
+    const std::size_t stringsOffset =
+        tagsOffset + header.numTags * sizeof(TagRecord);
+
+    if (file.GetSize() != stringsOffset + header.stringSize)
+    {
+        return false;
+    }
+
+    // NOTE: Validate all records first, so that a broken database doesn't
+    // leave cards that are partially loaded.
+    for (std::size_t i = 0; i < header.numCards; ++i)
+    {
+        const auto record =
+            ReadRecord<CardRecord>(data, cardsOffset + i * sizeof(CardRecord));
+
+        if (std::uint64_t{ record.idOffset } + record.idLength >
+                header.stringSize ||
+            std::uint64_t{ record.nameOffset } + record.nameLength >
+                header.stringSize ||
+            std::uint64_t{ record.textOffset } + record.textLength >
+                header.stringSize ||
+            std::uint64_t{ record.tagOffset } + record.tagCount >
+                header.numTags)
+        {
+            return false;
+        }
+    }
+
+    for (std::size_t i = 0; i < header.numTags; ++i)
+    {
+        const auto record =
+            ReadRecord<TagRecord>(data, tagsOffset + i * sizeof(TagRecord));
+
+        if (record.tag < 0 ||
+            static_cast<std::size_t>(record.tag) >= NUM_GAME_TAGS)
+        {
+            return false;
+        }
+    }
+
+    const char* strings = data + stringsOffset;
+    cards.reserve(cards.size() + header.numCards);
+
+    for (std::size_t i = 0; i < header.numCards; ++i)
+    {
+        const auto record =
+            ReadRecord<CardRecord>(data, cardsOffset + i * sizeof(CardRecord));
+
+        Card* card = new Card();
+        card->id.assign(strings + record.idOffset, record.idLength);
+        card->dbfID = record.dbfID;
+        card->name.assign(strings + record.nameOffset, record.nameLength);
+        card->text.assign(strings + record.textOffset, record.textLength);
+
+        for (std::size_t j = 0; j < record.tagCount; ++j)
+        {
+            const auto tag = ReadRecord<TagRecord>(
+                data, tagsOffset + (record.tagOffset + j) * sizeof(TagRecord));
+            card->gameTags.Set(static_cast<GameTag>(tag.tag), tag.value);
+        }
+
+        cards.emplace_back(card);
+    }
+
+    return true;
+}
+
+void CardLoader::SaveToBinary(const std::vector<Card*>& cards,
+                              const std::string& path)
+{
+    std::vector<CardRecord> cardRecords;
+    std::vector<TagRecord> tagRecords;
+    std::string strings;
+    std::unordered_map<std::string, std::uint32_t> stringOffsets;
+
+    // Stores each distinct string once and returns its offset
+    const auto Intern = [&](const std::string& str) {
+        const auto [iter, isInserted] = stringOffsets.try_emplace(
+            str, static_cast<std::uint32_t>(strings.size()));
+        if (isInserted)
+        {
+            strings += str;
+        }
+
+        return iter->second;
+    };
+
+    cardRecords.reserve(cards.size());
+
+    for (const auto& card : cards)
+    {
+        CardRecord record{};
+        record.dbfID = card->dbfID;
+        record.idOffset = Intern(card->id);
+        record.idLength = static_cast<std::uint32_t>(card->id.size());
+        record.nameOffset = Intern(card->name);
+        record.nameLength = static_cast<std::uint32_t>(card->name.size());
+        record.textOffset = Intern(card->text);
+        record.textLength = static_cast<std::uint32_t>(card->text.size());
+        record.tagOffset = static_cast<std::uint32_t>(tagRecords.size());
+
+        for (const auto& gameTag : card->gameTags)
+        {
+            tagRecords.push_back(
+                TagRecord{ static_cast<std::int32_t>(gameTag.first),
+                           static_cast<std::int32_t>(gameTag.second) });
+        }
+
+        record.tagCount =
+            static_cast<std::uint32_t>(tagRecords.size()) - record.tagOffset;
+        cardRecords.emplace_back(record);
+    }
+
+    CardDatabaseHeader header{};
+    header.magic = CARD_DATABASE_MAGIC;
+    header.version = CARD_DATABASE_VERSION;
+    header.numGameTags = static_cast<std::uint32_t>(NUM_GAME_TAGS);
+    header.numCards = static_cast<std::uint32_t>(cardRecords.size());
+    header.numTags = static_cast<std::uint32_t>(tagRecords.size());
+    header.stringSize = static_cast<std::uint32_t>(strings.size());
+    header.enumHash = HashEnums();
+
+    if (!HashSource(header.sourceSize, header.sourceHash))
+    {
+        throw std::runtime_error("Can't open cards.json");
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Can't open " + path);
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(cardRecords.data()),
+               cardRecords.size() * sizeof(CardRecord));
+    file.write(reinterpret_cast<const char*>(tagRecords.data()),
+               tagRecords.size() * sizeof(TagRecord));
+    file.write(strings.data(), strings.size());
+
+    if (!file)
+    {
+        throw std::runtime_error("Can't write " + path);
+    }
+}
 }  // namespace RosettaStone
@@ -13,16 +13,24 @@ void InternalCardLoader::Load(std::vector<Card*>& cards)
 {
     for (auto& card : cards)
     {
-        const auto cardDef =
+        const CardDef* cardDef =
             CardDefs::GetInstance().FindCardDefByCardID(card->id);
 
-        card->power = cardDef.power;
-        card->playRequirements = cardDef.playReqs;
-        card->chooseCardIDs = cardDef.chooseCardIDs;
-        card->entourages = cardDef.entourages;
+        // NOTE: Only the power is shared with the card def. The other data
+        // are small and are read from the fields of the card directly.
+        card->cardDef = cardDef;
+
+        if (cardDef != nullptr)
+        {
+            card->playRequirements = cardDef->playReqs;
+            card->chooseCardIDs = cardDef->chooseCardIDs;
+            card->entourages = cardDef->entourages;
+        }
+
         card->gameTags[GameTag::QUEST_PROGRESS_TOTAL] =
-            cardDef.questProgressTotal;
-        card->gameTags[GameTag::HERO_POWER] = cardDef.heroPowerDbfID;
+            cardDef != nullptr ? cardDef->questProgressTotal : 0;
+        card->gameTags[GameTag::HERO_POWER] =
+            cardDef != nullptr ? cardDef->heroPowerDbfID : 0;
 
         // NOTE: Load some game tag data
         // Scheme series
@@ -8,50 +8,120 @@
 #include <Rosetta/Models/Player.hpp>
 
 #include <stdexcept>
+#include <utility>
 
 namespace RosettaStone
 {
+TargetingPredicate::TargetingPredicate(std::function<bool(Character*)> func)
+    : m_func(std::move(func))
+{
+    // Do nothing
+}
+
+TargetingPredicate::TargetingPredicate(Op op, int value)
+    : m_op(op), m_value(value)
+{
+    // Do nothing
+}
+
+bool TargetingPredicate::operator()(Character* character) const
+{
+    switch (m_op)
+    {
+        case Op::CUSTOM:
+            return m_func(character);
+        case Op::ANY:
+            return true;
+        case Op::RACE:
+            return character->IsRace(static_cast<Race>(m_value));
+        case Op::DEATHRATTLE:
+            return character->HasDeathrattle();
+        case Op::DAMAGED:
+            return character->GetDamage() > 0;
+        case Op::UNDAMAGED:
+            return character->GetDamage() == 0;
+        case Op::MAX_ATTACK:
+            return character->GetAttack() <= m_value;
+        case Op::MIN_ATTACK:
+            return character->GetAttack() >= m_value;
+        case Op::TAUNT:
+            return character->HasTaunt();
+    }
+
+    return false;
+}
+
+AvailabilityPredicate::AvailabilityPredicate(
+    std::function<bool(Player*, Card*)> func)
+    : m_func(std::move(func))
+{
+    // Do nothing
+}
+
+AvailabilityPredicate::AvailabilityPredicate(Op op) : m_op(op)
+{
+    // Do nothing
+}
+
+bool AvailabilityPredicate::operator()(Player* player, Card* card) const
+{
+    switch (m_op)
+    {
+        case Op::CUSTOM:
+            return m_func(player, card);
+        case Op::COMBO_ACTIVE:
+            return player->IsComboActive();
+    }
+
+    return false;
+}
+
 TargetingPredicate TargetingPredicates::ReqMurlocTarget()
 {
-    return [](Character* character) { return character->IsRace(Race::MURLOC); };
+    return TargetingPredicate(TargetingPredicate::Op::RACE,
+                              static_cast<int>(Race::MURLOC));
 }
 
 TargetingPredicate TargetingPredicates::ReqDemonTarget()
 {
-    return [](Character* character) { return character->IsRace(Race::DEMON); };
+    return TargetingPredicate(TargetingPredicate::Op::RACE,
+                              static_cast<int>(Race::DEMON));
 }
 
 TargetingPredicate TargetingPredicates::ReqMechanicalTarget()
 {
-    return [](Character* character) {
-        return character->IsRace(Race::MECHANICAL);
-    };
+    return TargetingPredicate(TargetingPredicate::Op::RACE,
+                              static_cast<int>(Race::MECHANICAL));
 }
 
 TargetingPredicate TargetingPredicates::ReqElementalTarget()
 {
-    return
-        [](Character* character) { return character->IsRace(Race::ELEMENTAL); };
+    return TargetingPredicate(TargetingPredicate::Op::RACE,
+                              static_cast<int>(Race::ELEMENTAL));
 }
 
 TargetingPredicate TargetingPredicates::ReqBeastTarget()
 {
-    return [](Character* character) { return character->IsRace(Race::BEAST); };
+    return TargetingPredicate(TargetingPredicate::Op::RACE,
+                              static_cast<int>(Race::BEAST));
 }
 
 TargetingPredicate TargetingPredicates::ReqTotemTarget()
 {
-    return [](Character* character) { return character->IsRace(Race::TOTEM); };
+    return TargetingPredicate(TargetingPredicate::Op::RACE,
+                              static_cast<int>(Race::TOTEM));
 }
 
 TargetingPredicate TargetingPredicates::ReqPirateTarget()
 {
-    return [](Character* character) { return character->IsRace(Race::PIRATE); };
+    return TargetingPredicate(TargetingPredicate::Op::RACE,
+                              static_cast<int>(Race::PIRATE));
 }
 
 TargetingPredicate TargetingPredicates::ReqDragonTarget()
 {
-    return [](Character* character) { return character->IsRace(Race::DRAGON); };
+    return TargetingPredicate(TargetingPredicate::Op::RACE,
+                              static_cast<int>(Race::DRAGON));
 }
 
 TargetingPredicate TargetingPredicates::ReqTargetWithRace(Race race)
@@ -76,7 +146,7 @@ TargetingPredicate TargetingPredicates::ReqTargetWithRace(Race race)
             return ReqDragonTarget();
         case Race::UNDEAD:
         case Race::EGG:
-            return []([[maybe_unused]] Character* character) { return true; };
+            return TargetingPredicate(TargetingPredicate::Op::ANY);
         default:
             throw std::invalid_argument(
                 "TargetingPredicates::ReqTargetWithRace() - "
@@ -86,40 +156,36 @@ TargetingPredicate TargetingPredicates::ReqTargetWithRace(Race race)
 
 TargetingPredicate TargetingPredicates::ReqTargetWithDeathrattle()
 {
-    return [=](Character* character) { return character->HasDeathrattle(); };
+    return TargetingPredicate(TargetingPredicate::Op::DEATHRATTLE);
 }
 
 TargetingPredicate TargetingPredicates::ReqDamagedTarget()
 {
-    return [=](Character* character) { return character->GetDamage() > 0; };
+    return TargetingPredicate(TargetingPredicate::Op::DAMAGED);
 }
 
 TargetingPredicate TargetingPredicates::ReqUndamagedTarget()
 {
-    return [=](Character* character) { return character->GetDamage() == 0; };
+    return TargetingPredicate(TargetingPredicate::Op::UNDAMAGED);
 }
 
 TargetingPredicate TargetingPredicates::ReqTargetMaxAttack(int value)
 {
-    return
-        [=](Character* character) { return character->GetAttack() <= value; };
+    return TargetingPredicate(TargetingPredicate::Op::MAX_ATTACK, value);
 }
 
 TargetingPredicate TargetingPredicates::ReqTargetMinAttack(int value)
 {
-    return
-        [=](Character* character) { return character->GetAttack() >= value; };
+    return TargetingPredicate(TargetingPredicate::Op::MIN_ATTACK, value);
 }
 
 AvailabilityPredicate TargetingPredicates::ReqTargetForCombo()
 {
-    return [](Player* player, [[maybe_unused]] Card* card) {
-        return player->IsComboActive();
-    };
+    return AvailabilityPredicate(AvailabilityPredicate::Op::COMBO_ACTIVE);
 }
 
 TargetingPredicate TargetingPredicates::ReqMustTargetTaunter()
 {
-    return [=](Character* character) { return character->HasTaunt(); };
+    return TargetingPredicate(TargetingPredicate::Op::TAUNT);
 }
 }  // namespace RosettaStone
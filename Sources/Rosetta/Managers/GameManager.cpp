@@ -10,6 +10,8 @@ namespace RosettaStone
 {
 void GameManager::ProcessNextStep(Game& game, Step step)
 {
+    game.journal.NotifyMutation();
+
     switch (step)
     {
         case Step::BEGIN_FIRST:
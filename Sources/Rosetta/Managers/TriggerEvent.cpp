@@ -6,79 +6,169 @@
 
 #include <Rosetta/Managers/TriggerEvent.hpp>
 
-#include <algorithm>
+#include <utility>
 
 namespace RosettaStone
 {
-void TriggerEvent::AddHandler(const TriggerEventHandler& handler)
+TriggerEvent::Handle TriggerEvent::AddHandler(
+    const TriggerEventHandler& handler)
 {
-    m_handlers.emplace_back(std::make_unique<TriggerEventHandler>(handler));
+    std::uint32_t slotIdx;
+    if (!m_freeSlots.empty())
+    {
+        slotIdx = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else
+    {
+        slotIdx = static_cast<std::uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    }
+
+    // NOTE: The handlers that are added while notifying are stored apart, so
+    // the handlers being run are not moved.
+    Slot& slot = m_slots[slotIdx];
+    slot.isPending = m_notifyDepth > 0;
+
+    auto& entries = slot.isPending ? m_pendingEntries : m_entries;
+    slot.index = static_cast<std::uint32_t>(entries.size());
+    entries.emplace_back(Entry{ handler, slotIdx, false });
+
+    return Handle{ slotIdx, slot.generation };
 }
 
-void TriggerEvent::RemoveHandler(const TriggerEventHandler& handler)
+void TriggerEvent::RemoveHandler(Handle handle)
 {
-    if (m_isNotifying)
+    if (!Contains(handle))
     {
-        for (auto& _handler : m_handlers)
-        {
-            if (*_handler == handler)
-            {
-                _handler->toBeRemoved = true;
-                break;
-            }
-        }
+        return;
     }
-    else
+
+    Slot& slot = m_slots[handle.index];
+    ++slot.generation;
+
+    // NOTE: The handlers that are removed while notifying are still run for
+    // the event being notified, so they are removed after notifying.
+    if (m_notifyDepth > 0)
+    {
+        m_deferredSlots.emplace_back(handle.index);
+        return;
+    }
+
+    Remove(handle.index);
+
+    if (m_numRemoved * 2 > m_entries.size())
     {
-        m_handlers.erase(
-            std::remove_if(
-                m_handlers.begin(), m_handlers.end(),
-                [&](const std::unique_ptr<TriggerEventHandler>& _handler) {
-                    return *_handler == handler;
-                }),
-            m_handlers.end());
+        Compact();
     }
 }
 
+bool TriggerEvent::Contains(Handle handle) const
+{
+    return handle.index < m_slots.size() &&
+           m_slots[handle.index].generation == handle.generation;
+}
+
+std::size_t TriggerEvent::GetCount() const
+{
+    return m_entries.size() + m_pendingEntries.size() - m_numRemoved -
+           m_deferredSlots.size();
+}
+
 void TriggerEvent::operator()(Entity* entity)
 {
     NotifyHandlers(entity);
 }
 
-TriggerEvent& TriggerEvent::operator+=(const TriggerEventHandler& handler)
+void TriggerEvent::NotifyHandlers(Entity* entity)
 {
-    AddHandler(handler);
+    ++m_notifyDepth;
 
-    return *this;
+    const std::size_t count = m_entries.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (!m_entries[i].isRemoved)
+        {
+            m_entries[i].handler(entity);
+        }
+    }
+
+    --m_notifyDepth;
+
+    if (m_notifyDepth > 0)
+    {
+        return;
+    }
+
+    RemoveDeferred();
+
+    if (m_numRemoved > 0 || !m_pendingEntries.empty())
+    {
+        Compact();
+    }
 }
 
-TriggerEvent& TriggerEvent::operator-=(const TriggerEventHandler& handler)
+void TriggerEvent::Remove(std::uint32_t slotIdx)
 {
-    RemoveHandler(handler);
+    GetEntry(m_slots[slotIdx]).isRemoved = true;
+    m_freeSlots.emplace_back(slotIdx);
+    ++m_numRemoved;
+}
 
-    return *this;
+void TriggerEvent::RemoveDeferred()
+{
+    for (const std::uint32_t slotIdx : m_deferredSlots)
+    {
+        Remove(slotIdx);
+    }
+
+    m_deferredSlots.clear();
 }
 
-void TriggerEvent::NotifyHandlers(Entity* entity)
+TriggerEvent::Entry& TriggerEvent::GetEntry(const Slot& slot)
 {
-    m_isNotifying = true;
+    return slot.isPending ? m_pendingEntries[slot.index]
+                          : m_entries[slot.index];
+}
 
-    for (auto& func : m_handlers)
+void TriggerEvent::Compact()
+{
+    // Keeps the order of subscription
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < m_entries.size(); ++i)
     {
-        if (func != nullptr)
+        if (m_entries[i].isRemoved)
         {
-            (*func)(entity);
+            continue;
         }
+
+        m_slots[m_entries[i].slot].index = static_cast<std::uint32_t>(count);
+        if (count != i)
+        {
+            m_entries[count] = std::move(m_entries[i]);
+        }
+
+        ++count;
     }
 
-    m_handlers.erase(
-        std::remove_if(
-            m_handlers.begin(), m_handlers.end(),
-            [&](const std::unique_ptr<TriggerEventHandler>& handler) {
-                return handler->toBeRemoved;
-            }),
-        m_handlers.end());
+    m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(count),
+                    m_entries.end());
+
+    for (auto& entry : m_pendingEntries)
+    {
+        if (entry.isRemoved)
+        {
+            continue;
+        }
+
+        Slot& slot = m_slots[entry.slot];
+        slot.index = static_cast<std::uint32_t>(m_entries.size());
+        slot.isPending = false;
+
+        m_entries.emplace_back(std::move(entry));
+    }
 
-    m_isNotifying = false;
+    m_pendingEntries.clear();
+    m_numRemoved = 0;
 }
 }  // namespace RosettaStone
@@ -23,40 +23,6 @@ TriggerEventHandler::TriggerEventHandler(Func func)
     // Do nothing
 }
 
-TriggerEventHandler& TriggerEventHandler::operator=(
-    const TriggerEventHandler& handler)
-{
-    if (&handler == this)
-    {
-        return *this;
-    }
-
-    if (m_func == nullptr)
-    {
-        m_func = handler;
-        id = ++counter;
-    }
-
-    return *this;
-}
-
-TriggerEventHandler& TriggerEventHandler::operator=(
-    TriggerEventHandler&& handler) noexcept
-{
-    if (&handler == this)
-    {
-        return *this;
-    }
-
-    if (m_func == nullptr)
-    {
-        m_func = handler;
-        id = ++counter;
-    }
-
-    return *this;
-}
-
 void TriggerEventHandler::operator()(Entity* entity) const
 {
     if (m_func)
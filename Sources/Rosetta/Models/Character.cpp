@@ -15,8 +15,7 @@
 
 namespace RosettaStone
 {
-Character::Character(Player* player, Card* card, std::map<GameTag, int> tags,
-                     int id)
+Character::Character(Player* player, Card* card, GameTagStore tags, int id)
     : Playable(player, card, std::move(tags), id)
 {
     // Do nothing
@@ -202,8 +201,7 @@ bool Character::CantAttackHeroes() const
 
 bool Character::IsValidAttackTarget(Player* opponent, Character* target) const
 {
-    auto targets = GetValidAttackTargets(opponent);
-    if (std::find(targets.begin(), targets.end(), target) == targets.end())
+    if (!GetValidAttackTargetMask(opponent).Has(opponent->opponent, target))
     {
         return false;
     }
@@ -227,40 +225,35 @@ bool Character::IsValidAttackTarget(Player* opponent, Character* target) const
 
 std::vector<Character*> Character::GetValidAttackTargets(Player* opponent) const
 {
-    bool isExistTauntInField = false;
-    std::vector<Character*> targets;
-    std::vector<Character*> targetsHaveTaunt;
+    return GetValidAttackTargetMask(opponent).GetCharacters(opponent->opponent);
+}
 
-    for (auto& minion : opponent->GetFieldZone()->GetAll())
-    {
-        if (!minion->HasStealth())
-        {
-            if (minion->HasTaunt())
-            {
-                isExistTauntInField = true;
-                targetsHaveTaunt.emplace_back(minion);
-                continue;
-            }
-
-            if (!isExistTauntInField)
-            {
-                targets.emplace_back(minion);
-            }
-        }
-    }
+TargetMask Character::GetValidAttackTargetMask(Player* opponent) const
+{
+    return GetValidAttackTargetMask(CharacterMasks::Build(opponent));
+}
 
-    if (isExistTauntInField)
+TargetMask Character::GetValidAttackTargetMask(
+    const CharacterMasks& enemy) const
+{
+    const SideMask minions = enemy.occupied & MINION_BITS & ~enemy.stealth;
+
+    // The minions that have taunt must be attacked first
+    if (const SideMask taunts = minions & enemy.taunt; taunts != 0)
     {
-        return targetsHaveTaunt;
+        return TargetMask(0, taunts);
     }
 
-    if (!CantAttackHeroes() && !opponent->GetHero()->IsImmune() &&
-        !opponent->GetHero()->HasStealth())
+    SideMask targets = minions;
+
+    if (const SideMask hero = enemy.occupied & ~MINION_BITS &
+                              ~enemy.immune & ~enemy.stealth;
+        hero != 0 && !CantAttackHeroes())
     {
-        targets.emplace_back(opponent->GetHero());
+        targets |= hero;
     }
 
-    return targets;
+    return TargetMask(0, targets);
 }
 
 int Character::TakeDamage(Playable* source, int damage)
@@ -277,6 +270,7 @@ int Character::TakeDamage(Playable* source, int damage)
     const bool isFatigue = (hero != nullptr) && (this == source);
     if (isFatigue)
     {
+        game->journal.RecordInt(hero->fatigue);
         hero->fatigue = damage;
     }
 
@@ -343,6 +337,7 @@ int Character::TakeDamage(Playable* source, int damage)
 
     if (hero != nullptr)
     {
+        game->journal.RecordInt(hero->damageTakenThisTurn);
         hero->damageTakenThisTurn += amount;
     }
 
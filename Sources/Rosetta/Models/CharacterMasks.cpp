@@ -0,0 +1,89 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Models/CharacterMasks.hpp>
+#include <Rosetta/Models/Player.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+
+namespace RosettaStone
+{
+namespace
+{
+//! Adds the states of \p character to \p masks at \p bit.
+//! \param masks The masks of the characters.
+//! \param character The character to add.
+//! \param bit The bit of \p character.
+//! \param isCurrentPlayer Whether the owner of \p character is on turn.
+void AddCharacter(CharacterMasks& masks, const Character* character, int bit,
+                  bool isCurrentPlayer)
+{
+    const auto mask = static_cast<SideMask>(1 << bit);
+
+    masks.occupied |= mask;
+
+    if (character->card->IsUntouchable())
+    {
+        masks.untouchable |= mask;
+    }
+
+    if (character->HasTaunt())
+    {
+        masks.taunt |= mask;
+    }
+
+    if (character->HasStealth())
+    {
+        masks.stealth |= mask;
+    }
+
+    if (character->IsImmune())
+    {
+        masks.immune |= mask;
+    }
+
+    if (character->GetGameTag(GameTag::CANT_BE_TARGETED_BY_SPELLS))
+    {
+        masks.cantBeTargetedBySpells |= mask;
+    }
+
+    if (character->GetGameTag(GameTag::CANT_BE_TARGETED_BY_HERO_POWERS))
+    {
+        masks.cantBeTargetedByHeroPowers |= mask;
+    }
+
+    // Same as Character::CanAttack()
+    if (isCurrentPlayer && !character->IsFrozen() &&
+        !character->IsExhausted() && character->GetAttack() != 0 &&
+        !character->CantAttack())
+    {
+        masks.canAttack |= mask;
+    }
+}
+}  // namespace
+
+CharacterMasks CharacterMasks::Build(const Player* player)
+{
+    CharacterMasks masks;
+    const bool isCurrentPlayer = player == player->game->GetCurrentPlayer();
+
+    FieldZone& fieldZone = *player->GetFieldZone();
+    for (int pos = 0; pos < fieldZone.GetCount(); ++pos)
+    {
+        const Minion* minion = fieldZone[pos];
+        if (minion == nullptr || minion->isDestroyed)
+        {
+            continue;
+        }
+
+        AddCharacter(masks, minion, pos, isCurrentPlayer);
+    }
+
+    AddCharacter(masks, player->GetHero(), HERO_BIT, isCurrentPlayer);
+
+    return masks;
+}
+}  // namespace RosettaStone
@@ -36,7 +36,7 @@ void Choice::TryPrepare()
 
     if (choiceAction == ChoiceAction::SWAMPQUEEN_HAGATHA)
     {
-        auto playable = player->game->entityList[lastChoice];
+        auto playable = player->game->entityList.Get(lastChoice);
         bool isTargetingCard = false;
 
         for (auto& playReq : playable->card->playRequirements)
@@ -82,7 +82,8 @@ void Choice::TryPrepare()
         }
     }
 
-    auto cards = SimpleTasks::DiscoverTask::GetChoices(cardSets, 3);
+    auto cards =
+        SimpleTasks::DiscoverTask::GetChoices(player->game, cardSets, 3);
 
     std::vector<int> choiceCards;
     choiceCards.reserve(3);
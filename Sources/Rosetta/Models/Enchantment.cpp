@@ -13,8 +13,8 @@
 
 namespace RosettaStone
 {
-Enchantment::Enchantment(Player* player, Card* card,
-                         std::map<GameTag, int> tags, Entity* target, int id)
+Enchantment::Enchantment(Player* player, Card* card, GameTagStore tags,
+                         Entity* target, int id)
     : Playable(player, card, std::move(tags), id), m_target(target)
 {
     // Do nothing
@@ -27,7 +27,7 @@ std::shared_ptr<Enchantment> Enchantment::GetInstance(Player* player,
 {
     const int id = player->game->GetNextID();
 
-    std::map<GameTag, int> tags;
+    GameTagStore tags;
     tags[GameTag::ENTITY_ID] = id;
     tags[GameTag::CONTROLLER] = player->playerID;
     tags[GameTag::ZONE] = static_cast<int>(ZoneType::SETASIDE);
@@ -42,9 +42,11 @@ std::shared_ptr<Enchantment> Enchantment::GetInstance(Player* player,
         }
     }
 
-    auto instance =
-        std::make_shared<Enchantment>(player, card, tags, target, id);
+    auto instance = std::allocate_shared<Enchantment>(
+        ArenaAllocator<Enchantment>(player->game->arena), player, card, tags,
+        target, id);
 
+    player->game->journal.RecordValue(target->appliedEnchantments);
     target->appliedEnchantments.emplace_back(instance);
 
     if (card->gameTags[GameTag::TAG_ONE_TURN_EFFECT] == 1)
@@ -55,7 +57,7 @@ std::shared_ptr<Enchantment> Enchantment::GetInstance(Player* player,
 
     instance->orderOfPlay = player->game->GetNextOOP();
 
-    if (!card->power.GetDeathrattleTask().empty())
+    if (!card->GetPower().GetDeathrattleTask().empty())
     {
         dynamic_cast<Playable*>(target)->SetGameTag(GameTag::DEATHRATTLE, 1);
     }
@@ -95,19 +97,14 @@ void Enchantment::SetCapturedCard(Card* card)
 
 void Enchantment::Remove()
 {
-    if (const auto deathrattleTask = card->power.GetDeathrattleTask();
+    if (const auto deathrattleTask = card->GetPower().GetDeathrattleTask();
         !deathrattleTask.empty() &&
         m_target->zone->GetType() == ZoneType::GRAVEYARD)
     {
-        for (auto& power : card->power.GetDeathrattleTask())
+        for (auto& power : card->GetPower().GetDeathrattleTask())
         {
-            std::unique_ptr<ITask> clonedPower = power->Clone();
-
-            clonedPower->SetPlayer(m_target->player);
-            clonedPower->SetSource(m_target);
-            clonedPower->SetTarget(this);
-
-            game->taskQueue.Enqueue(std::move(clonedPower));
+            game->taskQueue.Enqueue(
+                power, TaskFrame{ m_target->player, m_target, this });
         }
     }
 
@@ -121,4 +118,14 @@ void Enchantment::Remove()
         activatedTrigger->Remove();
     }
 }
+
+void Enchantment::CopyStatesFrom(const Entity& rhs)
+{
+    Playable::CopyStatesFrom(rhs);
+
+    const auto& enchantment = dynamic_cast<const Enchantment&>(rhs);
+
+    m_capturedCard = enchantment.m_capturedCard;
+    m_isOneTurnActive = enchantment.m_isOneTurnActive;
+}
 }  // namespace RosettaStone
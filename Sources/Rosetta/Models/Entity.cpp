@@ -16,13 +16,10 @@
 
 namespace RosettaStone
 {
-Entity::Entity(Game* _game, Card* _card, std::map<GameTag, int> _tags, int _id)
+Entity::Entity(Game* _game, Card* _card, GameTagStore _tags, int _id)
     : game(_game), card(_card), m_gameTags(std::move(_tags))
 {
-    for (auto& gameTag : _card->gameTags)
-    {
-        Entity::SetGameTag(gameTag.first, gameTag.second);
-    }
+    m_gameTags.Merge(_card->gameTags);
 
     Entity::SetGameTag(GameTag::ENTITY_ID,
                        _id < 0 ? static_cast<int>(game->GetNextID()) : _id);
@@ -30,12 +27,10 @@ Entity::Entity(Game* _game, Card* _card, std::map<GameTag, int> _tags, int _id)
 
 Entity::~Entity()
 {
-    delete auraEffects;
-
-    m_gameTags.clear();
+    m_gameTags.Clear();
 }
 
-std::map<GameTag, int> Entity::GetGameTags() const
+GameTagStore Entity::GetGameTags() const
 {
     return m_gameTags;
 }
@@ -44,31 +39,18 @@ int Entity::GetGameTag(GameTag tag) const
 {
     int value = 0;
 
-    const auto entityVal = m_gameTags.find(tag);
-    if (entityVal == m_gameTags.end())
+    if (const int* entityVal = m_gameTags.Find(tag); entityVal != nullptr)
     {
-        if (card != nullptr)
-        {
-            const auto cardVal = card->gameTags.find(tag);
-            if (cardVal != card->gameTags.end())
-            {
-                value = cardVal->second;
-            }
-        }
-
-        if (auraEffects != nullptr)
-        {
-            value += auraEffects->GetGameTag(tag);
-        }
+        value = *entityVal;
     }
-    else
+    else if (card != nullptr)
     {
-        value += entityVal->second;
+        value = card->gameTags.Get(tag);
+    }
 
-        if (auraEffects != nullptr)
-        {
-            value += auraEffects->GetGameTag(tag);
-        }
+    if (auraEffects != nullptr)
+    {
+        value += auraEffects->GetGameTag(tag);
     }
 
     return value > 0 ? value : 0;
@@ -76,7 +58,15 @@ int Entity::GetGameTag(GameTag tag) const
 
 void Entity::SetGameTag(GameTag tag, int value)
 {
-    m_gameTags.insert_or_assign(tag, value);
+    game->journal.RecordGameTag(m_gameTags, tag);
+
+    if (hashState.bucket != ZobristHash::Bucket::NONE)
+    {
+        game->zobrist.UpdateGameTag(*this, tag, value);
+    }
+
+    m_gameTags.Set(tag, value);
+    m_lastMutation = game->journal.GetMutationCount();
 }
 
 int Entity::GetCardTarget() const
@@ -91,28 +81,79 @@ void Entity::SetCardTarget(int value)
 
 void Entity::Reset()
 {
-    m_gameTags.erase(GameTag::DAMAGE);
-    m_gameTags.erase(GameTag::EXHAUSTED);
-    m_gameTags.erase(GameTag::ATK);
-    m_gameTags.erase(GameTag::HEALTH);
-    m_gameTags.erase(GameTag::COST);
-    m_gameTags.erase(GameTag::TAUNT);
-    m_gameTags.erase(GameTag::FROZEN);
-    m_gameTags.erase(GameTag::CHARGE);
-    m_gameTags.erase(GameTag::WINDFURY);
-    m_gameTags.erase(GameTag::DIVINE_SHIELD);
-    m_gameTags.erase(GameTag::STEALTH);
-    m_gameTags.erase(GameTag::NUM_ATTACKS_THIS_TURN);
+    game->journal.NotifyMutation();
+
+    if (game->journal.IsRecording())
+    {
+        for (const auto tag :
+             { GameTag::DAMAGE, GameTag::EXHAUSTED, GameTag::ATK,
+               GameTag::HEALTH, GameTag::COST, GameTag::TAUNT, GameTag::FROZEN,
+               GameTag::CHARGE, GameTag::WINDFURY, GameTag::DIVINE_SHIELD,
+               GameTag::STEALTH, GameTag::NUM_ATTACKS_THIS_TURN })
+        {
+            game->journal.RecordGameTag(m_gameTags, tag);
+        }
+    }
+
+    game->zobrist.RemoveEntity(*this);
+
+    m_gameTags.Erase(GameTag::DAMAGE);
+    m_gameTags.Erase(GameTag::EXHAUSTED);
+    m_gameTags.Erase(GameTag::ATK);
+    m_gameTags.Erase(GameTag::HEALTH);
+    m_gameTags.Erase(GameTag::COST);
+    m_gameTags.Erase(GameTag::TAUNT);
+    m_gameTags.Erase(GameTag::FROZEN);
+    m_gameTags.Erase(GameTag::CHARGE);
+    m_gameTags.Erase(GameTag::WINDFURY);
+    m_gameTags.Erase(GameTag::DIVINE_SHIELD);
+    m_gameTags.Erase(GameTag::STEALTH);
+    m_gameTags.Erase(GameTag::NUM_ATTACKS_THIS_TURN);
+
+    game->zobrist.AddEntity(*this);
+    m_lastMutation = game->journal.GetMutationCount();
+}
+
+void Entity::NotifyMutation()
+{
+    game->journal.NotifyMutation();
+    m_lastMutation = game->journal.GetMutationCount();
+}
+
+void Entity::CopyStatesFrom(const Entity& rhs)
+{
+    m_gameTags = rhs.m_gameTags;
+
+    auraEffects = rhs.auraEffects != nullptr
+                      ? game->arena.Create<AuraEffects>(*rhs.auraEffects)
+                      : nullptr;
+}
+
+AuraEffects* Entity::GetOrCreateAuraEffects()
+{
+    if (auraEffects == nullptr)
+    {
+        game->journal.RecordPointer(auraEffects);
+        auraEffects = game->arena.Create<AuraEffects>(card->GetCardType());
+    }
+
+    game->journal.RecordState(m_auraEffectsEpoch, [this]() {
+        return [effects = auraEffects, saved = *auraEffects]() {
+            *effects = saved;
+        };
+    });
+
+    return auraEffects;
 }
 
 Playable* Entity::GetFromCard(Player* player, Card* card,
-                              std::optional<std::map<GameTag, int>> cardTags,
+                              std::optional<GameTagStore> cardTags,
                               IZone* zone, int id)
 {
-    std::map<GameTag, int> tags;
+    GameTagStore tags;
     if (cardTags.has_value())
     {
-        tags = cardTags.value();
+        tags = std::move(cardTags.value());
     }
 
     tags[GameTag::CONTROLLER] = player->playerID;
@@ -124,20 +165,25 @@ Playable* Entity::GetFromCard(Player* player, Card* card,
     switch (card->GetCardType())
     {
         case CardType::HERO:
-            result = new Hero(player, card, tags, id);
+            result = player->game->arena.Create<Hero>(player, card,
+                                                      std::move(tags), id);
             break;
         case CardType::HERO_POWER:
             tags[GameTag::ZONE] = static_cast<int>(ZoneType::PLAY);
-            result = new HeroPower(player, card, tags, id);
+            result = player->game->arena.Create<HeroPower>(
+                player, card, std::move(tags), id);
             break;
         case CardType::MINION:
-            result = new Minion(player, card, tags, id);
+            result = player->game->arena.Create<Minion>(
+                player, card, std::move(tags), id);
             break;
         case CardType::SPELL:
-            result = new Spell(player, card, tags, id);
+            result = player->game->arena.Create<Spell>(player, card,
+                                                       std::move(tags), id);
             break;
         case CardType::WEAPON:
-            result = new Weapon(player, card, tags, id);
+            result = player->game->arena.Create<Weapon>(
+                player, card, std::move(tags), id);
             break;
         default:
             throw std::invalid_argument(
@@ -145,8 +191,10 @@ Playable* Entity::GetFromCard(Player* player, Card* card,
     }
 
     // Add entity to list
-    player->game->entityList.emplace(result->GetGameTag(GameTag::ENTITY_ID),
-                                     result);
+    player->game->journal.RecordEntity(
+        player->game->entityList, result->GetGameTag(GameTag::ENTITY_ID));
+    player->game->entityList.Set(result->GetGameTag(GameTag::ENTITY_ID),
+                                 result);
 
     return result;
 }
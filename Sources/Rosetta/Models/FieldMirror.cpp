@@ -0,0 +1,180 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Models/FieldMirror.hpp>
+#include <Rosetta/Models/Player.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+
+#include <algorithm>
+
+namespace RosettaStone
+{
+namespace
+{
+//! Returns the keyword if \p value is true, or 0 otherwise.
+//! \param value The value to check.
+//! \param keyword The keyword to return.
+//! \return The keyword if \p value is true, or 0 otherwise.
+std::uint32_t GetKeyword(bool value, FieldMirror::Keyword keyword)
+{
+    return value ? static_cast<std::uint32_t>(keyword) : 0;
+}
+
+//! Fills the lane \p lane of \p mirror with the states of \p character.
+//! \param mirror The mirror of the characters.
+//! \param character The character to fill.
+//! \param lane The lane of \p character.
+void FillLane(FieldMirror& mirror, const Character* character, int lane)
+{
+    mirror.occupied |= static_cast<SideMask>(1 << lane);
+
+    mirror.attack[lane] = character->GetAttack();
+    mirror.health[lane] = character->GetHealth();
+    mirror.damage[lane] = character->GetDamage();
+    mirror.spellPower[lane] = character->GetSpellPower();
+    mirror.race[lane] = static_cast<std::int32_t>(character->card->GetRace());
+
+    const bool canAttack = character->CanAttack();
+    const bool hasMegaWindfury = character->HasMegaWindfury();
+    const bool hasWindfury = character->HasWindfury();
+
+    // The attacks left is at least 1 if it can attack, because it is
+    // exhausted after the last attack.
+    if (canAttack)
+    {
+        const int numAttacks = hasMegaWindfury ? 4 : (hasWindfury ? 2 : 1);
+        mirror.attacksLeft[lane] =
+            std::max(numAttacks - character->GetNumAttacksThisTurn(), 1);
+    }
+
+    mirror.keywords[lane] =
+        GetKeyword(character->HasTaunt(), FieldMirror::TAUNT) |
+        GetKeyword(character->HasDivineShield(), FieldMirror::DIVINE_SHIELD) |
+        GetKeyword(character->HasStealth(), FieldMirror::STEALTH) |
+        GetKeyword(character->IsImmune(), FieldMirror::IMMUNE) |
+        GetKeyword(character->IsFrozen(), FieldMirror::FROZEN) |
+        GetKeyword(hasWindfury, FieldMirror::WINDFURY) |
+        GetKeyword(hasMegaWindfury, FieldMirror::MEGA_WINDFURY) |
+        GetKeyword(character->HasPoisonous(), FieldMirror::POISONOUS) |
+        GetKeyword(character->HasLifesteal(), FieldMirror::LIFESTEAL) |
+        GetKeyword(canAttack, FieldMirror::CAN_ATTACK) |
+        GetKeyword(character->CantAttackHeroes(),
+                   FieldMirror::CANT_ATTACK_HEROES);
+}
+}  // namespace
+
+FieldMirror FieldMirror::Build(const Player* player)
+{
+    FieldMirror mirror;
+
+    FieldZone& fieldZone = *player->GetFieldZone();
+    for (int pos = 0; pos < fieldZone.GetCount(); ++pos)
+    {
+        const Minion* minion = fieldZone[pos];
+        if (minion == nullptr || minion->isDestroyed)
+        {
+            continue;
+        }
+
+        FillLane(mirror, minion, pos);
+
+        // A minion that has only rush can't attack heroes until next turn
+        mirror.keywords[pos] |=
+            GetKeyword(minion->HasCharge(), CHARGE) |
+            GetKeyword(minion->IsRush(), RUSH) |
+            GetKeyword(minion->HasReborn(), REBORN) |
+            GetKeyword(minion->IsAttackableByRush(), CANT_ATTACK_HEROES);
+    }
+
+    const Hero* hero = player->GetHero();
+    FillLane(mirror, hero, HERO_BIT);
+    mirror.armor[HERO_BIT] = hero->GetArmor();
+
+    return mirror;
+}
+
+int FieldMirror::GetTotalAttack(SideMask mask) const
+{
+    const SideMask lanes = mask & occupied;
+
+    int result = 0;
+    for (int i = 0; i < NUM_LANES; ++i)
+    {
+        result += attack[i] * ((lanes >> i) & 1);
+    }
+
+    return result;
+}
+
+int FieldMirror::GetFaceDamage() const
+{
+    int result = 0;
+    for (int i = 0; i < NUM_LANES; ++i)
+    {
+        const auto canAttackFace = static_cast<int>(
+            (keywords[i] & (CAN_ATTACK | CANT_ATTACK_HEROES)) == CAN_ATTACK);
+        result += attack[i] * attacksLeft[i] * canAttackFace;
+    }
+
+    return result;
+}
+
+bool FieldMirror::HasLethal(const FieldMirror& enemy) const
+{
+    // The minions that have taunt and stealth can't be attacked
+    std::uint32_t blockers = 0;
+    for (int i = 0; i < MAX_FIELD_SIZE; ++i)
+    {
+        blockers |= static_cast<std::uint32_t>(
+            (enemy.keywords[i] & (TAUNT | STEALTH)) == TAUNT);
+    }
+
+    const std::uint32_t heroKeywords = enemy.keywords[HERO_BIT];
+    if (blockers != 0 || (heroKeywords & (IMMUNE | STEALTH)) != 0)
+    {
+        return false;
+    }
+
+    return GetFaceDamage() >= enemy.health[HERO_BIT] + enemy.armor[HERO_BIT];
+}
+
+SideMask FieldMirror::DamageAllMinions(int amount)
+{
+    SideMask dead = 0;
+
+    for (int i = 0; i < MAX_FIELD_SIZE; ++i)
+    {
+        const int isOccupied = (occupied >> i) & 1;
+        const int isHit =
+            isOccupied & static_cast<int>((keywords[i] & IMMUNE) == 0);
+        const int hasShield =
+            static_cast<int>((keywords[i] & DIVINE_SHIELD) != 0);
+        const int dealt = amount * isHit * (1 - hasShield);
+
+        health[i] -= dealt;
+        damage[i] += dealt;
+        keywords[i] &= ~(DIVINE_SHIELD * static_cast<std::uint32_t>(isHit));
+        dead |= static_cast<SideMask>(
+            (isOccupied & static_cast<int>(health[i] <= 0)) << i);
+    }
+
+    return dead;
+}
+
+int FieldMirror::CountRace(Race race) const
+{
+    const auto value = static_cast<std::int32_t>(race);
+
+    int result = 0;
+    for (int i = 0; i < MAX_FIELD_SIZE; ++i)
+    {
+        result +=
+            ((occupied >> i) & 1) & static_cast<int>(this->race[i] == value);
+    }
+
+    return result;
+}
+}  // namespace RosettaStone
@@ -13,17 +13,12 @@
 
 namespace RosettaStone
 {
-Hero::Hero(Player* player, Card* card, std::map<GameTag, int> tags, int id)
+Hero::Hero(Player* player, Card* card, GameTagStore tags, int id)
     : Character(player, card, std::move(tags), id)
 {
     // Do nothing
 }
 
-Hero::~Hero()
-{
-    delete weapon;
-}
-
 int Hero::GetAttack() const
 {
     return HasWeapon() ? Character::GetAttack() + weapon->GetAttack()
@@ -44,7 +39,9 @@ void Hero::AddWeapon(Weapon& _weapon)
 {
     RemoveWeapon();
 
+    game->journal.RecordPointer(weapon);
     weapon = &_weapon;
+    game->journal.RecordInt(weapon->orderOfPlay);
     weapon->orderOfPlay = game->GetNextOOP();
     weapon->SetZoneType(ZoneType::PLAY);
     weapon->SetZonePosition(0);
@@ -73,6 +70,7 @@ void Hero::RemoveWeapon()
 
     player->GetGraveyardZone()->Add(weapon);
 
+    game->journal.RecordPointer(weapon);
     weapon = nullptr;
 }
 
@@ -95,4 +93,14 @@ bool Hero::HasLifesteal() const
 
     return false;
 }
+
+void Hero::CopyStatesFrom(const Entity& rhs)
+{
+    Character::CopyStatesFrom(rhs);
+
+    const auto& hero = dynamic_cast<const Hero&>(rhs);
+
+    fatigue = hero.fatigue;
+    damageTakenThisTurn = hero.damageTakenThisTurn;
+}
 }  // namespace RosettaStone
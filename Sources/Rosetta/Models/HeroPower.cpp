@@ -11,8 +11,7 @@
 
 namespace RosettaStone
 {
-HeroPower::HeroPower(Player* player, Card* card, std::map<GameTag, int> tags,
-                     int id)
+HeroPower::HeroPower(Player* player, Card* card, GameTagStore tags, int id)
     : Playable(player, card, std::move(tags), id)
 {
     // Do nothing
@@ -23,4 +22,9 @@ bool HeroPower::TargetingRequirements(Card* card, Character* target) const
     return !target->GetGameTag(GameTag::CANT_BE_TARGETED_BY_HERO_POWERS) &&
            Playable::TargetingRequirements(card, target);
 }
+
+SideMask HeroPower::GetUntargetableMask(const CharacterMasks& masks) const
+{
+    return masks.cantBeTargetedByHeroPowers;
+}
 }  // namespace RosettaStone
@@ -16,7 +16,7 @@
 
 namespace RosettaStone
 {
-Minion::Minion(Player* player, Card* card, std::map<GameTag, int> tags, int id)
+Minion::Minion(Player* player, Card* card, GameTagStore tags, int id)
     : Character(player, card, std::move(tags), id)
 {
     // Do nothing
@@ -153,7 +153,7 @@ void Minion::Silence()
         const auto size = static_cast<int>(appliedEnchantments.size());
         for (int i = size - 1; i >= 0; --i)
         {
-            if (appliedEnchantments[i]->card->power.GetAura() != nullptr)
+            if (appliedEnchantments[i]->card->GetPower().GetAura() != nullptr)
             {
                 appliedEnchantments[i]->Remove();
             }
@@ -163,7 +163,8 @@ void Minion::Silence()
     // NOTE: Abyssal Destroyer's Attack, Health, and Mana cost are set upon
     // being summoned and are not changed when targeted by effects that remove
     // enchantments.
-    if (card->id == "DRG_207t")
+    static const CardHandle abyssalDestroyer = Cards::GetHandle("DRG_207t");
+    if (card->IsCard(abyssalDestroyer, "DRG_207t"))
     {
         SetGameTag(GameTag::ATK, GetGameTag(GameTag::TAG_SCRIPT_DATA_NUM_1));
 
@@ -230,7 +231,9 @@ void Minion::Reset()
             game->deadMinions.erase(iter);
         }
 
+        game->journal.RecordBool(isDestroyed);
         isDestroyed = false;
+        NotifyMutation();
     }
 }
 
@@ -12,16 +12,11 @@
 #include <Rosetta/Zones/FieldZone.hpp>
 #include <Rosetta/Zones/SetasideZone.hpp>
 
-#include <effolkronium/random.hpp>
-
 #include <utility>
 
-using Random = effolkronium::random_static;
-
 namespace RosettaStone
 {
-Playable::Playable(Player* _player, Card* _card, std::map<GameTag, int> _tags,
-                   int _id)
+Playable::Playable(Player* _player, Card* _card, GameTagStore _tags, int _id)
     : Entity(_player->game, _card, std::move(_tags), _id)
 {
     player = _player;
@@ -39,7 +34,9 @@ ZoneType Playable::GetZoneType() const
 
 void Playable::SetZoneType(ZoneType type)
 {
+    game->zobrist.RemoveEntity(*this);
     SetGameTag(GameTag::ZONE, static_cast<int>(type));
+    game->zobrist.AddEntity(*this);
 }
 
 int Playable::GetZonePosition() const
@@ -134,15 +131,37 @@ bool Playable::IsEcho() const
     return GetGameTag(GameTag::ECHO) == 1;
 }
 
+void Playable::CopyStatesFrom(const Entity& rhs)
+{
+    Entity::CopyStatesFrom(rhs);
+
+    const auto& playable = dynamic_cast<const Playable&>(rhs);
+
+    orderOfPlay = playable.orderOfPlay;
+    isDestroyed = playable.isDestroyed;
+
+    if (playable.costManager != nullptr)
+    {
+        // NOTE: Adaptive cost effect will be set when the aura is cloned.
+        costManager = new CostManager(*playable.costManager);
+        costManager->DeactivateAdaptiveEffect();
+    }
+}
+
 void Playable::ResetCost()
 {
+    game->journal.RecordPointer(costManager);
     costManager = nullptr;
-    if (const auto iter = m_gameTags.find(GameTag::COST);
-        iter != m_gameTags.end())
+    game->journal.RecordGameTag(m_gameTags, GameTag::COST);
+
+    if (hashState.bucket != ZobristHash::Bucket::NONE)
     {
-        m_gameTags.erase(iter);
+        game->zobrist.UpdateGameTag(*this, GameTag::COST,
+                                    card->gameTags.Get(GameTag::COST));
     }
 
+    m_gameTags.Erase(GameTag::COST);
+
     if (const auto effect = dynamic_cast<AdaptiveCostEffect*>(ongoingEffect);
         effect != nullptr)
     {
@@ -152,7 +171,9 @@ void Playable::ResetCost()
 
 void Playable::Destroy()
 {
+    game->journal.RecordBool(isDestroyed);
     isDestroyed = true;
+    NotifyMutation();
 }
 
 bool Playable::IsPlayable()
@@ -165,6 +186,12 @@ bool Playable::TargetingRequirements(Card* card, Character* target) const
     return card->TargetingRequirements(player, target);
 }
 
+SideMask Playable::GetUntargetableMask(
+    [[maybe_unused]] const CharacterMasks& masks) const
+{
+    return 0;
+}
+
 bool Playable::IsPlayableByPlayer()
 {
     // Check if player has enough mana to play card
@@ -229,6 +256,23 @@ bool Playable::IsPlayableByCardReq() const
 }
 
 std::vector<Character*> Playable::GetValidPlayTargets() const
+{
+    return GetValidPlayTargetMask().GetCharacters(player);
+}
+
+TargetMask Playable::GetValidPlayTargetMask() const
+{
+    if (card->dbfID != 52812 && card->targetingType == TargetingType::NONE)
+    {
+        return TargetMask();
+    }
+
+    return GetValidPlayTargetMask(CharacterMasks::Build(player),
+                                  CharacterMasks::Build(player->opponent));
+}
+
+TargetMask Playable::GetValidPlayTargetMask(const CharacterMasks& friendly,
+                                            const CharacterMasks& enemy) const
 {
     // NOTE: Card 'Drustvar Horror' (DAL_431t) has two generated spells.
     // These cards can be targeting or non-targeting.
@@ -239,25 +283,22 @@ std::vector<Character*> Playable::GetValidPlayTargets() const
         const auto card2 =
             Cards::FindCardByDbfID(GetGameTag(GameTag::TAG_SCRIPT_DATA_ENT_2));
 
-        auto targets1 = card1->GetValidPlayTargets(player);
-        auto targets2 = card2->GetValidPlayTargets(player);
-
-        std::vector<Character*> targets;
-        targets.reserve(targets1.size() + targets2.size());
-
-        for (auto& target : targets1)
-        {
-            targets.emplace_back(target);
-        }
-        for (auto& target : targets2)
-        {
-            targets.emplace_back(target);
-        }
+        const TargetMask targets1 =
+            card1->GetValidPlayTargetMask(player, friendly, enemy);
+        const TargetMask targets2 =
+            card2->GetValidPlayTargetMask(player, friendly, enemy);
 
-        return targets;
+        return TargetMask((targets1.GetFriendly() | targets2.GetFriendly()) &
+                              ~GetUntargetableMask(friendly),
+                          (targets1.GetEnemy() | targets2.GetEnemy()) &
+                              ~GetUntargetableMask(enemy));
     }
 
-    return card->GetValidPlayTargets(player);
+    const TargetMask targets =
+        card->GetValidPlayTargetMask(player, friendly, enemy);
+
+    return TargetMask(targets.GetFriendly() & ~GetUntargetableMask(friendly),
+                      targets.GetEnemy() & ~GetUntargetableMask(enemy));
 }
 
 Character* Playable::GetRandomValidTarget()
@@ -268,7 +309,8 @@ Character* Playable::GetRandomValidTarget()
         return nullptr;
     }
 
-    const auto idx = Random::get<std::size_t>(0, validTargets.size() - 1);
+    const auto idx =
+        game->random.Get<std::size_t>(0, validTargets.size() - 1);
     Character* randTarget = validTargets[idx];
     SetCardTarget(randTarget->GetGameTag(GameTag::ENTITY_ID));
 
@@ -409,7 +451,7 @@ bool Playable::HasAnyValidPlayTargets(Card* card) const
 
     if (friendlyMinions)
     {
-        for (auto& minion : player->GetFieldZone()->GetAll())
+        for (auto& minion : player->GetFieldZone()->GetView())
         {
             if (TargetingRequirements(card, minion))
             {
@@ -420,7 +462,7 @@ bool Playable::HasAnyValidPlayTargets(Card* card) const
 
     if (enemyMinions)
     {
-        for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+        for (auto& minion : player->opponent->GetFieldZone()->GetView())
         {
             if (TargetingRequirements(card, minion))
             {
@@ -511,37 +553,51 @@ void Playable::ActivateTask(PowerType type, Character* target, int chooseOne,
         playable->ActivateTask(type, target, chooseOne, this);
     }
 
-    std::vector<std::shared_ptr<ITask>> tasks;
+    const std::vector<std::shared_ptr<ITask>>* tasks = nullptr;
     switch (type)
     {
         case PowerType::POWER:
-            tasks = card->power.GetPowerTask();
+            tasks = &card->GetPower().GetPowerTask();
             break;
         case PowerType::DEATHRATTLE:
-            tasks = card->power.GetDeathrattleTask();
+            tasks = &card->GetPower().GetDeathrattleTask();
             break;
         case PowerType::COMBO:
-            tasks = card->power.GetComboTask();
+            tasks = &card->GetPower().GetComboTask();
             break;
         case PowerType::OUTCAST:
-            tasks = card->power.GetOutcastTask();
+            tasks = &card->GetPower().GetOutcastTask();
             break;
     }
 
-    if (tasks.empty() || tasks[0] == nullptr)
+    if (tasks == nullptr || tasks->empty() || (*tasks)[0] == nullptr)
     {
         return;
     }
 
-    for (auto& task : tasks)
-    {
-        std::unique_ptr<ITask> clonedTask = task->Clone();
+    const TaskFrame frame{ player, chooseBase == nullptr ? this : chooseBase,
+                           target };
 
-        clonedTask->SetPlayer(player);
-        clonedTask->SetSource(chooseBase == nullptr ? this : chooseBase);
-        clonedTask->SetTarget(target);
+    for (auto& task : *tasks)
+    {
+        game->taskQueue.Enqueue(task, frame);
+    }
+}
 
-        game->taskQueue.Enqueue(std::move(clonedTask));
+CostManager* Playable::GetOrCreateCostManager()
+{
+    if (costManager == nullptr)
+    {
+        game->journal.RecordPointer(costManager);
+        costManager = new CostManager();
     }
+
+    game->journal.RecordState(m_costManagerEpoch, [this]() {
+        return [manager = costManager, saved = *costManager]() {
+            *manager = saved;
+        };
+    });
+
+    return costManager;
 }
 }  // namespace RosettaStone
@@ -6,6 +6,7 @@
 
 #include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Commons/Utils.hpp>
+#include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Models/HeroPower.hpp>
 #include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Zones/DeckZone.hpp>
@@ -29,12 +30,7 @@ Player::Player() : playerID(USER_INVALID)
 
 Player::~Player()
 {
-    // TODO: This code will refactor.
-    if (m_hero)
-    {
-        delete m_hero->heroPower;
-    }
-    delete m_hero;
+    // NOTE: The hero and the hero power are owned by the arena of game.
 }
 
 void Player::RefCopy(const Player& rhs)
@@ -44,8 +40,6 @@ void Player::RefCopy(const Player& rhs)
         return;
     }
 
-    delete m_hero;
-
     nickname = rhs.nickname;
     playerType = rhs.playerType;
     playerID = rhs.playerID;
@@ -67,6 +61,25 @@ void Player::RefCopy(const Player& rhs)
     m_gameTags = rhs.m_gameTags;
 }
 
+void Player::CopyStatesFrom(const Entity& rhs)
+{
+    Entity::CopyStatesFrom(rhs);
+
+    const auto& player = dynamic_cast<const Player&>(rhs);
+
+    nickname = player.nickname;
+    playerID = player.playerID;
+
+    baseClass = player.baseClass;
+    playState = player.playState;
+    mulliganState = player.mulliganState;
+
+    playerAuraEffects = player.playerAuraEffects;
+    cardsPlayedThisTurn = player.cardsPlayedThisTurn;
+
+    m_gameTags = player.m_gameTags;
+}
+
 FieldZone* Player::GetFieldZone() const
 {
     return m_fieldZone.get();
@@ -104,9 +117,23 @@ Hero* Player::GetHero() const
 
 void Player::SetHero(Hero* hero)
 {
+    game->journal.RecordPointer(m_hero);
     m_hero = hero;
 }
 
+const FieldMirror& Player::GetFieldMirror() const
+{
+    // Every write of game tags, zones and auras is counted by the journal
+    const std::uint64_t mutationCount = game->journal.GetMutationCount();
+    if (mutationCount != m_fieldMirrorMutationCount)
+    {
+        m_fieldMirror = FieldMirror::Build(this);
+        m_fieldMirrorMutationCount = mutationCount;
+    }
+
+    return m_fieldMirror;
+}
+
 HeroPower& Player::GetHeroPower() const
 {
     return *m_hero->heroPower;
@@ -121,7 +148,7 @@ int Player::GetCurrentSpellPower() const
 {
     int value = 0;
 
-    for (auto& minion : GetFieldZone()->GetAll())
+    for (auto& minion : GetFieldZone()->GetView())
     {
         value += minion->GetSpellPower();
     }
@@ -144,6 +171,12 @@ int Player::GetGameTag(GameTag tag) const
 
 void Player::SetGameTag(GameTag tag, int value)
 {
+    if (game != nullptr)
+    {
+        game->journal.RecordGameTag(m_gameTags, tag);
+        game->zobrist.UpdatePlayerTag(*this, tag, GetGameTag(tag), value);
+    }
+
     m_gameTags.insert_or_assign(tag, value);
 }
 
@@ -350,6 +383,9 @@ void Player::UpgradeGalakrond()
 
     // NOTE: The length of level 1 card IDs is 7.
     // For example, "DRG_600".
+    game->zobrist.RemoveEntity(*galakrond);
+    game->journal.RecordPointer(galakrond->card);
+
     if (cardID.size() == 7)
     {
         galakrond->card = Cards::FindCardByID(cardID + "t2");
@@ -358,6 +394,9 @@ void Player::UpgradeGalakrond()
     {
         galakrond->card = Cards::FindCardByID(cardID.substr(0, 7) + "t3");
     }
+
+    galakrond->NotifyMutation();
+    game->zobrist.AddEntity(*galakrond);
 }
 
 int Player::GetInvoke() const
@@ -389,10 +428,12 @@ void Player::AddHeroAndPower(Card* heroCard, Card* powerCard)
         auraEffects = m_hero->auraEffects;
     }
 
+    game->journal.RecordPointer(m_hero);
     m_hero = dynamic_cast<Hero*>(GetFromCard(this, heroCard));
     m_hero->SetZoneType(ZoneType::PLAY);
 
     m_hero->heroPower = dynamic_cast<HeroPower*>(GetFromCard(this, powerCard));
+    m_hero->heroPower->SetZoneType(ZoneType::PLAY);
 
     m_hero->weapon = weapon;
     m_hero->auraEffects = auraEffects;
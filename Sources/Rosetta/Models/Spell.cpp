@@ -12,7 +12,7 @@
 
 namespace RosettaStone
 {
-Spell::Spell(Player* player, Card* card, std::map<GameTag, int> tags, int id)
+Spell::Spell(Player* player, Card* card, GameTagStore tags, int id)
     : Playable(player, card, std::move(tags), id)
 {
     // Do nothing
@@ -65,6 +65,11 @@ bool Spell::TargetingRequirements(Card* card, Character* target) const
            Playable::TargetingRequirements(card, target);
 }
 
+SideMask Spell::GetUntargetableMask(const CharacterMasks& masks) const
+{
+    return masks.cantBeTargetedBySpells;
+}
+
 bool Spell::IsPlayableByPlayer()
 {
     if ((IsSecret() || IsSidequest()) && (player->GetSecretZone()->IsFull() ||
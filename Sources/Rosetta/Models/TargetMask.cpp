@@ -0,0 +1,117 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Models/Player.hpp>
+#include <Rosetta/Models/TargetMask.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+
+namespace RosettaStone
+{
+namespace
+{
+//! Adds the minions of \p player in \p mask to \p characters.
+//! \param player The player that owns the minions.
+//! \param mask The mask of the characters of \p player.
+//! \param characters A list of characters to add to.
+void AddMinions(Player* player, SideMask mask,
+                std::vector<Character*>& characters)
+{
+    FieldZone& fieldZone = *player->GetFieldZone();
+
+    for (int pos = 0; pos < MAX_FIELD_SIZE; ++pos)
+    {
+        if (mask & (1 << pos))
+        {
+            characters.emplace_back(fieldZone[pos]);
+        }
+    }
+}
+}  // namespace
+
+TargetMask::TargetMask(SideMask friendly, SideMask enemy)
+    : m_friendly(friendly), m_enemy(enemy)
+{
+    // Do nothing
+}
+
+SideMask TargetMask::GetFriendly() const
+{
+    return m_friendly;
+}
+
+SideMask TargetMask::GetEnemy() const
+{
+    return m_enemy;
+}
+
+bool TargetMask::IsEmpty() const
+{
+    return m_friendly == 0 && m_enemy == 0;
+}
+
+int TargetMask::GetCount() const
+{
+    int count = 0;
+
+    for (unsigned int bits = m_friendly | (m_enemy << 8); bits != 0;
+         bits &= bits - 1)
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+bool TargetMask::Has(Player* player, Character* character) const
+{
+    const SideMask mask = character->player == player ? m_friendly : m_enemy;
+
+    if (character == character->player->GetHero())
+    {
+        return mask & (1 << HERO_BIT);
+    }
+
+    if (character->GetZoneType() != ZoneType::PLAY)
+    {
+        return false;
+    }
+
+    const int pos = character->GetZonePosition();
+    return pos >= 0 && pos < MAX_FIELD_SIZE && (mask & (1 << pos)) &&
+           (*character->player->GetFieldZone())[pos] == character;
+}
+
+std::vector<Character*> TargetMask::GetCharacters(Player* player) const
+{
+    std::vector<Character*> characters;
+    characters.reserve(GetCount());
+
+    AddMinions(player, m_friendly, characters);
+    AddMinions(player->opponent, m_enemy, characters);
+
+    if (m_friendly & (1 << HERO_BIT))
+    {
+        characters.emplace_back(player->GetHero());
+    }
+
+    if (m_enemy & (1 << HERO_BIT))
+    {
+        characters.emplace_back(player->opponent->GetHero());
+    }
+
+    return characters;
+}
+
+bool TargetMask::operator==(const TargetMask& rhs) const
+{
+    return m_friendly == rhs.m_friendly && m_enemy == rhs.m_enemy;
+}
+
+bool TargetMask::operator!=(const TargetMask& rhs) const
+{
+    return !(*this == rhs);
+}
+}  // namespace RosettaStone
@@ -11,17 +11,12 @@
 
 namespace RosettaStone
 {
-Weapon::Weapon(Player* player, Card* card, std::map<GameTag, int> tags, int id)
+Weapon::Weapon(Player* player, Card* card, GameTagStore tags, int id)
     : Playable(player, card, std::move(tags), id)
 {
     // Do nothing
 }
 
-Weapon::~Weapon()
-{
-    player->GetHero()->weapon = nullptr;
-}
-
 int Weapon::GetAttack() const
 {
     return GetGameTag(GameTag::ATK);
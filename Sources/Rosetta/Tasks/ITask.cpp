@@ -14,13 +14,13 @@ ITask::ITask(EntityType entityType) : m_entityType(entityType)
 }
 
 ITask::ITask(Entity* source, Playable* target)
-    : m_source(source), m_target(target)
+    : m_frame{ nullptr, source, target }
 {
     // Do nothing
 }
 
 ITask::ITask(EntityType entityType, Entity* source, Playable* target)
-    : m_entityType(entityType), m_source(source), m_target(target)
+    : m_entityType(entityType), m_frame{ nullptr, source, target }
 {
     // Do nothing
 }
@@ -30,35 +30,43 @@ EntityType ITask::GetEntityType() const
     return m_entityType;
 }
 
+Player* ITask::GetPlayer() const
+{
+    return m_frame.player;
+}
+
 void ITask::SetPlayer(Player* player)
 {
-    m_player = player;
+    m_frame.player = player;
+}
+
+Entity* ITask::GetSource() const
+{
+    return m_frame.source;
 }
 
 void ITask::SetSource(Entity* source)
 {
-    m_source = source;
+    m_frame.source = source;
 }
 
-void ITask::SetTarget(Playable* target)
+Playable* ITask::GetTarget() const
 {
-    m_target = target;
+    return m_frame.target;
 }
 
-TaskStatus ITask::Run()
+void ITask::SetTarget(Playable* target)
 {
-    return Impl(m_player);
+    m_frame.target = target;
 }
 
-std::unique_ptr<ITask> ITask::Clone()
+TaskStatus ITask::Run() const
 {
-    std::unique_ptr<ITask> clonedTask = CloneImpl();
-    
-    clonedTask->m_entityType = m_entityType;
-    clonedTask->m_player = m_player;
-    clonedTask->m_source = m_source;
-    clonedTask->m_target = m_target;
+    return Impl(m_frame.player, m_frame.source, m_frame.target);
+}
 
-    return clonedTask;
+TaskStatus ITask::Run(const TaskFrame& frame) const
+{
+    return Impl(frame.player, frame.source, frame.target);
 }
 }  // namespace RosettaStone
@@ -13,16 +13,12 @@ AttackTask::AttackTask(Entity* source, Playable* target) : ITask(source, target)
     // Do nothing
 }
 
-TaskStatus AttackTask::Impl(Player* player)
+TaskStatus AttackTask::Impl(Player* player, Entity* source,
+                            Playable* target) const
 {
-    Generic::Attack(player, dynamic_cast<Character*>(m_source),
-                    dynamic_cast<Character*>(m_target), false);
+    Generic::Attack(player, dynamic_cast<Character*>(source),
+                    dynamic_cast<Character*>(target), false);
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> AttackTask::CloneImpl()
-{
-    return std::make_unique<AttackTask>(m_source, m_target);
-}
 }  // namespace RosettaStone::PlayerTasks
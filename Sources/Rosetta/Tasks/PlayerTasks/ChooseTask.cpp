@@ -27,7 +27,8 @@ ChooseTask ChooseTask::Pick(Player*, int choice)
     return ChooseTask({ choice });
 }
 
-TaskStatus ChooseTask::Impl(Player* player)
+TaskStatus ChooseTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                            [[maybe_unused]] Playable* target) const
 {
     switch (player->choice->choiceType)
     {
@@ -54,9 +55,4 @@ TaskStatus ChooseTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ChooseTask::CloneImpl()
-{
-    return std::make_unique<ChooseTask>(m_choices);
-}
 }  // namespace RosettaStone::PlayerTasks
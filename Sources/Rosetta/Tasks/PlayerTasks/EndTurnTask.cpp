@@ -10,7 +10,8 @@
 
 namespace RosettaStone::PlayerTasks
 {
-TaskStatus EndTurnTask::Impl(Player* player)
+TaskStatus EndTurnTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                             [[maybe_unused]] Playable* target) const
 {
     auto game = player->game;
 
@@ -19,9 +20,4 @@ TaskStatus EndTurnTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> EndTurnTask::CloneImpl()
-{
-    return std::make_unique<EndTurnTask>();
-}
 }  // namespace RosettaStone::PlayerTasks
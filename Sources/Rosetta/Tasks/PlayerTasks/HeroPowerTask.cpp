@@ -4,6 +4,7 @@
 // Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
 
 #include <Rosetta/Actions/PlayCard.hpp>
+#include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/PlayerTasks/HeroPowerTask.hpp>
 
@@ -14,13 +15,15 @@ HeroPowerTask::HeroPowerTask(Playable* target) : ITask(nullptr, target)
     // Do nothing
 }
 
-TaskStatus HeroPowerTask::Impl(Player* player)
+TaskStatus HeroPowerTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                               Playable* target) const
 {
     HeroPower& power = player->GetHeroPower();
 
     // NOTE: 'Steady Shot' (DS1h_292) can target by some cards
     // e.g. Steamwheedle Sniper, Dwarven Sharpshooter
-    if (power.card->id == "DS1h_292")
+    static const CardHandle steadyShot = Cards::GetHandle("DS1h_292");
+    if (power.card->IsCard(steadyShot, "DS1h_292"))
     {
         if (const auto& auraEffects = player->playerAuraEffects;
             auraEffects.GetValue(GameTag::CAN_TARGET_MINION_BY_HERO_POWER) == 1)
@@ -29,12 +32,12 @@ TaskStatus HeroPowerTask::Impl(Player* player)
         }
         else
         {
-            m_target = player->opponent->GetHero();
+            target = player->opponent->GetHero();
         }
     }
 
     if (!power.IsPlayableByPlayer() || !power.IsPlayableByCardReq() ||
-        !power.IsValidPlayTarget(dynamic_cast<Character*>(m_target)))
+        !power.IsValidPlayTarget(dynamic_cast<Character*>(target)))
     {
         return TaskStatus::STOP;
     }
@@ -54,7 +57,7 @@ TaskStatus HeroPowerTask::Impl(Player* player)
     }
 
     // Process target trigger
-    if (m_target != nullptr)
+    if (target != nullptr)
     {
         Trigger::ValidateTriggers(player->game, &power, SequenceType::TARGET);
         player->game->taskQueue.StartEvent();
@@ -65,7 +68,7 @@ TaskStatus HeroPowerTask::Impl(Player* player)
 
     // Process power tasks
     player->game->taskQueue.StartEvent();
-    power.ActivateTask(PowerType::POWER, dynamic_cast<Character*>(m_target));
+    power.ActivateTask(PowerType::POWER, dynamic_cast<Character*>(target));
     player->game->ProcessTasks();
     player->game->taskQueue.EndEvent();
 
@@ -83,9 +86,4 @@ TaskStatus HeroPowerTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> HeroPowerTask::CloneImpl()
-{
-    return std::make_unique<HeroPowerTask>(m_target);
-}
 }  // namespace RosettaStone::PlayerTasks
@@ -47,19 +47,14 @@ PlayCardTask PlayCardTask::WeaponTarget(Entity* source, Playable* target)
     return PlayCardTask(source, target);
 }
 
-TaskStatus PlayCardTask::Impl(Player* player)
+TaskStatus PlayCardTask::Impl(Player* player, Entity* source,
+                              Playable* target) const
 {
-    const auto source = dynamic_cast<Playable*>(m_source);
-    const auto target = dynamic_cast<Character*>(m_target);
+    const auto realSource = dynamic_cast<Playable*>(source);
+    const auto realTarget = dynamic_cast<Character*>(target);
 
-    Generic::PlayCard(player, source, target, m_fieldPos, m_chooseOne);
+    Generic::PlayCard(player, realSource, realTarget, m_fieldPos, m_chooseOne);
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> PlayCardTask::CloneImpl()
-{
-    return std::make_unique<PlayCardTask>(m_source, m_target, m_fieldPos,
-                                          m_chooseOne);
-}
 }  // namespace RosettaStone::PlayerTasks
@@ -9,9 +9,10 @@
 
 namespace RosettaStone::SimpleTasks
 {
-TaskStatus ActivateCapturedDeathrattleTask::Impl(Player* player)
+TaskStatus ActivateCapturedDeathrattleTask::Impl(Player* player, Entity* source,
+                                                 Playable* target) const
 {
-    const auto enchantment = dynamic_cast<Enchantment*>(m_target);
+    const auto enchantment = dynamic_cast<Enchantment*>(target);
     if (enchantment == nullptr)
     {
         throw std::invalid_argument(
@@ -27,7 +28,7 @@ TaskStatus ActivateCapturedDeathrattleTask::Impl(Player* player)
             "have any captured card!");
     }
 
-    auto tasks = card->power.GetDeathrattleTask();
+    const auto& tasks = card->GetPower().GetDeathrattleTask();
     if (tasks.empty())
     {
         return TaskStatus::STOP;
@@ -35,20 +36,10 @@ TaskStatus ActivateCapturedDeathrattleTask::Impl(Player* player)
 
     for (auto& task : tasks)
     {
-        std::unique_ptr<ITask> clonedTask = task->Clone();
-
-        clonedTask->SetPlayer(player);
-        clonedTask->SetSource(m_source);
-        clonedTask->SetTarget(m_target);
-
-        player->game->taskQueue.Enqueue(std::move(clonedTask));
+        player->game->taskQueue.Enqueue(
+            task, TaskFrame{ player, source, target });
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ActivateCapturedDeathrattleTask::CloneImpl()
-{
-    return std::make_unique<ActivateCapturedDeathrattleTask>();
-}
 }  // namespace RosettaStone::SimpleTasks
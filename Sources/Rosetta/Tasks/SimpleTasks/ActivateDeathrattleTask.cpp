@@ -16,10 +16,11 @@ ActivateDeathrattleTask::ActivateDeathrattleTask(EntityType entityType)
     // Do nothing
 }
 
-TaskStatus ActivateDeathrattleTask::Impl(Player* player)
+TaskStatus ActivateDeathrattleTask::Impl(Player* player, Entity* source,
+                                         Playable* target) const
 {
     const auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -27,25 +28,16 @@ TaskStatus ActivateDeathrattleTask::Impl(Player* player)
 
         for (auto& enchantment : playable->appliedEnchantments)
         {
-            auto tasks = enchantment->card->power.GetDeathrattleTask();
+            const auto& tasks =
+                enchantment->card->GetPower().GetDeathrattleTask();
             for (auto& task : tasks)
             {
-                std::unique_ptr<ITask> clonedTask = task->Clone();
-
-                clonedTask->SetPlayer(player);
-                clonedTask->SetSource(m_source);
-                clonedTask->SetTarget(m_target);
-
-                player->game->taskQueue.Enqueue(std::move(clonedTask));
+                player->game->taskQueue.Enqueue(
+                    task, TaskFrame{ player, source, target });
             }
         }
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ActivateDeathrattleTask::CloneImpl()
-{
-    return std::make_unique<ActivateDeathrattleTask>(m_entityType);
-}
 }  // namespace RosettaStone::SimpleTasks
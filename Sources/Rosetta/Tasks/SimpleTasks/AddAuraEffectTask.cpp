@@ -17,10 +17,11 @@ AddAuraEffectTask::AddAuraEffectTask(std::shared_ptr<IEffect> effect,
     // Do nothing
 }
 
-TaskStatus AddAuraEffectTask::Impl(Player* player)
+TaskStatus AddAuraEffectTask::Impl(Player* player, Entity* source,
+                                   Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
     for (auto& playable : playables)
     {
         m_effect->ApplyAuraTo(playable);
@@ -28,9 +29,4 @@ TaskStatus AddAuraEffectTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> AddAuraEffectTask::CloneImpl()
-{
-    return std::make_unique<AddAuraEffectTask>(m_effect, m_entityType);
-}
 }  // namespace RosettaStone::SimpleTasks
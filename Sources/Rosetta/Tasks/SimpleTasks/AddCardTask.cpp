@@ -18,7 +18,8 @@ AddCardTask::AddCardTask(EntityType entityType, std::string cardID, int amount)
     // Do nothing
 }
 
-TaskStatus AddCardTask::Impl(Player* player)
+TaskStatus AddCardTask::Impl(Player* player, Entity* source,
+                             [[maybe_unused]] Playable* target) const
 {
     std::vector<Entity*> entities;
 
@@ -50,7 +51,7 @@ TaskStatus AddCardTask::Impl(Player* player)
                  ++i)
             {
                 Card* card = Cards::FindCardByID(m_cardID);
-                Generic::ShuffleIntoDeck(player, m_source,
+                Generic::ShuffleIntoDeck(player, source,
                                          Entity::GetFromCard(player, card));
             }
             break;
@@ -63,7 +64,7 @@ TaskStatus AddCardTask::Impl(Player* player)
             {
                 Card* card = Cards::FindCardByID(m_cardID);
                 Generic::ShuffleIntoDeck(
-                    player->opponent, m_source,
+                    player->opponent, source,
                     Entity::GetFromCard(player->opponent, card));
             }
             break;
@@ -75,9 +76,4 @@ TaskStatus AddCardTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> AddCardTask::CloneImpl()
-{
-    return std::make_unique<AddCardTask>(m_entityType, m_cardID, m_amount);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -26,42 +26,44 @@ AddEnchantmentTask::AddEnchantmentTask(
     // Do nothing
 }
 
-TaskStatus AddEnchantmentTask::Impl(Player* player)
+TaskStatus AddEnchantmentTask::Impl(Player* player, Entity* source,
+                                    Playable* target) const
 {
     int num1 = 0, num2 = 0, entityID = 0;
     if (m_useScriptTag)
     {
-        num1 = m_source->game->taskStack.num[0];
-        num2 = m_source->game->taskStack.num[1];
+        num1 = source->game->taskStack.num[0];
+        num2 = source->game->taskStack.num[1];
 
         if (m_useEntityID)
         {
-            entityID = m_source->game->taskStack.playables[0]->GetGameTag(
+            entityID = source->game->taskStack.playables[0]->GetGameTag(
                 GameTag::ENTITY_ID);
         }
     }
     else if (m_useEntityID)
     {
-        num1 = entityID = m_source->game->taskStack.num[0];
+        num1 = entityID = source->game->taskStack.num[0];
     }
 
-    const auto source = dynamic_cast<Playable*>(m_source);
+    const auto realSource = dynamic_cast<Playable*>(source);
 
     if (m_entityType == EntityType::PLAYER)
     {
-        Generic::AddEnchantment(m_enchantmentCard, source, player, num1, num2, entityID);
+        Generic::AddEnchantment(m_enchantmentCard, realSource, player, num1,
+                                num2, entityID);
         return TaskStatus::COMPLETE;
     }
 
     if (m_entityType == EntityType::ENEMY_PLAYER)
     {
-        Generic::AddEnchantment(m_enchantmentCard, source, player->opponent,
-                                num1, num2, entityID);
+        Generic::AddEnchantment(m_enchantmentCard, realSource,
+                                player->opponent, num1, num2, entityID);
         return TaskStatus::COMPLETE;
     }
 
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -70,17 +72,10 @@ TaskStatus AddEnchantmentTask::Impl(Player* player)
             continue;
         }
 
-        Generic::AddEnchantment(m_enchantmentCard, source, playable, num1,
+        Generic::AddEnchantment(m_enchantmentCard, realSource, playable, num1,
                                 num2, entityID);
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> AddEnchantmentTask::CloneImpl()
-{
-    return std::make_unique<AddEnchantmentTask>(m_enchantmentCard->id,
-                                                m_entityType, m_useScriptTag,
-                                                m_useEntityID, m_selfCondition);
-}
 }  // namespace RosettaStone::SimpleTasks
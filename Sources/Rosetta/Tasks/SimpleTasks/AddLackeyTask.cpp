@@ -9,10 +9,6 @@
 #include <Rosetta/Tasks/SimpleTasks/AddLackeyTask.hpp>
 #include <Rosetta/Zones/HandZone.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 AddLackeyTask::AddLackeyTask(int amount) : m_amount(amount)
@@ -20,7 +16,8 @@ AddLackeyTask::AddLackeyTask(int amount) : m_amount(amount)
     // Do nothing
 }
 
-TaskStatus AddLackeyTask::Impl(Player* player)
+TaskStatus AddLackeyTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                               [[maybe_unused]] Playable* target) const
 {
     auto lackeys = Cards::GetLackeys();
 
@@ -28,16 +25,12 @@ TaskStatus AddLackeyTask::Impl(Player* player)
 
     for (int i = 0; i < m_amount && !player->GetHandZone()->IsFull(); ++i)
     {
-        const auto lackey = Entity::GetFromCard(
-            player, *Random::get(lackeys), std::nullopt, player->GetHandZone());
+        const auto lackey =
+            Entity::GetFromCard(player, *player->game->random.Get(lackeys),
+                                std::nullopt, player->GetHandZone());
         Generic::AddCardToHand(player, lackey);
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> AddLackeyTask::CloneImpl()
-{
-    return std::make_unique<AddLackeyTask>(m_amount);
-}
 }  // namespace RosettaStone::SimpleTasks
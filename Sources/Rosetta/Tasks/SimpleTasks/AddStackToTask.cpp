@@ -14,7 +14,8 @@ AddStackToTask::AddStackToTask(EntityType entityType) : ITask(entityType)
     // Do nothing
 }
 
-TaskStatus AddStackToTask::Impl(Player* player)
+TaskStatus AddStackToTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                                [[maybe_unused]] Playable* target) const
 {
     switch (m_entityType)
     {
@@ -41,9 +42,4 @@ TaskStatus AddStackToTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> AddStackToTask::CloneImpl()
-{
-    return std::make_unique<AddStackToTask>(m_entityType);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -17,10 +17,11 @@ ApplyEffectTask::ApplyEffectTask(EntityType entityType,
     // Do nothing
 }
 
-TaskStatus ApplyEffectTask::Impl(Player* player)
+TaskStatus ApplyEffectTask::Impl(Player* player, Entity* source,
+                                 Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -32,9 +33,4 @@ TaskStatus ApplyEffectTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ApplyEffectTask::CloneImpl()
-{
-    return std::make_unique<ApplyEffectTask>(m_entityType, m_effects);
-}
 }  // namespace RosettaStone::SimpleTasks
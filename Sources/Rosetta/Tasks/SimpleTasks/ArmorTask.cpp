@@ -14,16 +14,12 @@ ArmorTask::ArmorTask(int amount, bool useNumber)
     // Do nothing
 }
 
-TaskStatus ArmorTask::Impl(Player* player)
+TaskStatus ArmorTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                           [[maybe_unused]] Playable* target) const
 {
     const int amount = m_useNumber ? player->game->taskStack.num[0] : m_amount;
     player->GetHero()->GainArmor(amount);
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ArmorTask::CloneImpl()
-{
-    return std::make_unique<ArmorTask>(m_amount, m_useNumber);
-}
 }  // namespace RosettaStone::SimpleTasks
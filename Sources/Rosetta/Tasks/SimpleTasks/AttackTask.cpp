@@ -16,12 +16,13 @@ AttackTask::AttackTask(EntityType attacker, EntityType defender, bool force)
     // Do nothing
 }
 
-TaskStatus AttackTask::Impl(Player* player)
+TaskStatus AttackTask::Impl(Player* player, Entity* source,
+                            Playable* target) const
 {
     const auto attacker = dynamic_cast<Character*>(IncludeTask::GetEntities(
-        m_attackerType, player, m_source, m_target)[0]);
+        m_attackerType, player, source, target)[0]);
     const auto defender = dynamic_cast<Character*>(IncludeTask::GetEntities(
-        m_defenderType, player, m_source, m_target)[0]);
+        m_defenderType, player, source, target)[0]);
 
     if (!m_force && attacker->CantAttack())
     {
@@ -40,10 +41,4 @@ TaskStatus AttackTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> AttackTask::CloneImpl()
-{
-    return std::make_unique<AttackTask>(m_attackerType, m_defenderType,
-                                        m_force);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -6,10 +6,6 @@
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/ChanceTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 ChanceTask::ChanceTask(bool useFlag) : m_useFlag(useFlag)
@@ -17,9 +13,10 @@ ChanceTask::ChanceTask(bool useFlag) : m_useFlag(useFlag)
     // Do nothing
 }
 
-TaskStatus ChanceTask::Impl(Player* player)
+TaskStatus ChanceTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                            [[maybe_unused]] Playable* target) const
 {
-    const auto num = Random::get<int>(0, 1);
+    const auto num = player->game->random.Get<int>(0, 1);
 
     if (!m_useFlag)
     {
@@ -29,9 +26,4 @@ TaskStatus ChanceTask::Impl(Player* player)
     player->game->taskStack.flag = (num != 0);
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ChanceTask::CloneImpl()
-{
-    return std::make_unique<ChanceTask>(m_useFlag);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -16,10 +16,11 @@ ChangeAttackingTargetTask::ChangeAttackingTargetTask(EntityType typeA,
     // Do nothing
 }
 
-TaskStatus ChangeAttackingTargetTask::Impl(Player* player)
+TaskStatus ChangeAttackingTargetTask::Impl(Player* player, Entity* source,
+                                           Playable* target) const
 {
-    auto typeA = IncludeTask::GetEntities(m_typeA, player, m_source, m_target);
-    auto typeB = IncludeTask::GetEntities(m_typeB, player, m_source, m_target);
+    auto typeA = IncludeTask::GetEntities(m_typeA, player, source, target);
+    auto typeB = IncludeTask::GetEntities(m_typeB, player, source, target);
 
     if (typeA.size() != 1 || typeB.size() != 1)
     {
@@ -38,9 +39,4 @@ TaskStatus ChangeAttackingTargetTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ChangeAttackingTargetTask::CloneImpl()
-{
-    return std::make_unique<ChangeAttackingTargetTask>(m_typeA, m_typeB);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -5,14 +5,11 @@
 
 #include <Rosetta/Actions/Generic.hpp>
 #include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/ChangeEntityTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/IncludeTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/RandomCardTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 ChangeEntityTask::ChangeEntityTask(EntityType entityType, EntityType protoType,
@@ -60,19 +57,21 @@ ChangeEntityTask::ChangeEntityTask(EntityType sourceType, EntityType protoType)
     // Do nothing
 }
 
-TaskStatus ChangeEntityTask::Impl(Player* player)
+TaskStatus ChangeEntityTask::Impl(Player* player, Entity* source,
+                                  Playable* target) const
 {
     const auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     if (m_useRandomCard)
     {
         auto randCards = RandomCardTask::GetCardList(
-            m_source, m_cardType, m_cardClass, m_race, m_rarity);
+            source, m_cardType, m_cardClass, m_race, m_rarity);
 
         for (auto& playable : playables)
         {
-            const auto idx = Random::get<std::size_t>(0, randCards.size() - 1);
+            const auto idx =
+                player->game->random.Get<std::size_t>(0, randCards.size() - 1);
             Card* card = randCards[idx];
 
             Generic::ChangeEntity(player, playable, card, m_removeEnchantments);
@@ -85,7 +84,7 @@ TaskStatus ChangeEntityTask::Impl(Player* player)
     if (m_protoType != EntityType::INVALID)
     {
         auto playablesForProtoType =
-            IncludeTask::GetEntities(m_protoType, player, m_source, m_target);
+            IncludeTask::GetEntities(m_protoType, player, source, target);
         card = playablesForProtoType[0]->card;
     }
     else
@@ -100,12 +99,4 @@ TaskStatus ChangeEntityTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ChangeEntityTask::CloneImpl()
-{
-    return std::make_unique<ChangeEntityTask>(
-        m_entityType, m_protoType, m_cardType, m_cardClass, m_race, m_rarity,
-        m_card != nullptr ? m_card->id : "", m_removeEnchantments,
-        m_useRandomCard);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -6,6 +6,7 @@
 #include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/ChangeHeroPowerTask.hpp>
+#include <Rosetta/Zones/SetasideZone.hpp>
 
 namespace RosettaStone::SimpleTasks
 {
@@ -14,17 +15,16 @@ ChangeHeroPowerTask::ChangeHeroPowerTask(const std::string& cardID)
     m_card = Cards::FindCardByID(cardID);
 }
 
-TaskStatus ChangeHeroPowerTask::Impl(Player* player)
+TaskStatus ChangeHeroPowerTask::Impl(Player* player,
+                                     [[maybe_unused]] Entity* source,
+                                     [[maybe_unused]] Playable* target) const
 {
-    delete player->GetHero()->heroPower;
+    player->GetSetasideZone()->Add(player->GetHero()->heroPower);
+    player->game->journal.RecordPointer(player->GetHero()->heroPower);
     player->GetHero()->heroPower =
         dynamic_cast<HeroPower*>(Entity::GetFromCard(player, m_card));
+    player->GetHero()->heroPower->SetZoneType(ZoneType::PLAY);
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ChangeHeroPowerTask::CloneImpl()
-{
-    return std::make_unique<ChangeHeroPowerTask>(m_card->id);
-}
 }  // namespace RosettaStone::SimpleTasks
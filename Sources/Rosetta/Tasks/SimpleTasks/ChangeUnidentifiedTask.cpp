@@ -5,28 +5,21 @@
 
 #include <Rosetta/Actions/Generic.hpp>
 #include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/ChangeUnidentifiedTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
-TaskStatus ChangeUnidentifiedTask::Impl(Player* player)
+TaskStatus ChangeUnidentifiedTask::Impl(Player* player, Entity* source,
+                                        [[maybe_unused]] Playable* target) const
 {
-    const auto idx =
-        Random::get<std::size_t>(0, m_source->card->entourages.size() - 1);
+    const auto idx = player->game->random.Get<std::size_t>(
+        0, source->card->entourages.size() - 1);
 
-    Generic::ChangeEntity(player, dynamic_cast<Playable*>(m_source),
-                          Cards::FindCardByID(m_source->card->entourages[idx]),
+    Generic::ChangeEntity(player, dynamic_cast<Playable*>(source),
+                          Cards::FindCardByID(source->card->entourages[idx]),
                           false);
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ChangeUnidentifiedTask::CloneImpl()
-{
-    return std::make_unique<ChangeUnidentifiedTask>();
-}
 }  // namespace RosettaStone::SimpleTasks
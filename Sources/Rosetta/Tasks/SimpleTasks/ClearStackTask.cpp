@@ -8,15 +8,11 @@
 
 namespace RosettaStone::SimpleTasks
 {
-TaskStatus ClearStackTask::Impl(Player* player)
+TaskStatus ClearStackTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                                [[maybe_unused]] Playable* target) const
 {
     player->game->taskStack.playables.clear();
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ClearStackTask::CloneImpl()
-{
-    return std::make_unique<ClearStackTask>();
-}
 }  // namespace RosettaStone::SimpleTasks
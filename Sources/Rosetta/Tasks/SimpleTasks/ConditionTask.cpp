@@ -38,10 +38,11 @@ ConditionTask::ConditionTask(
     // Do nothing
 }
 
-TaskStatus ConditionTask::Impl(Player* player)
+TaskStatus ConditionTask::Impl(Player* player, Entity* source,
+                               Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
     if (playables.empty())
     {
         return TaskStatus::STOP;
@@ -59,7 +60,7 @@ TaskStatus ConditionTask::Impl(Player* player)
         for (auto& condition : m_relaConditions)
         {
             flag = flag && condition->Evaluate(
-                               dynamic_cast<Playable*>(m_source), playable);
+                               dynamic_cast<Playable*>(source), playable);
         }
     }
 
@@ -67,10 +68,4 @@ TaskStatus ConditionTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ConditionTask::CloneImpl()
-{
-    return std::make_unique<ConditionTask>(m_entityType, m_selfConditions,
-                                           m_relaConditions);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -17,10 +17,11 @@ ControlTask::ControlTask(EntityType entityType, bool opposite)
     // Do nothing
 }
 
-TaskStatus ControlTask::Impl(Player* player)
+TaskStatus ControlTask::Impl(Player* player, Entity* source,
+                             Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -39,6 +40,7 @@ TaskStatus ControlTask::Impl(Player* player)
         const auto removedMinion =
             dynamic_cast<Minion*>(playable->zone->Remove(playable));
         removedMinion->game->UpdateAura();
+        removedMinion->game->journal.RecordPointer(removedMinion->player);
         removedMinion->player = m_opposite ? player->opponent : player;
 
         removedMinion->player->GetFieldZone()->Add(removedMinion);
@@ -50,9 +52,4 @@ TaskStatus ControlTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ControlTask::CloneImpl()
-{
-    return std::make_unique<ControlTask>(m_entityType, m_opposite);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -23,7 +23,8 @@ CopyTask::CopyTask(EntityType entityType, ZoneType zoneType, int amount,
     // Do nothing
 }
 
-TaskStatus CopyTask::Impl(Player* player)
+TaskStatus CopyTask::Impl(Player* player, Entity* source,
+                          Playable* target) const
 {
     Player* owner = m_toOpponent ? player->opponent : player;
     IZone* targetZone = Generic::GetZone(owner, m_zoneType);
@@ -74,18 +75,19 @@ TaskStatus CopyTask::Impl(Player* player)
         {
             case EntityType::SOURCE:
             {
-                toBeCopied = dynamic_cast<Playable*>(m_source);
-
-                auto enchantment = dynamic_cast<Enchantment*>(m_target);
-                deathrattle =
-                    (m_zoneType == ZoneType::PLAY) &&
-                    (enchantment != nullptr) &&
-                    (!enchantment->card->power.GetDeathrattleTask().empty());
+                toBeCopied = dynamic_cast<Playable*>(source);
+
+                auto enchantment = dynamic_cast<Enchantment*>(target);
+                deathrattle = (m_zoneType == ZoneType::PLAY) &&
+                              (enchantment != nullptr) &&
+                              (!enchantment->card->GetPower()
+                                    .GetDeathrattleTask()
+                                    .empty());
                 break;
             }
             case EntityType::TARGET:
             {
-                toBeCopied = m_target;
+                toBeCopied = target;
                 break;
             }
             default:
@@ -127,10 +129,4 @@ TaskStatus CopyTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> CopyTask::CloneImpl()
-{
-    return std::make_unique<CopyTask>(m_entityType, m_zoneType, m_amount,
-                                      m_addToStack, m_toOpponent);
-}
 }  // namespace RosettaStone::SimpleTasks
\ No newline at end of file
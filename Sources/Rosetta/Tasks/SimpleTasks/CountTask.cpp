@@ -38,7 +38,8 @@ CountTask::CountTask(EntityType entityType, int numIndex,
     // Do nothing
 }
 
-TaskStatus CountTask::Impl(Player* player)
+TaskStatus CountTask::Impl(Player* player, Entity* source,
+                           Playable* target) const
 {
     if (m_zoneType != ZoneType::INVALID)
     {
@@ -54,7 +55,7 @@ TaskStatus CountTask::Impl(Player* player)
     }
 
     const auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     int count;
     if (m_conditions.empty())
@@ -99,10 +100,4 @@ TaskStatus CountTask::Impl(Player* player)
     }
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> CountTask::CloneImpl()
-{
-    return std::make_unique<CountTask>(m_entityType, m_numIndex, m_conditions,
-                                       m_zoneType, m_getFreeSpace, m_opponent);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -15,15 +15,11 @@ CustomTask::CustomTask(std::function<void(Player*, Entity*, Playable*)> func)
     // Do nothing
 }
 
-TaskStatus CustomTask::Impl(Player* player)
+TaskStatus CustomTask::Impl(Player* player, Entity* source,
+                            Playable* target) const
 {
-    m_func(player, m_source, m_target);
+    m_func(player, source, target);
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> CustomTask::CloneImpl()
-{
-    return std::make_unique<CustomTask>(m_func);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -16,31 +16,27 @@ DamageNumberTask::DamageNumberTask(EntityType entityType, bool isSpellDamage)
     // Do nothing
 }
 
-TaskStatus DamageNumberTask::Impl(Player* player)
+TaskStatus DamageNumberTask::Impl(Player* player, Entity* source,
+                                  Playable* target) const
 {
-    const int spellPower = m_source->player->GetCurrentSpellPower();
+    const int spellPower = source->player->GetCurrentSpellPower();
 
-    int damage = m_source->game->taskStack.num[0];
+    int damage = source->game->taskStack.num[0];
     if (m_isSpellDamage)
     {
         damage += spellPower;
     }
 
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
         const auto character = dynamic_cast<Character*>(playable);
-        Generic::TakeDamageToCharacter(dynamic_cast<Playable*>(m_source),
+        Generic::TakeDamageToCharacter(dynamic_cast<Playable*>(source),
                                        character, damage, m_isSpellDamage);
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> DamageNumberTask::CloneImpl()
-{
-    return std::make_unique<DamageNumberTask>(m_entityType, m_isSpellDamage);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -4,14 +4,11 @@
 // Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
 
 #include <Rosetta/Actions/Generic.hpp>
+#include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/DamageTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/DestroyTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/IncludeTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 DamageTask::DamageTask(EntityType entityType, int damage, bool isSpellDamage)
@@ -30,21 +27,22 @@ DamageTask::DamageTask(EntityType entityType, int damage, int randomDamage,
     // Do nothing
 }
 
-TaskStatus DamageTask::Impl(Player* player)
+TaskStatus DamageTask::Impl(Player* player, Entity* source,
+                            Playable* target) const
 {
-    const int spellPower = m_source->player->GetCurrentSpellPower();
+    const int spellPower = source->player->GetCurrentSpellPower();
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
-        const auto source = dynamic_cast<Playable*>(m_source);
+        const auto realSource = dynamic_cast<Playable*>(source);
         const auto character = dynamic_cast<Character*>(playable);
 
         int randomDamage = 0;
         if (m_randomDamage > 0)
         {
-            randomDamage = Random::get<int>(0, m_randomDamage);
+            randomDamage = player->game->random.Get<int>(0, m_randomDamage);
         }
 
         int damage = m_damage + randomDamage;
@@ -53,16 +51,10 @@ TaskStatus DamageTask::Impl(Player* player)
             damage += spellPower;
         }
 
-        Generic::TakeDamageToCharacter(source, character, damage,
+        Generic::TakeDamageToCharacter(realSource, character, damage,
                                        m_isSpellDamage);
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> DamageTask::CloneImpl()
-{
-    return std::make_unique<DamageTask>(m_entityType, m_damage, m_randomDamage,
-                                        m_isSpellDamage);
-}
 }  // namespace RosettaStone::SimpleTasks
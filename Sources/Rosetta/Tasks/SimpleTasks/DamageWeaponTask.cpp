@@ -5,6 +5,8 @@
 
 #include <Rosetta/Tasks/SimpleTasks/DamageWeaponTask.hpp>
 
+#include <algorithm>
+
 namespace RosettaStone::SimpleTasks
 {
 DamageWeaponTask::DamageWeaponTask(bool opponent, int amount)
@@ -13,7 +15,9 @@ DamageWeaponTask::DamageWeaponTask(bool opponent, int amount)
     // Do nothing
 }
 
-TaskStatus DamageWeaponTask::Impl(Player* player)
+TaskStatus DamageWeaponTask::Impl(Player* player,
+                                  [[maybe_unused]] Entity* source,
+                                  [[maybe_unused]] Playable* target) const
 {
     Weapon* weapon = m_opponent ? player->opponent->GetHero()->weapon
                                 : player->GetHero()->weapon;
@@ -23,18 +27,9 @@ TaskStatus DamageWeaponTask::Impl(Player* player)
         return TaskStatus::COMPLETE;
     }
 
-    if (weapon->GetDurability() < m_amount)
-    {
-        m_amount = weapon->GetDurability();
-    }
-
-    weapon->SetDurability(weapon->GetDurability() - m_amount);
+    const int amount = std::min(m_amount, weapon->GetDurability());
+    weapon->SetDurability(weapon->GetDurability() - amount);
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> DamageWeaponTask::CloneImpl()
-{
-    return std::make_unique<DamageWeaponTask>(m_opponent, m_amount);
-}
 }  // namespace RosettaStone::SimpleTasks
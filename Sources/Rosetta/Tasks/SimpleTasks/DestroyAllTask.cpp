@@ -17,10 +17,11 @@ DestroyAllTask::DestroyAllTask(EntityType entityType) : ITask(entityType)
     // Do nothing
 }
 
-TaskStatus DestroyAllTask::Impl(Player* player)
+TaskStatus DestroyAllTask::Impl(Player* player, Entity* source,
+                                Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -99,9 +100,4 @@ TaskStatus DestroyAllTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> DestroyAllTask::CloneImpl()
-{
-    return std::make_unique<DestroyAllTask>(m_entityType);
-}
 }  // namespace RosettaStone::SimpleTasks
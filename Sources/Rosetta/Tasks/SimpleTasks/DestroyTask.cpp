@@ -15,10 +15,11 @@ DestroyTask::DestroyTask(EntityType entityType, bool forceDeathPhase)
     // Do nothing
 }
 
-TaskStatus DestroyTask::Impl(Player* player)
+TaskStatus DestroyTask::Impl(Player* player, Entity* source,
+                             Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -32,9 +33,4 @@ TaskStatus DestroyTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> DestroyTask::CloneImpl()
-{
-    return std::make_unique<DestroyTask>(m_entityType, m_forceDeathPhase);
-}
 }  // namespace RosettaStone::SimpleTasks
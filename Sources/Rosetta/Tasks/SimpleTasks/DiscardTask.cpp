@@ -9,10 +9,6 @@
 #include <Rosetta/Zones/GraveyardZone.hpp>
 #include <Rosetta/Zones/HandZone.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 DiscardTask::DiscardTask(EntityType entityType) : ITask(entityType)
@@ -20,10 +16,11 @@ DiscardTask::DiscardTask(EntityType entityType) : ITask(entityType)
     // Do nothing
 }
 
-TaskStatus DiscardTask::Impl(Player* player)
+TaskStatus DiscardTask::Impl(Player* player, Entity* source,
+                             Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -38,9 +35,4 @@ TaskStatus DiscardTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> DiscardTask::CloneImpl()
-{
-    return std::make_unique<DiscardTask>(m_entityType);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -5,20 +5,75 @@
 
 #include <Rosetta/Actions/Choose.hpp>
 #include <Rosetta/Actions/Generic.hpp>
-#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Cards/CardQuery.hpp>
+#include <Rosetta/Commons/SpinLocks.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/DiscoverTask.hpp>
 #include <Rosetta/Zones/GraveyardZone.hpp>
 #include <Rosetta/Zones/HandZone.hpp>
 
-#include <effolkronium/random.hpp>
-
+#include <algorithm>
+#include <array>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <tuple>
 #include <utility>
 
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
+namespace
+{
+//! The maximum number of choices that are sampled without allocation.
+constexpr std::size_t MAX_SAMPLED_CHOICES = 8;
+
+//! The key of the discover pool: discover type, card type, class, race and
+//! rarity of the criteria, class of the player and format.
+using DiscoverPoolKey = std::tuple<DiscoverType, CardType, CardClass, Race,
+                                   Rarity, CardClass, FormatType>;
+
+//!
+//! \brief DiscoverPoolCache struct.
+//!
+//! This struct stores the pools of cards to discover that are shared by all
+//! games. The pools are only inserted and never modified, so the references
+//! to them are valid until the end of the process.
+//!
+struct DiscoverPoolCache
+{
+    std::map<DiscoverPoolKey, std::vector<Card*>> pools;
+    SharedSpinLock lock;
+};
+
+//! Returns the pool of \p key, or builds it by \p builder if it isn't cached.
+//! \param key The key of the pool.
+//! \param builder The function that returns the pool of \p key.
+//! \return The pool of \p key.
+template <typename Builder>
+const std::vector<Card*>& GetOrBuildPool(const DiscoverPoolKey& key,
+                                         Builder&& builder)
+{
+    static DiscoverPoolCache cache;
+
+    {
+        std::shared_lock<SharedSpinLock> lock(cache.lock);
+
+        const auto iter = cache.pools.find(key);
+        if (iter != cache.pools.end())
+        {
+            return iter->second;
+        }
+    }
+
+    // NOTE: The pool is built without the lock. If another thread inserts
+    // the pool first, it is the same as this one and this one is discarded.
+    std::vector<Card*> pool = builder();
+
+    std::unique_lock<SharedSpinLock> lock(cache.lock);
+    return cache.pools.try_emplace(key, std::move(pool)).first->second;
+}
+}  // namespace
+
 DiscoverCriteria::DiscoverCriteria(CardType _cardType, CardClass _cardClass,
                                    Race _race, Rarity _rarity)
     : cardType(_cardType), cardClass(_cardClass), race(_race), rarity(_rarity)
@@ -26,7 +81,7 @@ DiscoverCriteria::DiscoverCriteria(CardType _cardType, CardClass _cardClass,
     // Do nothing
 }
 
-bool DiscoverCriteria::Evaluate(Card* card) const
+bool DiscoverCriteria::Evaluate(const Card* card) const
 {
     return (cardType == CardType::INVALID || cardType == card->GetCardType()) &&
            (race == Race::INVALID || race == card->GetRace()) &&
@@ -83,57 +138,184 @@ DiscoverTask::DiscoverTask(std::vector<Card*> cards, DiscoverType discoverType,
     // Do nothing
 }
 
-std::vector<Card*> DiscoverTask::GetChoices(std::vector<Card*> cardsToDiscover,
-                                            int numberOfChoices, bool doShuffle)
+std::vector<Card*> DiscoverTask::GetChoices(
+    Game* game, const std::vector<Card*>& cardsToDiscover, int numberOfChoices,
+    bool doShuffle)
 {
+    if (numberOfChoices >= static_cast<int>(cardsToDiscover.size()))
+    {
+        return cardsToDiscover;
+    }
+
+    const auto numCards = cardsToDiscover.size();
+    const auto numChoices = static_cast<std::size_t>(numberOfChoices);
+
     std::vector<Card*> result;
+    result.reserve(numChoices);
 
-    if (numberOfChoices >= static_cast<int>(cardsToDiscover.size()))
+    if (!doShuffle)
     {
-        result = cardsToDiscover;
+        for (std::size_t i = 0; i < numChoices; ++i)
+        {
+            result.emplace_back(cardsToDiscover[i]);
+        }
     }
-    else
+    else if (numChoices <= MAX_SAMPLED_CHOICES)
     {
-        result.reserve(numberOfChoices);
-
-        if (doShuffle)
+        // NOTE: Floyd's algorithm draws distinct indices with one random
+        // number per choice, so the pool is neither copied nor visited.
+        std::array<std::size_t, MAX_SAMPLED_CHOICES> indices{};
+        const auto indicesBegin = indices.begin();
+        const auto indicesEnd = indices.begin() + numChoices;
+        auto iter = indicesBegin;
+
+        for (std::size_t j = numCards - numChoices; j < numCards; ++j)
         {
-            std::sample(cardsToDiscover.begin(), cardsToDiscover.end(),
-                        std::back_inserter(result), numberOfChoices,
-                        Random::get_engine());
+            const auto idx = game->random.Get<std::size_t>(0, j);
+            *iter = std::find(indicesBegin, iter, idx) == iter ? idx : j;
+            ++iter;
         }
-        else
+
+        // Keeps the order of the pool as std::sample() does
+        std::sort(indicesBegin, indicesEnd);
+
+        for (auto idx = indicesBegin; idx != indicesEnd; ++idx)
         {
-            for (int i = 0; i < numberOfChoices; ++i)
-            {
-                result[i] = cardsToDiscover[i];
-            }
+            result.emplace_back(cardsToDiscover[*idx]);
         }
     }
+    else
+    {
+        std::sample(cardsToDiscover.begin(), cardsToDiscover.end(),
+                    std::back_inserter(result), numChoices,
+                    game->random.GetEngine());
+    }
 
     return result;
 }
 
-TaskStatus DiscoverTask::Impl(Player* player)
+const std::vector<Card*>& DiscoverTask::GetDiscoverPool(
+    DiscoverType discoverType, CardClass baseClass, FormatType format)
 {
-    std::vector<Card*> result;
-    std::vector<Card*> cardsToDiscover;
+    const DiscoverPoolKey key{ discoverType,       CardType::INVALID,
+                               CardClass::INVALID, Race::INVALID,
+                               Rarity::INVALID,    baseClass,
+                               format };
 
-    if (!m_cards.empty())
-    {
-        result = GetChoices(m_cards, m_numberOfChoices);
-    }
-    else if (m_discoverType != DiscoverType::INVALID)
-    {
-        cardsToDiscover =
-            Discover(player->game, player, m_discoverType, m_choiceAction);
-        result = GetChoices(cardsToDiscover, m_numberOfChoices);
-    }
-    else
-    {
-        cardsToDiscover = Discover(player->game, player, m_discoverCriteria);
-        result = GetChoices(cardsToDiscover, m_numberOfChoices);
-    }
+    return GetOrBuildPool(key, [=]() -> std::vector<Card*> {
+        CardQuery query(format);
+
+        switch (discoverType)
+        {
+            case DiscoverType::SPELL:
+                query.WithType(CardType::SPELL);
+                break;
+            case DiscoverType::DRAGON:
+                query.WithRace(Race::DRAGON);
+                break;
+            case DiscoverType::LEGENDARY_MINION_SUMMON:
+                query.WithType(CardType::MINION).WithRarity(Rarity::LEGENDARY);
+                break;
+            case DiscoverType::SIX_COST_SUMMON:
+                query.WithType(CardType::MINION).WithCost(6);
+                break;
+            case DiscoverType::SPELL_THREE_COST_OR_LESS:
+                query.WithType(CardType::SPELL).WithCost(0, 3);
+                break;
+            case DiscoverType::HEISTBARON_TOGWAGGLE:
+                return { Cards::FindCardByID("LOOT_998h"),
+                         Cards::FindCardByID("LOOT_998j"),
+                         Cards::FindCardByID("LOOT_998l"),
+                         Cards::FindCardByID("LOOT_998k") };
+            case DiscoverType::SWAMPQUEEN_HAGATHA:
+                query.WithType(CardType::SPELL).WithClass(CardClass::SHAMAN);
+                break;
+            default:
+                throw std::out_of_range(
+                    "DiscoverTask::GetDiscoverPool() - Invalid discover type");
+        }
+
+        return query
+            .Where([=](const Card* card) {
+                return (card->GetCardClass() == baseClass &&
+                        !card->IsQuest()) ||
+                       card->GetCardClass() == CardClass::NEUTRAL;
+            })
+            .GetCards();
+    });
+}
+
+const std::vector<Card*>& DiscoverTask::GetDiscoverPool(
+    const DiscoverCriteria& criteria, CardClass heroClass, FormatType format)
+{
+    // NOTE: The class of the hero only matters to relative classes.
+    const bool isRelativeClass =
+        criteria.cardClass == CardClass::PLAYER_CLASS ||
+        criteria.cardClass == CardClass::ANOTHER_CLASS;
+    const DiscoverPoolKey key{ DiscoverType::INVALID,
+                               criteria.cardType,
+                               criteria.cardClass,
+                               criteria.race,
+                               criteria.rarity,
+                               isRelativeClass ? heroClass : CardClass::INVALID,
+                               format };
+
+    return GetOrBuildPool(key, [=]() {
+        CardQuery query(format);
+
+        if (criteria.cardType != CardType::INVALID)
+        {
+            query.WithType(criteria.cardType);
+        }
+        if (criteria.race != Race::INVALID)
+        {
+            query.WithRace(criteria.race);
+        }
+        if (criteria.rarity != Rarity::INVALID)
+        {
+            query.WithRarity(criteria.rarity);
+        }
+
+        if (criteria.cardClass == CardClass::PLAYER_CLASS)
+        {
+            query.Where([=](const Card* card) {
+                return card->GetCardClass() == heroClass &&
+                       card->GetCardClass() != CardClass::NEUTRAL;
+            });
+        }
+        else if (criteria.cardClass == CardClass::ANOTHER_CLASS)
+        {
+            query.Where([=](const Card* card) {
+                return card->GetCardClass() != heroClass &&
+                       card->GetCardClass() != CardClass::NEUTRAL;
+            });
+        }
+        else if (criteria.cardClass != CardClass::INVALID)
+        {
+            query.WithClass(criteria.cardClass);
+        }
+
+        return query.GetCards();
+    });
+}
+
+TaskStatus DiscoverTask::Impl(Player* player, Entity* source,
+                              [[maybe_unused]] Playable* target) const
+{
+    std::vector<Card*> cards;
+    ChoiceAction choiceAction = m_choiceAction;
+
+    const std::vector<Card*>& cardsToDiscover =
+        !m_cards.empty()
+            ? m_cards
+            : m_discoverType != DiscoverType::INVALID
+                  ? Discover(player, m_discoverType, choiceAction, cards)
+                  : GetDiscoverPool(m_discoverCriteria,
+                                    player->GetHero()->card->GetCardClass(),
+                                    player->game->GetFormatType());
+
+    const std::vector<Card*> result =
+        GetChoices(player->game, cardsToDiscover, m_numberOfChoices);
 
     if (result.empty())
     {
@@ -151,8 +333,8 @@ TaskStatus DiscoverTask::Impl(Player* player)
         }
     }
 
-    Generic::CreateChoiceCards(player, m_source, ChoiceType::GENERAL,
-                               m_choiceAction, result);
+    Generic::CreateChoiceCards(player, source, ChoiceType::GENERAL,
+                               choiceAction, result);
 
     if (m_repeat > 1)
     {
@@ -162,8 +344,8 @@ TaskStatus DiscoverTask::Impl(Player* player)
         {
             auto choice = new Choice(player, cardsToDiscover);
             choice->choiceType = ChoiceType::GENERAL;
-            choice->choiceAction = m_choiceAction;
-            choice->source = m_source;
+            choice->choiceAction = choiceAction;
+            choice->source = source;
             choice->depth = i + 1;
 
             currentChoice->nextChoice = choice;
@@ -174,82 +356,25 @@ TaskStatus DiscoverTask::Impl(Player* player)
     return TaskStatus::COMPLETE;
 }
 
-std::unique_ptr<ITask> DiscoverTask::CloneImpl()
+const std::vector<Card*>& DiscoverTask::Discover(Player* player,
+                                                 DiscoverType discoverType,
+                                                 ChoiceAction& choiceAction,
+                                                 std::vector<Card*>& cards)
 {
-    return std::make_unique<DiscoverTask>(
-        m_cards, m_discoverType, m_discoverCriteria.cardType,
-        m_discoverCriteria.cardClass, m_discoverCriteria.race,
-        m_discoverCriteria.rarity, m_choiceAction, m_numberOfChoices,
-        m_doShuffle, m_repeat, m_keepAll);
-}
-
-std::vector<Card*> DiscoverTask::Discover(Game* game, Player* player,
-                                          DiscoverType discoverType,
-                                          ChoiceAction& choiceAction) const
-{
-    const FormatType format = game->GetFormatType();
-
-    std::vector<Card*> allCards;
-    if (format == FormatType::STANDARD)
-    {
-        for (auto& card : Cards::GetAllStandardCards())
-        {
-            if ((card->GetCardClass() == player->baseClass &&
-                 !card->IsQuest()) ||
-                card->GetCardClass() == CardClass::NEUTRAL)
-            {
-                allCards.emplace_back(card);
-            }
-        }
-    }
-    else
-    {
-        for (auto& card : Cards::GetAllWildCards())
-        {
-            if ((card->GetCardClass() == player->baseClass &&
-                 !card->IsQuest()) ||
-                card->GetCardClass() == CardClass::NEUTRAL)
-            {
-                allCards.emplace_back(card);
-            }
-        }
-    }
-
-    std::vector<Card*> cards;
-    choiceAction = ChoiceAction::INVALID;
-
     switch (discoverType)
     {
         case DiscoverType::SPELL:
-            choiceAction = ChoiceAction::HAND;
-            for (auto& card : allCards)
-            {
-                if (card->GetCardType() == CardType::SPELL)
-                {
-                    cards.emplace_back(card);
-                }
-            }
-            break;
         case DiscoverType::DRAGON:
+        case DiscoverType::SPELL_THREE_COST_OR_LESS:
+        case DiscoverType::HEISTBARON_TOGWAGGLE:
             choiceAction = ChoiceAction::HAND;
-            for (auto& card : allCards)
-            {
-                if (card->GetRace() == Race::DRAGON)
-                {
-                    cards.emplace_back(card);
-                }
-            }
             break;
         case DiscoverType::LEGENDARY_MINION_SUMMON:
+        case DiscoverType::SIX_COST_SUMMON:
             choiceAction = ChoiceAction::SUMMON;
-            for (auto& card : allCards)
-            {
-                if (card->GetCardType() == CardType::MINION &&
-                    card->GetRarity() == Rarity::LEGENDARY)
-                {
-                    cards.emplace_back(card);
-                }
-            }
+            break;
+        case DiscoverType::SWAMPQUEEN_HAGATHA:
+            choiceAction = ChoiceAction::SWAMPQUEEN_HAGATHA;
             break;
         case DiscoverType::DEATHRATTLE_MINION_DIED:
             choiceAction = ChoiceAction::HAND_AND_STACK;
@@ -261,127 +386,20 @@ std::vector<Card*> DiscoverTask::Discover(Game* game, Player* player,
                     cards.emplace_back(playable->card);
                 }
             }
-            break;
-        case DiscoverType::SIX_COST_SUMMON:
-            choiceAction = ChoiceAction::SUMMON;
-            for (auto& card : allCards)
-            {
-                if (card->GetCardType() == CardType::MINION &&
-                    card->GetCost() == 6)
-                {
-                    cards.emplace_back(card);
-                }
-            }
-            break;
-        case DiscoverType::SPELL_THREE_COST_OR_LESS:
-            choiceAction = ChoiceAction::HAND;
-            for (auto& card : allCards)
-            {
-                if (card->GetCardType() == CardType::SPELL &&
-                    card->GetCost() <= 3)
-                {
-                    cards.emplace_back(card);
-                }
-            }
-            break;
-        case DiscoverType::HEISTBARON_TOGWAGGLE:
-            choiceAction = ChoiceAction::HAND;
-            cards = { Cards::FindCardByID("LOOT_998h"),
-                      Cards::FindCardByID("LOOT_998j"),
-                      Cards::FindCardByID("LOOT_998l"),
-                      Cards::FindCardByID("LOOT_998k") };
-            break;
+            return cards;
         case DiscoverType::MADAME_LAZUL:
             choiceAction = ChoiceAction::HAND;
             for (auto& playable : player->opponent->GetHandZone()->GetAll())
             {
                 cards.emplace_back(playable->card);
             }
-            break;
-        case DiscoverType::SWAMPQUEEN_HAGATHA:
-            choiceAction = ChoiceAction::SWAMPQUEEN_HAGATHA;
-            for (auto& card : allCards)
-            {
-                if (card->GetCardType() == CardType::SPELL &&
-                    card->GetCardClass() == CardClass::SHAMAN)
-                {
-                    cards.emplace_back(card);
-                }
-            }
-            break;
+            return cards;
         default:
             throw std::out_of_range(
                 "DiscoverTask::Discover() - Invalid discover type");
     }
 
-    return cards;
-}
-
-std::vector<Card*> DiscoverTask::Discover(Game* game, Player* player,
-                                          DiscoverCriteria criteria) const
-{
-    const FormatType format = game->GetFormatType();
-    std::vector<Card*> cards;
-
-    if (criteria.cardClass == CardClass::INVALID ||
-        criteria.cardClass == CardClass::PLAYER_CLASS ||
-        criteria.cardClass == CardClass::ANOTHER_CLASS)
-    {
-        auto allCards = (format == FormatType::STANDARD)
-                            ? Cards::GetAllStandardCards()
-                            : Cards::GetAllWildCards();
-
-        for (auto& card : allCards)
-        {
-            if (!criteria.Evaluate(card))
-            {
-                continue;
-            }
-
-            if (criteria.cardClass == CardClass::INVALID)
-            {
-                cards.emplace_back(card);
-            }
-            else if (criteria.cardClass == CardClass::PLAYER_CLASS)
-            {
-                if (card->GetCardClass() ==
-                        player->GetHero()->card->GetCardClass() &&
-                    card->GetCardClass() != CardClass::NEUTRAL)
-                {
-                    cards.emplace_back(card);
-                }
-            }
-            else
-            {
-                if (card->GetCardClass() !=
-                        player->GetHero()->card->GetCardClass() &&
-                    card->GetCardClass() != CardClass::NEUTRAL)
-                {
-                    cards.emplace_back(card);
-                }
-            }
-        }
-    }
-    else
-    {
-        auto allCards = (format == FormatType::STANDARD)
-                            ? Cards::GetStandardCards(criteria.cardClass)
-                            : Cards::GetWildCards(criteria.cardClass);
-
-        for (auto& card : allCards)
-        {
-            if (!criteria.Evaluate(card))
-            {
-                continue;
-            }
-
-            if (card->GetCardClass() == criteria.cardClass)
-            {
-                cards.emplace_back(card);
-            }
-        }
-    }
-
-    return cards;
+    return GetDiscoverPool(discoverType, player->baseClass,
+                           player->game->GetFormatType());
 }
 }  // namespace RosettaStone::SimpleTasks
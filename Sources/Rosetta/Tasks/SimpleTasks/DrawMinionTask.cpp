@@ -8,10 +8,6 @@
 #include <Rosetta/Tasks/SimpleTasks/DrawMinionTask.hpp>
 #include <Rosetta/Zones/DeckZone.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 DrawMinionTask::DrawMinionTask(bool lowestCost, int amount, bool addToStack)
@@ -20,7 +16,8 @@ DrawMinionTask::DrawMinionTask(bool lowestCost, int amount, bool addToStack)
     // Do nothing
 }
 
-TaskStatus DrawMinionTask::Impl(Player* player)
+TaskStatus DrawMinionTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                                [[maybe_unused]] Playable* target) const
 {
     auto deck = player->GetDeckZone()->GetAll();
     if (deck.empty())
@@ -83,7 +80,8 @@ TaskStatus DrawMinionTask::Impl(Player* player)
     {
         for (int i = 0; i < m_amount; ++i)
         {
-            const auto pick = Random::get<std::size_t>(0, cards.size() - 1);
+            const auto pick =
+                player->game->random.Get<std::size_t>(0, cards.size() - 1);
 
             if (m_addToStack)
             {
@@ -97,10 +95,4 @@ TaskStatus DrawMinionTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> DrawMinionTask::CloneImpl()
-{
-    return std::make_unique<DrawMinionTask>(m_lowestCost, m_amount,
-                                            m_addToStack);
-}
 }  // namespace RosettaStone::SimpleTasks
\ No newline at end of file
@@ -9,7 +9,8 @@
 
 namespace RosettaStone::SimpleTasks
 {
-TaskStatus DrawNumberTask::Impl(Player* player)
+TaskStatus DrawNumberTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                                [[maybe_unused]] Playable* target) const
 {
     std::vector<Entity*> cards;
 
@@ -26,9 +27,4 @@ TaskStatus DrawNumberTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> DrawNumberTask::CloneImpl()
-{
-    return std::make_unique<DrawNumberTask>();
-}
 }  // namespace RosettaStone::SimpleTasks
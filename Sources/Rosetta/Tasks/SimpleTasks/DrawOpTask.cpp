@@ -15,7 +15,8 @@ DrawOpTask::DrawOpTask(int amount, bool toStack)
     // Do nothing
 }
 
-TaskStatus DrawOpTask::Impl(Player* player)
+TaskStatus DrawOpTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                            [[maybe_unused]] Playable* target) const
 {
     std::vector<Playable*> cards;
 
@@ -40,9 +41,4 @@ TaskStatus DrawOpTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> DrawOpTask::CloneImpl()
-{
-    return std::make_unique<DrawOpTask>(m_amount, m_toStack);
-}
 }  // namespace RosettaStone::SimpleTasks
\ No newline at end of file
@@ -14,7 +14,8 @@ DrawStackTask::DrawStackTask(std::size_t amount) : m_amount(amount)
     // Do nothing
 }
 
-TaskStatus DrawStackTask::Impl(Player* player)
+TaskStatus DrawStackTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                               [[maybe_unused]] Playable* target) const
 {
     auto& stack = player->game->taskStack.playables;
     const std::size_t amount =
@@ -30,9 +31,4 @@ TaskStatus DrawStackTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> DrawStackTask::CloneImpl()
-{
-    return std::make_unique<DrawStackTask>(m_amount);
-}
 }  // namespace RosettaStone::SimpleTasks
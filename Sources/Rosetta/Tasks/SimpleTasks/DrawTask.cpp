@@ -15,7 +15,8 @@ DrawTask::DrawTask(int amount, bool toStack)
     // Do nothing
 }
 
-TaskStatus DrawTask::Impl(Player* player)
+TaskStatus DrawTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                          [[maybe_unused]] Playable* target) const
 {
     std::vector<Playable*> cards;
 
@@ -40,9 +41,4 @@ TaskStatus DrawTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> DrawTask::CloneImpl()
-{
-    return std::make_unique<DrawTask>(m_amount, m_toStack);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -17,7 +17,8 @@ EnqueueNumberTask::EnqueueNumberTask(std::vector<std::shared_ptr<ITask>> tasks,
     // Do nothing
 }
 
-TaskStatus EnqueueNumberTask::Impl(Player* player)
+TaskStatus EnqueueNumberTask::Impl(Player* player, Entity* source,
+                                   Playable* target) const
 {
     const int num = player->game->taskStack.num[0];
     if (num < 1)
@@ -32,21 +33,11 @@ TaskStatus EnqueueNumberTask::Impl(Player* player)
     {
         for (auto& task : m_tasks)
         {
-            std::unique_ptr<ITask> clonedTask = task->Clone();
-
-            clonedTask->SetPlayer(player);
-            clonedTask->SetSource(m_source);
-            clonedTask->SetTarget(m_target);
-
-            player->game->taskQueue.Enqueue(std::move(clonedTask));
+            player->game->taskQueue.Enqueue(
+                task, TaskFrame{ player, source, target });
         }
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> EnqueueNumberTask::CloneImpl()
-{
-    return std::make_unique<EnqueueNumberTask>(m_tasks, m_isSpellDamage);
-}
 }  // namespace RosettaStone::SimpleTasks
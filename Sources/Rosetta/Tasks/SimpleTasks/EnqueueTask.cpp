@@ -17,7 +17,8 @@ EnqueueTask::EnqueueTask(std::vector<std::shared_ptr<ITask>> tasks, int num,
     // Do nothing
 }
 
-TaskStatus EnqueueTask::Impl(Player* player)
+TaskStatus EnqueueTask::Impl(Player* player, Entity* source,
+                             Playable* target) const
 {
     const int times =
         m_isSpellDamage ? m_num + player->GetCurrentSpellPower() : m_num;
@@ -26,21 +27,11 @@ TaskStatus EnqueueTask::Impl(Player* player)
     {
         for (auto& task : m_tasks)
         {
-            std::unique_ptr<ITask> clonedTask = task->Clone();
-
-            clonedTask->SetPlayer(player);
-            clonedTask->SetSource(m_source);
-            clonedTask->SetTarget(m_target);
-
-            player->game->taskQueue.Enqueue(std::move(clonedTask));
+            player->game->taskQueue.Enqueue(
+                task, TaskFrame{ player, source, target });
         }
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> EnqueueTask::CloneImpl()
-{
-    return std::make_unique<EnqueueTask>(m_tasks, m_num, m_isSpellDamage);
-}
 }  // namespace RosettaStone::SimpleTasks
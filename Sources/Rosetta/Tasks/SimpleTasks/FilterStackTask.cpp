@@ -25,12 +25,13 @@ FilterStackTask::FilterStackTask(
     // Do nothing
 }
 
-TaskStatus FilterStackTask::Impl(Player* player)
+TaskStatus FilterStackTask::Impl(Player* player, Entity* source,
+                                 Playable* target) const
 {
     if (!m_relaConditions.empty())
     {
         auto entities =
-            IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+            IncludeTask::GetEntities(m_entityType, player, source, target);
         if (entities.size() != 1)
         {
             return TaskStatus::STOP;
@@ -82,20 +83,4 @@ TaskStatus FilterStackTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> FilterStackTask::CloneImpl()
-{
-    if (!m_selfConditions.empty())
-    {
-        return std::make_unique<FilterStackTask>(m_selfConditions);
-    }
-
-    if (!m_relaConditions.empty())
-    {
-        return std::make_unique<FilterStackTask>(m_entityType,
-                                                 m_relaConditions);
-    }
-
-    return nullptr;
-}
 }  // namespace RosettaStone::SimpleTasks
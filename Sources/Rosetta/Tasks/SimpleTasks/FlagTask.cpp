@@ -16,7 +16,8 @@ FlagTask::FlagTask(bool flag, std::vector<std::shared_ptr<ITask>> toDoTasks)
     // Do nothing
 }
 
-TaskStatus FlagTask::Impl(Player* player)
+TaskStatus FlagTask::Impl(Player* player, Entity* source,
+                          Playable* target) const
 {
     if (player->game->taskStack.flag != m_flag)
     {
@@ -25,20 +26,9 @@ TaskStatus FlagTask::Impl(Player* player)
 
     for (auto& task : m_toDoTasks)
     {
-        std::unique_ptr<ITask> clonedTask = task->Clone();
-
-        clonedTask->SetPlayer(player);
-        clonedTask->SetSource(m_source);
-        clonedTask->SetTarget(m_target);
-
-        clonedTask->Run();
+        task->Run(TaskFrame{ player, source, target });
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> FlagTask::CloneImpl()
-{
-    return std::make_unique<FlagTask>(m_flag, m_toDoTasks);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -16,19 +16,15 @@ FuncNumberTask::FuncNumberTask(std::function<int(Playable*)> func)
     // Do nothing
 }
 
-TaskStatus FuncNumberTask::Impl(Player* player)
+TaskStatus FuncNumberTask::Impl(Player* player, Entity* source,
+                                [[maybe_unused]] Playable* target) const
 {
     if (m_func != nullptr)
     {
         player->game->taskStack.num[0] =
-            m_func(dynamic_cast<Playable*>(m_source));
+            m_func(dynamic_cast<Playable*>(source));
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> FuncNumberTask::CloneImpl()
-{
-    return std::make_unique<FuncNumberTask>(m_func);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -17,7 +17,9 @@ FuncPlayableTask::FuncPlayableTask(
     // Do nothing
 }
 
-TaskStatus FuncPlayableTask::Impl(Player* player)
+TaskStatus FuncPlayableTask::Impl(Player* player,
+                                  [[maybe_unused]] Entity* source,
+                                  [[maybe_unused]] Playable* target) const
 {
     if (m_func != nullptr)
     {
@@ -27,9 +29,4 @@ TaskStatus FuncPlayableTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> FuncPlayableTask::CloneImpl()
-{
-    return std::make_unique<FuncPlayableTask>(m_func);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -13,7 +13,9 @@ GetEventNumberTask::GetEventNumberTask(int numIndex) : m_numIndex(numIndex)
     // Do nothing
 }
 
-TaskStatus GetEventNumberTask::Impl(Player* player)
+TaskStatus GetEventNumberTask::Impl(Player* player,
+                                    [[maybe_unused]] Entity* source,
+                                    [[maybe_unused]] Playable* target) const
 {
     const auto data = player->game->currentEventData.get();
 
@@ -32,9 +34,4 @@ TaskStatus GetEventNumberTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> GetEventNumberTask::CloneImpl()
-{
-    return std::make_unique<GetEventNumberTask>(m_numIndex);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -19,10 +19,11 @@ GetGameTagTask::GetGameTagTask(EntityType entityType, GameTag tag,
     // Do nothing
 }
 
-TaskStatus GetGameTagTask::Impl(Player* player)
+TaskStatus GetGameTagTask::Impl(Player* player, Entity* source,
+                                Playable* target) const
 {
     auto entities =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
     if (entities.empty() || static_cast<int>(entities.size()) <= m_entityIndex)
     {
         return TaskStatus::STOP;
@@ -58,10 +59,4 @@ TaskStatus GetGameTagTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> GetGameTagTask::CloneImpl()
-{
-    return std::make_unique<GetGameTagTask>(m_entityType, m_gameTag,
-                                            m_entityIndex, m_numIndex);
-}
 }  // namespace RosettaStone::SimpleTasks
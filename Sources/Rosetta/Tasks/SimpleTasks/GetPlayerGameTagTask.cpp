@@ -13,14 +13,11 @@ GetPlayerGameTagTask::GetPlayerGameTagTask(GameTag tag) : m_gameTag(tag)
     // Do nothing
 }
 
-TaskStatus GetPlayerGameTagTask::Impl(Player* player)
+TaskStatus GetPlayerGameTagTask::Impl(Player* player,
+                                      [[maybe_unused]] Entity* source,
+                                      [[maybe_unused]] Playable* target) const
 {
     player->game->taskStack.num[0] = player->GetGameTag(m_gameTag);
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> GetPlayerGameTagTask::CloneImpl()
-{
-    return std::make_unique<GetPlayerGameTagTask>(m_gameTag);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -8,15 +8,12 @@
 
 namespace RosettaStone::SimpleTasks
 {
-TaskStatus GetPlayerManaTask::Impl(Player* player)
+TaskStatus GetPlayerManaTask::Impl(Player* player,
+                                   [[maybe_unused]] Entity* source,
+                                   [[maybe_unused]] Playable* target) const
 {
     player->game->taskStack.num[0] = player->GetRemainingMana();
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> GetPlayerManaTask::CloneImpl()
-{
-    return std::make_unique<GetPlayerManaTask>();
-}
 }  // namespace RosettaStone::SimpleTasks
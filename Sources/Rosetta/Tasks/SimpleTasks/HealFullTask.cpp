@@ -13,22 +13,18 @@ HealFullTask::HealFullTask(EntityType entityType) : ITask(entityType)
     // Do nothing
 }
 
-TaskStatus HealFullTask::Impl(Player* player)
+TaskStatus HealFullTask::Impl(Player* player, Entity* source,
+                              Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
         auto character = dynamic_cast<Character*>(playable);
-        character->TakeFullHeal(dynamic_cast<Playable*>(m_source));
+        character->TakeFullHeal(dynamic_cast<Playable*>(source));
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> HealFullTask::CloneImpl()
-{
-    return std::make_unique<HealFullTask>(m_entityType);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -14,22 +14,18 @@ HealTask::HealTask(EntityType entityType, int amount)
     // Do nothing
 }
 
-TaskStatus HealTask::Impl(Player* player)
+TaskStatus HealTask::Impl(Player* player, Entity* source,
+                          Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
         auto character = dynamic_cast<Character*>(playable);
-        character->TakeHeal(dynamic_cast<Playable*>(m_source), m_amount);
+        character->TakeHeal(dynamic_cast<Playable*>(source), m_amount);
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> HealTask::CloneImpl()
-{
-    return std::make_unique<HealTask>(m_entityType, m_amount);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -17,7 +17,8 @@ IncludeAdjacentTask::IncludeAdjacentTask(EntityType entityType,
     // Do nothing
 }
 
-TaskStatus IncludeAdjacentTask::Impl(Player* player)
+TaskStatus IncludeAdjacentTask::Impl(Player* player, Entity* source,
+                                     Playable* target) const
 {
     Minion* left = nullptr;
     Minion* right = nullptr;
@@ -28,10 +29,10 @@ TaskStatus IncludeAdjacentTask::Impl(Player* player)
     switch (m_entityType)
     {
         case EntityType::SOURCE:
-            center = dynamic_cast<Minion*>(m_source);
+            center = dynamic_cast<Minion*>(source);
             break;
         case EntityType::TARGET:
-            center = dynamic_cast<Minion*>(m_target);
+            center = dynamic_cast<Minion*>(target);
             break;
         case EntityType::EVENT_TARGET:
             if (const auto eventData = player->game->currentEventData.get();
@@ -111,9 +112,4 @@ TaskStatus IncludeAdjacentTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> IncludeAdjacentTask::CloneImpl()
-{
-    return std::make_unique<IncludeAdjacentTask>(m_entityType, m_includeCenter);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -261,11 +261,11 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
             break;
         case EntityType::STACK_NUM0:
             entities.emplace_back(
-                player->game->entityList[player->game->taskStack.num[0]]);
+                player->game->entityList.Get(player->game->taskStack.num[0]));
             break;
         case EntityType::STACK_NUM1:
             entities.emplace_back(
-                player->game->entityList[player->game->taskStack.num[1]]);
+                player->game->entityList.Get(player->game->taskStack.num[1]));
             break;
         case EntityType::EVENT_SOURCE:
             if (auto eventData = player->game->currentEventData.get();
@@ -525,11 +525,11 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
             break;
         case EntityType::STACK_NUM0:
             entities.emplace_back(
-                player->game->entityList[player->game->taskStack.num[0]]);
+                player->game->entityList.Get(player->game->taskStack.num[0]));
             break;
         case EntityType::STACK_NUM1:
             entities.emplace_back(
-                player->game->entityList[player->game->taskStack.num[1]]);
+                player->game->entityList.Get(player->game->taskStack.num[1]));
             break;
         case EntityType::EVENT_SOURCE:
             if (auto eventData = player->game->currentEventData.get();
@@ -553,16 +553,17 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
     return entities;
 }
 
-TaskStatus IncludeTask::Impl(Player* player)
+TaskStatus IncludeTask::Impl(Player* player, Entity* source,
+                             Playable* target) const
 {
-    const auto entities = GetEntities(m_entityType, player, m_source, m_target);
+    const auto entities = GetEntities(m_entityType, player, source, target);
 
     if (!m_excludeTypes.empty())
     {
         std::vector<Playable*> exceptEntities;
         for (auto& excludeType : m_excludeTypes)
         {
-            auto temp = GetEntities(excludeType, player, m_source, m_target);
+            auto temp = GetEntities(excludeType, player, source, target);
             exceptEntities.insert(exceptEntities.end(), temp.begin(),
                                   temp.end());
         }
@@ -600,10 +601,4 @@ TaskStatus IncludeTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> IncludeTask::CloneImpl()
-{
-    return std::make_unique<IncludeTask>(m_entityType, m_excludeTypes,
-                                         m_addFlag);
-}
 }  // namespace RosettaStone::SimpleTasks
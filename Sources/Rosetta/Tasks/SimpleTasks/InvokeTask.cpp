@@ -10,7 +10,8 @@
 
 namespace RosettaStone::SimpleTasks
 {
-TaskStatus InvokeTask::Impl(Player* player)
+TaskStatus InvokeTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                            [[maybe_unused]] Playable* target) const
 {
     if (player->galakrond == nullptr)
     {
@@ -28,23 +29,12 @@ TaskStatus InvokeTask::Impl(Player* player)
     // Activate hero power of Galakrond
     auto heroPower = Cards::FindCardByDbfID(
         player->galakrond->GetGameTag(GameTag::HERO_POWER));
-    auto heroPowerTasks = heroPower->power.GetPowerTask();
+    const auto& heroPowerTasks = heroPower->GetPower().GetPowerTask();
     for (auto& task : heroPowerTasks)
     {
-        std::unique_ptr<ITask> clonedTask = task->Clone();
-
-        clonedTask->SetPlayer(player);
-        clonedTask->SetSource(player);
-        clonedTask->SetTarget(nullptr);
-
-        clonedTask->Run();
+        task->Run(TaskFrame{ player, player, nullptr });
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> InvokeTask::CloneImpl()
-{
-    return std::make_unique<InvokeTask>();
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -14,7 +14,9 @@ ManaCrystalTask::ManaCrystalTask(int amount, bool fill, bool isOpponent)
     // Do nothing
 }
 
-TaskStatus ManaCrystalTask::Impl(Player* player)
+TaskStatus ManaCrystalTask::Impl(Player* player,
+                                 [[maybe_unused]] Entity* source,
+                                 [[maybe_unused]] Playable* target) const
 {
     if (m_isOpponent)
     {
@@ -27,9 +29,4 @@ TaskStatus ManaCrystalTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ManaCrystalTask::CloneImpl()
-{
-    return std::make_unique<ManaCrystalTask>(m_amount, m_fill, m_isOpponent);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -13,15 +13,11 @@ MathAddTask::MathAddTask(int amount) : m_amount(amount)
     // Do nothing
 }
 
-TaskStatus MathAddTask::Impl(Player* player)
+TaskStatus MathAddTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                             [[maybe_unused]] Playable* target) const
 {
     player->game->taskStack.num[0] += m_amount;
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> MathAddTask::CloneImpl()
-{
-    return std::make_unique<MathAddTask>(m_amount);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -13,15 +13,12 @@ MathMultiplyTask::MathMultiplyTask(int amount) : m_amount(amount)
     // Do nothing
 }
 
-TaskStatus MathMultiplyTask::Impl(Player* player)
+TaskStatus MathMultiplyTask::Impl(Player* player,
+                                  [[maybe_unused]] Entity* source,
+                                  [[maybe_unused]] Playable* target) const
 {
     player->game->taskStack.num[0] *= m_amount;
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> MathMultiplyTask::CloneImpl()
-{
-    return std::make_unique<MathMultiplyTask>(m_amount);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -19,7 +19,9 @@ MathNumberIndexTask::MathNumberIndexTask(int indexA, int indexB,
     // Do nothing
 }
 
-TaskStatus MathNumberIndexTask::Impl(Player* player)
+TaskStatus MathNumberIndexTask::Impl(Player* player,
+                                     [[maybe_unused]] Entity* source,
+                                     [[maybe_unused]] Playable* target) const
 {
     TaskStack& stack = player->game->taskStack;
 
@@ -69,13 +71,8 @@ TaskStatus MathNumberIndexTask::Impl(Player* player)
     return TaskStatus::COMPLETE;
 }
 
-std::unique_ptr<ITask> MathNumberIndexTask::CloneImpl()
-{
-    return std::make_unique<MathNumberIndexTask>(m_indexA, m_indexB, m_mathOp,
-                                                 m_resultIndex);
-}
-
-int MathNumberIndexTask::GetNumber(int index, const TaskStack& taskStack)
+int MathNumberIndexTask::GetNumber(int index,
+                                   const TaskStack& taskStack) const
 {
     switch (index)
     {
@@ -6,10 +6,6 @@
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/MathRandTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 MathRandTask::MathRandTask(int min, int max) : m_min(min), m_max(max)
@@ -17,14 +13,11 @@ MathRandTask::MathRandTask(int min, int max) : m_min(min), m_max(max)
     // Do nothing
 }
 
-TaskStatus MathRandTask::Impl(Player* player)
+TaskStatus MathRandTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                              [[maybe_unused]] Playable* target) const
 {
-    player->game->taskStack.num[0] = Random::get<int>(m_min, m_max);
+    player->game->taskStack.num[0] =
+        player->game->random.Get<int>(m_min, m_max);
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> MathRandTask::CloneImpl()
-{
-    return std::make_unique<MathRandTask>(m_min, m_max);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -13,15 +13,12 @@ MathSubtractTask::MathSubtractTask(int amount) : m_amount(amount)
     // Do nothing
 }
 
-TaskStatus MathSubtractTask::Impl(Player* player)
+TaskStatus MathSubtractTask::Impl(Player* player,
+                                  [[maybe_unused]] Entity* source,
+                                  [[maybe_unused]] Playable* target) const
 {
     player->game->taskStack.num[0] -= m_amount;
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> MathSubtractTask::CloneImpl()
-{
-    return std::make_unique<MathSubtractTask>(m_amount);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -15,23 +15,19 @@ MoveToDeckTask::MoveToDeckTask(EntityType entityType) : ITask(entityType)
     // Do nothing
 }
 
-TaskStatus MoveToDeckTask::Impl(Player* player)
+TaskStatus MoveToDeckTask::Impl(Player* player, Entity* source,
+                                Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
         playable->zone->Remove(playable);
 
-        Generic::ShuffleIntoDeck(player, m_source, playable);
+        Generic::ShuffleIntoDeck(player, source, playable);
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> MoveToDeckTask::CloneImpl()
-{
-    return std::make_unique<MoveToDeckTask>(m_entityType);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -16,10 +16,11 @@ MoveToGraveyardTask::MoveToGraveyardTask(EntityType entityType)
     // Do nothing
 }
 
-TaskStatus MoveToGraveyardTask::Impl(Player* player)
+TaskStatus MoveToGraveyardTask::Impl(Player* player, Entity* source,
+                                     Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -35,9 +36,4 @@ TaskStatus MoveToGraveyardTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> MoveToGraveyardTask::CloneImpl()
-{
-    return std::make_unique<MoveToGraveyardTask>(m_entityType);
-}
 }  // namespace RosettaStone::SimpleTasks
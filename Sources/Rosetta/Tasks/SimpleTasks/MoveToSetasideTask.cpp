@@ -15,10 +15,11 @@ MoveToSetasideTask::MoveToSetasideTask(EntityType entityType)
     // Do nothing
 }
 
-TaskStatus MoveToSetasideTask::Impl(Player* player)
+TaskStatus MoveToSetasideTask::Impl(Player* player, Entity* source,
+                                    Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -28,9 +29,4 @@ TaskStatus MoveToSetasideTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> MoveToSetasideTask::CloneImpl()
-{
-    return std::make_unique<MoveToSetasideTask>(m_entityType);
-}
 }  // namespace RosettaStone::SimpleTasks
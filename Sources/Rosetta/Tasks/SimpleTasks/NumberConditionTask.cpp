@@ -20,7 +20,9 @@ NumberConditionTask::NumberConditionTask(RelaSign relaSign)
     // Do nothing
 }
 
-TaskStatus NumberConditionTask::Impl(Player* player)
+TaskStatus NumberConditionTask::Impl(Player* player,
+                                     [[maybe_unused]] Entity* source,
+                                     [[maybe_unused]] Playable* target) const
 {
     auto& taskStack = player->game->taskStack;
 
@@ -57,9 +59,4 @@ TaskStatus NumberConditionTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> NumberConditionTask::CloneImpl()
-{
-    return std::make_unique<NumberConditionTask>(m_referenceValue, m_relaSign);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -9,10 +9,6 @@
 #include <Rosetta/Models/Spell.hpp>
 #include <Rosetta/Tasks/SimpleTasks/PlayTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 PlayTask::PlayTask(PlayType playType, bool randTarget)
@@ -21,7 +17,8 @@ PlayTask::PlayTask(PlayType playType, bool randTarget)
     // Do nothing
 }
 
-TaskStatus PlayTask::Impl(Player* player)
+TaskStatus PlayTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                          [[maybe_unused]] Playable* target) const
 {
     if (m_playType == PlayType::SPELL)
     {
@@ -61,8 +58,8 @@ TaskStatus PlayTask::Impl(Player* player)
             while (spellPlayer->choice != nullptr)
             {
                 auto choices = spellPlayer->choice->choices;
-                const auto idx =
-                    Random::get<std::size_t>(0, choices.size() - 1);
+                const auto idx = player->game->random.Get<std::size_t>(
+                    0, choices.size() - 1);
                 Generic::ChoicePick(spellPlayer, choices[idx]);
             }
         }
@@ -70,9 +67,4 @@ TaskStatus PlayTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> PlayTask::CloneImpl()
-{
-    return std::make_unique<PlayTask>(m_playType, m_randTarget);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -10,6 +10,7 @@
 #include <Rosetta/Tasks/SimpleTasks/QuestProgressTask.hpp>
 #include <Rosetta/Zones/GraveyardZone.hpp>
 #include <Rosetta/Zones/SecretZone.hpp>
+#include <Rosetta/Zones/SetasideZone.hpp>
 
 namespace RosettaStone::SimpleTasks
 {
@@ -36,9 +37,10 @@ QuestProgressTask::QuestProgressTask(
     // Do nothing
 }
 
-TaskStatus QuestProgressTask::Impl(Player* player)
+TaskStatus QuestProgressTask::Impl(Player* player, Entity* source,
+                                   Playable* target) const
 {
-    auto spell = dynamic_cast<Spell*>(m_source);
+    auto spell = dynamic_cast<Spell*>(source);
     if (spell == nullptr)
     {
         return TaskStatus::STOP;
@@ -52,8 +54,9 @@ TaskStatus QuestProgressTask::Impl(Player* player)
         case ProgressType::SPEND_MANA:
         case ProgressType::SPEND_MANA_ON_SPELLS:
         {
-            const auto source = player->game->currentEventData->eventSource;
-            const auto cost = source->GetCost();
+            const auto eventSource =
+                player->game->currentEventData->eventSource;
+            const auto cost = eventSource->GetCost();
             for (int i = 0; i < cost; ++i)
             {
                 spell->IncreaseQuestProgress();
@@ -70,7 +73,7 @@ TaskStatus QuestProgressTask::Impl(Player* player)
 
     if (spell->GetQuestProgress() >= spell->GetQuestProgressTotal())
     {
-        if (!m_card->id.empty())
+        if (m_card != nullptr && !m_card->id.empty())
         {
             Playable* reward = Entity::GetFromCard(player, m_card);
 
@@ -78,8 +81,11 @@ TaskStatus QuestProgressTask::Impl(Player* player)
             if (const auto heroPower = dynamic_cast<HeroPower*>(reward);
                 heroPower)
             {
-                delete player->GetHero()->heroPower;
+                player->GetSetasideZone()->Add(player->GetHero()->heroPower);
+                player->game->journal.RecordPointer(
+                    player->GetHero()->heroPower);
                 player->GetHero()->heroPower = heroPower;
+                heroPower->SetZoneType(ZoneType::PLAY);
             }
             else
             {
@@ -100,13 +106,7 @@ TaskStatus QuestProgressTask::Impl(Player* player)
         {
             for (auto& task : m_tasks)
             {
-                std::unique_ptr<ITask> clonedTask = task->Clone();
-
-                clonedTask->SetPlayer(player);
-                clonedTask->SetSource(m_source);
-                clonedTask->SetTarget(m_target);
-
-                clonedTask->Run();
+                task->Run(TaskFrame{ player, source, target });
             }
 
             spell->SetGameTag(GameTag::REVEALED, 1);
@@ -122,10 +122,4 @@ TaskStatus QuestProgressTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> QuestProgressTask::CloneImpl()
-{
-    const std::string cardID = m_card ? m_card->id : "";
-    return std::make_unique<QuestProgressTask>(cardID, m_progressType, m_tasks);
-}
 }  // namespace RosettaStone::SimpleTasks
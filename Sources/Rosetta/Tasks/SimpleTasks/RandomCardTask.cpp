@@ -3,14 +3,10 @@
 // RosettaStone is hearthstone simulator using C++ with reinforcement learning.
 // Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
 
-#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Cards/CardQuery.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/RandomCardTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 RandomCardTask::RandomCardTask(EntityType entityType, bool opposite)
@@ -35,66 +31,37 @@ std::vector<Card*> RandomCardTask::GetCardList(Entity* source,
                                                CardClass cardClass, Race race,
                                                Rarity rarity)
 {
-    std::vector<Card*> result;
+    CardQuery query(source->game->GetFormatType());
 
-    if (cardClass == CardClass::INVALID)
+    if (cardClass == CardClass::PLAYER_CLASS)
     {
-        const auto cards = source->game->GetFormatType() == FormatType::STANDARD
-                               ? Cards::GetAllStandardCards()
-                               : Cards::GetAllWildCards();
-
-        for (const auto& card : cards)
-        {
-            if ((cardType == CardType::INVALID ||
-                 cardType == card->GetCardType()) &&
-                (race == Race::INVALID || race == card->GetRace()) &&
-                (rarity == Rarity::INVALID || rarity == card->GetRarity()))
-            {
-                result.emplace_back(card);
-            }
-        }
+        query.WithClass(source->player->GetHero()->card->GetCardClass());
     }
-    else if (cardClass == CardClass::PLAYER_CLASS)
+    else if (cardClass != CardClass::INVALID)
     {
-        const auto playerClass =
-            source->player->GetHero()->card->GetCardClass();
-        const auto cards = source->game->GetFormatType() == FormatType::STANDARD
-                               ? Cards::GetStandardCards(playerClass)
-                               : Cards::GetWildCards(playerClass);
+        query.WithClass(cardClass);
+    }
 
-        for (const auto& card : cards)
-        {
-            if ((cardType == CardType::INVALID ||
-                 cardType == card->GetCardType()) &&
-                (race == Race::INVALID || race == card->GetRace()) &&
-                (rarity == Rarity::INVALID || rarity == card->GetRarity()))
-            {
-                result.emplace_back(card);
-            }
-        }
+    if (cardType != CardType::INVALID)
+    {
+        query.WithType(cardType);
     }
-    else
+
+    if (race != Race::INVALID)
     {
-        const auto cards = source->game->GetFormatType() == FormatType::STANDARD
-                               ? Cards::GetStandardCards(cardClass)
-                               : Cards::GetWildCards(cardClass);
+        query.WithRace(race);
+    }
 
-        for (const auto& card : cards)
-        {
-            if ((cardType == CardType::INVALID ||
-                 cardType == card->GetCardType()) &&
-                (race == Race::INVALID || race == card->GetRace()) &&
-                (rarity == Rarity::INVALID || rarity == card->GetRarity()))
-            {
-                result.emplace_back(card);
-            }
-        }
+    if (rarity != Rarity::INVALID)
+    {
+        query.WithRarity(rarity);
     }
 
-    return result;
+    return query.GetCards();
 }
 
-TaskStatus RandomCardTask::Impl(Player* player)
+TaskStatus RandomCardTask::Impl(Player* player, Entity* source,
+                                [[maybe_unused]] Playable* target) const
 {
     CardClass cardClass;
 
@@ -115,27 +82,19 @@ TaskStatus RandomCardTask::Impl(Player* player)
     }
 
     auto cardsList =
-        GetCardList(m_source, m_cardType, cardClass, m_race, m_rarity);
+        GetCardList(source, m_cardType, cardClass, m_race, m_rarity);
     if (cardsList.empty())
     {
         return TaskStatus::STOP;
     }
 
     player->game->taskStack.playables.clear();
-    const auto idx = Random::get<std::size_t>(0, cardsList.size() - 1);
+    const auto idx =
+        player->game->random.Get<std::size_t>(0, cardsList.size() - 1);
     auto card = Entity::GetFromCard(m_opposite ? player->opponent : player,
                                     cardsList.at(idx));
     player->game->taskStack.playables.emplace_back(card);
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> RandomCardTask::CloneImpl()
-{
-    auto clonedTask = std::make_unique<RandomCardTask>(
-        m_cardType, m_cardClass, m_race, m_rarity, m_opposite);
-    clonedTask->m_entityType = m_entityType;
-
-    return clonedTask;
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -7,10 +7,6 @@
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/RandomEntourageTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 RandomEntourageTask::RandomEntourageTask(int count, bool isOpponent)
@@ -19,24 +15,25 @@ RandomEntourageTask::RandomEntourageTask(int count, bool isOpponent)
     // Do nothing
 }
 
-TaskStatus RandomEntourageTask::Impl(Player* player)
+TaskStatus RandomEntourageTask::Impl(Player* player, Entity* source,
+                                     [[maybe_unused]] Playable* target) const
 {
-    if (m_source == nullptr || m_source->card->entourages.empty())
+    if (source == nullptr || source->card->entourages.empty())
     {
         return TaskStatus::STOP;
     }
 
-    if (m_count > static_cast<int>(m_source->card->entourages.size()))
+    if (m_count > static_cast<int>(source->card->entourages.size()))
     {
         return TaskStatus::STOP;
     }
 
     for (int i = 0; i < m_count; ++i)
     {
-        const auto idx =
-            Random::get<std::size_t>(0, m_source->card->entourages.size() - 1);
+        const auto idx = player->game->random.Get<std::size_t>(
+            0, source->card->entourages.size() - 1);
         const auto entourageCard =
-            Cards::FindCardByID(m_source->card->entourages[idx]);
+            Cards::FindCardByID(source->card->entourages[idx]);
 
         Playable* entouragePlayable =
             Entity::GetFromCard(player, entourageCard);
@@ -45,9 +42,4 @@ TaskStatus RandomEntourageTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> RandomEntourageTask::CloneImpl()
-{
-    return std::make_unique<RandomEntourageTask>(m_count, m_isOpponent);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -7,10 +7,6 @@
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/RandomMinionNumberTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 RandomMinionNumberTask::RandomMinionNumberTask(GameTag tag, bool toOpponent)
@@ -19,9 +15,10 @@ RandomMinionNumberTask::RandomMinionNumberTask(GameTag tag, bool toOpponent)
     // Do nothing
 }
 
-TaskStatus RandomMinionNumberTask::Impl(Player* player)
+TaskStatus RandomMinionNumberTask::Impl(Player* player, Entity* source,
+                                        [[maybe_unused]] Playable* target) const
 {
-    const auto cards = m_source->game->GetFormatType() == FormatType::STANDARD
+    const auto cards = source->game->GetFormatType() == FormatType::STANDARD
                            ? Cards::GetAllStandardCards()
                            : Cards::GetAllWildCards();
 
@@ -45,7 +42,8 @@ TaskStatus RandomMinionNumberTask::Impl(Player* player)
     std::vector<Playable*> randomMinions;
     randomMinions.reserve(1);
 
-    const auto idx = Random::get<std::size_t>(0, cardsList.size() - 1);
+    const auto idx =
+        player->game->random.Get<std::size_t>(0, cardsList.size() - 1);
     auto card = Entity::GetFromCard(m_toOpponent ? player->opponent : player,
                                     cardsList.at(idx));
     randomMinions.emplace_back(card);
@@ -54,9 +52,4 @@ TaskStatus RandomMinionNumberTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> RandomMinionNumberTask::CloneImpl()
-{
-    return std::make_unique<RandomMinionNumberTask>(m_gameTag, m_toOpponent);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -3,16 +3,12 @@
 // RosettaStone is hearthstone simulator using C++ with reinforcement learning.
 // Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
 
-#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Cards/CardQuery.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/RandomMinionTask.hpp>
 
-#include <effolkronium/random.hpp>
-
 #include <utility>
 
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 RandomMinionTask::RandomMinionTask(std::vector<TagValue> tagValues, int amount,
@@ -25,57 +21,50 @@ RandomMinionTask::RandomMinionTask(std::vector<TagValue> tagValues, int amount,
     // Do nothing
 }
 
-TaskStatus RandomMinionTask::Impl(Player* player)
+TaskStatus RandomMinionTask::Impl(Player* player, Entity* source,
+                                  [[maybe_unused]] Playable* target) const
 {
-    const auto cards = m_source->game->GetFormatType() == FormatType::STANDARD
-                           ? Cards::GetAllStandardCards()
-                           : Cards::GetAllWildCards();
+    CardQuery query(source->game->GetFormatType());
 
-    std::vector<Card*> cardsList;
-    for (const auto& card : cards)
+    if (!m_tagValues.empty())
     {
-        if (m_excludeSelf && card->id == m_source->card->id)
-        {
-            continue;
-        }
+        query.WithType(CardType::MINION);
+    }
 
-        bool check = true;
+    for (const auto& tagValue : m_tagValues)
+    {
+        const auto& [gameTag, value, relaSign] = tagValue;
 
-        for (auto& tagValue : m_tagValues)
+        if (gameTag == GameTag::CARDRACE && relaSign == RelaSign::EQ)
         {
-            auto& [gameTag, value, relaSign] = tagValue;
-            if (gameTag == GameTag::CARDRACE && relaSign == RelaSign::EQ)
-            {
-                if (card->GetCardType() != CardType::MINION ||
-                    card->GetRace() != static_cast<Race>(std::get<1>(tagValue)))
-                {
-                    check = false;
-                    break;
-                }
-            }
-            else
-            {
-                if (card->GetCardType() != CardType::MINION ||
-                    ((relaSign == RelaSign::EQ &&
-                      card->gameTags[gameTag] != value) ||
-                     (relaSign == RelaSign::GEQ &&
-                      card->gameTags[gameTag] <= value) ||
-                     (relaSign == RelaSign::LEQ &&
-                      card->gameTags[gameTag] >= value)))
-                {
-                    check = false;
-                    break;
-                }
-            }
+            query.WithRace(static_cast<Race>(value));
         }
-
-        if (check)
+        else if (gameTag == GameTag::COST && relaSign == RelaSign::EQ)
         {
-            cardsList.emplace_back(card);
+            query.WithCost(value);
         }
+        else
+        {
+            query.Where([&tagValue](const Card* card) {
+                const auto& [tag, val, sign] = tagValue;
+                const int cardValue = card->gameTags.Get(tag);
+
+                return !((sign == RelaSign::EQ && cardValue != val) ||
+                         (sign == RelaSign::GEQ && cardValue <= val) ||
+                         (sign == RelaSign::LEQ && cardValue >= val));
+            });
+        }
+    }
+
+    if (m_excludeSelf)
+    {
+        query.Where([source](const Card* card) {
+            return !card->IsCard(*source->card);
+        });
     }
 
-    if (cardsList.empty())
+    const std::size_t numCards = query.GetCount();
+    if (numCards == 0)
     {
         return TaskStatus::STOP;
     }
@@ -85,12 +74,13 @@ TaskStatus RandomMinionTask::Impl(Player* player)
 
     if (m_amount > 1)
     {
-        std::vector<Card*> list = cardsList;
+        std::vector<Card*> list = query.GetCards();
 
         while (randomMinions.size() < static_cast<std::size_t>(m_amount) &&
-               !cardsList.empty())
+               !list.empty())
         {
-            const auto idx = Random::get<std::size_t>(0, list.size() - 1);
+            const auto idx =
+                player->game->random.Get<std::size_t>(0, list.size() - 1);
             auto card = Entity::GetFromCard(
                 m_opposite ? player->opponent : player, list.at(idx));
 
@@ -101,9 +91,9 @@ TaskStatus RandomMinionTask::Impl(Player* player)
     }
     else
     {
-        const auto idx = Random::get<std::size_t>(0, cardsList.size() - 1);
+        const auto idx = player->game->random.Get<std::size_t>(0, numCards - 1);
         auto card = Entity::GetFromCard(m_opposite ? player->opponent : player,
-                                        cardsList.at(idx));
+                                        query.GetNth(idx));
         randomMinions.emplace_back(card);
     }
 
@@ -111,10 +101,4 @@ TaskStatus RandomMinionTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> RandomMinionTask::CloneImpl()
-{
-    return std::make_unique<RandomMinionTask>(m_tagValues, m_amount, m_opposite,
-                                              m_excludeSelf);
-}
 }  // namespace RosettaStone::SimpleTasks
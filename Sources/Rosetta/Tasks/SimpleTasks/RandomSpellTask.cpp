@@ -3,14 +3,10 @@
 // RosettaStone is hearthstone simulator using C++ with reinforcement learning.
 // Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
 
-#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Cards/CardQuery.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/RandomSpellTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 RandomSpellTask::RandomSpellTask(CardClass cardClass, GameTag tag, int value,
@@ -25,58 +21,33 @@ RandomSpellTask::RandomSpellTask(CardClass cardClass, GameTag tag, int value,
     // Do nothing
 }
 
-TaskStatus RandomSpellTask::Impl(Player* player)
+TaskStatus RandomSpellTask::Impl(Player* player, Entity* source,
+                                 [[maybe_unused]] Playable* target) const
 {
-    std::vector<Card*> result;
+    CardQuery query(source->game->GetFormatType());
 
-    if (m_cardClass == CardClass::INVALID)
+    if (m_cardClass == CardClass::PLAYER_CLASS)
     {
-        const auto cards =
-            m_source->game->GetFormatType() == FormatType::STANDARD
-                ? Cards::GetAllStandardCards()
-                : Cards::GetAllWildCards();
-
-        for (const auto& card : cards)
-        {
-            if (Evaluate(card))
-            {
-                result.emplace_back(card);
-            }
-        }
+        query.WithClass(player->GetHero()->card->GetCardClass());
     }
-    else if (m_cardClass == CardClass::PLAYER_CLASS)
+    else if (m_cardClass != CardClass::INVALID)
     {
-        const auto playerClass = player->GetHero()->card->GetCardClass();
-        const auto cards =
-            m_source->game->GetFormatType() == FormatType::STANDARD
-                ? Cards::GetStandardCards(playerClass)
-                : Cards::GetWildCards(playerClass);
+        query.WithClass(m_cardClass);
+    }
 
-        for (const auto& card : cards)
-        {
-            if (Evaluate(card))
-            {
-                result.emplace_back(card);
-            }
-        }
+    query.WithType(CardType::SPELL);
+
+    if (m_gameTag == GameTag::COST && m_relaSign == RelaSign::EQ)
+    {
+        query.WithCost(m_value);
     }
     else
     {
-        const auto cards =
-            m_source->game->GetFormatType() == FormatType::STANDARD
-                ? Cards::GetStandardCards(m_cardClass)
-                : Cards::GetWildCards(m_cardClass);
-
-        for (const auto& card : cards)
-        {
-            if (Evaluate(card))
-            {
-                result.emplace_back(card);
-            }
-        }
+        query.Where([this](const Card* card) { return Evaluate(card); });
     }
 
-    if (result.empty())
+    const std::size_t numCards = query.GetCount();
+    if (numCards == 0)
     {
         return TaskStatus::STOP;
     }
@@ -86,12 +57,13 @@ TaskStatus RandomSpellTask::Impl(Player* player)
 
     if (m_amount > 1)
     {
-        std::vector<Card*> list = result;
+        std::vector<Card*> list = query.GetCards();
 
         while (randomMinions.size() < static_cast<std::size_t>(m_amount) &&
-               !result.empty())
+               !list.empty())
         {
-            const auto idx = Random::get<std::size_t>(0, list.size() - 1);
+            const auto idx =
+                player->game->random.Get<std::size_t>(0, list.size() - 1);
             auto card = Entity::GetFromCard(
                 m_opposite ? player->opponent : player, list.at(idx));
 
@@ -102,9 +74,9 @@ TaskStatus RandomSpellTask::Impl(Player* player)
     }
     else
     {
-        const auto idx = Random::get<std::size_t>(0, result.size() - 1);
+        const auto idx = player->game->random.Get<std::size_t>(0, numCards - 1);
         auto card = Entity::GetFromCard(m_opposite ? player->opponent : player,
-                                        result.at(idx));
+                                        query.GetNth(idx));
         randomMinions.emplace_back(card);
     }
 
@@ -113,23 +85,12 @@ TaskStatus RandomSpellTask::Impl(Player* player)
     return TaskStatus::COMPLETE;
 }
 
-std::unique_ptr<ITask> RandomSpellTask::CloneImpl()
+bool RandomSpellTask::Evaluate(const Card* card) const
 {
-    return std::make_unique<RandomSpellTask>(m_cardClass, m_gameTag, m_value,
-                                             m_amount, m_relaSign, m_opposite);
-}
-
-bool RandomSpellTask::Evaluate(Card* card) const
-{
-    if (card->GetCardType() == CardType::SPELL &&
-        ((m_relaSign == RelaSign::EQ && card->gameTags[m_gameTag] == m_value) ||
-         (m_relaSign == RelaSign::GEQ &&
-          card->gameTags[m_gameTag] >= m_value) ||
-         (m_relaSign == RelaSign::LEQ && card->gameTags[m_gameTag] <= m_value)))
-    {
-        return true;
-    }
+    const int value = card->gameTags.Get(m_gameTag);
 
-    return false;
+    return (m_relaSign == RelaSign::EQ && value == m_value) ||
+           (m_relaSign == RelaSign::GEQ && value >= m_value) ||
+           (m_relaSign == RelaSign::LEQ && value <= m_value);
 }
 }  // namespace RosettaStone::SimpleTasks
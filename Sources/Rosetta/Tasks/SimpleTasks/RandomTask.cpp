@@ -7,10 +7,6 @@
 #include <Rosetta/Tasks/SimpleTasks/IncludeTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/RandomTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 RandomTask::RandomTask(EntityType entityType, int amount)
@@ -19,12 +15,13 @@ RandomTask::RandomTask(EntityType entityType, int amount)
     // Do nothing
 }
 
-TaskStatus RandomTask::Impl(Player* player)
+TaskStatus RandomTask::Impl(Player* player, Entity* source,
+                            Playable* target) const
 {
     auto& stackPlayables = player->game->taskStack.playables;
 
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     if (playables.empty())
     {
@@ -39,19 +36,16 @@ TaskStatus RandomTask::Impl(Player* player)
 
     if (m_amount == 1)
     {
-        const auto idx = Random::get<std::size_t>(0, playables.size() - 1);
+        const auto idx =
+            player->game->random.Get<std::size_t>(0, playables.size() - 1);
         stackPlayables = std::vector<Playable*>{ playables.at(idx) };
     }
     else
     {
-        stackPlayables = ChooseNElements(playables, m_amount);
+        stackPlayables =
+            ChooseNElements(playables, m_amount, player->game->random);
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> RandomTask::CloneImpl()
-{
-    return std::make_unique<RandomTask>(m_entityType, m_amount);
-}
 }  // namespace RosettaStone::SimpleTasks
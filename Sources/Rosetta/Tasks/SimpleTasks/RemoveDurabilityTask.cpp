@@ -9,7 +9,9 @@ RemoveDurabilityTask::RemoveDurabilityTask(int amount, bool isOpponent)
     // Do nothing
 }
 
-TaskStatus RemoveDurabilityTask::Impl(Player* player)
+TaskStatus RemoveDurabilityTask::Impl(Player* player,
+                                      [[maybe_unused]] Entity* source,
+                                      [[maybe_unused]] Playable* target) const
 {
     if (Weapon* weapon = m_isOpponent ? player->opponent->GetHero()->weapon
                                       : player->GetHero()->weapon;
@@ -20,9 +22,4 @@ TaskStatus RemoveDurabilityTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> RemoveDurabilityTask::CloneImpl()
-{
-    return std::make_unique<RemoveDurabilityTask>(m_amount, m_isOpponent);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -9,15 +9,16 @@
 
 namespace RosettaStone::SimpleTasks
 {
-TaskStatus RemoveEnchantmentTask::Impl([[maybe_unused]] Player* player)
+TaskStatus RemoveEnchantmentTask::Impl(Player* player, Entity* source,
+                                       [[maybe_unused]] Playable* target) const
 {
-    auto enchantment = dynamic_cast<Enchantment*>(m_source);
+    auto enchantment = dynamic_cast<Enchantment*>(source);
     if (enchantment == nullptr)
     {
         return TaskStatus::STOP;
     }
 
-    if (auto enchant = enchantment->card->power.GetEnchant();
+    if (auto enchant = enchantment->card->GetPower().GetEnchant();
         enchant != nullptr && (!enchantment->IsOneTurnActive() ||
                                player->game->step != Step::MAIN_CLEANUP))
     {
@@ -49,9 +50,4 @@ TaskStatus RemoveEnchantmentTask::Impl([[maybe_unused]] Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> RemoveEnchantmentTask::CloneImpl()
-{
-    return std::make_unique<RemoveEnchantmentTask>();
-}
 }  // namespace RosettaStone::SimpleTasks
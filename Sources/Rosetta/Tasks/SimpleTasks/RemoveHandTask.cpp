@@ -15,10 +15,11 @@ RemoveHandTask::RemoveHandTask(EntityType entityType) : ITask(entityType)
     // Do nothing
 }
 
-TaskStatus RemoveHandTask::Impl(Player* player)
+TaskStatus RemoveHandTask::Impl(Player* player, Entity* source,
+                                Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
     std::vector<Playable*> list;
 
     for (auto& playable : playables)
@@ -34,9 +35,4 @@ TaskStatus RemoveHandTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> RemoveHandTask::CloneImpl()
-{
-    return std::make_unique<RemoveHandTask>(m_entityType);
-}
 }  // namespace RosettaStone::SimpleTasks
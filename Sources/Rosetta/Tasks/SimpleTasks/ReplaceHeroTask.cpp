@@ -38,9 +38,10 @@ ReplaceHeroTask::ReplaceHeroTask(Card* heroCard, Card* heroPowerCard,
     // Do nothing
 }
 
-TaskStatus ReplaceHeroTask::Impl(Player* player)
+TaskStatus ReplaceHeroTask::Impl(Player* player, Entity* source,
+                                 [[maybe_unused]] Playable* target) const
 {
-    auto playable = dynamic_cast<Playable*>(m_source);
+    auto playable = dynamic_cast<Playable*>(source);
     if (playable == nullptr || player == nullptr)
     {
         return TaskStatus::STOP;
@@ -58,10 +59,4 @@ TaskStatus ReplaceHeroTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ReplaceHeroTask::CloneImpl()
-{
-    return std::make_unique<ReplaceHeroTask>(m_heroCard, m_heroPowerCard,
-                                             m_weaponCard);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -15,10 +15,11 @@ ReturnHandTask::ReturnHandTask(EntityType entityType) : ITask(entityType)
     // Do nothing
 }
 
-TaskStatus ReturnHandTask::Impl(Player* player)
+TaskStatus ReturnHandTask::Impl(Player* player, Entity* source,
+                                Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -29,9 +30,4 @@ TaskStatus ReturnHandTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> ReturnHandTask::CloneImpl()
-{
-    return std::make_unique<ReturnHandTask>(m_entityType);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -14,10 +14,11 @@ RevealStealthTask::RevealStealthTask(EntityType entityType) : ITask(entityType)
     // Do nothing
 }
 
-TaskStatus RevealStealthTask::Impl(Player* player)
+TaskStatus RevealStealthTask::Impl(Player* player, Entity* source,
+                                   Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -29,9 +30,4 @@ TaskStatus RevealStealthTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> RevealStealthTask::CloneImpl()
-{
-    return std::make_unique<RevealStealthTask>(m_entityType);
-}
 }  // namespace RosettaStone::SimpleTasks
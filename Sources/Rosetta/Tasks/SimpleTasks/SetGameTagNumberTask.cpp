@@ -15,10 +15,11 @@ SetGameTagNumberTask::SetGameTagNumberTask(EntityType entityType, GameTag tag)
     // Do nothing
 }
 
-TaskStatus SetGameTagNumberTask::Impl(Player* player)
+TaskStatus SetGameTagNumberTask::Impl(Player* player, Entity* source,
+                                      Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -27,9 +28,4 @@ TaskStatus SetGameTagNumberTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> SetGameTagNumberTask::CloneImpl()
-{
-    return std::make_unique<SetGameTagNumberTask>(m_entityType, m_gameTag);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -14,10 +14,11 @@ SetGameTagTask::SetGameTagTask(EntityType entityType, GameTag tag, int amount)
     // Do nothing
 }
 
-TaskStatus SetGameTagTask::Impl(Player* player)
+TaskStatus SetGameTagTask::Impl(Player* player, Entity* source,
+                                Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -26,9 +27,4 @@ TaskStatus SetGameTagTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> SetGameTagTask::CloneImpl()
-{
-    return std::make_unique<SetGameTagTask>(m_entityType, m_gameTag, m_amount);
-}
 }  // namespace RosettaStone::SimpleTasks
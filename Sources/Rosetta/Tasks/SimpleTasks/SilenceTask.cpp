@@ -14,10 +14,11 @@ SilenceTask::SilenceTask(EntityType entityType) : ITask(entityType)
     // Do nothing
 }
 
-TaskStatus SilenceTask::Impl(Player* player)
+TaskStatus SilenceTask::Impl(Player* player, Entity* source,
+                             Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -32,9 +33,4 @@ TaskStatus SilenceTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> SilenceTask::CloneImpl()
-{
-    return std::make_unique<SilenceTask>(m_entityType);
-}
 }  // namespace RosettaStone::SimpleTasks
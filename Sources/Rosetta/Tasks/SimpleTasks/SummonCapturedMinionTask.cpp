@@ -11,9 +11,10 @@
 
 namespace RosettaStone::SimpleTasks
 {
-TaskStatus SummonCapturedMinionTask::Impl(Player* player)
+TaskStatus SummonCapturedMinionTask::Impl(Player* player, Entity* source,
+                                          Playable* target) const
 {
-    const auto enchantment = dynamic_cast<Enchantment*>(m_target);
+    const auto enchantment = dynamic_cast<Enchantment*>(target);
     if (enchantment == nullptr)
     {
         throw std::invalid_argument(
@@ -33,15 +34,10 @@ TaskStatus SummonCapturedMinionTask::Impl(Player* player)
         dynamic_cast<Minion*>(Entity::GetFromCard(player, card));
     int alternateCount = 0;
     const int summonPos = SummonTask::GetPosition(
-        m_source, SummonSide::DEATHRATTLE, m_target, alternateCount);
+        source, SummonSide::DEATHRATTLE, target, alternateCount);
 
-    Generic::Summon(minion, summonPos, m_source);
+    Generic::Summon(minion, summonPos, source);
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> SummonCapturedMinionTask::CloneImpl()
-{
-    return std::make_unique<SummonCapturedMinionTask>();
-}
 }  // namespace RosettaStone::SimpleTasks
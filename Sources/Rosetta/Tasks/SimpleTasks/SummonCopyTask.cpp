@@ -28,7 +28,8 @@ SummonCopyTask::SummonCopyTask(EntityType entityType, bool randomFlag,
     // Do nothing
 }
 
-TaskStatus SummonCopyTask::Impl(Player* player)
+TaskStatus SummonCopyTask::Impl(Player* player, Entity* source,
+                                Playable* target) const
 {
     if (player->GetFieldZone()->IsFull())
     {
@@ -36,7 +37,7 @@ TaskStatus SummonCopyTask::Impl(Player* player)
     }
 
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     if (playables.empty())
     {
@@ -72,13 +73,13 @@ TaskStatus SummonCopyTask::Impl(Player* player)
                 Entity::GetFromCard(player, playables[i]->card));
 
             Generic::Summon(minion,
-                            SummonTask::GetPosition(m_source, m_side, m_target,
+                            SummonTask::GetPosition(source, m_side, target,
                                                     alternateCount),
-                            m_source);
+                            source);
 
             if (m_addToStack)
             {
-                m_source->game->taskStack.playables.emplace_back(minion);
+                source->game->taskStack.playables.emplace_back(minion);
             }
         }
     }
@@ -99,12 +100,12 @@ TaskStatus SummonCopyTask::Impl(Player* player)
             }
 
             const int zonePos = SummonTask::GetPosition(
-                m_source, m_side, m_target, alternateCount);
+                source, m_side, target, alternateCount);
 
             const auto copy = dynamic_cast<Minion*>(
                 Entity::GetFromCard(player, minion->card, minion->GetGameTags(),
                                     player->GetFieldZone()));
-            Generic::Summon(copy, zonePos, m_source);
+            Generic::Summon(copy, zonePos, source);
             minion->CopyInternalAttributes(copy);
 
             if (!minion->appliedEnchantments.empty())
@@ -148,11 +149,11 @@ TaskStatus SummonCopyTask::Impl(Player* player)
             {
                 if (m_side == SummonSide::TARGET)
                 {
-                    m_source->game->taskStack.playables.emplace_back(copy);
+                    source->game->taskStack.playables.emplace_back(copy);
                 }
                 else
                 {
-                    m_source->game->taskStack.playables.emplace_back(minion);
+                    source->game->taskStack.playables.emplace_back(minion);
                 }
             }
         }
@@ -160,10 +161,4 @@ TaskStatus SummonCopyTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> SummonCopyTask::CloneImpl()
-{
-    return std::make_unique<SummonCopyTask>(m_entityType, m_randomFlag,
-                                            m_addToStack, m_side);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -17,7 +17,8 @@ SummonNumberTask::SummonNumberTask(const std::string& cardID, bool opponent,
     // Do nothing
 }
 
-TaskStatus SummonNumberTask::Impl(Player* player)
+TaskStatus SummonNumberTask::Impl(Player* player, Entity* source,
+                                  Playable* target) const
 {
     TaskStack stack = player->game->taskStack;
     std::unique_ptr<ITask> task;
@@ -32,14 +33,9 @@ TaskStatus SummonNumberTask::Impl(Player* player)
     }
 
     task->SetPlayer(player);
-    task->SetSource(m_source);
-    task->SetTarget(m_target);
+    task->SetSource(source);
+    task->SetTarget(target);
 
     return task->Run();
 }
-
-std::unique_ptr<ITask> SummonNumberTask::CloneImpl()
-{
-    return std::make_unique<SummonNumberTask>(m_card->id, m_opponent, m_side);
-}
 }  // namespace RosettaStone::SimpleTasks
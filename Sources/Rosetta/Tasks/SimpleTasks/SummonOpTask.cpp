@@ -25,7 +25,8 @@ SummonOpTask::SummonOpTask(const std::string& cardID, int amount,
     // Do nothing
 }
 
-TaskStatus SummonOpTask::Impl(Player* player)
+TaskStatus SummonOpTask::Impl(Player* player, Entity* source,
+                              Playable* target) const
 {
     TaskStack stack = player->game->taskStack;
 
@@ -55,7 +56,7 @@ TaskStatus SummonOpTask::Impl(Player* player)
         }
 
         int summonPos =
-            SummonTask::GetPosition(m_source, m_side, m_target, alternateCount);
+            SummonTask::GetPosition(source, m_side, target, alternateCount);
         if (summonPos > player->opponent->GetFieldZone()->GetCount())
         {
             summonPos = player->opponent->GetFieldZone()->GetCount();
@@ -67,15 +68,10 @@ TaskStatus SummonOpTask::Impl(Player* player)
         }
         else
         {
-            Generic::Summon(summonEntity, summonPos, m_source);
+            Generic::Summon(summonEntity, summonPos, source);
         }
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> SummonOpTask::CloneImpl()
-{
-    return std::make_unique<SummonOpTask>(m_card, m_amount, m_side);
-}
 }  // namespace RosettaStone::SimpleTasks
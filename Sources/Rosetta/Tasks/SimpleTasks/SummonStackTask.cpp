@@ -16,7 +16,8 @@ SummonStackTask::SummonStackTask(bool removeFromZone)
     // Do nothing
 }
 
-TaskStatus SummonStackTask::Impl(Player* player)
+TaskStatus SummonStackTask::Impl(Player* player, Entity* source,
+                                 [[maybe_unused]] Playable* target) const
 {
     const auto stack = player->game->taskStack;
 
@@ -37,14 +38,9 @@ TaskStatus SummonStackTask::Impl(Player* player)
             playable->zone->Remove(playable);
         }
 
-        Generic::Summon(dynamic_cast<Minion*>(playable), -1, m_source);
+        Generic::Summon(dynamic_cast<Minion*>(playable), -1, source);
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> SummonStackTask::CloneImpl()
-{
-    return std::make_unique<SummonStackTask>(m_removeFromZone);
-}
 }  // namespace RosettaStone::SimpleTasks
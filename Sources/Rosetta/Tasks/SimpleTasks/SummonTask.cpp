@@ -164,7 +164,8 @@ int SummonTask::GetPosition(Entity* source, SummonSide side, Entity* target,
     return summonPos;
 }
 
-TaskStatus SummonTask::Impl(Player* player)
+TaskStatus SummonTask::Impl(Player* player, Entity* source,
+                            Playable* target) const
 {
     TaskStack& stack = player->game->taskStack;
 
@@ -221,7 +222,7 @@ TaskStatus SummonTask::Impl(Player* player)
             return TaskStatus::STOP;
         }
 
-        int summonPos = GetPosition(m_source, m_side, m_target, alternateCount);
+        int summonPos = GetPosition(source, m_side, target, alternateCount);
         if (summonPos > player->GetFieldZone()->GetCount())
         {
             summonPos = player->GetFieldZone()->GetCount();
@@ -233,16 +234,10 @@ TaskStatus SummonTask::Impl(Player* player)
         }
         else
         {
-            Generic::Summon(summonEntity, summonPos, m_source);
+            Generic::Summon(summonEntity, summonPos, source);
         }
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> SummonTask::CloneImpl()
-{
-    return std::make_unique<SummonTask>(m_side, m_card, m_removeFromStack,
-                                        m_addToStack, m_amount);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -18,10 +18,11 @@ SwapAttackHealthTask::SwapAttackHealthTask(EntityType entityType,
     // Do nothing
 }
 
-TaskStatus SwapAttackHealthTask::Impl(Player* player)
+TaskStatus SwapAttackHealthTask::Impl(Player* player, Entity* source,
+                                      Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -40,10 +41,4 @@ TaskStatus SwapAttackHealthTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> SwapAttackHealthTask::CloneImpl()
-{
-    return std::make_unique<SwapAttackHealthTask>(m_entityType,
-                                                  m_enchantmentID);
-}
 }  // namespace RosettaStone::SimpleTasks
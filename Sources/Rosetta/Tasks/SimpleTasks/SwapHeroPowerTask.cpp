@@ -3,24 +3,36 @@
 // RosettaStone is hearthstone simulator using C++ with reinforcement learning.
 // Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
 
+#include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/SwapHeroPowerTask.hpp>
 
 namespace RosettaStone::SimpleTasks
 {
-TaskStatus SwapHeroPowerTask::Impl(Player* player)
+TaskStatus SwapHeroPowerTask::Impl(Player* player,
+                                   [[maybe_unused]] Entity* source,
+                                   [[maybe_unused]] Playable* target) const
 {
+    GameJournal& journal = player->game->journal;
+    ZobristHash& zobrist = player->game->zobrist;
+    zobrist.RemoveEntity(*player->GetHero()->heroPower);
+    zobrist.RemoveEntity(*player->opponent->GetHero()->heroPower);
+
+    journal.RecordPointer(player->GetHero()->heroPower);
+    journal.RecordPointer(player->opponent->GetHero()->heroPower);
+
     const auto temp = player->GetHero()->heroPower;
     player->GetHero()->heroPower = player->opponent->GetHero()->heroPower;
     player->opponent->GetHero()->heroPower = temp;
 
+    journal.RecordPointer(player->GetHero()->heroPower->player);
+    journal.RecordPointer(player->opponent->GetHero()->heroPower->player);
+
     player->GetHero()->heroPower->player = player;
     player->opponent->GetHero()->heroPower->player = player->opponent;
 
-    return TaskStatus::COMPLETE;
-}
+    zobrist.AddEntity(*player->GetHero()->heroPower);
+    zobrist.AddEntity(*player->opponent->GetHero()->heroPower);
 
-std::unique_ptr<ITask> SwapHeroPowerTask::CloneImpl()
-{
-    return std::make_unique<SwapHeroPowerTask>();
+    return TaskStatus::COMPLETE;
 }
 }  // namespace RosettaStone::SimpleTasks
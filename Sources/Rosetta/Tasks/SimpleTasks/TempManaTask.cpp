@@ -13,7 +13,8 @@ TempManaTask::TempManaTask(int amount) : m_amount(amount)
     // Do nothing
 }
 
-TaskStatus TempManaTask::Impl(Player* player)
+TaskStatus TempManaTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                              [[maybe_unused]] Playable* target) const
 {
     if (player->GetRemainingMana() + m_amount > MANA_UPPER_LIMIT)
     {
@@ -28,9 +29,4 @@ TaskStatus TempManaTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> TempManaTask::CloneImpl()
-{
-    return std::make_unique<TempManaTask>(m_amount);
-}
 }  // namespace RosettaStone::SimpleTasks
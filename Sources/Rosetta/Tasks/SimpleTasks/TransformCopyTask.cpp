@@ -17,29 +17,30 @@ TransformCopyTask::TransformCopyTask(bool toTarget, bool addToStack)
     // Do nothing
 }
 
-TaskStatus TransformCopyTask::Impl(Player* player)
+TaskStatus TransformCopyTask::Impl(Player* player, Entity* source,
+                                   Playable* target) const
 {
-    const auto target = dynamic_cast<Minion*>(m_toTarget ? m_source : m_target);
-    if (target == nullptr)
+    const auto realTarget = dynamic_cast<Minion*>(m_toTarget ? source : target);
+    if (realTarget == nullptr)
     {
         return TaskStatus::STOP;
     }
 
-    const auto source = dynamic_cast<Minion*>(m_toTarget ? m_target : m_source);
-    if (source->GetZoneType() != ZoneType::PLAY)
+    const auto realSource = dynamic_cast<Minion*>(m_toTarget ? target : source);
+    if (realSource->GetZoneType() != ZoneType::PLAY)
     {
         return TaskStatus::STOP;
     }
 
-    auto copy = Entity::GetFromCard(player, target->card, {});
-    IAura* aura = target->ongoingEffect;
+    auto copy = Entity::GetFromCard(player, realTarget->card, {});
+    IAura* aura = realTarget->ongoingEffect;
 
-    source->player->GetFieldZone()->Replace(source,
+    realSource->player->GetFieldZone()->Replace(realSource,
                                             dynamic_cast<Minion*>(copy));
 
-    if (!target->appliedEnchantments.empty())
+    if (!realTarget->appliedEnchantments.empty())
     {
-        for (auto& e : target->appliedEnchantments)
+        for (auto& e : realTarget->appliedEnchantments)
         {
             auto instance = Enchantment::GetInstance(player, e->card, copy);
             if (e->GetGameTag(GameTag::TAG_SCRIPT_DATA_NUM_1) > 0)
@@ -58,7 +59,7 @@ TaskStatus TransformCopyTask::Impl(Player* player)
         }
     }
 
-    for (auto& tag : target->GetGameTags())
+    for (const auto& tag : realTarget->GetGameTags())
     {
         switch (tag.first)
         {
@@ -76,11 +77,11 @@ TaskStatus TransformCopyTask::Impl(Player* player)
         aura->Clone(copy);
     }
 
-    if (target->HasCharge())
+    if (realTarget->HasCharge())
     {
         copy->SetExhausted(false);
     }
-    else if (target->IsRush())
+    else if (realTarget->IsRush())
     {
         dynamic_cast<Minion*>(copy)->SetAttackableByRush(true);
         copy->game->rushMinions.emplace_back(
@@ -94,9 +95,4 @@ TaskStatus TransformCopyTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> TransformCopyTask::CloneImpl()
-{
-    return std::make_unique<TransformCopyTask>(m_toTarget, m_addToStack);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -9,10 +9,6 @@
 #include <Rosetta/Tasks/SimpleTasks/IncludeTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/TransformMinionTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 TransformMinionTask::TransformMinionTask(EntityType entityType, int costChange)
@@ -21,10 +17,11 @@ TransformMinionTask::TransformMinionTask(EntityType entityType, int costChange)
     // Do nothing
 }
 
-TaskStatus TransformMinionTask::Impl(Player* player)
+TaskStatus TransformMinionTask::Impl(Player* player, Entity* source,
+                                     Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     const FormatType format = player->game->GetFormatType();
 
@@ -63,16 +60,12 @@ TaskStatus TransformMinionTask::Impl(Player* player)
 
         if (!cards.empty())
         {
-            const auto idx = Random::get<std::size_t>(0, cards.size() - 1);
-            Generic::ChangeEntity(m_player, playable, cards[idx], true);
+            const auto idx =
+                player->game->random.Get<std::size_t>(0, cards.size() - 1);
+            Generic::ChangeEntity(player, playable, cards[idx], true);
         }
     }
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> TransformMinionTask::CloneImpl()
-{
-    return std::make_unique<TransformMinionTask>(m_entityType, m_costChange);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -18,10 +18,11 @@ TransformTask::TransformTask(EntityType entityType, std::string cardID)
     // Do nothing
 }
 
-TaskStatus TransformTask::Impl(Player* player)
+TaskStatus TransformTask::Impl(Player* player, Entity* source,
+                               Playable* target) const
 {
     auto playables =
-        IncludeTask::GetEntities(m_entityType, player, m_source, m_target);
+        IncludeTask::GetEntities(m_entityType, player, source, target);
 
     for (auto& playable : playables)
     {
@@ -38,9 +39,4 @@ TaskStatus TransformTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> TransformTask::CloneImpl()
-{
-    return std::make_unique<TransformTask>(m_entityType, m_cardID);
-}
 }  // namespace RosettaStone::SimpleTasks
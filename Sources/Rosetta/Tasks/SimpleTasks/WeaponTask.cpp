@@ -14,7 +14,8 @@ WeaponTask::WeaponTask(std::string cardID) : m_cardID(std::move(cardID))
     // Do nothing
 }
 
-TaskStatus WeaponTask::Impl(Player* player)
+TaskStatus WeaponTask::Impl(Player* player, [[maybe_unused]] Entity* source,
+                            [[maybe_unused]] Playable* target) const
 {
     Card* weaponCard = Cards::FindCardByID(m_cardID);
     if (weaponCard->id.empty())
@@ -33,9 +34,4 @@ TaskStatus WeaponTask::Impl(Player* player)
 
     return TaskStatus::COMPLETE;
 }
-
-std::unique_ptr<ITask> WeaponTask::CloneImpl()
-{
-    return std::make_unique<WeaponTask>(m_cardID);
-}
 }  // namespace RosettaStone::SimpleTasks
@@ -7,14 +7,14 @@
 
 namespace RosettaStone
 {
-std::queue<std::unique_ptr<ITask>>& TaskQueue::GetCurrentQueue()
+std::size_t TaskQueue::GetCount() const
 {
-    return m_eventStack.empty() ? m_baseQueue : m_eventStack.top();
+    return m_entries.size() - m_segments.back().head;
 }
 
-bool TaskQueue::IsEmpty()
+bool TaskQueue::IsEmpty() const
 {
-    return m_eventFlag || GetCurrentQueue().empty();
+    return m_eventFlag || GetCount() == 0;
 }
 
 void TaskQueue::StartEvent()
@@ -30,33 +30,69 @@ void TaskQueue::EndEvent()
         return;
     }
 
-    if (!m_eventStack.empty())
+    if (m_segments.size() > 1)
     {
-        m_eventStack.pop();
+        const auto begin = static_cast<std::ptrdiff_t>(m_segments.back().begin);
+        m_entries.erase(m_entries.begin() + begin, m_entries.end());
+        m_segments.pop_back();
     }
 }
 
-void TaskQueue::Enqueue(std::unique_ptr<ITask> task)
+void TaskQueue::Enqueue(std::shared_ptr<ITask> task, const TaskFrame& frame)
 {
     if (m_eventFlag)
     {
-        if (!GetCurrentQueue().empty())
+        if (GetCount() > 0)
         {
-            m_eventStack.push(std::queue<std::unique_ptr<ITask>>{});
+            m_segments.emplace_back(
+                Segment{ m_entries.size(), m_entries.size() });
         }
 
         m_eventFlag = false;
     }
 
-    GetCurrentQueue().push(std::move(task));
+    m_entries.emplace_back(Entry{ std::move(task), frame });
 }
 
 TaskStatus TaskQueue::Process()
 {
-    std::unique_ptr<ITask> currentTask = std::move(GetCurrentQueue().front());
-    GetCurrentQueue().pop();
+    Segment& segment = m_segments.back();
+    const Entry entry = std::move(m_entries[segment.head]);
+    ++segment.head;
 
-    const TaskStatus status = currentTask->Run();
-    return status;
+    // Rewinds the segment to reuse its storage
+    if (segment.head == m_entries.size())
+    {
+        const auto begin = static_cast<std::ptrdiff_t>(segment.begin);
+        m_entries.erase(m_entries.begin() + begin, m_entries.end());
+        segment.head = segment.begin;
+    }
+
+    return entry.task->Run(entry.frame);
+}
+
+void TaskQueue::CopyFrom(
+    const TaskQueue& rhs,
+    const std::function<TaskFrame(const TaskFrame&)>& copyFrame)
+{
+    m_entries.clear();
+    m_entries.reserve(rhs.m_entries.size());
+
+    for (auto& entry : rhs.m_entries)
+    {
+        // The entries that are already processed have no task
+        if (entry.task == nullptr)
+        {
+            m_entries.emplace_back(Entry{});
+        }
+        else
+        {
+            m_entries.emplace_back(
+                Entry{ entry.task, copyFrame(entry.frame) });
+        }
+    }
+
+    m_segments = rhs.m_segments;
+    m_eventFlag = rhs.m_eventFlag;
 }
 }  // namespace RosettaStone
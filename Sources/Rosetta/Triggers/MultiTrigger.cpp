@@ -6,6 +6,7 @@
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Triggers/MultiTrigger.hpp>
 
+#include <algorithm>
 #include <utility>
 
 namespace RosettaStone
@@ -47,15 +48,25 @@ std::shared_ptr<Trigger> MultiTrigger::Activate(Playable* source,
     }
 
     auto instance = std::make_shared<MultiTrigger>(triggers, *this, *source);
+    source->game->journal.RecordValue(source->activatedTrigger);
+    source->activatedTrigger = instance;
 
     return instance;
 }
 
-void MultiTrigger::Remove() const
+void MultiTrigger::Remove()
 {
     for (auto& trigger : m_triggers)
     {
         trigger->Remove();
     }
 }
+
+bool MultiTrigger::IsRemoved() const
+{
+    return std::all_of(m_triggers.begin(), m_triggers.end(),
+                       [](const std::shared_ptr<Trigger>& trigger) {
+                           return trigger->IsRemoved();
+                       });
+}
 }  // namespace RosettaStone
@@ -10,10 +10,6 @@
 #include <Rosetta/Tasks/ITask.hpp>
 #include <Rosetta/Triggers/Trigger.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone
 {
 Trigger::Trigger(TriggerType type) : m_triggerType(type)
@@ -56,7 +52,8 @@ Trigger::Trigger(Trigger& prototype, Entity& owner)
       m_sequenceType(prototype.m_sequenceType)
 {
     auto triggerFunc = [this](Entity* e) {
-        if (percentage == 1.0f || Random::get<float>(0.0f, 1.0f) < percentage)
+        if (percentage == 1.0f ||
+            m_owner->game->random.Get<float>(0.0f, 1.0f) < percentage)
         {
             Process(e);
         }
@@ -80,215 +77,121 @@ std::shared_ptr<Trigger> Trigger::Activate(Playable* source,
     auto instance = std::make_shared<Trigger>(*this, *source);
     Game* game = source->game;
 
+    game->journal.RecordValue(source->activatedTrigger);
     source->activatedTrigger = instance;
 
     if (m_sequenceType != SequenceType::NONE)
     {
+        game->journal.RecordValue(game->triggers);
         game->triggers.emplace_back(instance);
     }
 
-    switch (m_triggerType)
+    instance->Subscribe();
+
+    if (game->journal.IsRecording())
     {
-        case TriggerType::TURN_START:
-            game->triggerManager.startTurnTrigger += instance->handler;
-            break;
-        case TriggerType::TURN_END:
-            game->triggerManager.endTurnTrigger += instance->handler;
-            break;
-        case TriggerType::DRAW_CARD:
-            game->triggerManager.drawCardTrigger += instance->handler;
-            break;
-        case TriggerType::PLAY_CARD:
-            game->triggerManager.playCardTrigger += instance->handler;
-            break;
-        case TriggerType::AFTER_PLAY_CARD:
-            game->triggerManager.afterPlayCardTrigger += instance->handler;
-            break;
-        case TriggerType::PLAY_MINION:
-            game->triggerManager.playMinionTrigger += instance->handler;
-            break;
-        case TriggerType::AFTER_PLAY_MINION:
-            game->triggerManager.afterPlayMinionTrigger += instance->handler;
-            break;
-        case TriggerType::CAST_SPELL:
-            game->triggerManager.castSpellTrigger += instance->handler;
-            break;
-        case TriggerType::AFTER_CAST:
-            game->triggerManager.afterCastTrigger += instance->handler;
-            break;
-        case TriggerType::SECRET_REVEALED:
-            game->triggerManager.secretRevealedTrigger += instance->handler;
-            break;
-        case TriggerType::ZONE:
-            game->triggerManager.zoneTrigger += instance->handler;
-            break;
-        case TriggerType::GIVE_HEAL:
-            game->triggerManager.giveHealTrigger += instance->handler;
-            break;
-        case TriggerType::TAKE_HEAL:
-            game->triggerManager.takeHealTrigger += instance->handler;
-            break;
-        case TriggerType::ATTACK:
-            game->triggerManager.attackTrigger += instance->handler;
-            break;
-        case TriggerType::AFTER_ATTACK:
-            switch (triggerSource)
-            {
-                case TriggerSource::HERO:
-                {
-                    source->player->GetHero()->afterAttackTrigger +=
-                        instance->handler;
-                    break;
-                }
-                case TriggerSource::SELF:
-                {
-                    auto minion = dynamic_cast<Minion*>(source);
-                    minion->afterAttackTrigger += instance->handler;
-                    break;
-                }
-                case TriggerSource::ENCHANTMENT_TARGET:
-                {
-                    const auto enchantment = dynamic_cast<Enchantment*>(source);
-                    auto minion =
-                        dynamic_cast<Minion*>(enchantment->GetTarget());
-                    minion->afterAttackTrigger += instance->handler;
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-        case TriggerType::AFTER_ATTACKED:
-            switch (triggerSource)
-            {
-                case TriggerSource::SELF:
-                {
-                    auto minion = dynamic_cast<Minion*>(source);
-                    minion->afterAttackedTrigger += instance->handler;
-                    break;
-                }
-                default:
-                    break;
-            }
-            break;
-        case TriggerType::SUMMON:
-            game->triggerManager.summonTrigger += instance->handler;
-            break;
-        case TriggerType::AFTER_SUMMON:
-            game->triggerManager.afterSummonTrigger += instance->handler;
-            break;
-        case TriggerType::DEAL_DAMAGE:
-            game->triggerManager.dealDamageTrigger += instance->handler;
-            break;
-        case TriggerType::TAKE_DAMAGE:
-            game->triggerManager.takeDamageTrigger += instance->handler;
-            break;
-        case TriggerType::PREDAMAGE:
-            switch (triggerSource)
+        game->journal.RecordUndo([instance]() { instance->Unsubscribe(); });
+    }
+
+    return instance;
+}
+
+void Trigger::Remove()
+{
+    Game* game = m_owner->game;
+
+    Unsubscribe();
+
+    if (m_sequenceType != SequenceType::NONE)
+    {
+        game->journal.RecordValue(game->triggers);
+        EraseIf(game->triggers, [this](std::shared_ptr<Trigger> trigger) {
+            return trigger.get() == this;
+        });
+    }
+
+    // NOTE: The owner keeps this trigger alive as its activated trigger, so
+    // the closure can refer to it.
+    if (game->journal.IsRecording())
+    {
+        game->journal.RecordUndo([this, isRemoved = m_isRemoved]() {
+            if (!isRemoved)
             {
-                case TriggerSource::HERO:
-                {
-                    source->player->GetHero()->preDamageTrigger +=
-                        instance->handler;
-                    break;
-                }
-                case TriggerSource::SELF:
-                {
-                    auto minion = dynamic_cast<Minion*>(source);
-                    minion->preDamageTrigger += instance->handler;
-                    break;
-                }
-                case TriggerSource::ENCHANTMENT_TARGET:
-                {
-                    const auto enchantment = dynamic_cast<Enchantment*>(source);
-                    auto minion =
-                        dynamic_cast<Minion*>(enchantment->GetTarget());
-                    minion->preDamageTrigger += instance->handler;
-                    break;
-                }
-                default:
-                    break;
+                Subscribe();
             }
-            break;
-        case TriggerType::TARGET:
-            game->triggerManager.targetTrigger += instance->handler;
-            break;
-        case TriggerType::DEATH:
-            game->triggerManager.deathTrigger += instance->handler;
-            break;
-        case TriggerType::USE_HERO_POWER:
-            game->triggerManager.useHeroPowerTrigger += instance->handler;
-            break;
-        case TriggerType::SHUFFLE_INTO_DECK:
-            game->triggerManager.shuffleIntoDeckTrigger += instance->handler;
-            break;
-        default:
-            break;
+
+            m_isRemoved = isRemoved;
+        });
     }
 
-    return instance;
+    m_isRemoved = true;
 }
 
-void Trigger::Remove() const
+bool Trigger::IsRemoved() const
+{
+    return m_isRemoved;
+}
+
+void Trigger::Subscribe()
 {
     Game* game = m_owner->game;
 
     switch (m_triggerType)
     {
         case TriggerType::TURN_START:
-            game->triggerManager.startTurnTrigger -= handler;
+            m_event = &game->triggerManager.startTurnTrigger;
             break;
         case TriggerType::TURN_END:
-            game->triggerManager.endTurnTrigger -= handler;
+            m_event = &game->triggerManager.endTurnTrigger;
             break;
         case TriggerType::DRAW_CARD:
-            game->triggerManager.drawCardTrigger -= handler;
+            m_event = &game->triggerManager.drawCardTrigger;
             break;
         case TriggerType::PLAY_CARD:
-            game->triggerManager.playCardTrigger -= handler;
+            m_event = &game->triggerManager.playCardTrigger;
             break;
         case TriggerType::AFTER_PLAY_CARD:
-            game->triggerManager.afterPlayCardTrigger -= handler;
+            m_event = &game->triggerManager.afterPlayCardTrigger;
             break;
         case TriggerType::PLAY_MINION:
-            game->triggerManager.playMinionTrigger -= handler;
+            m_event = &game->triggerManager.playMinionTrigger;
             break;
         case TriggerType::AFTER_PLAY_MINION:
-            game->triggerManager.afterPlayMinionTrigger -= handler;
+            m_event = &game->triggerManager.afterPlayMinionTrigger;
             break;
         case TriggerType::CAST_SPELL:
-            game->triggerManager.castSpellTrigger -= handler;
+            m_event = &game->triggerManager.castSpellTrigger;
             break;
         case TriggerType::AFTER_CAST:
-            game->triggerManager.afterCastTrigger -= handler;
+            m_event = &game->triggerManager.afterCastTrigger;
             break;
         case TriggerType::SECRET_REVEALED:
-            game->triggerManager.secretRevealedTrigger -= handler;
+            m_event = &game->triggerManager.secretRevealedTrigger;
             break;
         case TriggerType::ZONE:
-            game->triggerManager.zoneTrigger -= handler;
+            m_event = &game->triggerManager.zoneTrigger;
             break;
         case TriggerType::GIVE_HEAL:
-            game->triggerManager.giveHealTrigger -= handler;
+            m_event = &game->triggerManager.giveHealTrigger;
             break;
         case TriggerType::TAKE_HEAL:
-            game->triggerManager.takeHealTrigger -= handler;
+            m_event = &game->triggerManager.takeHealTrigger;
             break;
         case TriggerType::ATTACK:
-            game->triggerManager.attackTrigger -= handler;
+            m_event = &game->triggerManager.attackTrigger;
             break;
         case TriggerType::AFTER_ATTACK:
             switch (triggerSource)
             {
                 case TriggerSource::HERO:
                 {
-                    m_owner->player->GetHero()->afterAttackTrigger -= handler;
+                    m_event = &m_owner->player->GetHero()->afterAttackTrigger;
                     break;
                 }
                 case TriggerSource::SELF:
                 {
                     auto minion = dynamic_cast<Minion*>(m_owner);
-                    minion->afterAttackTrigger -= handler;
+                    m_event = &minion->afterAttackTrigger;
                     break;
                 }
                 case TriggerSource::ENCHANTMENT_TARGET:
@@ -297,19 +200,20 @@ void Trigger::Remove() const
                         dynamic_cast<Enchantment*>(m_owner);
                     auto minion =
                         dynamic_cast<Minion*>(enchantment->GetTarget());
-                    minion->afterAttackTrigger -= handler;
+                    m_event = &minion->afterAttackTrigger;
                     break;
                 }
                 default:
                     break;
             }
+            break;
         case TriggerType::AFTER_ATTACKED:
             switch (triggerSource)
             {
                 case TriggerSource::SELF:
                 {
                     auto minion = dynamic_cast<Minion*>(m_owner);
-                    minion->afterAttackedTrigger -= handler;
+                    m_event = &minion->afterAttackedTrigger;
                     break;
                 }
                 default:
@@ -317,29 +221,29 @@ void Trigger::Remove() const
             }
             break;
         case TriggerType::SUMMON:
-            game->triggerManager.summonTrigger -= handler;
+            m_event = &game->triggerManager.summonTrigger;
             break;
         case TriggerType::AFTER_SUMMON:
-            game->triggerManager.afterSummonTrigger -= handler;
+            m_event = &game->triggerManager.afterSummonTrigger;
             break;
         case TriggerType::DEAL_DAMAGE:
-            game->triggerManager.dealDamageTrigger -= handler;
+            m_event = &game->triggerManager.dealDamageTrigger;
             break;
         case TriggerType::TAKE_DAMAGE:
-            game->triggerManager.takeDamageTrigger -= handler;
+            m_event = &game->triggerManager.takeDamageTrigger;
             break;
         case TriggerType::PREDAMAGE:
             switch (triggerSource)
             {
                 case TriggerSource::HERO:
                 {
-                    m_owner->player->GetHero()->preDamageTrigger -= handler;
+                    m_event = &m_owner->player->GetHero()->preDamageTrigger;
                     break;
                 }
                 case TriggerSource::SELF:
                 {
                     auto minion = dynamic_cast<Minion*>(m_owner);
-                    minion->preDamageTrigger -= handler;
+                    m_event = &minion->preDamageTrigger;
                     break;
                 }
                 case TriggerSource::ENCHANTMENT_TARGET:
@@ -348,33 +252,41 @@ void Trigger::Remove() const
                         dynamic_cast<Enchantment*>(m_owner);
                     auto minion =
                         dynamic_cast<Minion*>(enchantment->GetTarget());
-                    minion->preDamageTrigger -= handler;
+                    m_event = &minion->preDamageTrigger;
                     break;
                 }
                 default:
                     break;
             }
+            break;
         case TriggerType::TARGET:
-            game->triggerManager.targetTrigger -= handler;
+            m_event = &game->triggerManager.targetTrigger;
             break;
         case TriggerType::DEATH:
-            game->triggerManager.deathTrigger -= handler;
+            m_event = &game->triggerManager.deathTrigger;
             break;
         case TriggerType::USE_HERO_POWER:
-            game->triggerManager.useHeroPowerTrigger -= handler;
+            m_event = &game->triggerManager.useHeroPowerTrigger;
             break;
         case TriggerType::SHUFFLE_INTO_DECK:
-            game->triggerManager.shuffleIntoDeckTrigger -= handler;
+            m_event = &game->triggerManager.shuffleIntoDeckTrigger;
             break;
         default:
             break;
     }
 
-    if (m_sequenceType != SequenceType::NONE)
+    if (m_event != nullptr)
     {
-        EraseIf(game->triggers, [this](std::shared_ptr<Trigger> trigger) {
-            return trigger.get() == this;
-        });
+        m_handle = m_event->AddHandler(handler);
+    }
+}
+
+void Trigger::Unsubscribe()
+{
+    if (m_event != nullptr)
+    {
+        m_event->RemoveHandler(m_handle);
+        m_event = nullptr;
     }
 }
 
@@ -426,48 +338,27 @@ void Trigger::ProcessInternal(Entity* source)
 
 void Trigger::ProcessTasks(Entity* source)
 {
-    for (auto& task : tasks)
-    {
-        std::unique_ptr<ITask> clonedTask = task->Clone();
-
-        clonedTask->SetPlayer(m_owner->player);
-        clonedTask->SetSource(m_owner);
-
-        if (const auto playable = dynamic_cast<Playable*>(source); playable)
-        {
-            clonedTask->SetTarget(playable);
-        }
-        else
-        {
-            const auto enchantment = dynamic_cast<Enchantment*>(m_owner);
-
-            if (enchantment != nullptr)
-            {
-                const auto enchantPlayable =
-                    dynamic_cast<Playable*>(enchantment->GetTarget());
+    TaskFrame frame{ m_owner->player, m_owner, nullptr };
 
-                if (enchantPlayable != nullptr)
-                {
-                    clonedTask->SetTarget(enchantPlayable);
-                }
-                else
-                {
-                    clonedTask->SetTarget(nullptr);
-                }
-            }
-            else
-            {
-                clonedTask->SetTarget(nullptr);
-            }
-        }
+    if (const auto playable = dynamic_cast<Playable*>(source); playable)
+    {
+        frame.target = playable;
+    }
+    else if (const auto enchantment = dynamic_cast<Enchantment*>(m_owner);
+             enchantment != nullptr)
+    {
+        frame.target = dynamic_cast<Playable*>(enchantment->GetTarget());
+    }
 
+    for (auto& task : tasks)
+    {
         if (fastExecution)
         {
-            clonedTask->Run();
+            task->Run(frame);
         }
         else
         {
-            m_owner->game->taskQueue.Enqueue(std::move(clonedTask));
+            m_owner->game->taskQueue.Enqueue(task, frame);
         }
     }
 }
@@ -46,6 +46,16 @@ ReducedBoardView Board::CreateView() const
     }
 }
 
+PackedBoardView Board::CreatePackedView() const
+{
+    return PackedBoardView(BoardRefView(m_game, m_playerType));
+}
+
+std::uint64_t Board::GetHash() const
+{
+    return m_game.GetHash(m_playerType);
+}
+
 CurrentPlayerBoardRefView Board::GetCurPlayerStateRefView() const
 {
     if (m_game.GetCurrentPlayer()->playerType != m_playerType)
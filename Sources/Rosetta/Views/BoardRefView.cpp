@@ -192,9 +192,11 @@ std::vector<std::pair<Playable*, bool>> BoardRefView::GetOpponentHandCards()
 
     std::vector<std::pair<Playable*, bool>> result;
 
+    const CardHandle coin = Cards::GetHandle("GAME_005");
+
     for (auto& playable : playables)
     {
-        if (playable->card->id == "GAME_005")
+        if (playable->card->IsCard(coin, "GAME_005"))
         {
             // The Coin. This also reveals to opponent.
             result.emplace_back(std::make_pair(playable, true));
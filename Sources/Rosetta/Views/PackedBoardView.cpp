@@ -0,0 +1,187 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Views/BoardRefView.hpp>
+#include <Rosetta/Views/PackedBoardView.hpp>
+#include <Rosetta/Zones/HandZone.hpp>
+
+#include <cstring>
+#include <string>
+
+namespace RosettaStone
+{
+namespace
+{
+//! Returns the key that identifies \p card in the packed view.
+//! The cards that aren't loaded by Cards, e.g. the cards generated by tests,
+//! don't have handles, so they are identified by the hash of their IDs with
+//! the highest bit set not to collide with the ordinals of loaded cards.
+//! \param card The card to identify.
+//! \return The key of \p card.
+std::uint32_t GetCardKey(const Card* card)
+{
+    if (card->handle.IsValid())
+    {
+        return card->handle.GetOrdinal();
+    }
+
+    return static_cast<std::uint32_t>(std::hash<std::string>()(card->id)) |
+           0x8000'0000;
+}
+
+//! Returns the flag if \p value is true, or 0 otherwise.
+//! \param value The value to check.
+//! \param flag The flag to return.
+//! \return The flag if \p value is true, or 0 otherwise.
+int GetFlag(bool value, PackedBoardView::Flag flag)
+{
+    return value ? static_cast<int>(flag) : 0;
+}
+
+//! Fills \p side with the states of \p playerType in \p view.
+//! \param side The side to fill.
+//! \param view The board ref view.
+//! \param playerType The player type of the side.
+//! \param isMySide The flag indicates whether the side is of the view.
+void FillSide(PackedBoardView::Side& side, const BoardRefView& view,
+              PlayerType playerType, bool isMySide)
+{
+    const Hero* hero = isMySide ? view.GetHero() : view.GetOpponentHero();
+    side.hero.attack = static_cast<std::int16_t>(hero->GetAttack());
+    side.hero.health = static_cast<std::int16_t>(hero->GetHealth());
+    side.hero.armor = static_cast<std::int16_t>(hero->GetArmor());
+    side.hero.flags = static_cast<std::uint8_t>(
+        GetFlag(hero->GetGameTag(GameTag::STEALTH) == 1,
+                PackedBoardView::STEALTH) |
+        GetFlag(hero->GetGameTag(GameTag::IMMUNE) == 1,
+                PackedBoardView::IMMUNE) |
+        GetFlag(isMySide && view.IsHeroAttackable(playerType),
+                PackedBoardView::ATTACKABLE));
+
+    const HeroPower& heroPower = view.GetHeroPower(playerType);
+    side.heroPower.card = GetCardKey(heroPower.card);
+    side.heroPower.isExhausted =
+        static_cast<std::uint8_t>(heroPower.IsExhausted());
+
+    side.weapon.card = CardHandle::INVALID;
+    if (const Weapon* weapon = view.GetWeapon(playerType); weapon != nullptr)
+    {
+        side.weapon.card = GetCardKey(weapon->card);
+        side.weapon.attack = static_cast<std::int16_t>(weapon->GetAttack());
+        side.weapon.durability =
+            static_cast<std::int16_t>(weapon->GetDurability());
+    }
+
+    side.manaCrystal.remaining =
+        static_cast<std::int8_t>(view.GetRemainingMana(playerType));
+    side.manaCrystal.total =
+        static_cast<std::int8_t>(view.GetTotalMana(playerType));
+    side.manaCrystal.overloadOwed =
+        static_cast<std::int8_t>(view.GetOverloadOwed(playerType));
+    side.manaCrystal.overloadLocked =
+        static_cast<std::int8_t>(view.GetOverloadLocked(playerType));
+
+    view.ForEachMinion(playerType, [&](const Minion* minion) {
+        PackedBoardView::Minion& packed = side.minions[side.minionCount++];
+        packed.card = GetCardKey(minion->card);
+        packed.attack = static_cast<std::int16_t>(minion->GetAttack());
+        packed.health = static_cast<std::int16_t>(minion->GetHealth());
+        packed.flags = static_cast<std::uint8_t>(
+            GetFlag(minion->GetGameTag(GameTag::SILENCED) == 1,
+                    PackedBoardView::SILENCED) |
+            GetFlag(minion->GetGameTag(GameTag::TAUNT) == 1,
+                    PackedBoardView::TAUNT) |
+            GetFlag(minion->GetGameTag(GameTag::CANNOT_ATTACK_HEROES) == 1,
+                    PackedBoardView::CANT_ATTACK_HEROES) |
+            GetFlag(minion->GetGameTag(GameTag::STEALTH) == 1,
+                    PackedBoardView::STEALTH) |
+            GetFlag(minion->GetGameTag(GameTag::IMMUNE) == 1,
+                    PackedBoardView::IMMUNE) |
+            GetFlag(isMySide && minion->CanAttack(),
+                    PackedBoardView::ATTACKABLE));
+    });
+
+    side.deckCount =
+        static_cast<std::int16_t>(view.GetDeckCardCount(playerType));
+}
+}  // namespace
+
+PackedBoardView::PackedBoardView(const BoardRefView& view)
+    : m_turn(view.GetTurn()), m_side(static_cast<std::int32_t>(view.GetSide()))
+{
+    const PlayerType side = view.GetSide();
+    const PlayerType opSide =
+        (side == PlayerType::PLAYER1 ? PlayerType::PLAYER2
+                                     : PlayerType::PLAYER1);
+
+    FillSide(m_my, view, side, true);
+    view.ForEachHandCard([this](Playable* entity) {
+        HandCard& card = m_myHand[m_my.handCount++];
+        card.card = GetCardKey(entity->card);
+        card.cost = static_cast<std::int16_t>(entity->GetCost());
+        card.attack =
+            static_cast<std::int16_t>(entity->GetGameTag(GameTag::ATK));
+        card.health =
+            static_cast<std::int16_t>(entity->GetGameTag(GameTag::HEALTH));
+    });
+
+    FillSide(m_op, view, opSide, false);
+    m_op.handCount = static_cast<std::uint8_t>(view.GetOpponentHandCardCount());
+}
+
+bool PackedBoardView::operator==(const PackedBoardView& rhs) const
+{
+    return std::memcmp(this, &rhs, sizeof(PackedBoardView)) == 0;
+}
+
+bool PackedBoardView::operator!=(const PackedBoardView& rhs) const
+{
+    return !(*this == rhs);
+}
+
+std::size_t PackedBoardView::GetHash() const
+{
+    constexpr std::size_t NUM_WORDS = sizeof(PackedBoardView) / 8;
+
+    std::array<std::uint64_t, NUM_WORDS> words{};
+    std::memcpy(words.data(), this, sizeof(PackedBoardView));
+
+    std::uint64_t result = 0xCBF2'9CE4'8422'2325;
+    for (const std::uint64_t word : words)
+    {
+        result = (result ^ word) * 0x0000'0100'0000'01B3;
+        result ^= result >> 32;
+    }
+
+    return static_cast<std::size_t>(result);
+}
+
+int PackedBoardView::GetTurn() const
+{
+    return m_turn;
+}
+
+PlayerType PackedBoardView::GetSide() const
+{
+    return static_cast<PlayerType>(m_side);
+}
+
+const PackedBoardView::Side& PackedBoardView::GetMySide() const
+{
+    return m_my;
+}
+
+const PackedBoardView::Side& PackedBoardView::GetOpSide() const
+{
+    return m_op;
+}
+
+const std::array<PackedBoardView::HandCard, MAX_HAND_SIZE>&
+PackedBoardView::GetMyHand() const
+{
+    return m_myHand;
+}
+}  // namespace RosettaStone
@@ -7,34 +7,33 @@
 // It is based on peter1591's hearthstone-ai repository.
 // References: https://github.com/peter1591/hearthstone-ai
 //
-#include <Rosetta/Commons/Constants.hpp>
 #include <Rosetta/Views/Types/CardInfo.hpp>
 
 namespace RosettaStone::Views::Types
 {
-void CardInfo::SetAsRevealedCard(std::string _cardID)
+void CardInfo::SetAsRevealedCard(CardHandle _card)
 {
-    cardID = std::move(_cardID);
+    card = _card;
 }
 
 void CardInfo::SetAsHiddenCard(size_t setID, size_t cardIdx)
 {
-    cardID = INVALID_CARD_ID;
+    card = CardHandle();
     unknownCardsSetID = setID;
     unknownCardsSetCardIdx = cardIdx;
 }
 
-std::string CardInfo::GetCardID(
+CardHandle CardInfo::GetCard(
     const UnknownCardsSetsManager& unknownCardsManager) const
 {
-    if (cardID != INVALID_CARD_ID)
+    if (card.IsValid())
     {
-        return cardID;
+        return card;
     }
     else
     {
-        return unknownCardsManager.GetCardID(unknownCardsSetID,
-                                             unknownCardsSetCardIdx);
+        return unknownCardsManager.GetCard(unknownCardsSetID,
+                                           unknownCardsSetCardIdx);
     }
 }
 }  // namespace RosettaStone::Views::Types
@@ -85,26 +85,25 @@ void Player::Parse(BoardRefView gameState, PlayerType side,
     deck.clear();
     for (int i = 0; i < gameState.GetDeckCardCount(side); ++i)
     {
-        deck.push_back(
-            ParseCardInfo(INVALID_CARD_ID, blockID, unknownCardsInfo));
+        deck.push_back(ParseCardInfo(CardHandle(), blockID, unknownCardsInfo));
     }
 
     hand.clear();
     if (side == gameState.GetSide())
     {
-        gameState.ForEachCurHandCard([&](const std::string& cardID) {
-            hand.push_back(ParseCardInfo(cardID, blockID, unknownCardsInfo));
+        gameState.ForEachCurHandCard([&](CardHandle card) {
+            hand.push_back(ParseCardInfo(card, blockID, unknownCardsInfo));
         });
     }
     else
     {
-        gameState.ForEachOpHandCard([&](const std::string& cardID) {
-            hand.push_back(ParseCardInfo(cardID, blockID, unknownCardsInfo));
+        gameState.ForEachOpHandCard([&](CardHandle card) {
+            hand.push_back(ParseCardInfo(card, blockID, unknownCardsInfo));
         });
     }
 }
 
-CardInfo Player::ParseCardInfo(const std::string& cardID, int blockID,
+CardInfo Player::ParseCardInfo(CardHandle card, int blockID,
                                UnknownCardsInfo& unknownCardsInfo)
 {
     CardInfo info;
@@ -121,13 +120,13 @@ CardInfo Player::ParseCardInfo(const std::string& cardID, int blockID,
         return unknownCardsInfo.deckCards;
     };
 
-    if (cardID != INVALID_CARD_ID)
+    if (card.IsValid())
     {
         const std::size_t cardsSetID =
             GetUnknownCardSetID(blockID, BlockCardsGetter, unknownCardsInfo);
-        unknownCardsInfo.unknownCardsSets.RemoveCardFromSet(cardsSetID, cardID);
+        unknownCardsInfo.unknownCardsSets.RemoveCardFromSet(cardsSetID, card);
 
-        info.SetAsRevealedCard(cardID);
+        info.SetAsRevealedCard(card);
     }
     else
     {
@@ -9,28 +9,24 @@
 
 #include <Rosetta/Views/Types/UnknownCards.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::Views::Types
 {
-UnknownCardsSet::UnknownCardsSet(std::vector<std::string> cards)
+UnknownCardsSet::UnknownCardsSet(std::vector<CardHandle> cards)
     : m_cards(std::move(cards)), m_cardsSize(0)
 {
     // Do nothing
 }
 
-void UnknownCardsSet::Add(const std::string& cardID)
+void UnknownCardsSet::Add(CardHandle card)
 {
-    m_cards.push_back(cardID);
+    m_cards.push_back(card);
 }
 
-void UnknownCardsSet::Remove(const std::string& cardID)
+void UnknownCardsSet::Remove(CardHandle card)
 {
     for (auto iter = m_cards.begin(); iter != m_cards.end(); ++iter)
     {
-        if (*iter == cardID)
+        if (*iter == card)
         {
             m_cards.erase(iter);
             return;
@@ -43,7 +39,7 @@ void UnknownCardsSet::ResetState()
     m_cardsSize = m_cards.size();
 }
 
-std::size_t UnknownCardsSets::AddCardsSet(const std::vector<std::string>& cards)
+std::size_t UnknownCardsSets::AddCardsSet(const std::vector<CardHandle>& cards)
 {
     SetItem newItem(cards);
     newItem.refCards = 0;
@@ -60,10 +56,9 @@ std::size_t UnknownCardsSets::AssignCardToSet(size_t setIdx)
     return idx;
 }
 
-void UnknownCardsSets::RemoveCardFromSet(size_t setIdx,
-                                         const std::string& cardID)
+void UnknownCardsSets::RemoveCardFromSet(size_t setIdx, CardHandle card)
 {
-    m_sets[setIdx].cards.Remove(cardID);
+    m_sets[setIdx].cards.Remove(card);
 }
 
 void UnknownCardsSets::ResetState()
@@ -84,20 +79,20 @@ void UnknownCardsSetsManager::Setup(UnknownCardsSets& data)
     m_data = &data;
 }
 
-void UnknownCardsSetsManager::Prepare()
+void UnknownCardsSetsManager::Prepare(RandomEngine& random)
 {
     m_data->ResetState();
     m_shuffledCards.clear();
 
-    std::vector<std::string> cardsPool;
+    std::vector<CardHandle> cardsPool;
     m_data->ForEach([&](const UnknownCardsSet& set, size_t refCards) {
         set.ForEachRestCard(
-            [&](const std::string& cardID) { cardsPool.push_back(cardID); });
+            [&](CardHandle card) { cardsPool.push_back(card); });
 
         m_shuffledCards.emplace_back();
         for (std::size_t i = 0; i < refCards; ++i)
         {
-            const int randIdx = Random::get<int>(0, cardsPool.size() - 1);
+            const int randIdx = random.Get<int>(0, cardsPool.size() - 1);
             std::swap(cardsPool[randIdx], cardsPool.back());
             m_shuffledCards.back().push_back(cardsPool.back());
             cardsPool.pop_back();
@@ -105,8 +100,8 @@ void UnknownCardsSetsManager::Prepare()
     });
 }
 
-std::string UnknownCardsSetsManager::GetCardID(size_t setIdx,
-                                               size_t cardIdx) const
+CardHandle UnknownCardsSetsManager::GetCard(size_t setIdx,
+                                           size_t cardIdx) const
 {
     return m_shuffledCards[setIdx][cardIdx];
 }
@@ -5,11 +5,10 @@
 // property of any third parties.
 
 #include <Rosetta/Commons/Constants.hpp>
+#include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Zones/DeckZone.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
+#include <algorithm>
 
 namespace RosettaStone
 {
@@ -21,11 +20,6 @@ DeckZone::DeckZone(Player* player) : LimitedZone(ZoneType::DECK, MAX_DECK_SIZE)
 
 void DeckZone::RefCopy(DeckZone* rhs) const
 {
-    for (int i = 0; i < m_count; ++i)
-    {
-        delete m_entities[i];
-    }
-
     for (int i = 0; i < rhs->m_count; ++i)
     {
         m_entities[i] = rhs->m_entities[i];
@@ -41,9 +35,9 @@ void DeckZone::Add(Playable* entity, int zonePos)
 {
     LimitedZone::Add(entity, zonePos);
 
-    if (entity->card->power.GetTrigger())
+    if (entity->card->GetPower().GetTrigger())
     {
-        entity->card->power.GetTrigger()->Activate(entity,
+        entity->card->GetPower().GetTrigger()->Activate(entity,
                                                    TriggerActivation::DECK);
     }
 }
@@ -55,7 +49,7 @@ void DeckZone::ChangeEntity(Playable* oldEntity, Playable* newEntity)
     {
         if (m_entities[i] == oldEntity)
         {
-            m_entities[i] = newEntity;
+            SetAt(newEntity, i);
             flag = true;
             break;
         }
@@ -67,21 +61,34 @@ void DeckZone::ChangeEntity(Playable* oldEntity, Playable* newEntity)
             "DeckZone::ChangeEntity() - Can't find old entity");
     }
 
+    m_player->game->journal.RecordPointer(newEntity->zone);
     newEntity->zone = this;
 }
 
-void DeckZone::Shuffle() const
+void DeckZone::Shuffle()
 {
-    Random::shuffle(m_entities, m_entities + m_count);
+    GameJournal& journal = m_player->game->journal;
+    if (journal.IsRecording())
+    {
+        journal.RecordUndo(
+            [entities = m_entities,
+             saved = std::vector<Playable*>(m_entities,
+                                            m_entities + m_count)]() {
+                std::copy(saved.begin(), saved.end(), entities);
+            });
+    }
+
+    m_player->game->random.Shuffle(m_entities, m_entities + m_count);
 }
 
 void DeckZone::SetEntity(int index, Playable* newEntity)
 {
-    m_entities[index] = newEntity;
+    SetAt(newEntity, index);
+    m_player->game->journal.RecordPointer(newEntity->zone);
     newEntity->zone = this;
 }
 
-void DeckZone::Swap(Playable* entity1, Playable* entity2) const
+void DeckZone::Swap(Playable* entity1, Playable* entity2)
 {
     if (entity1->zone->GetType() != entity2->zone->GetType())
     {
@@ -108,7 +115,7 @@ void DeckZone::Swap(Playable* entity1, Playable* entity2) const
     }
 
     const auto temp = m_entities[entity1Pos];
-    m_entities[entity1Pos] = m_entities[entity2Pos];
-    m_entities[entity2Pos] = temp;
+    SetAt(m_entities[entity2Pos], entity1Pos);
+    SetAt(temp, entity2Pos);
 }
 }  // namespace RosettaStone
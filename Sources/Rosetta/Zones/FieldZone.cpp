@@ -20,11 +20,6 @@ FieldZone::FieldZone(Player* player)
 
 void FieldZone::RefCopy(FieldZone* rhs) const
 {
-    for (int i = 0; i < m_count; ++i)
-    {
-        delete m_entities[i];
-    }
-
     for (int i = 0; i < rhs->m_count; ++i)
     {
         m_entities[i] = rhs->m_entities[i];
@@ -64,6 +59,7 @@ void FieldZone::Add(Playable* entity, int zonePos)
         }
     }
 
+    minion->game->journal.RecordInt(minion->orderOfPlay);
     minion->orderOfPlay = minion->game->GetNextOOP();
 
     ActivateAura(minion);
@@ -104,10 +100,13 @@ void FieldZone::Replace(Minion* oldEntity, Minion* newEntity)
     oldEntity->player->GetSetasideZone()->Add(oldEntity);
 
     // Add new entity
+    GameJournal& journal = newEntity->game->journal;
+    journal.RecordInt(newEntity->orderOfPlay);
     newEntity->orderOfPlay = newEntity->game->GetNextOOP();
-    m_entities[pos] = dynamic_cast<Minion*>(newEntity);
+    SetAt(newEntity, pos);
     newEntity->SetZonePosition(pos);
     newEntity->SetZoneType(m_type);
+    journal.RecordPointer(newEntity->zone);
     newEntity->zone = this;
     ActivateAura(newEntity);
     for (auto& aura : auras)
@@ -149,14 +148,14 @@ int FieldZone::FindIndex(Minion* minion) const
 
 void FieldZone::ActivateAura(Minion* entity)
 {
-    if (entity->card->power.GetTrigger())
+    if (entity->card->GetPower().GetTrigger())
     {
-        entity->card->power.GetTrigger()->Activate(entity);
+        entity->card->GetPower().GetTrigger()->Activate(entity);
     }
 
-    if (entity->card->power.GetAura())
+    if (entity->card->GetPower().GetAura())
     {
-        entity->card->power.GetAura()->Activate(entity);
+        entity->card->GetPower().GetAura()->Activate(entity);
     }
 }
 
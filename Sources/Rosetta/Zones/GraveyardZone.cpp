@@ -17,11 +17,6 @@ GraveyardZone::GraveyardZone(Player* player)
 
 void GraveyardZone::RefCopy(GraveyardZone* rhs)
 {
-    for (int i = 0; i < GetCount(); ++i)
-    {
-        delete m_entities[i];
-    }
-
     for (int i = 0; i < rhs->GetCount(); ++i)
     {
         m_entities.emplace_back(rhs->m_entities[i]);
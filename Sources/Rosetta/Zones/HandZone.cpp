@@ -21,11 +21,6 @@ HandZone::HandZone(Player* player)
 
 void HandZone::RefCopy(HandZone* rhs) const
 {
-    for (int i = 0; i < m_count; ++i)
-    {
-        delete m_entities[i];
-    }
-
     for (int i = 0; i < rhs->m_count; ++i)
     {
         m_entities[i] = rhs->m_entities[i];
@@ -36,7 +31,7 @@ void HandZone::Add(Playable* entity, int zonePos)
 {
     PositioningZone::Add(entity, zonePos);
 
-    if (const auto aura = entity->card->power.GetAura(); aura)
+    if (const auto aura = entity->card->GetPower().GetAura(); aura)
     {
         if (auto effect = dynamic_cast<AdaptiveCostEffect*>(aura); effect)
         {
@@ -44,7 +39,7 @@ void HandZone::Add(Playable* entity, int zonePos)
         }
     }
 
-    if (auto trigger = entity->card->power.GetTrigger(); trigger)
+    if (auto trigger = entity->card->GetPower().GetTrigger(); trigger)
     {
         trigger->Activate(entity, TriggerActivation::HAND);
     }
@@ -93,6 +88,10 @@ void HandZone::Expand(int newSize)
 
     delete[] m_entities;
     m_entities = entities;
+
+    // NOTE: The expanded array is kept on rollback, so only the maximum size
+    // is recorded.
+    m_player->game->journal.RecordInt(m_maxSize);
     m_maxSize = newSize;
 }
 
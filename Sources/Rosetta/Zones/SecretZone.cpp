@@ -19,11 +19,6 @@ SecretZone::SecretZone(Player* player)
 
 void SecretZone::RefCopy(SecretZone* rhs) const
 {
-    for (int i = 0; i < m_count; ++i)
-    {
-        delete m_entities[i];
-    }
-
     for (int i = 0; i < rhs->m_count; ++i)
     {
         m_entities[i] = rhs->m_entities[i];
@@ -46,6 +41,7 @@ void SecretZone::Add(Playable* entity, int zonePos)
 
     LimitedZone::Add(spell, zonePos);
 
+    entity->game->journal.RecordInt(entity->orderOfPlay);
     entity->orderOfPlay = entity->game->GetNextOOP();
 }
 
@@ -64,7 +60,7 @@ bool SecretZone::Exist(Playable* entity) const
 {
     for (int i = 0; i < m_count; ++i)
     {
-        if (entity->card->id == m_entities[i]->card->id)
+        if (entity->card->IsCard(*m_entities[i]->card))
         {
             return true;
         }
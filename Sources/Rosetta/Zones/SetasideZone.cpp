@@ -16,11 +16,6 @@ SetasideZone::SetasideZone(Player* player)
 
 void SetasideZone::RefCopy(SetasideZone* rhs)
 {
-    for (int i = 0; i < GetCount(); ++i)
-    {
-        delete m_entities[i];
-    }
-
     for (int i = 0; i < rhs->GetCount(); ++i)
     {
         m_entities.emplace_back(rhs->m_entities[i]);
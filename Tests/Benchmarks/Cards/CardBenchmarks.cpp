@@ -0,0 +1,91 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Cards/Cards.hpp>
+
+using namespace RosettaStone;
+
+namespace
+{
+//! Reads the properties that the rules check from the tags of all cards, as
+//! the getters did before the hot data.
+void TagLookup(std::size_t iterations)
+{
+    // NOTE: The card data is loaded when the instance is created.
+    const auto& cards = Cards::GetInstance().GetAllCards();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        std::size_t count = 0;
+
+        for (const auto& card : cards)
+        {
+            if (card->gameTags.Get(GameTag::CARDTYPE) ==
+                    static_cast<int>(CardType::MINION) &&
+                card->gameTags.Get(GameTag::COST) <= static_cast<int>(i % 10) &&
+                card->gameTags.Get(GameTag::COLLECTIBLE) == 1)
+            {
+                ++count;
+            }
+        }
+
+        Benchmarks::DoNotOptimize(count);
+    }
+}
+
+//! Reads the properties that the rules check from the hot data of all cards.
+void HotDataLookup(std::size_t iterations)
+{
+    const auto& cards = Cards::GetInstance().GetAllCards();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        std::size_t count = 0;
+
+        for (const auto& card : cards)
+        {
+            if (card->GetCardType() == CardType::MINION &&
+                card->GetCost() <= static_cast<int>(i % 10) &&
+                card->IsCollectible())
+            {
+                ++count;
+            }
+        }
+
+        Benchmarks::DoNotOptimize(count);
+    }
+}
+
+//! Reads the properties that the rules check from the contiguous table of
+//! the hot data.
+void HotDataTableScan(std::size_t iterations)
+{
+    const auto& hotData = Cards::GetInstance().GetAllHotData();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        std::size_t count = 0;
+
+        for (const auto& data : hotData)
+        {
+            if (data.cardType == CardType::MINION &&
+                data.cost <= static_cast<int>(i % 10) &&
+                data.HasFlag(CardHotData::COLLECTIBLE))
+            {
+                ++count;
+            }
+        }
+
+        Benchmarks::DoNotOptimize(count);
+    }
+}
+}  // namespace
+
+BENCHMARK("[Card] - TagLookup", TagLookup);
+BENCHMARK("[Card] - HotDataLookup", HotDataLookup);
+BENCHMARK("[Card] - HotDataTableScan", HotDataTableScan);
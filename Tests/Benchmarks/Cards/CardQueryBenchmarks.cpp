@@ -0,0 +1,85 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Cards/CardQuery.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+
+#include <vector>
+
+using namespace RosettaStone;
+
+namespace
+{
+//! Returns the collectible cards of wild format.
+//! \return The collectible cards of wild format.
+const std::vector<Card*>& GetWildCards()
+{
+    // NOTE: The card data is loaded when the instance is created.
+    Cards::GetInstance();
+
+    return Cards::GetAllWildCards();
+}
+
+//! Picks a beast of each cost by scanning all cards, as the random-card tasks
+//! did before the index.
+void LinearScan(std::size_t iterations)
+{
+    const auto& cards = GetWildCards();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        const int cost = static_cast<int>(i % 10);
+        std::vector<Card*> result;
+
+        for (const auto& card : cards)
+        {
+            if (card->GetCardType() == CardType::MINION &&
+                card->GetRace() == Race::BEAST &&
+                card->gameTags.Get(GameTag::COST) == cost)
+            {
+                result.emplace_back(card);
+            }
+        }
+
+        Benchmarks::DoNotOptimize(result.empty() ? 0 : result.size());
+    }
+}
+
+//! Picks a beast of each cost by intersecting the index.
+void IndexedQuery(std::size_t iterations)
+{
+    GetWildCards();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        const int cost = static_cast<int>(i % 10);
+        CardQuery query(FormatType::WILD);
+        query.WithType(CardType::MINION).WithRace(Race::BEAST).WithCost(cost);
+
+        const std::size_t count = query.GetCount();
+        Benchmarks::DoNotOptimize(
+            count == 0 ? 0 : query.GetNth(i % count)->dbfID);
+    }
+}
+
+//! Finds a card by its ID.
+void FindCardByID(std::size_t iterations)
+{
+    const auto& cards = GetWildCards();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        const Card* card = Cards::FindCardByID(cards[i % cards.size()]->id);
+        Benchmarks::DoNotOptimize(card->dbfID);
+    }
+}
+}  // namespace
+
+BENCHMARK("[Cards] - LinearScan", LinearScan);
+BENCHMARK("[CardQuery] - IndexedQuery", IndexedQuery);
+BENCHMARK("[Cards] - FindCardByID", FindCardByID);
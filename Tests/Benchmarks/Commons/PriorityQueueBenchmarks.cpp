@@ -0,0 +1,182 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Auras/AuraUpdateInstruction.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Commons/Constants.hpp>
+#include <Rosetta/Commons/FixedPriorityQueue.hpp>
+#include <Rosetta/Commons/PriorityQueue.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Zones/DeckZone.hpp>
+
+#include <vector>
+
+using namespace RosettaStone;
+
+namespace
+{
+using LinkedQueue = PriorityQueue<AuraUpdateInstruction>;
+using HeapQueue = FixedPriorityQueue<AuraUpdateInstruction,
+                                     NUM_INLINE_AURA_UPDATE_INSTRUCTIONS>;
+
+//! Returns the entities that are used as the sources of instructions.
+//! \return The entities in the decks of a game.
+const std::vector<Playable*>& GetSources()
+{
+    static GameConfig config = [] {
+        // NOTE: The card data is loaded when the instance is created.
+        Cards::GetInstance();
+
+        GameConfig gameConfig;
+        gameConfig.player1Class = CardClass::MAGE;
+        gameConfig.player2Class = CardClass::WARRIOR;
+        gameConfig.startPlayer = PlayerType::PLAYER1;
+        gameConfig.doFillDecks = true;
+        gameConfig.autoRun = false;
+        return gameConfig;
+    }();
+    static Game game(config);
+    static const std::vector<Playable*> sources = [] {
+        std::vector<Playable*> entities =
+            game.GetPlayer1()->GetDeckZone()->GetAll();
+        for (auto& entity : game.GetPlayer2()->GetDeckZone()->GetAll())
+        {
+            entities.emplace_back(entity);
+        }
+        return entities;
+    }();
+
+    return sources;
+}
+
+//! Pops all instructions of \p queue as Aura::Update() does.
+//! \param queue The queue to drain.
+template <typename Queue>
+void Drain(Queue& queue)
+{
+    std::size_t sum = 0;
+
+    while (!queue.IsEmpty())
+    {
+        sum += static_cast<std::size_t>(queue.Pop().instruction);
+    }
+
+    Benchmarks::DoNotOptimize(sum);
+}
+
+//! Pushes the instruction to add \p source once, as
+//! Aura::NotifyEntityAdded() does.
+//! \param queue The queue to push.
+//! \param source The entity that is added.
+template <typename Queue>
+void PushAdd(Queue& queue, Playable* source)
+{
+    const auto instruction =
+        AuraUpdateInstruction(source, AuraInstruction::ADD);
+
+    if (!queue.IsExist(instruction))
+    {
+        queue.Push(instruction, 2);
+    }
+}
+
+//! A card is played between two aura updates: a few entities enter or leave
+//! the zone of aura.
+template <typename Queue>
+void PlayCardMix(std::size_t iterations)
+{
+    const auto& sources = GetSources();
+    Queue queue;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        Playable* source = sources[i % sources.size()];
+
+        PushAdd(queue, source);
+        PushAdd(queue, sources[(i + 1) % sources.size()]);
+        PushAdd(queue, source);
+        queue.Push(AuraUpdateInstruction(source, AuraInstruction::REMOVE), 1);
+
+        Drain(queue);
+    }
+}
+
+//! An aura is activated and removed: the instructions to apply and remove the
+//! aura to all entities.
+template <typename Queue>
+void ActivateMix(std::size_t iterations)
+{
+    Queue queue;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        queue.Push(AuraUpdateInstruction(AuraInstruction::ADD_ALL), 1);
+        Drain(queue);
+
+        queue.Push(AuraUpdateInstruction(AuraInstruction::REMOVE_ALL), 0);
+        Drain(queue);
+    }
+}
+
+//! The board is cleared and refilled: many entities leave and enter the zone
+//! of aura before it is updated.
+template <typename Queue>
+void BoardClearMix(std::size_t iterations)
+{
+    const auto& sources = GetSources();
+    const auto fieldSize = static_cast<std::size_t>(MAX_FIELD_SIZE);
+    Queue queue;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        for (std::size_t j = 0; j < 2 * fieldSize; ++j)
+        {
+            queue.Push(AuraUpdateInstruction(sources[j % sources.size()],
+                                             AuraInstruction::REMOVE),
+                       1);
+        }
+
+        for (std::size_t j = 0; j < fieldSize; ++j)
+        {
+            PushAdd(queue, sources[(2 * fieldSize + j) % sources.size()]);
+        }
+
+        Drain(queue);
+    }
+}
+
+//! An aura that has pending instructions is copied, as it is when the game is
+//! cloned.
+template <typename Queue>
+void CopyMix(std::size_t iterations)
+{
+    const auto& sources = GetSources();
+    Queue queue;
+
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        PushAdd(queue, sources[i]);
+    }
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        Queue copied(queue);
+        Benchmarks::DoNotOptimize(
+            static_cast<std::size_t>(copied.Pop().instruction));
+    }
+}
+}  // namespace
+
+BENCHMARK("[PriorityQueue] - PlayCardMix", PlayCardMix<LinkedQueue>);
+BENCHMARK("[FixedPriorityQueue] - PlayCardMix", PlayCardMix<HeapQueue>);
+BENCHMARK("[PriorityQueue] - ActivateMix", ActivateMix<LinkedQueue>);
+BENCHMARK("[FixedPriorityQueue] - ActivateMix", ActivateMix<HeapQueue>);
+BENCHMARK("[PriorityQueue] - BoardClearMix", BoardClearMix<LinkedQueue>);
+BENCHMARK("[FixedPriorityQueue] - BoardClearMix", BoardClearMix<HeapQueue>);
+BENCHMARK("[PriorityQueue] - CopyMix", CopyMix<LinkedQueue>);
+BENCHMARK("[FixedPriorityQueue] - CopyMix", CopyMix<HeapQueue>);
@@ -0,0 +1,179 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Actions/ActionParams.hpp>
+#include <Rosetta/Actions/MoveGenerator.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Commons/DeckCode.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Games/GameBatch.hpp>
+
+#include <algorithm>
+#include <random>
+
+using namespace RosettaStone;
+
+namespace
+{
+//! The seed of the random choices of playouts.
+constexpr std::uint32_t SEED = 42;
+
+//! The number of games that are played together by GameBatch.
+constexpr std::size_t BATCH_SIZE = 64;
+
+//! Makes a game config of two warlocks of the same deck.
+//! \return The game config.
+GameConfig MakeConfig()
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::WARLOCK;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doShuffle = false;
+    config.doFillDecks = false;
+    config.skipMulligan = true;
+    config.autoRun = true;
+    config.seed = SEED;
+
+    const auto deck =
+        DeckCode::Decode("AAEBAfqUAwAPMJMB3ALVA9AE9wTOBtwGkgeeB/sHsQjCCMQI9ggA")
+            .GetCardIDs();
+
+    for (std::size_t i = 0; i < deck.size(); ++i)
+    {
+        config.player1Deck[i] = Cards::FindCardByID(deck[i]);
+        config.player2Deck[i] = Cards::FindCardByID(deck[i]);
+    }
+
+    return config;
+}
+
+//!
+//! \brief RandomActionParams class.
+//!
+//! This class chooses each number of an action at random.
+//!
+class RandomActionParams : public ActionParams
+{
+ public:
+    explicit RandomActionParams(std::mt19937& random) : m_random(random)
+    {
+        // Do nothing
+    }
+
+    std::size_t GetNumber([[maybe_unused]] ActionType actionType,
+                          ActionChoices& choices) final
+    {
+        std::uniform_int_distribution<std::size_t> dist(0, choices.Size() - 1);
+        return choices.Get(dist(m_random));
+    }
+
+ private:
+    std::mt19937& m_random;
+};
+
+//! Plays random games by choosing each number of ActionParams.
+void ActionParamsPlayout(std::size_t iterations)
+{
+    const GameConfig config = MakeConfig();
+    std::mt19937 random(SEED);
+    std::size_t actions = 0;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        Game game(config);
+        game.Start();
+
+        while (game.state != State::COMPLETE)
+        {
+            RandomActionParams params(random);
+            params.Initialize(game);
+            game.PerformAction(params);
+            ++actions;
+        }
+    }
+
+    Benchmarks::DoNotOptimize(actions);
+}
+
+//! Plays random games by choosing a move from the generated moves.
+void MoveGeneratorPlayout(std::size_t iterations)
+{
+    const GameConfig config = MakeConfig();
+    std::mt19937 random(SEED);
+    std::vector<Move> moves;
+    std::size_t actions = 0;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        Game game(config);
+        game.Start();
+
+        while (game.state != State::COMPLETE)
+        {
+            MoveGenerator(game).Generate(moves);
+
+            std::uniform_int_distribution<std::size_t> dist(0,
+                                                            moves.size() - 1);
+            game.ApplyMove(moves[dist(random)]);
+            ++actions;
+        }
+    }
+
+    Benchmarks::DoNotOptimize(actions);
+}
+
+//! Plays random games in a batch, replacing each finished game with a new
+//! game until the given number of games are played.
+void GameBatchPlayout(std::size_t iterations)
+{
+    GameBatch batch(MakeConfig(), std::min(iterations, BATCH_SIZE));
+    batch.Start();
+
+    std::mt19937 random(SEED);
+    std::vector<Move> moves(batch.GetSize());
+    std::size_t numStarted = batch.GetSize();
+    std::size_t actions = 0;
+
+    while (batch.GetNumRunning() > 0)
+    {
+        batch.GenerateMoves();
+
+        for (std::size_t i = 0; i < batch.GetSize(); ++i)
+        {
+            const auto& gameMoves = batch.GetMoves(i);
+            if (gameMoves.empty())
+            {
+                continue;
+            }
+
+            std::uniform_int_distribution<std::size_t> dist(
+                0, gameMoves.size() - 1);
+            moves[i] = gameMoves[dist(random)];
+            ++actions;
+        }
+
+        const auto& results = batch.Step(moves);
+
+        for (std::size_t i = 0; i < batch.GetSize(); ++i)
+        {
+            if (results[i].isComplete && numStarted < iterations)
+            {
+                batch.Reset(i);
+                ++numStarted;
+            }
+        }
+    }
+
+    Benchmarks::DoNotOptimize(actions);
+}
+}  // namespace
+
+BENCHMARK("[Playout] - ActionParams", ActionParamsPlayout);
+BENCHMARK("[Playout] - MoveGenerator", MoveGeneratorPlayout);
+BENCHMARK("[Playout] - GameBatch", GameBatchPlayout);
@@ -0,0 +1,137 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Actions/Summon.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+
+using namespace RosettaStone;
+
+namespace
+{
+//! Makes a game that both fields are full of beasts and other minions.
+//! \param game The game to set up.
+void SetUpGame(Game& game)
+{
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    for (Player* player : { game.GetCurrentPlayer(), game.GetOpponentPlayer() })
+    {
+        for (int i = 0; i < MAX_FIELD_SIZE; ++i)
+        {
+            const auto minion = dynamic_cast<Minion*>(Entity::GetFromCard(
+                player, Cards::FindCardByID(i % 2 == 0 ? "CS2_120" : "CS1_042"),
+                std::nullopt, player->GetFieldZone()));
+            Generic::Summon(minion, -1, nullptr);
+            minion->SetExhausted(false);
+        }
+    }
+}
+
+//! Makes a game config of a hunter and a warrior.
+//! \return The game config.
+GameConfig MakeConfig()
+{
+    GameConfig config;
+    config.player1Class = CardClass::HUNTER;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    return config;
+}
+
+//! Evaluates the heuristic queries by reading the tags of each character.
+void PointerQueries(std::size_t iterations)
+{
+    Game game(MakeConfig());
+    SetUpGame(game);
+
+    Player* player = game.GetCurrentPlayer();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        int attack = 0;
+        int beasts = 0;
+        int taunts = 0;
+
+        for (const auto& minion : player->GetFieldZone()->GetView())
+        {
+            attack += minion->CanAttack() ? minion->GetAttack() : 0;
+            beasts += minion->IsRace(Race::BEAST) ? 1 : 0;
+        }
+
+        for (const auto& minion : player->opponent->GetFieldZone()->GetView())
+        {
+            taunts += minion->HasTaunt() ? 1 : 0;
+            beasts -= minion->IsRace(Race::BEAST) ? 1 : 0;
+        }
+
+        const Hero* hero = player->opponent->GetHero();
+        const bool isLethal =
+            taunts == 0 && attack >= hero->GetHealth() + hero->GetArmor();
+
+        Benchmarks::DoNotOptimize(static_cast<std::size_t>(
+            attack + beasts + taunts + static_cast<int>(isLethal)));
+    }
+}
+
+//! Evaluates the heuristic queries by building the mirrors every time.
+void MirrorBuildQueries(std::size_t iterations)
+{
+    Game game(MakeConfig());
+    SetUpGame(game);
+
+    Player* player = game.GetCurrentPlayer();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        const FieldMirror mine = FieldMirror::Build(player);
+        const FieldMirror enemy = FieldMirror::Build(player->opponent);
+
+        const int attack = mine.GetFaceDamage();
+        const int beasts =
+            mine.CountRace(Race::BEAST) - enemy.CountRace(Race::BEAST);
+        const bool isLethal = mine.HasLethal(enemy);
+
+        Benchmarks::DoNotOptimize(static_cast<std::size_t>(
+            attack + beasts + static_cast<int>(isLethal)));
+    }
+}
+
+//! Evaluates the heuristic queries by reading the mirrors of players, which
+//! are built only once while the game doesn't change.
+void MirrorCachedQueries(std::size_t iterations)
+{
+    Game game(MakeConfig());
+    SetUpGame(game);
+
+    Player* player = game.GetCurrentPlayer();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        const FieldMirror& mine = player->GetFieldMirror();
+        const FieldMirror& enemy = player->opponent->GetFieldMirror();
+
+        const int attack = mine.GetFaceDamage();
+        const int beasts =
+            mine.CountRace(Race::BEAST) - enemy.CountRace(Race::BEAST);
+        const bool isLethal = mine.HasLethal(enemy);
+
+        Benchmarks::DoNotOptimize(static_cast<std::size_t>(
+            attack + beasts + static_cast<int>(isLethal)));
+    }
+}
+}  // namespace
+
+BENCHMARK("[FieldMirror] - PointerQueries", PointerQueries);
+BENCHMARK("[FieldMirror] - MirrorBuildQueries", MirrorBuildQueries);
+BENCHMARK("[FieldMirror] - MirrorCachedQueries", MirrorCachedQueries);
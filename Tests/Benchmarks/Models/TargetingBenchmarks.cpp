@@ -0,0 +1,161 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Actions/ActionValidGetter.hpp>
+#include <Rosetta/Actions/Draw.hpp>
+#include <Rosetta/Actions/Summon.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+
+using namespace RosettaStone;
+
+namespace
+{
+//! The number of Fireballs in hand.
+constexpr int NUM_CARDS = 5;
+
+//! Makes a game that both fields are full and the current player has
+//! Fireballs in hand.
+//! \param game The game to set up.
+void SetUpGame(Game& game)
+{
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    for (Player* player : { game.GetCurrentPlayer(), game.GetOpponentPlayer() })
+    {
+        for (int i = 0; i < MAX_FIELD_SIZE; ++i)
+        {
+            const auto minion = dynamic_cast<Minion*>(Entity::GetFromCard(
+                player, Cards::FindCardByID("CS2_172"), std::nullopt,
+                player->GetFieldZone()));
+            Generic::Summon(minion, -1, nullptr);
+            minion->SetExhausted(false);
+        }
+    }
+
+    for (int i = 0; i < NUM_CARDS; ++i)
+    {
+        Generic::DrawCard(game.GetCurrentPlayer(),
+                          Cards::FindCardByID("CS2_029"));
+    }
+}
+
+//! Makes a game config of a mage and a warrior.
+//! \return The game config.
+GameConfig MakeConfig()
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    return config;
+}
+
+//! Enumerates the play targets of Fireballs as lists of characters.
+void PlayTargetList(std::size_t iterations)
+{
+    Game game(MakeConfig());
+    SetUpGame(game);
+
+    const auto& hand = *game.GetCurrentPlayer()->GetHandZone();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        std::size_t count = 0;
+
+        for (const auto& card : hand.GetView())
+        {
+            count += card->GetValidPlayTargets().size();
+        }
+
+        Benchmarks::DoNotOptimize(count);
+    }
+}
+
+//! Enumerates the play targets of Fireballs as masks, building the masks of
+//! characters once.
+void PlayTargetMask(std::size_t iterations)
+{
+    Game game(MakeConfig());
+    SetUpGame(game);
+
+    Player* player = game.GetCurrentPlayer();
+    const auto& hand = *player->GetHandZone();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        const CharacterMasks friendly = CharacterMasks::Build(player);
+        const CharacterMasks enemy = CharacterMasks::Build(player->opponent);
+        std::size_t count = 0;
+
+        for (const auto& card : hand.GetView())
+        {
+            count += card->GetValidPlayTargetMask(friendly, enemy).GetCount();
+        }
+
+        Benchmarks::DoNotOptimize(count);
+    }
+}
+
+//! Enumerates the attackers and their targets as lists of characters.
+void AttackTargetList(std::size_t iterations)
+{
+    Game game(MakeConfig());
+    SetUpGame(game);
+
+    Player* player = game.GetCurrentPlayer();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        std::size_t count = 0;
+
+        for (const auto& minion : player->GetFieldZone()->GetView())
+        {
+            if (minion->CanAttack())
+            {
+                count += minion->GetValidAttackTargets(player->opponent).size();
+            }
+        }
+
+        Benchmarks::DoNotOptimize(count);
+    }
+}
+
+//! Enumerates the attackers and their targets as masks.
+void AttackTargetMask(std::size_t iterations)
+{
+    Game game(MakeConfig());
+    SetUpGame(game);
+
+    Player* player = game.GetCurrentPlayer();
+    const ActionValidGetter getter(game);
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        const CharacterMasks enemy = CharacterMasks::Build(player->opponent);
+        std::size_t count = 0;
+
+        getter.ForEachAttacker([&](Character* character) {
+            count += character->GetValidAttackTargetMask(enemy).GetCount();
+            return true;
+        });
+
+        Benchmarks::DoNotOptimize(count);
+    }
+}
+}  // namespace
+
+BENCHMARK("[Targeting] - PlayTargetList", PlayTargetList);
+BENCHMARK("[Targeting] - PlayTargetMask", PlayTargetMask);
+BENCHMARK("[Targeting] - AttackTargetList", AttackTargetList);
+BENCHMARK("[Targeting] - AttackTargetMask", AttackTargetMask);
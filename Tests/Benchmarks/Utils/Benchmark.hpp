@@ -0,0 +1,53 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BENCHMARKS_BENCHMARK_HPP
+#define BENCHMARKS_BENCHMARK_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Benchmarks
+{
+//! The function that runs a benchmark for given number of iterations.
+using BenchmarkFunc = void (*)(std::size_t iterations);
+
+//!
+//! \brief Benchmark struct.
+//!
+//! This struct stores the name and the function of a benchmark.
+//!
+struct Benchmark
+{
+    std::string name;
+    BenchmarkFunc func = nullptr;
+};
+
+//! Returns all registered benchmarks.
+//! \return All registered benchmarks in order of registration.
+std::vector<Benchmark>& GetBenchmarks();
+
+//! Registers a benchmark.
+//! \param name The name of benchmark.
+//! \param func The function of benchmark.
+//! \return Always true. It is used to register at static initialization.
+bool Register(std::string name, BenchmarkFunc func);
+
+//! Prevents the compiler from optimizing away the computation of \p value.
+//! \param value The value to keep.
+void DoNotOptimize(std::size_t value);
+}  // namespace Benchmarks
+
+#define BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_IMPL(a, b)
+
+//! Registers \p func as a benchmark that is named \p name.
+#define BENCHMARK(name, func)                                         \
+    static const bool BENCHMARK_CONCAT(benchmarkRegistered, __LINE__) = \
+        Benchmarks::Register(name, func)
+
+#endif  // BENCHMARKS_BENCHMARK_HPP
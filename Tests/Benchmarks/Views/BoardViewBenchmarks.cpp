@@ -0,0 +1,97 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Actions/Draw.hpp>
+#include <Rosetta/Actions/Summon.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Views/BoardRefView.hpp>
+#include <Rosetta/Views/PackedBoardView.hpp>
+#include <Rosetta/Views/ReducedBoardView.hpp>
+
+using namespace RosettaStone;
+
+namespace
+{
+//! Makes a game that both fields are full and the hands have some cards.
+//! \param game The game to set up.
+void SetUpGame(Game& game)
+{
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    for (Player* player : { game.GetCurrentPlayer(), game.GetOpponentPlayer() })
+    {
+        for (int i = 0; i < MAX_FIELD_SIZE; ++i)
+        {
+            const auto minion = dynamic_cast<Minion*>(Entity::GetFromCard(
+                player, Cards::FindCardByID("CS2_172"), std::nullopt,
+                player->GetFieldZone()));
+            Generic::Summon(minion, -1, nullptr);
+        }
+
+        for (int i = 0; i < 3; ++i)
+        {
+            Generic::DrawCard(player, Cards::FindCardByID("CS2_029"));
+        }
+    }
+}
+
+//! Makes a game config of a mage and a warrior.
+//! \return The game config.
+GameConfig MakeConfig()
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    return config;
+}
+
+//! Creates, hashes and compares reduced board views as search keys.
+void ReducedView(std::size_t iterations)
+{
+    Game game(MakeConfig());
+    SetUpGame(game);
+
+    const BoardRefView board(game, PlayerType::PLAYER1);
+    const ReducedBoardView key(board);
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        const ReducedBoardView view(board);
+        const std::size_t hash = std::hash<ReducedBoardView>()(view);
+
+        Benchmarks::DoNotOptimize(hash + static_cast<std::size_t>(view == key));
+    }
+}
+
+//! Creates, hashes and compares packed board views as search keys.
+void PackedView(std::size_t iterations)
+{
+    Game game(MakeConfig());
+    SetUpGame(game);
+
+    const BoardRefView board(game, PlayerType::PLAYER1);
+    const PackedBoardView key(board);
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        const PackedBoardView view(board);
+        const std::size_t hash = std::hash<PackedBoardView>()(view);
+
+        Benchmarks::DoNotOptimize(hash + static_cast<std::size_t>(view == key));
+    }
+}
+}  // namespace
+
+BENCHMARK("[BoardView] - ReducedView", ReducedView);
+BENCHMARK("[BoardView] - PackedView", PackedView);
@@ -0,0 +1,85 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/Benchmark.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <utility>
+
+namespace Benchmarks
+{
+namespace
+{
+//! The minimum time to run a benchmark for a stable measurement.
+constexpr std::chrono::milliseconds MIN_DURATION(200);
+
+volatile std::size_t g_sink = 0;
+}  // namespace
+
+std::vector<Benchmark>& GetBenchmarks()
+{
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+bool Register(std::string name, BenchmarkFunc func)
+{
+    GetBenchmarks().emplace_back(Benchmark{ std::move(name), func });
+    return true;
+}
+
+void DoNotOptimize(std::size_t value)
+{
+    g_sink = g_sink + value;
+}
+}  // namespace Benchmarks
+
+int main(int argc, char* argv[])
+{
+    using namespace Benchmarks;
+    using Clock = std::chrono::steady_clock;
+
+    // Runs the benchmarks whose name contains the filter if it is given
+    const std::string filter = argc > 1 ? argv[1] : "";
+
+    for (const auto& benchmark : GetBenchmarks())
+    {
+        if (benchmark.name.find(filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        // NOTE: The first run loads the card data and warms up caches.
+        benchmark.func(1);
+
+        // Doubles the number of iterations until it runs long enough
+        std::size_t iterations = 1;
+        Clock::duration elapsed{};
+        while (true)
+        {
+            const auto start = Clock::now();
+            benchmark.func(iterations);
+            elapsed = Clock::now() - start;
+
+            if (elapsed >= MIN_DURATION)
+            {
+                break;
+            }
+
+            iterations *= 2;
+        }
+
+        const double nanoseconds = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                .count());
+        std::printf("%-56s %12.1f ns/op %12zu ops\n", benchmark.name.c_str(),
+                    nanoseconds / static_cast<double>(iterations), iterations);
+    }
+
+    return 0;
+}
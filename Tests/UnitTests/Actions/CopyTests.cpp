@@ -51,8 +51,6 @@ TEST_CASE("[Copy] - Copy")
 
         auto copiedEntity = Generic::Copy(curPlayer, playable, ZoneType::HAND);
         CHECK_EQ(copiedEntity->GetZoneType(), ZoneType::HAND);
-
-        delete playable;
     }
 
     // Case 1-2: Hand -> Play
@@ -70,8 +68,6 @@ TEST_CASE("[Copy] - Copy")
 
         auto copiedEntity = Generic::Copy(curPlayer, playable, ZoneType::PLAY);
         CHECK_EQ(copiedEntity->GetZoneType(), ZoneType::PLAY);
-
-        delete playable;
     }
 
     // Case 1-3: Deck -> Play
@@ -89,8 +85,6 @@ TEST_CASE("[Copy] - Copy")
 
         auto copiedEntity = Generic::Copy(curPlayer, playable, ZoneType::PLAY);
         CHECK_EQ(copiedEntity->GetZoneType(), ZoneType::PLAY);
-
-        delete playable;
     }
 
     // Case 2-1: Play -> Hand
@@ -108,8 +102,6 @@ TEST_CASE("[Copy] - Copy")
 
         auto copiedEntity = Generic::Copy(curPlayer, playable, ZoneType::HAND);
         CHECK_EQ(copiedEntity->GetZoneType(), ZoneType::HAND);
-
-        delete playable;
     }
 
     // Case 2-2: Hand -> Deck
@@ -127,8 +119,6 @@ TEST_CASE("[Copy] - Copy")
 
         auto copiedEntity = Generic::Copy(curPlayer, playable, ZoneType::DECK);
         CHECK_EQ(copiedEntity->GetZoneType(), ZoneType::DECK);
-
-        delete playable;
     }
 
     // Case 2-3: Play -> Deck
@@ -146,8 +136,6 @@ TEST_CASE("[Copy] - Copy")
 
         auto copiedEntity = Generic::Copy(curPlayer, playable, ZoneType::DECK);
         CHECK_EQ(copiedEntity->GetZoneType(), ZoneType::DECK);
-
-        delete playable;
     }
 
     // Case 2-4: Play -> Graveyard
@@ -166,8 +154,6 @@ TEST_CASE("[Copy] - Copy")
         auto copiedEntity =
             Generic::Copy(curPlayer, playable, ZoneType::GRAVEYARD);
         CHECK_NE(copiedEntity->GetZoneType(), ZoneType::GRAVEYARD);
-
-        delete playable;
     }
 
     // Case 2-5: Hand -> Graveyard
@@ -186,8 +172,6 @@ TEST_CASE("[Copy] - Copy")
         auto copiedEntity =
             Generic::Copy(curPlayer, playable, ZoneType::GRAVEYARD);
         CHECK_NE(copiedEntity->GetZoneType(), ZoneType::GRAVEYARD);
-
-        delete playable;
     }
 
     // Case 2-6: Deck -> Graveyard
@@ -206,8 +190,6 @@ TEST_CASE("[Copy] - Copy")
         auto copiedEntity =
             Generic::Copy(curPlayer, playable, ZoneType::GRAVEYARD);
         CHECK_NE(copiedEntity->GetZoneType(), ZoneType::GRAVEYARD);
-
-        delete playable;
     }
 
     // Case 2-7: Graveyard -> Play
@@ -225,8 +207,6 @@ TEST_CASE("[Copy] - Copy")
 
         auto copiedEntity = Generic::Copy(curPlayer, playable, ZoneType::PLAY);
         CHECK_EQ(copiedEntity->GetZoneType(), ZoneType::PLAY);
-
-        delete playable;
     }
 
     // Case 2-8: Graveyard -> Hand
@@ -244,8 +224,6 @@ TEST_CASE("[Copy] - Copy")
 
         auto copiedEntity = Generic::Copy(curPlayer, playable, ZoneType::HAND);
         CHECK_EQ(copiedEntity->GetZoneType(), ZoneType::HAND);
-
-        delete playable;
     }
 
     // Case 2-9: Graveyard -> Deck
@@ -263,8 +241,6 @@ TEST_CASE("[Copy] - Copy")
 
         auto copiedEntity = Generic::Copy(curPlayer, playable, ZoneType::DECK);
         CHECK_EQ(copiedEntity->GetZoneType(), ZoneType::DECK);
-
-        delete playable;
     }
 
     // Case 3-1: sourceZone equals targetZone
@@ -282,8 +258,6 @@ TEST_CASE("[Copy] - Copy")
 
         auto copiedEntity = Generic::Copy(curPlayer, playable, ZoneType::HAND);
         CHECK_EQ(copiedEntity->GetZoneType(), ZoneType::HAND);
-
-        delete playable;
     }
 
     // Case 3-2: targetZone is setaside
@@ -302,7 +276,5 @@ TEST_CASE("[Copy] - Copy")
         auto copiedEntity =
             Generic::Copy(curPlayer, playable, ZoneType::SETASIDE);
         CHECK_EQ(copiedEntity->GetZoneType(), ZoneType::SETASIDE);
-
-        delete playable;
     }
 }
\ No newline at end of file
@@ -0,0 +1,158 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Actions/ActionValidChecker.hpp>
+#include <Rosetta/Actions/Draw.hpp>
+#include <Rosetta/Actions/MoveGenerator.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Commons/DeckCode.hpp>
+#include <Rosetta/Commons/RandomEngine.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+#include <Rosetta/Zones/HandZone.hpp>
+
+#include <algorithm>
+
+using namespace RosettaStone;
+using namespace PlayerTasks;
+
+namespace
+{
+//! Returns the number of moves of \p op in \p moves.
+std::size_t CountMoves(const std::vector<Move>& moves, MainOpType op)
+{
+    return static_cast<std::size_t>(
+        std::count_if(moves.begin(), moves.end(),
+                      [op](const Move& move) { return move.op == op; }));
+}
+}  // namespace
+
+TEST_CASE("[MoveGenerator] - Generate")
+{
+    GameConfig config;
+    config.player1Class = CardClass::DRUID;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = false;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    auto& curField = *(curPlayer->GetFieldZone());
+    auto& curHand = *(curPlayer->GetHandZone());
+
+    const auto card1 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Wisp"));
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+    Generic::DrawCard(curPlayer, Cards::FindCardByName("Wisp"));
+    Generic::DrawCard(curPlayer, Cards::FindCardByName("Moonfire"));
+    Generic::DrawCard(curPlayer, Cards::FindCardByName("Wrath"));
+
+    std::vector<Move> moves;
+    MoveGenerator(game).Generate(moves);
+
+    // Wisp is put in 2 positions, Moonfire has 3 targets, and each of 2
+    // options of Wrath has 1 target. The Wisp in field can't attack yet.
+    CHECK_EQ(CountMoves(moves, MainOpType::PLAY_CARD), 2u + 3u + 2u);
+    CHECK_EQ(CountMoves(moves, MainOpType::ATTACK), 0u);
+    CHECK_EQ(CountMoves(moves, MainOpType::USE_HERO_POWER), 1u);
+    CHECK_EQ(moves.back().op, MainOpType::END_TURN);
+    CHECK_EQ(moves.front().position, 0);
+    CHECK_EQ(moves.front().target, Move::NO_TARGET);
+
+    // The moves agree with ActionValidChecker
+    ActionValidChecker checker;
+    checker.Check(game);
+    CHECK_EQ(checker.GetMainActionsCount(), 3);
+
+    for (const auto& move : moves)
+    {
+        if (move.op != MainOpType::PLAY_CARD)
+        {
+            continue;
+        }
+
+        const auto& cards = checker.GetPlayableCards();
+        CHECK(std::find(cards.begin(), cards.end(), curHand[move.source]) !=
+              cards.end());
+    }
+
+    // Moonfire to the enemy hero
+    const Move move = *std::find_if(moves.begin(), moves.end(), [&](auto m) {
+        return m.op == MainOpType::PLAY_CARD &&
+               curHand[m.source]->card->name == "Moonfire" &&
+               Move::GetCharacter(curPlayer, m.target) == opPlayer->GetHero();
+    });
+    CHECK_EQ(move.target, Move::ENEMY_OFFSET + HERO_BIT);
+
+    const int opHealth = opPlayer->GetHero()->GetHealth();
+    game.ApplyMove(move);
+    CHECK_EQ(opPlayer->GetHero()->GetHealth(), opHealth - 1);
+    CHECK_EQ(curHand.GetCount(), 2);
+
+    // The Wisp is put in the left of the Wisp in field
+    MoveGenerator(game).Generate(moves);
+    const Move wisp = moves.front();
+    CHECK_EQ(curHand[wisp.source]->card->name, "Wisp");
+    game.ApplyMove(wisp);
+    CHECK_EQ(curField.GetCount(), 2);
+    CHECK_EQ(curField[1], card1);
+}
+
+TEST_CASE("[MoveGenerator] - Playout")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::ROGUE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doShuffle = false;
+    config.doFillDecks = false;
+    config.skipMulligan = true;
+    config.autoRun = true;
+    config.seed = 7;
+
+    const std::string INNKEEPER_EXPERT_WARLOCK =
+        "AAEBAfqUAwAPMJMB3ALVA9AE9wTOBtwGkgeeB/sHsQjCCMQI9ggA";
+    auto deck = DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
+
+    for (std::size_t j = 0; j < deck.size(); ++j)
+    {
+        config.player1Deck[j] = Cards::FindCardByID(deck[j]);
+        config.player2Deck[j] = Cards::FindCardByID(deck[j]);
+    }
+
+    Game game(config);
+    game.Start();
+
+    RandomEngine random(7);
+    std::vector<Move> moves;
+
+    while (game.state != State::COMPLETE)
+    {
+        MoveGenerator(game).Generate(moves);
+        CHECK_FALSE(moves.empty());
+
+        const auto idx = random.Get<std::size_t>(0, moves.size() - 1);
+        game.ApplyMove(moves[idx]);
+    }
+
+    const PlayState p1State = game.GetPlayer1()->playState;
+    const PlayState p2State = game.GetPlayer2()->playState;
+    CHECK((p1State == PlayState::WON || p1State == PlayState::LOST ||
+           p1State == PlayState::TIED));
+    CHECK((p2State == PlayState::WON || p2State == PlayState::LOST ||
+           p2State == PlayState::TIED));
+}
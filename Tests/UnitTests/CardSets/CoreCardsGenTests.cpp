@@ -5567,7 +5567,7 @@ TEST_CASE("[Demon Hunter : Minion] - BT_323 : Sightless Watcher")
     CHECK_EQ(curPlayer->choice->choices.size(), 3u);
 
     auto pickedCardID =
-        game.entityList[curPlayer->choice->choices[0]]->card->id;
+        game.entityList.Get(curPlayer->choice->choices[0])->card->id;
     game.Process(curPlayer,
                  ChooseTask::Pick(curPlayer, curPlayer->choice->choices[0]));
 
@@ -8298,7 +8298,7 @@ TEST_CASE("[Neutral : Minion] - DRG_086 : Chromatic Egg")
     }
 
     Generic::ChoicePick(curPlayer, 27);
-    auto minion = game.entityList[27];
+    auto minion = game.entityList.Get(27);
 
     game.Process(curPlayer, EndTurnTask());
     game.ProcessUntil(Step::MAIN_ACTION);
@@ -0,0 +1,150 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Cards/CardBitset.hpp>
+#include <Rosetta/Cards/CardQuery.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+
+#include <vector>
+
+using namespace RosettaStone;
+
+TEST_CASE("[CardBitset] - Set and Count")
+{
+    CardBitset bits(130);
+    CHECK_EQ(bits.GetSize(), 130u);
+    CHECK_EQ(bits.Count(), 0u);
+
+    bits.Set(0);
+    bits.Set(63);
+    bits.Set(64);
+    bits.Set(129);
+    CHECK(bits.Test(63));
+    CHECK_FALSE(bits.Test(62));
+    CHECK_FALSE(bits.Test(200));
+    CHECK_EQ(bits.Count(), 4u);
+    CHECK_EQ(bits.FindNth(2), 64u);
+    CHECK_EQ(bits.FindNth(3), 129u);
+    CHECK_EQ(bits.FindNth(4), 130u);
+
+    std::vector<std::size_t> indices;
+    bits.ForEach([&](std::size_t idx) { indices.emplace_back(idx); });
+    CHECK_EQ(indices, std::vector<std::size_t>{ 0, 63, 64, 129 });
+
+    CardBitset other(130);
+    other.Set(63);
+    other.Set(100);
+
+    CardBitset united = bits;
+    united |= other;
+    CHECK_EQ(united.Count(), 5u);
+
+    bits &= other;
+    CHECK_EQ(bits.Count(), 1u);
+    CHECK(bits.Test(63));
+
+    // The missing bits of a shorter bitset are 0
+    bits &= CardBitset();
+    CHECK_EQ(bits.Count(), 0u);
+}
+
+TEST_CASE("[CardQuery] - Format and properties")
+{
+    Cards::GetInstance();
+
+    // The query of format matches the cards of the format in the same order
+    CHECK_EQ(CardQuery(FormatType::STANDARD).GetCards(),
+             Cards::GetAllStandardCards());
+    CHECK_EQ(CardQuery(FormatType::WILD).GetCards(), Cards::GetAllWildCards());
+    CHECK_EQ(CardQuery().GetCount(), Cards::GetAllCards().size());
+
+    std::vector<Card*> expected;
+    for (const auto& card : Cards::GetAllWildCards())
+    {
+        if (card->GetCardType() == CardType::MINION &&
+            card->GetRace() == Race::BEAST &&
+            card->gameTags.Get(GameTag::COST) == 3)
+        {
+            expected.emplace_back(card);
+        }
+    }
+
+    CardQuery query(FormatType::WILD);
+    query.WithType(CardType::MINION).WithRace(Race::BEAST).WithCost(3);
+    CHECK_FALSE(expected.empty());
+    CHECK_EQ(query.GetCards(), expected);
+    CHECK_EQ(query.GetCount(), expected.size());
+    CHECK_EQ(query.GetNth(0), expected.front());
+    CHECK_EQ(query.GetNth(expected.size() - 1), expected.back());
+    CHECK_EQ(query.GetNth(expected.size()), nullptr);
+
+    expected.clear();
+    for (const auto& card : Cards::GetStandardCards(CardClass::MAGE))
+    {
+        if (card->GetCardType() == CardType::SPELL &&
+            card->GetRarity() == Rarity::EPIC)
+        {
+            expected.emplace_back(card);
+        }
+    }
+
+    CHECK_EQ(CardQuery(FormatType::STANDARD)
+                 .WithClass(CardClass::MAGE)
+                 .WithType(CardType::SPELL)
+                 .WithRarity(Rarity::EPIC)
+                 .GetCards(),
+             expected);
+}
+
+TEST_CASE("[CardQuery] - Cost and Where")
+{
+    Cards::GetInstance();
+
+    const auto cards = CardQuery(FormatType::STANDARD)
+                           .WithType(CardType::MINION)
+                           .WithCost(1, 2)
+                           .Where([](const Card* card) {
+                               return card->gameTags.Get(GameTag::TAUNT) == 1;
+                           })
+                           .GetCards();
+    CHECK_FALSE(cards.empty());
+
+    for (const auto& card : cards)
+    {
+        CHECK_EQ(card->GetCardType(), CardType::MINION);
+        CHECK_GE(card->gameTags.Get(GameTag::COST), 1);
+        CHECK_LE(card->gameTags.Get(GameTag::COST), 2);
+        CHECK_EQ(card->gameTags.Get(GameTag::TAUNT), 1);
+    }
+
+    CHECK(CardQuery().WithCost(2, 1).IsEmpty());
+    CHECK(CardQuery().WithCost(1000).IsEmpty());
+    CHECK(CardQuery().WithRace(static_cast<Race>(-1)).IsEmpty());
+}
+
+TEST_CASE("[CardQuery] - Filters don't change the base cards")
+{
+    Cards::GetInstance();
+
+    const std::size_t numStandardCards = Cards::GetAllStandardCards().size();
+
+    // The query without filters matches the base cards
+    CHECK_EQ(CardQuery().GetCount(), Cards::GetAllCards().size());
+    CHECK_EQ(CardQuery(FormatType::STANDARD).GetCount(), numStandardCards);
+    CHECK_EQ(CardQuery(FormatType::STANDARD).GetNth(0),
+             Cards::GetAllStandardCards()[0]);
+
+    CHECK(CardQuery(FormatType::STANDARD)
+              .Where([](const Card*) { return false; })
+              .IsEmpty());
+    CHECK(CardQuery(FormatType::STANDARD).WithCost(1000).IsEmpty());
+
+    // The filters of the queries above are not applied to the base cards
+    CHECK_EQ(CardQuery(FormatType::STANDARD).GetCards(),
+             Cards::GetAllStandardCards());
+}
@@ -7,6 +7,7 @@
 #include "doctest_proxy.hpp"
 
 #include <Rosetta/Cards/Card.hpp>
+#include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Enums/CardEnums.hpp>
 
 using namespace RosettaStone;
@@ -48,10 +49,10 @@ TEST_CASE("[Card] - Constructer")
     CHECK_EQ(CardClass::NEUTRAL, card1.GetCardClass());
     CHECK_EQ(CardType::MINION, card1.GetCardType());
     CHECK_EQ(Race::DRAGON, card1.GetRace());
-    CHECK_EQ(1, card1.gameTags.at(GameTag::COST));
+    CHECK_EQ(1, card1.gameTags.At(GameTag::COST));
     CHECK_EQ(2, static_cast<int>(card1.GetMaxAllowedInDeck()));
     CHECK_EQ(1, static_cast<int>(card2.GetMaxAllowedInDeck()));
-    CHECK_EQ(1, card1.gameTags.at(GameTag::COLLECTIBLE));
+    CHECK_EQ(1, card1.gameTags.At(GameTag::COLLECTIBLE));
 }
 
 TEST_CASE("[Card] - HasMechanic")
@@ -71,4 +72,62 @@ TEST_CASE("[Card] - HasMechanic")
     card.Initialize();
 
     CHECK_EQ(false, card.HasGameTag(GameTag::ADAPT));
-}
\ No newline at end of file
+}
+
+TEST_CASE("[Card] - HotData")
+{
+    Cards::GetInstance();
+
+    // The getters of loaded cards read the hot data that matches the tags
+    const auto& cards = Cards::GetAllCards();
+    const auto& hotData = Cards::GetAllHotData();
+    REQUIRE(hotData.size() == cards.size());
+
+    for (std::size_t i = 0; i < cards.size(); ++i)
+    {
+        const Card* card = cards[i];
+        REQUIRE(card->hotData == &hotData[i]);
+        REQUIRE(card->GetCost() == card->gameTags.At(GameTag::COST));
+        REQUIRE(card->GetCardType() ==
+                static_cast<CardType>(card->gameTags.At(GameTag::CARDTYPE)));
+        REQUIRE(card->GetRace() ==
+                static_cast<Race>(card->gameTags.At(GameTag::CARDRACE)));
+        REQUIRE(card->IsCollectible() ==
+                static_cast<bool>(card->gameTags.At(GameTag::COLLECTIBLE)));
+        REQUIRE(card->hotData->numPlayReqs == card->playRequirements.size());
+    }
+
+    CHECK(Cards::FindCardByID("DAL_613")->IsLackey());
+    CHECK_FALSE(Cards::FindCardByID("CS2_029")->IsLackey());
+    CHECK(Cards::FindCardByID("DRG_600t2")->IsGalakrond());
+    CHECK(Cards::FindCardByID("EX1_130")->IsSecret());
+
+    // A card that isn't loaded reads its tags
+    Card card;
+    card.id = "DRG_052";
+    card.gameTags[GameTag::RARITY] = static_cast<int>(Rarity::COMMON);
+    card.gameTags[GameTag::FACTION] = static_cast<int>(Faction::NEUTRAL);
+    card.gameTags[GameTag::CARD_SET] = static_cast<int>(CardSet::DRAGONS);
+    card.gameTags[GameTag::CLASS] = static_cast<int>(CardClass::NEUTRAL);
+    card.gameTags[GameTag::CARDTYPE] = static_cast<int>(CardType::MINION);
+    card.gameTags[GameTag::CARDRACE] = static_cast<int>(Race::INVALID);
+    card.gameTags[GameTag::COLLECTIBLE] = 0;
+    card.gameTags[GameTag::COST] = 3;
+    card.playRequirements.emplace(PlayReq::REQ_MINIMUM_ENEMY_MINIONS, 40000);
+    card.Initialize();
+
+    CHECK_EQ(card.hotData, nullptr);
+    CHECK_EQ(card.GetCost(), 3);
+    CHECK(card.IsLackey());
+    CHECK(card.IsStandardSet());
+
+    // The play requirement that doesn't fit is read from the card
+    const CardHotData data = card.MakeHotData();
+    CHECK_EQ(data.cost, 3);
+    CHECK_EQ(data.cardType, CardType::MINION);
+    CHECK(data.HasFlag(CardHotData::LACKEY));
+    CHECK(data.HasFlag(CardHotData::STANDARD_SET));
+    CHECK_FALSE(data.HasFlag(CardHotData::COLLECTIBLE));
+    CHECK(data.HasFlag(CardHotData::PLAY_REQS_OVERFLOW));
+    CHECK_EQ(data.numPlayReqs, 0);
+}
@@ -6,6 +6,7 @@
 
 #include "doctest_proxy.hpp"
 
+#include <Rosetta/Cards/CardDefs.hpp>
 #include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Enums/CardEnums.hpp>
 #include <Rosetta/Commons/Constants.hpp>
@@ -243,7 +244,7 @@ TEST_CASE("[Cards] - FindCardByGameTag")
     std::vector<Card*> cards2 = instance.FindCardByGameTag(tags2);
     auto gameTags = cards1.front()->gameTags;
 
-    CHECK(gameTags.find(GameTag::CANT_ATTACK) != gameTags.end());
+    CHECK(gameTags.Contains(GameTag::CANT_ATTACK));
     CHECK(cards2.empty());
 }
 
@@ -307,3 +308,48 @@ TEST_CASE("[Cards] - FindCardBySpellDamage")
     CHECK_FALSE(cards1.empty());
     CHECK(cards2.empty());
 }
+
+TEST_CASE("[Cards] - GetPower")
+{
+    Cards& instance = Cards::GetInstance();
+
+    // The power of a loaded card is shared with its card def
+    const Card* fireball = instance.FindCardByID("CS2_029");
+    const CardDef* cardDef = CardDefs::FindCardDefByCardID("CS2_029");
+    REQUIRE(cardDef != nullptr);
+    CHECK_EQ(fireball->cardDef, cardDef);
+    CHECK_EQ(&fireball->GetPower(), &cardDef->power);
+    CHECK_FALSE(fireball->GetPower().GetPowerTask().empty());
+
+    CHECK_EQ(CardDefs::FindCardDefByCardID("NOT_EXIST"), nullptr);
+
+    // A card that isn't loaded uses its own power
+    Card card;
+    card.power.AddPowerTask(nullptr);
+    CHECK_EQ(&card.GetPower(), &card.power);
+}
+
+TEST_CASE("[Cards] - CardHandle")
+{
+    Cards& instance = Cards::GetInstance();
+
+    // The handle of a loaded card is its ordinal in the list of all cards
+    const auto& cards = instance.GetAllCards();
+    for (std::size_t i = 0; i < cards.size(); ++i)
+    {
+        REQUIRE(cards[i]->handle.GetOrdinal() == i);
+        REQUIRE(instance.FindCardByHandle(cards[i]->handle) == cards[i]);
+    }
+
+    const Card* fireball = instance.FindCardByID("CS2_029");
+    CHECK(fireball->handle.IsValid());
+    CHECK_EQ(instance.GetHandle("CS2_029"), fireball->handle);
+    CHECK_NE(instance.GetHandle("CS2_022"), fireball->handle);
+
+    // An unknown card ID has an invalid handle that refers to the empty card
+    const CardHandle invalid = instance.GetHandle("NOT_EXIST");
+    CHECK_FALSE(invalid.IsValid());
+    CHECK_EQ(invalid, CardHandle());
+    CHECK_EQ(instance.FindCardByHandle(invalid),
+             instance.FindCardByID("NOT_EXIST"));
+}
@@ -0,0 +1,104 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Commons/Arena.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace RosettaStone;
+
+namespace
+{
+struct Tracker
+{
+    Tracker(std::vector<int>& _log, int _id) : log(_log), id(_id)
+    {
+        // Do nothing
+    }
+
+    ~Tracker()
+    {
+        log.emplace_back(id);
+    }
+
+    std::vector<int>& log;
+    int id;
+};
+}  // namespace
+
+TEST_CASE("[Arena] - Create and Release")
+{
+    std::vector<int> log;
+
+    Arena arena(64);
+    CHECK_EQ(arena.GetReservedSize(), 0u);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        const auto tracker = arena.Create<Tracker>(log, i);
+        CHECK_EQ(tracker->id, i);
+        CHECK_EQ(reinterpret_cast<std::uintptr_t>(tracker) % alignof(Tracker),
+                 0u);
+    }
+    CHECK(log.empty());
+    CHECK(arena.GetReservedSize() > 0u);
+
+    // Destructors are called in reverse order of creation
+    arena.Release();
+    CHECK_EQ(log, std::vector<int>{ 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 });
+    CHECK_EQ(arena.GetReservedSize(), 0u);
+
+    // The arena can be used again after release
+    const auto value = arena.Create<int>(42);
+    CHECK_EQ(*value, 42);
+}
+
+TEST_CASE("[Arena] - Allocate")
+{
+    Arena arena(64);
+
+    const auto small = static_cast<char*>(arena.Allocate(1, 1));
+    const auto aligned = arena.Allocate(16, 16);
+    CHECK_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 16, 0u);
+    CHECK_NE(static_cast<void*>(small), aligned);
+
+    // An allocation larger than the block size gets its own block
+    const auto large = static_cast<char*>(arena.Allocate(1000, 8));
+    large[0] = 'a';
+    large[999] = 'z';
+    CHECK(arena.GetReservedSize() >= 1000u);
+}
+
+TEST_CASE("[Arena] - ArenaAllocator")
+{
+    std::vector<int> log;
+
+    {
+        Arena arena;
+
+        std::vector<int, ArenaAllocator<int>> values{ ArenaAllocator<int>(
+            arena) };
+        for (int i = 0; i < 100; ++i)
+        {
+            values.emplace_back(i);
+        }
+        CHECK_EQ(values.size(), 100u);
+        CHECK_EQ(values[99], 99);
+
+        auto tracker = std::allocate_shared<Tracker>(
+            ArenaAllocator<Tracker>(arena), log, 1);
+        CHECK_EQ(tracker->id, 1);
+
+        tracker.reset();
+        CHECK_EQ(log, std::vector<int>{ 1 });
+    }
+
+    CHECK_EQ(log, std::vector<int>{ 1 });
+}
@@ -0,0 +1,100 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Commons/FixedPriorityQueue.hpp>
+#include <Rosetta/Commons/PriorityQueue.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+using namespace RosettaStone;
+
+TEST_CASE("[FixedPriorityQueue] - Push and Pop")
+{
+    FixedPriorityQueue<int, 8> queue;
+    CHECK(queue.IsEmpty());
+    CHECK_EQ(queue.GetCapacity(), 8u);
+
+    // The elements that have same priority are popped in order of insertion
+    queue.Push(1, 1);
+    queue.Push(2, 2);
+    queue.Push(3, 1);
+    queue.Push(4, 0);
+    queue.Push(5, 2);
+    queue.Push(6, 1);
+    CHECK_EQ(queue.GetCount(), 6u);
+    CHECK(queue.IsExist(5));
+    CHECK_FALSE(queue.IsExist(7));
+
+    std::vector<int> values;
+    while (!queue.IsEmpty())
+    {
+        values.emplace_back(queue.Pop());
+    }
+    CHECK_EQ(values, std::vector<int>{ 4, 1, 3, 6, 2, 5 });
+
+    // The elements beyond the capacity are stored in the heap
+    for (int i = 0; i < 20; ++i)
+    {
+        queue.Push(i, 20 - i);
+    }
+    queue.Push(20, 0);
+    CHECK_EQ(queue.GetCount(), 21u);
+    CHECK(queue.IsExist(0));
+    CHECK(queue.IsExist(20));
+
+    // The copy has its own elements
+    FixedPriorityQueue<int, 8> copied(queue);
+    CHECK_EQ(copied.Pop(), 20);
+    CHECK_EQ(copied.GetCount(), 20u);
+    CHECK_EQ(queue.GetCount(), 21u);
+
+    values.clear();
+    while (!queue.IsEmpty())
+    {
+        values.emplace_back(queue.Pop());
+    }
+    CHECK_EQ(values.size(), 21u);
+    CHECK_EQ(values.front(), 20);
+    CHECK_EQ(values[1], 19);
+    CHECK_EQ(values.back(), 0);
+    CHECK(std::is_sorted(values.begin() + 1, values.end(),
+                         std::greater<int>()));
+}
+
+TEST_CASE("[FixedPriorityQueue] - Same order as PriorityQueue")
+{
+    FixedPriorityQueue<int, 4> fixedQueue;
+    PriorityQueue<int> linkedQueue;
+
+    // Interleaves pushes and pops of the instructions of aura
+    const std::vector<std::pair<int, int>> pushes = {
+        { 0, 1 }, { 1, 2 }, { 2, 2 }, { 3, 1 }, { 4, 0 }, { 5, 2 },
+        { 6, 1 }, { 7, 0 }, { 8, 2 }, { 9, 1 }, { 10, 2 }, { 11, 0 },
+    };
+
+    for (std::size_t i = 0; i < pushes.size(); ++i)
+    {
+        fixedQueue.Push(pushes[i].first, pushes[i].second);
+        linkedQueue.Push(pushes[i].first, pushes[i].second);
+
+        if (i % 3 == 2)
+        {
+            CHECK_EQ(fixedQueue.Pop(), linkedQueue.Pop());
+        }
+    }
+
+    while (!linkedQueue.IsEmpty())
+    {
+        REQUIRE(fixedQueue.GetCount() == linkedQueue.GetCount());
+        CHECK_EQ(fixedQueue.Pop(), linkedQueue.Pop());
+    }
+    CHECK(fixedQueue.IsEmpty());
+}
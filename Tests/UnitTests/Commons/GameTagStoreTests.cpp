@@ -0,0 +1,91 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Commons/GameTagStore.hpp>
+
+#include <stdexcept>
+
+using namespace RosettaStone;
+
+TEST_CASE("[GameTagStore] - Set and Get")
+{
+    GameTagStore store;
+
+    CHECK(store.IsEmpty());
+    CHECK_FALSE(store.Contains(GameTag::ATK));
+    CHECK_EQ(store.Get(GameTag::ATK), 0);
+    CHECK_EQ(store.Find(GameTag::ATK), nullptr);
+
+    // Hot game tag
+    store.Set(GameTag::ATK, 3);
+    // Overflow game tag
+    store.Set(GameTag::QUEST_PROGRESS_TOTAL, 7);
+    store[GameTag::HEALTH] = 5;
+
+    CHECK(store.Contains(GameTag::ATK));
+    CHECK(store.Contains(GameTag::QUEST_PROGRESS_TOTAL));
+    CHECK_EQ(store.Get(GameTag::ATK), 3);
+    CHECK_EQ(store.At(GameTag::HEALTH), 5);
+    CHECK_EQ(*store.Find(GameTag::QUEST_PROGRESS_TOTAL), 7);
+    CHECK_EQ(store.GetCount(), 3u);
+    CHECK_THROWS_AS(store.At(GameTag::DAMAGE), std::out_of_range);
+
+    // A game tag with value 0 still exists
+    store.Set(GameTag::DAMAGE, 0);
+    CHECK(store.Contains(GameTag::DAMAGE));
+    CHECK_EQ(store.At(GameTag::DAMAGE), 0);
+}
+
+TEST_CASE("[GameTagStore] - Erase and Clear")
+{
+    GameTagStore store;
+    store.Set(GameTag::COST, 4);
+    store.Set(GameTag::HERO_POWER, 100);
+
+    CHECK(store.Erase(GameTag::COST));
+    CHECK_FALSE(store.Erase(GameTag::COST));
+    CHECK(store.Erase(GameTag::HERO_POWER));
+    CHECK_FALSE(store.Erase(GameTag::HERO_POWER));
+    CHECK(store.IsEmpty());
+
+    store.Set(GameTag::TAUNT, 1);
+    store.Set(GameTag::HERO_POWER, 100);
+    store.Clear();
+    CHECK(store.IsEmpty());
+    CHECK_EQ(store.Get(GameTag::TAUNT), 0);
+}
+
+TEST_CASE("[GameTagStore] - Merge and Iterate")
+{
+    std::map<GameTag, int> tags;
+    tags[GameTag::ATK] = 2;
+    tags[GameTag::HEALTH] = 3;
+    tags[GameTag::TAG_SCRIPT_DATA_NUM_1] = 1;
+
+    GameTagStore store1(tags);
+    GameTagStore store2;
+    store2.Set(GameTag::ATK, 5);
+    store2.Set(GameTag::GHOSTLY, 1);
+
+    store2.Merge(store1);
+    CHECK_EQ(store2.Get(GameTag::ATK), 2);
+    CHECK_EQ(store2.Get(GameTag::HEALTH), 3);
+    CHECK_EQ(store2.Get(GameTag::GHOSTLY), 1);
+    CHECK_EQ(store2.Get(GameTag::TAG_SCRIPT_DATA_NUM_1), 1);
+
+    std::size_t count = 0;
+    for (const auto& [tag, value] : store2)
+    {
+        CHECK_EQ(store2.At(tag), value);
+        ++count;
+    }
+    CHECK_EQ(count, store2.GetCount());
+
+    CHECK(store1 == GameTagStore(store1.ToMap()));
+    CHECK(store1 != store2);
+}
@@ -0,0 +1,110 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Commons/RandomEngine.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Zones/DeckZone.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+using namespace RosettaStone;
+
+TEST_CASE("[RandomEngine] - Seed")
+{
+    RandomEngine random1(42);
+    RandomEngine random2(42);
+    CHECK_EQ(random1.GetSeed(), 42u);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        CHECK_EQ(random1.Get(0, 1000), random2.Get(0, 1000));
+    }
+
+    // Reseeding restarts the sequence
+    RandomEngine random3(7);
+    const int first = random3.Get(0, 1000);
+    random3.Get(0, 1000);
+    random3.Seed(7);
+    CHECK_EQ(random3.Get(0, 1000), first);
+}
+
+TEST_CASE("[RandomEngine] - Get")
+{
+    RandomEngine random(1234);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        const int value = random.Get(3, 5);
+        CHECK_GE(value, 3);
+        CHECK_LE(value, 5);
+
+        const std::size_t idx = random.Get<std::size_t>(4, 0);
+        CHECK_LE(idx, 4u);
+
+        const float prob = random.Get<float>(0.0f, 1.0f);
+        CHECK_GE(prob, 0.0f);
+        CHECK_LT(prob, 1.0f);
+    }
+
+    std::vector<int> values{ 1, 2, 3 };
+    const auto iter = random.Get(values);
+    CHECK_NE(iter, values.end());
+
+    std::vector<int> empty;
+    CHECK_EQ(random.Get(empty), empty.end());
+}
+
+TEST_CASE("[RandomEngine] - Shuffle")
+{
+    std::vector<int> values1(20);
+    std::iota(values1.begin(), values1.end(), 0);
+    std::vector<int> values2 = values1;
+
+    RandomEngine random1(99);
+    RandomEngine random2(99);
+    random1.Shuffle(values1.begin(), values1.end());
+    random2.Shuffle(values2.begin(), values2.end());
+    CHECK_EQ(values1, values2);
+
+    std::sort(values1.begin(), values1.end());
+    for (int i = 0; i < 20; ++i)
+    {
+        CHECK_EQ(values1[i], i);
+    }
+}
+
+TEST_CASE("[RandomEngine] - Game")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::RANDOM;
+    config.doFillDecks = true;
+    config.doShuffle = true;
+    config.autoRun = false;
+    config.seed = 2019;
+
+    Game game1(config);
+    Game game2(config);
+    CHECK_EQ(game1.random.GetSeed(), 2019u);
+    CHECK_EQ(game1.GetCurrentPlayer()->playerType,
+             game2.GetCurrentPlayer()->playerType);
+
+    game1.Start();
+    game2.Start();
+
+    const auto deck1 = game1.GetPlayer1()->GetDeckZone()->GetAll();
+    const auto deck2 = game2.GetPlayer1()->GetDeckZone()->GetAll();
+    REQUIRE(deck1.size() == deck2.size());
+    for (std::size_t i = 0; i < deck1.size(); ++i)
+    {
+        CHECK_EQ(deck1[i]->card->id, deck2[i]->card->id);
+    }
+}
@@ -0,0 +1,186 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/CardSetUtils.hpp>
+#include <Utils/TestUtils.hpp>
+
+#include <Rosetta/Actions/Draw.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Conditions/RelaCondition.hpp>
+#include <Rosetta/Conditions/SelfCondition.hpp>
+#include <Rosetta/Loaders/TargetingPredicates.hpp>
+#include <Rosetta/Zones/DeckZone.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+
+using namespace RosettaStone;
+using namespace PlayerTasks;
+using namespace SimpleTasks;
+
+TEST_CASE("[SelfCondition] - Compiled conditions")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::PRIEST;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    const auto card1 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByID("CS2_172"));
+    const auto card2 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByID("CS2_120"));
+    const auto card3 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByID("CS2_029"));
+
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+    game.Process(curPlayer, PlayCardTask::Minion(card2));
+
+    auto raptor = dynamic_cast<Minion*>(card1);
+    raptor->SetDamage(1);
+
+    CHECK(SelfCondition::IsMinion().Evaluate(raptor));
+    CHECK_FALSE(SelfCondition::IsMinion().Evaluate(card3));
+    CHECK(SelfCondition::IsSpell().Evaluate(card3));
+    CHECK(SelfCondition::IsRace(Race::BEAST).Evaluate(raptor));
+    CHECK_FALSE(SelfCondition::IsRace(Race::BEAST).Evaluate(card3));
+    CHECK(SelfCondition::IsCardID("CS2_172").Evaluate(raptor));
+    CHECK_FALSE(SelfCondition::IsCardID("CS2_120").Evaluate(raptor));
+    CHECK(SelfCondition::IsHeroPowerCard("CS2_034").Evaluate(raptor));
+    CHECK_FALSE(SelfCondition::IsHeroPowerCard("CS1h_001").Evaluate(raptor));
+
+    CHECK(SelfCondition::IsCost(2).Evaluate(raptor));
+    CHECK_FALSE(SelfCondition::IsCost(3, RelaSign::GEQ).Evaluate(raptor));
+    CHECK(SelfCondition::IsCost(4, RelaSign::LEQ).Evaluate(raptor));
+    CHECK(SelfCondition::IsTagValue(GameTag::ATK, 3, RelaSign::GEQ)
+              .Evaluate(raptor));
+    CHECK(SelfCondition::IsHealth(1, RelaSign::EQ).Evaluate(raptor));
+    CHECK_FALSE(SelfCondition::IsHealth(1, RelaSign::EQ).Evaluate(card3));
+
+    CHECK(SelfCondition::IsDamaged().Evaluate(raptor));
+    CHECK_FALSE(SelfCondition::IsUndamaged().Evaluate(raptor));
+    CHECK_FALSE(SelfCondition::IsDamaged().Evaluate(card3));
+    CHECK(SelfCondition::IsInZone(ZoneType::PLAY).Evaluate(raptor));
+    CHECK(SelfCondition::IsInZone(ZoneType::HAND).Evaluate(card3));
+    CHECK(SelfCondition::IsCurrentPlayer().Evaluate(raptor));
+    CHECK_FALSE(SelfCondition::IsEnemyTurn().Evaluate(raptor));
+    CHECK(SelfCondition::IsFieldNotEmpty().Evaluate(card3));
+    CHECK_FALSE(SelfCondition::IsFieldFull().Evaluate(card3));
+    CHECK_FALSE(SelfCondition::HasDeathrattle().Evaluate(raptor));
+    CHECK(SelfCondition::HasNotStealth().Evaluate(raptor));
+    CHECK_FALSE(SelfCondition::HasNotStealth().Evaluate(card3));
+
+    // The condition that is made from a custom function runs the function
+    const SelfCondition custom([](Playable* playable) {
+        return playable->GetZonePosition() == 1;
+    });
+    CHECK_FALSE(custom.Evaluate(raptor));
+    CHECK(custom.Evaluate(card2));
+
+    CHECK(RelaCondition::IsFriendly().Evaluate(raptor, card3));
+    CHECK_FALSE(
+        RelaCondition::IsFriendly().Evaluate(raptor, game.GetOpponentPlayer()
+                                                         ->GetHero()));
+    CHECK(RelaCondition::IsSideBySide().Evaluate(raptor, card2));
+    CHECK_FALSE(RelaCondition::IsSideBySide().Evaluate(raptor, card3));
+}
+
+TEST_CASE("[SelfCondition] - Cards that are made in tests")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::PRIEST;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = false;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+
+    // The cards that are made in tests have invalid handles
+    auto card1 = TestUtils::GenerateMinionCard("minion1", 1, 1);
+    auto card2 = TestUtils::GenerateMinionCard("minion2", 1, 1);
+    CHECK_FALSE(card1.handle.IsValid());
+    CHECK_EQ(card1.handle, card2.handle);
+
+    // They are told apart by their IDs
+    CHECK(card1.IsCard(card1));
+    CHECK_FALSE(card1.IsCard(card2));
+    CHECK_FALSE(card1.IsCard(*Cards::FindCardByID("CS2_172")));
+
+    TestUtils::PlayMinionCard(curPlayer, &card1);
+    TestUtils::PlayMinionCard(curPlayer, &card2);
+
+    auto& curField = *(curPlayer->GetFieldZone());
+    CHECK(SelfCondition::IsCardID("minion1").Evaluate(curField[0]));
+    CHECK_FALSE(SelfCondition::IsCardID("minion1").Evaluate(curField[1]));
+    CHECK_FALSE(SelfCondition::IsCardID("NOT_EXIST").Evaluate(curField[0]));
+
+    auto& curDeck = *(curPlayer->GetDeckZone());
+    curDeck.Add(Entity::GetFromCard(curPlayer, &card1));
+    curDeck.Add(Entity::GetFromCard(curPlayer, &card2));
+    CHECK(SelfCondition::IsNoDuplicateInDeck().Evaluate(curField[0]));
+
+    curDeck.Add(Entity::GetFromCard(curPlayer, &card1));
+    CHECK_FALSE(SelfCondition::IsNoDuplicateInDeck().Evaluate(curField[0]));
+}
+
+TEST_CASE("[TargetingPredicates] - Compiled predicates")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::PRIEST;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    const auto card1 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByID("CS2_172"));
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+
+    auto raptor = dynamic_cast<Minion*>(card1);
+    raptor->SetDamage(1);
+
+    CHECK(TargetingPredicates::ReqBeastTarget()(raptor));
+    CHECK_FALSE(TargetingPredicates::ReqDemonTarget()(raptor));
+    CHECK(TargetingPredicates::ReqTargetWithRace(Race::BEAST)(raptor));
+    CHECK(TargetingPredicates::ReqTargetWithRace(Race::EGG)(raptor));
+    CHECK(TargetingPredicates::ReqDamagedTarget()(raptor));
+    CHECK_FALSE(TargetingPredicates::ReqUndamagedTarget()(raptor));
+    CHECK(TargetingPredicates::ReqTargetMaxAttack(3)(raptor));
+    CHECK_FALSE(TargetingPredicates::ReqTargetMaxAttack(2)(raptor));
+    CHECK(TargetingPredicates::ReqTargetMinAttack(3)(raptor));
+    CHECK_FALSE(TargetingPredicates::ReqTargetMinAttack(4)(raptor));
+    CHECK_FALSE(TargetingPredicates::ReqMustTargetTaunter()(raptor));
+    CHECK_FALSE(TargetingPredicates::ReqTargetWithDeathrattle()(raptor));
+
+    // The combo is active after the raptor is played
+    CHECK(TargetingPredicates::ReqTargetForCombo()(curPlayer, raptor->card));
+    CHECK_FALSE(TargetingPredicates::ReqTargetForCombo()(
+        game.GetOpponentPlayer(), raptor->card));
+
+    const TargetingPredicate custom(
+        [](Character* character) { return character->GetHealth() == 1; });
+    CHECK(custom(raptor));
+}
@@ -0,0 +1,91 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Games/EntityList.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Zones/DeckZone.hpp>
+
+#include <stdexcept>
+
+using namespace RosettaStone;
+
+TEST_CASE("[EntityList] - Set and Get")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    Playable* entity1 = game.GetPlayer1()->GetDeckZone()->GetTopCard();
+    Playable* entity2 = game.GetPlayer2()->GetDeckZone()->GetTopCard();
+
+    EntityList entities;
+    CHECK(entities.IsEmpty());
+    CHECK_EQ(entities.Get(0), nullptr);
+    CHECK_EQ(entities.Get(-1), nullptr);
+    CHECK_THROWS_AS(entities.At(3), std::out_of_range);
+    CHECK_THROWS_AS(entities.Set(-1, entity1), std::out_of_range);
+
+    entities.Set(10, entity1);
+    entities.Set(4, entity2);
+    CHECK_EQ(entities.GetCount(), 2u);
+    CHECK_EQ(entities.Get(10), entity1);
+    CHECK_EQ(entities.At(4), entity2);
+    CHECK_EQ(entities.Get(5), nullptr);
+    CHECK(entities.Contains(4));
+    CHECK_FALSE(entities.Contains(11));
+
+    // Replace the entity with same ID
+    entities.Set(10, entity2);
+    CHECK_EQ(entities.GetCount(), 2u);
+    CHECK_EQ(entities.Get(10), entity2);
+
+    // Entities are visited in order of ID
+    std::vector<Playable*> visited;
+    entities.ForEach([&](Playable* entity) { visited.emplace_back(entity); });
+    CHECK_EQ(visited, std::vector<Playable*>{ entity2, entity2 });
+
+    CHECK(entities.Erase(4));
+    CHECK_FALSE(entities.Erase(4));
+    CHECK_EQ(entities.GetCount(), 1u);
+
+    entities.Clear();
+    CHECK(entities.IsEmpty());
+    CHECK_EQ(entities.Get(10), nullptr);
+}
+
+TEST_CASE("[EntityList] - Game")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    std::size_t count = 0;
+    int prevID = -1;
+    game.entityList.ForEach([&](Playable* entity) {
+        const int id = entity->GetGameTag(GameTag::ENTITY_ID);
+        CHECK_LT(prevID, id);
+        CHECK_EQ(game.entityList.Get(id), entity);
+
+        prevID = id;
+        ++count;
+    });
+
+    CHECK_FALSE(game.entityList.IsEmpty());
+    CHECK_EQ(count, game.entityList.GetCount());
+}
@@ -0,0 +1,182 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Commons/DeckCode.hpp>
+#include <Rosetta/Commons/RandomEngine.hpp>
+#include <Rosetta/Games/GameBatch.hpp>
+
+using namespace RosettaStone;
+
+namespace
+{
+//! Makes a game config of two warlocks of the same deck.
+//! \return The game config.
+GameConfig MakeConfig()
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::WARLOCK;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doShuffle = true;
+    config.doFillDecks = false;
+    config.skipMulligan = true;
+    config.autoRun = true;
+    config.seed = 7;
+
+    const std::string INNKEEPER_EXPERT_WARLOCK =
+        "AAEBAfqUAwAPMJMB3ALVA9AE9wTOBtwGkgeeB/sHsQjCCMQI9ggA";
+    const auto deck = DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
+
+    for (std::size_t i = 0; i < deck.size(); ++i)
+    {
+        config.player1Deck[i] = Cards::FindCardByID(deck[i]);
+        config.player2Deck[i] = Cards::FindCardByID(deck[i]);
+    }
+
+    return config;
+}
+
+//! Returns a random move of \p moves, or END_TURN if \p moves is empty.
+//! \param random The random engine to choose a move.
+//! \param moves The moves to choose from.
+//! \return The chosen move.
+Move ChooseMove(RandomEngine& random, const std::vector<Move>& moves)
+{
+    if (moves.empty())
+    {
+        Move move;
+        move.op = MainOpType::END_TURN;
+        return move;
+    }
+
+    return moves[random.Get<std::size_t>(0, moves.size() - 1)];
+}
+}  // namespace
+
+TEST_CASE("[GameBatch] - Step")
+{
+    GameBatch batch(MakeConfig(), 8);
+    batch.Start();
+
+    CHECK_EQ(batch.GetSize(), 8u);
+    CHECK_EQ(batch.GetNumRunning(), 8u);
+
+    for (std::size_t i = 0; i < batch.GetSize(); ++i)
+    {
+        const Game& game = batch.GetGame(i);
+        CHECK_EQ(game.step, Step::MAIN_ACTION);
+        CHECK_EQ(game.GetTurn(), 1);
+    }
+
+    // Every game ends its turn at the same time
+    std::vector<Move> moves(batch.GetSize());
+    for (auto& move : moves)
+    {
+        move.op = MainOpType::END_TURN;
+    }
+
+    batch.Step(moves);
+    for (std::size_t i = 0; i < batch.GetSize(); ++i)
+    {
+        const Game& game = batch.GetGame(i);
+        CHECK_EQ(game.step, Step::MAIN_ACTION);
+        CHECK_EQ(game.GetTurn(), 2);
+        CHECK_EQ(game.GetCurrentPlayer()->playerType, PlayerType::PLAYER2);
+    }
+
+    RandomEngine random(7);
+
+    while (batch.GetNumRunning() > 0)
+    {
+        batch.GenerateMoves();
+
+        for (std::size_t i = 0; i < batch.GetSize(); ++i)
+        {
+            moves[i] = ChooseMove(random, batch.GetMoves(i));
+        }
+
+        const auto& results = batch.Step(moves);
+        CHECK_EQ(results.size(), batch.GetSize());
+    }
+
+    batch.GenerateMoves();
+    for (std::size_t i = 0; i < batch.GetSize(); ++i)
+    {
+        const Game& game = batch.GetGame(i);
+        CHECK_EQ(game.state, State::COMPLETE);
+        CHECK(batch.GetMoves(i).empty());
+    }
+
+    // The finished game is replaced in its slot
+    const Game* game = &batch.GetGame(3);
+    batch.Reset(3);
+    CHECK_EQ(&batch.GetGame(3), game);
+    CHECK_EQ(batch.GetNumRunning(), 1u);
+    CHECK_EQ(game->state, State::RUNNING);
+    CHECK_EQ(game->step, Step::MAIN_ACTION);
+    CHECK_EQ(game->GetTurn(), 1);
+}
+
+TEST_CASE("[GameBatch] - Lockstep")
+{
+    const GameConfig config = MakeConfig();
+
+    // The games of batch are the same as the games that run by themselves
+    GameBatch batch(config, 4);
+    batch.Start();
+
+    std::vector<std::unique_ptr<Game>> games;
+    for (std::size_t i = 0; i < batch.GetSize(); ++i)
+    {
+        GameConfig gameConfig = config;
+        gameConfig.seed =
+            config.seed.value() + static_cast<RandomEngine::SeedType>(i);
+
+        games.emplace_back(std::make_unique<Game>(gameConfig));
+        games.back()->Start();
+    }
+
+    RandomEngine random(7);
+    std::vector<Move> moves(batch.GetSize());
+    std::vector<Move> gameMoves;
+
+    while (batch.GetNumRunning() > 0)
+    {
+        batch.GenerateMoves();
+
+        for (std::size_t i = 0; i < batch.GetSize(); ++i)
+        {
+            Game& game = *games[i];
+            CHECK_EQ(game.state, batch.GetGame(i).state);
+            CHECK_EQ(game.GetHash(PlayerType::PLAYER1),
+                     batch.GetGame(i).GetHash(PlayerType::PLAYER1));
+
+            if (game.state == State::COMPLETE)
+            {
+                continue;
+            }
+
+            MoveGenerator(game).Generate(gameMoves);
+            CHECK(gameMoves == batch.GetMoves(i));
+
+            moves[i] = ChooseMove(random, gameMoves);
+            game.ApplyMove(moves[i]);
+        }
+
+        const auto& results = batch.Step(moves);
+
+        for (std::size_t i = 0; i < batch.GetSize(); ++i)
+        {
+            CHECK_EQ(results[i].player1, games[i]->GetPlayer1()->playState);
+            CHECK_EQ(results[i].player2, games[i]->GetPlayer2()->playState);
+            CHECK_EQ(results[i].isComplete,
+                     games[i]->state == State::COMPLETE);
+        }
+    }
+}
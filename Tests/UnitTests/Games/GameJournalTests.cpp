@@ -0,0 +1,234 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Actions/Draw.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Commons/GameTagStore.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Games/GameJournal.hpp>
+#include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
+#include <Rosetta/Zones/DeckZone.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+#include <Rosetta/Zones/GraveyardZone.hpp>
+#include <Rosetta/Zones/HandZone.hpp>
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+using namespace RosettaStone;
+using namespace PlayerTasks;
+
+TEST_CASE("[GameJournal] - Record and Rollback")
+{
+    GameJournal journal;
+    GameTagStore tags;
+    std::map<GameTag, int> playerTags;
+    std::vector<int> values{ 1, 2 };
+    int value = 1;
+    int* pointer = &value;
+
+    tags.Set(GameTag::ATK, 1);
+
+    // Nothing is recorded until the journal starts, but it is counted
+    journal.RecordGameTag(tags, GameTag::ATK);
+    journal.RecordValue(values);
+    journal.NotifyMutation();
+    CHECK_EQ(journal.GetSize(), 0u);
+    CHECK_EQ(journal.GetMutationCount(), 3u);
+
+    journal.Start();
+    const std::size_t checkpoint = journal.GetSize();
+
+    journal.RecordGameTag(tags, GameTag::ATK);
+    tags.Set(GameTag::ATK, 5);
+    journal.RecordGameTag(tags, GameTag::HEALTH);
+    tags.Set(GameTag::HEALTH, 3);
+    journal.RecordGameTag(playerTags, GameTag::RESOURCES);
+    playerTags[GameTag::RESOURCES] = 10;
+    journal.RecordValue(values);
+    values.emplace_back(3);
+
+    const std::size_t nested = journal.GetSize();
+    int other = 2;
+    journal.RecordPointer(pointer);
+    pointer = &other;
+    journal.RecordGameTag(tags, GameTag::ATK);
+    tags.Erase(GameTag::ATK);
+
+    // Rolls back to the nested checkpoint
+    journal.Rollback(nested);
+    CHECK_EQ(pointer, &value);
+    CHECK_EQ(tags.Get(GameTag::ATK), 5);
+    CHECK_EQ(values.size(), 3u);
+
+    const std::uint64_t count = journal.GetMutationCount();
+    journal.Rollback(checkpoint);
+    CHECK_GT(journal.GetMutationCount(), count);
+    CHECK(journal.IsRecording());
+    CHECK_EQ(journal.GetSize(), checkpoint);
+    CHECK_EQ(tags.Get(GameTag::ATK), 1);
+    CHECK_FALSE(tags.Contains(GameTag::HEALTH));
+    CHECK(playerTags.empty());
+    CHECK_EQ(values, std::vector<int>{ 1, 2 });
+
+    journal.Stop();
+    CHECK_FALSE(journal.IsRecording());
+    CHECK_EQ(journal.GetSize(), 0u);
+}
+
+TEST_CASE("[Game] - Checkpoint and Rollback")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    const auto card1 = Generic::DrawCard(
+        curPlayer, Cards::FindCardByName("Stormwind Champion"));
+    const auto card2 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Acolyte of Pain"));
+    const auto card3 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Moonfire"));
+    const auto card4 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Wisp"));
+
+    auto& curField = *(curPlayer->GetFieldZone());
+    auto& curHand = *(curPlayer->GetHandZone());
+    const int handCount = curHand.GetCount();
+    const int deckCount = curPlayer->GetDeckZone()->GetCount();
+    const int graveyardCount = curPlayer->GetGraveyardZone()->GetCount();
+    const std::size_t entityCount = game.entityList.GetCount();
+    const std::size_t auraCount = game.auras.size();
+    const Step step = game.step;
+    const std::vector<Playable*> hand = curHand.GetAll();
+
+    const auto checkRolledBack = [&]() {
+        CHECK_EQ(game.step, step);
+        CHECK_EQ(curPlayer->GetRemainingMana(), 10);
+        CHECK_EQ(curField.GetCount(), 0);
+        CHECK_EQ(curHand.GetAll(), hand);
+        CHECK_EQ(curPlayer->GetDeckZone()->GetCount(), deckCount);
+        CHECK_EQ(curPlayer->GetGraveyardZone()->GetCount(), graveyardCount);
+        CHECK_EQ(game.entityList.GetCount(), entityCount);
+        CHECK_EQ(game.auras.size(), auraCount);
+        CHECK(curField.auras.empty());
+
+        for (int i = 0; i < handCount; ++i)
+        {
+            CHECK_EQ(curHand[i]->zone, &curHand);
+            CHECK_EQ(curHand[i]->GetZonePosition(), i);
+        }
+    };
+
+    const std::size_t checkpoint = game.Checkpoint();
+
+    // Zone moves, tag writes and the trigger of Acolyte of Pain
+    game.Process(curPlayer, PlayCardTask::Minion(card2));
+    game.Process(curPlayer, PlayCardTask::SpellTarget(card3, card2));
+    CHECK_EQ(curField[0]->GetHealth(), 2);
+    CHECK_EQ(curPlayer->GetDeckZone()->GetCount(), deckCount - 1);
+    CHECK_EQ(curHand.GetCount(), handCount - 1);
+
+    game.Rollback(checkpoint);
+    checkRolledBack();
+    CHECK_EQ(card2->GetGameTag(GameTag::DAMAGE), 0);
+    CHECK_EQ(card3->zone, &curHand);
+
+    // The trigger is registered only once when it is applied again
+    game.Process(curPlayer, PlayCardTask::Minion(card2));
+    game.Process(curPlayer, PlayCardTask::SpellTarget(card3, card2));
+    CHECK_EQ(curField[0]->GetHealth(), 2);
+    CHECK_EQ(curPlayer->GetDeckZone()->GetCount(), deckCount - 1);
+
+    game.Rollback(checkpoint);
+    checkRolledBack();
+
+    // The aura of Stormwind Champion is unregistered
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+    CHECK_EQ(game.auras.size(), auraCount + 1);
+    CHECK_EQ(curField.auras.size(), 1u);
+
+    game.Rollback(checkpoint);
+    checkRolledBack();
+
+    game.Process(curPlayer, PlayCardTask::Minion(card4));
+    CHECK_EQ(curField[0]->GetAttack(), 1);
+    CHECK_EQ(curField[0]->GetHealth(), 1);
+
+    game.StopJournal();
+    CHECK_FALSE(game.journal.IsRecording());
+}
+
+TEST_CASE("[Game] - Rollback under Aura")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    const auto card1 = Generic::DrawCard(
+        curPlayer, Cards::FindCardByName("Stormwind Champion"));
+    const auto card2 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Wisp"));
+
+    auto& curField = *(curPlayer->GetFieldZone());
+    auto& curHand = *(curPlayer->GetHandZone());
+
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+    CHECK_EQ(curField.GetCount(), 1);
+    CHECK_EQ(curField[0]->GetAttack(), 6);
+    CHECK_EQ(curField[0]->GetHealth(), 6);
+
+    const std::size_t checkpoint = game.Checkpoint();
+
+    // The aura applies to the minion that is played under it
+    game.Process(curPlayer, PlayCardTask::Minion(card2));
+    CHECK_EQ(curField.GetCount(), 2);
+    CHECK_EQ(curField[1]->GetAttack(), 2);
+    CHECK_EQ(curField[1]->GetHealth(), 2);
+
+    game.Rollback(checkpoint);
+    CHECK_EQ(curField.GetCount(), 1);
+    CHECK_EQ(card2->zone, &curHand);
+    CHECK_EQ(curField[0]->GetAttack(), 6);
+    CHECK_EQ(curField[0]->GetHealth(), 6);
+    CHECK_EQ(dynamic_cast<Minion*>(card2)->GetAttack(), 1);
+    CHECK_EQ(dynamic_cast<Minion*>(card2)->GetHealth(), 1);
+
+    // The aura applies once again after the rollback
+    game.Process(curPlayer, PlayCardTask::Minion(card2));
+    CHECK_EQ(curField[1]->GetAttack(), 2);
+    CHECK_EQ(curField[1]->GetHealth(), 2);
+
+    game.Rollback(checkpoint);
+    CHECK_EQ(dynamic_cast<Minion*>(card2)->GetAttack(), 1);
+    CHECK_EQ(dynamic_cast<Minion*>(card2)->GetHealth(), 1);
+
+    game.StopJournal();
+}
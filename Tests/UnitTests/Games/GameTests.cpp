@@ -18,6 +18,9 @@
 #include <Rosetta/Tasks/PlayerTasks/EndTurnTask.hpp>
 #include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
 #include <Rosetta/Views/Board.hpp>
+#include <Rosetta/Zones/DeckZone.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+#include <Rosetta/Zones/HandZone.hpp>
 
 #include <effolkronium/random.hpp>
 
@@ -95,6 +98,82 @@ TEST_CASE("[Game] - RefCopyFrom")
     delete game1;
 }
 
+TEST_CASE("[Game] - Clone")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    const auto card1 = Generic::DrawCard(
+        curPlayer, Cards::FindCardByName("Stormwind Champion"));
+    const auto card2 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Acolyte of Pain"));
+    const auto card3 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Frostbolt"));
+    const auto card4 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Wisp"));
+
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+    game.Process(curPlayer, PlayCardTask::Minion(card2));
+    curPlayer->SetUsedMana(0);
+
+    auto clone = game.Clone();
+    Player* clonePlayer = clone->GetCurrentPlayer();
+
+    const auto findCopy = [&clone](Playable* playable) {
+        return clone->entityList.Get(playable->GetGameTag(GameTag::ENTITY_ID));
+    };
+
+    CHECK_NE(clonePlayer, curPlayer);
+    CHECK_EQ(clonePlayer->game, clone.get());
+    CHECK_EQ(clone->step, game.step);
+    CHECK_EQ(clone->GetTurn(), game.GetTurn());
+    CHECK_EQ(clone->entityList.GetCount(), game.entityList.GetCount());
+
+    auto& cloneField = *(clonePlayer->GetFieldZone());
+    CHECK_EQ(cloneField.GetCount(), 2);
+    CHECK_NE(cloneField[1], card2);
+    CHECK_EQ(cloneField[1], findCopy(card2));
+    CHECK_EQ(cloneField[1]->player, clonePlayer);
+    CHECK_EQ(cloneField[1]->GetAttack(), 2);
+    CHECK_EQ(cloneField[1]->GetHealth(), 4);
+    CHECK_EQ(clonePlayer->GetHandZone()->GetCount(),
+             curPlayer->GetHandZone()->GetCount());
+
+    // The trigger of Acolyte of Pain works in the copy
+    const int deckCount = curPlayer->GetDeckZone()->GetCount();
+    clone->Process(clonePlayer,
+                   PlayCardTask::SpellTarget(findCopy(card3),
+                                             findCopy(card2)));
+    CHECK_EQ(cloneField[1]->GetHealth(), 1);
+    CHECK_EQ(clonePlayer->GetDeckZone()->GetCount(), deckCount - 1);
+
+    // The aura of Stormwind Champion works in the copy
+    clone->Process(clonePlayer, PlayCardTask::Minion(findCopy(card4)));
+    CHECK_EQ(cloneField.GetCount(), 3);
+    CHECK_EQ(cloneField[2]->GetAttack(), 2);
+    CHECK_EQ(cloneField[2]->GetHealth(), 2);
+
+    // The original game is not changed
+    auto& curField = *(curPlayer->GetFieldZone());
+    CHECK_EQ(curField.GetCount(), 2);
+    CHECK_EQ(curField[1]->GetHealth(), 4);
+    CHECK_EQ(curPlayer->GetDeckZone()->GetCount(), deckCount);
+    CHECK_EQ(card3->zone, curPlayer->GetHandZone());
+    CHECK_EQ(card4->zone, curPlayer->GetHandZone());
+}
+
 TEST_CASE("[Game] - GetPlayers")
 {
     GameConfig config;
@@ -346,4 +425,75 @@ TEST_CASE("[Game] - CreateView")
 
     const auto player2View = game.CreateView();
     CHECK_EQ(player2View.GetMyHeroPower().cardID, "CS2_083b");
-}
\ No newline at end of file
+}
+
+TEST_CASE("[Game] - UpdateAura")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::ROGUE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    auto& curField = *(curPlayer->GetFieldZone());
+
+    const auto card1 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Old Murk-Eye"));
+    const auto card2 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Murloc Raider"));
+    const auto card3 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Raging Worgen"));
+    const auto card4 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Murloc Raider"));
+
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+    game.Process(curPlayer, PlayCardTask::Minion(card2));
+    game.Process(curPlayer, PlayCardTask::Minion(card3));
+    CHECK_EQ(curField[0]->GetAttack(), 3);
+
+    // Nothing is changed when the state of game is not changed
+    std::uint64_t count = game.journal.GetMutationCount();
+    std::size_t numSkipped = game.GetNumSkippedAuraUpdates();
+    game.UpdateAura();
+    game.UpdateAura();
+    CHECK_EQ(game.journal.GetMutationCount(), count);
+    CHECK_EQ(game.GetNumSkippedAuraUpdates(),
+             numSkipped + 2 * game.auras.size());
+
+    // Auras are updated when the state of game is changed
+    game.Process(curPlayer, PlayCardTask::Minion(card4));
+    CHECK_EQ(curField[0]->GetAttack(), 4);
+
+    count = game.journal.GetMutationCount();
+    game.UpdateAura();
+    CHECK_EQ(game.journal.GetMutationCount(), count);
+
+    curField.Remove(curField[3]);
+    CHECK_GT(game.journal.GetMutationCount(), count);
+    game.UpdateAura();
+    CHECK_EQ(curField[0]->GetAttack(), 3);
+
+    // The enrage effect is skipped while its owner is not changed
+    Minion* worgen = curField[2];
+    numSkipped = game.GetNumSkippedAuraUpdates();
+    game.GetOpponentPlayer()->GetHero()->SetDamage(1);
+    game.UpdateAura();
+    CHECK_EQ(game.GetNumSkippedAuraUpdates(), numSkipped + 1);
+    CHECK_EQ(worgen->GetAttack(), 3);
+
+    numSkipped = game.GetNumSkippedAuraUpdates();
+    worgen->SetDamage(1);
+    game.UpdateAura();
+    CHECK_EQ(game.GetNumSkippedAuraUpdates(), numSkipped);
+    CHECK_EQ(worgen->GetAttack(), 4);
+    CHECK(worgen->HasWindfury());
+}
@@ -0,0 +1,289 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Actions/Draw.hpp>
+#include <Rosetta/Actions/Generic.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Tasks/PlayerTasks/AttackTask.hpp>
+#include <Rosetta/Tasks/PlayerTasks/EndTurnTask.hpp>
+#include <Rosetta/Tasks/PlayerTasks/HeroPowerTask.hpp>
+#include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+#include <Rosetta/Zones/HandZone.hpp>
+
+#include <cstdint>
+
+using namespace RosettaStone;
+using namespace PlayerTasks;
+
+namespace
+{
+//! Checks the hash that is maintained incrementally is the same as the hash
+//! that is computed from scratch.
+void CheckRebuild(Game& game)
+{
+    const std::uint64_t hash1 = game.GetHash(PlayerType::PLAYER1);
+    const std::uint64_t hash2 = game.GetHash(PlayerType::PLAYER2);
+
+    game.zobrist.Rebuild(game);
+    CHECK_EQ(game.GetHash(PlayerType::PLAYER1), hash1);
+    CHECK_EQ(game.GetHash(PlayerType::PLAYER2), hash2);
+}
+}  // namespace
+
+TEST_CASE("[ZobristHash] - Incremental update")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    CheckRebuild(game);
+
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+    CheckRebuild(game);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+    opPlayer->SetTotalMana(10);
+    opPlayer->SetUsedMana(0);
+
+    const auto card1 = Generic::DrawCard(
+        curPlayer, Cards::FindCardByName("Stormwind Champion"));
+    const auto card2 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Acolyte of Pain"));
+    const auto card3 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Moonfire"));
+    const auto card4 =
+        Generic::DrawCard(opPlayer, Cards::FindCardByName("Wolfrider"));
+    CheckRebuild(game);
+
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+    game.Process(curPlayer, PlayCardTask::Minion(card2));
+    CheckRebuild(game);
+
+    game.Process(curPlayer, PlayCardTask::SpellTarget(card3, card2));
+    game.Process(curPlayer, HeroPowerTask(opPlayer->GetHero()));
+    CheckRebuild(game);
+
+    game.Process(curPlayer, EndTurnTask());
+    game.ProcessUntil(Step::MAIN_ACTION);
+    CheckRebuild(game);
+
+    game.Process(opPlayer, PlayCardTask::Minion(card4));
+    game.Process(opPlayer, AttackTask(card4, card1));
+    CheckRebuild(game);
+
+    // The same state that is reached in a different order has the same hash
+    auto& field = *(curPlayer->GetFieldZone());
+    const std::uint64_t hash = game.GetHash(PlayerType::PLAYER1);
+
+    field[0]->SetGameTag(GameTag::FROZEN, 1);
+    field[1]->SetGameTag(GameTag::TAUNT, 1);
+    CHECK_NE(game.GetHash(PlayerType::PLAYER1), hash);
+
+    field[0]->SetGameTag(GameTag::FROZEN, 0);
+    field[1]->SetGameTag(GameTag::TAUNT, 0);
+    CHECK_EQ(game.GetHash(PlayerType::PLAYER1), hash);
+}
+
+TEST_CASE("[ZobristHash] - Hidden information")
+{
+    GameConfig config;
+    config.player1Class = CardClass::PRIEST;
+    config.player2Class = CardClass::HUNTER;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+
+    std::uint64_t curHash = game.GetHash(PlayerType::PLAYER1);
+    std::uint64_t opHash = game.GetHash(PlayerType::PLAYER2);
+    CHECK_NE(curHash, opHash);
+
+    // The card in the hand of opponent is hidden
+    Playable* card = (*opPlayer->GetHandZone())[0];
+    Generic::ChangeEntity(opPlayer, card, Cards::FindCardByName("Wisp"), false);
+    CHECK_EQ(game.GetHash(PlayerType::PLAYER1), curHash);
+    CHECK_NE(game.GetHash(PlayerType::PLAYER2), opHash);
+    CheckRebuild(game);
+
+    opHash = game.GetHash(PlayerType::PLAYER2);
+    (*opPlayer->GetHandZone())[0]->SetCost(7);
+    CHECK_EQ(game.GetHash(PlayerType::PLAYER1), curHash);
+    CHECK_NE(game.GetHash(PlayerType::PLAYER2), opHash);
+    CheckRebuild(game);
+
+    // The number of cards in hand is public
+    curHash = game.GetHash(PlayerType::PLAYER1);
+    opHash = game.GetHash(PlayerType::PLAYER2);
+    Generic::Draw(curPlayer);
+    CHECK_NE(game.GetHash(PlayerType::PLAYER1), curHash);
+    CHECK_NE(game.GetHash(PlayerType::PLAYER2), opHash);
+    CheckRebuild(game);
+}
+
+TEST_CASE("[ZobristHash] - Hero card")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    const auto card1 = Generic::DrawCard(
+        curPlayer, Cards::FindCardByName("Galakrond, the Wretched"));
+    const auto card2 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Grizzled Wizard"));
+
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+    CheckRebuild(game);
+
+    // The hero power of the new hero is hashed
+    std::uint64_t hash = game.GetHash(PlayerType::PLAYER1);
+    curPlayer->GetHeroPower().SetExhausted(true);
+    CHECK_NE(game.GetHash(PlayerType::PLAYER1), hash);
+    CheckRebuild(game);
+
+    curPlayer->GetHeroPower().SetExhausted(false);
+    CHECK_EQ(game.GetHash(PlayerType::PLAYER1), hash);
+
+    game.Process(curPlayer, HeroPowerTask());
+    CHECK_NE(game.GetHash(PlayerType::PLAYER1), hash);
+    CheckRebuild(game);
+
+    // The hero powers are hashed after they are swapped
+    curPlayer->SetUsedMana(0);
+    hash = game.GetHash(PlayerType::PLAYER1);
+    game.Process(curPlayer, PlayCardTask::Minion(card2));
+    CHECK_EQ(curPlayer->GetHeroPower().card->name, "Fireblast");
+    CHECK_NE(game.GetHash(PlayerType::PLAYER1), hash);
+    CheckRebuild(game);
+}
+
+TEST_CASE("[ZobristHash] - Changed hero power")
+{
+    GameConfig config;
+    config.player1Class = CardClass::PRIEST;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    Hero* opHero = opPlayer->GetHero();
+
+    const auto card1 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Shadowform"));
+    const auto card2 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Shadowform"));
+
+    HeroPower* oldPower = curPlayer->GetHero()->heroPower;
+    game.Process(curPlayer, PlayCardTask::Spell(card1));
+    CHECK_EQ(curPlayer->GetHeroPower().card->name, "Mind Spike");
+    CheckRebuild(game);
+
+    // The old hero power is moved to the setaside zone and isn't hashed
+    CHECK_EQ(oldPower->GetZoneType(), ZoneType::SETASIDE);
+    CHECK_EQ(curPlayer->GetHeroPower().GetZoneType(), ZoneType::PLAY);
+
+    const std::uint64_t hash = game.GetHash(PlayerType::PLAYER1);
+    oldPower->SetExhausted(true);
+    CHECK_EQ(game.GetHash(PlayerType::PLAYER1), hash);
+
+    // The new hero powers work as before
+    game.Process(curPlayer, HeroPowerTask(opHero));
+    CHECK_EQ(opHero->GetHealth(), 28);
+    CheckRebuild(game);
+
+    game.Process(curPlayer, PlayCardTask::Spell(card2));
+    CHECK_EQ(curPlayer->GetHeroPower().card->name, "Mind Shatter");
+    CHECK_FALSE(curPlayer->GetHeroPower().IsExhausted());
+    CheckRebuild(game);
+
+    game.Process(curPlayer, HeroPowerTask(opHero));
+    CHECK_EQ(opHero->GetHealth(), 25);
+    CheckRebuild(game);
+}
+
+TEST_CASE("[ZobristHash] - Rollback and Clone")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    const auto card1 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Acolyte of Pain"));
+    const auto card2 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Moonfire"));
+
+    const std::uint64_t hash = game.GetHash(PlayerType::PLAYER1);
+    const std::size_t checkpoint = game.Checkpoint();
+
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+    game.Process(curPlayer, PlayCardTask::SpellTarget(card2, card1));
+    const std::uint64_t played = game.GetHash(PlayerType::PLAYER1);
+    CHECK_NE(played, hash);
+
+    const auto clone = game.Clone();
+    CHECK_EQ(clone->GetHash(PlayerType::PLAYER1), played);
+    CHECK_EQ(clone->GetHash(PlayerType::PLAYER2),
+             game.GetHash(PlayerType::PLAYER2));
+
+    game.Rollback(checkpoint);
+    CHECK_EQ(game.GetHash(PlayerType::PLAYER1), hash);
+
+    // The hash is maintained incrementally after the rollback
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+    game.Process(curPlayer, PlayCardTask::SpellTarget(card2, card1));
+    CHECK_EQ(game.GetHash(PlayerType::PLAYER1), played);
+    CheckRebuild(game);
+
+    game.StopJournal();
+}
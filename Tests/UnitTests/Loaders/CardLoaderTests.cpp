@@ -0,0 +1,90 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Loaders/CardLoader.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+using namespace RosettaStone;
+
+TEST_CASE("[CardLoader] - Binary")
+{
+    const std::string path = "cards_test.bin";
+
+    std::vector<Card*> jsonCards;
+    CardLoader::LoadFromJSON(jsonCards);
+    CardLoader::SaveToBinary(jsonCards, path);
+
+    std::vector<Card*> binaryCards;
+    CHECK(CardLoader::LoadFromBinary(path, binaryCards));
+    REQUIRE(binaryCards.size() == jsonCards.size());
+
+    bool isSame = true;
+    for (std::size_t i = 0; i < jsonCards.size() && isSame; ++i)
+    {
+        const Card* jsonCard = jsonCards[i];
+        const Card* binaryCard = binaryCards[i];
+
+        isSame = jsonCard->id == binaryCard->id &&
+                 jsonCard->dbfID == binaryCard->dbfID &&
+                 jsonCard->name == binaryCard->name &&
+                 jsonCard->text == binaryCard->text;
+
+        for (const auto& gameTag : jsonCard->gameTags)
+        {
+            const int* value = binaryCard->gameTags.Find(gameTag.first);
+            isSame = isSame && value != nullptr && *value == gameTag.second;
+        }
+        for (const auto& gameTag : binaryCard->gameTags)
+        {
+            isSame = isSame && jsonCard->gameTags.Contains(gameTag.first);
+        }
+    }
+    CHECK(isSame);
+
+    std::ifstream input(path, std::ios::binary);
+    const std::string contents((std::istreambuf_iterator<char>(input)),
+                               std::istreambuf_iterator<char>());
+    input.close();
+
+    // The database that is made from other cards.json is rejected
+    // The hash of cards.json is stored at 40th byte of the header
+    std::string outdated = contents;
+    outdated[40] = static_cast<char>(outdated[40] ^ 1);
+
+    std::ofstream output(path, std::ios::binary | std::ios::trunc);
+    output.write(outdated.data(), outdated.size());
+    output.close();
+
+    std::vector<Card*> invalidCards;
+    CHECK_FALSE(CardLoader::LoadFromBinary(path, invalidCards));
+    CHECK(invalidCards.empty());
+
+    // The truncated database is rejected and the cards are not changed
+    output.open(path, std::ios::binary | std::ios::trunc);
+    output.write(contents.data(), contents.size() - 1);
+    output.close();
+
+    CHECK_FALSE(CardLoader::LoadFromBinary(path, invalidCards));
+    CHECK(invalidCards.empty());
+    CHECK_FALSE(CardLoader::LoadFromBinary("cards_not_exist.bin", invalidCards));
+
+    std::remove(path.c_str());
+
+    for (auto& card : jsonCards)
+    {
+        delete card;
+    }
+    for (auto& card : binaryCards)
+    {
+        delete card;
+    }
+}
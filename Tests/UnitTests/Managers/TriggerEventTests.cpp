@@ -0,0 +1,94 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Managers/TriggerEvent.hpp>
+
+#include <vector>
+
+using namespace RosettaStone;
+
+TEST_CASE("[TriggerEvent] - AddHandler and RemoveHandler")
+{
+    TriggerEvent event;
+    std::vector<int> order;
+
+    const auto handle1 = event.AddHandler(
+        TriggerEventHandler([&](Entity*) { order.emplace_back(1); }));
+    const auto handle2 = event.AddHandler(
+        TriggerEventHandler([&](Entity*) { order.emplace_back(2); }));
+    const auto handle3 = event.AddHandler(
+        TriggerEventHandler([&](Entity*) { order.emplace_back(3); }));
+    CHECK_EQ(event.GetCount(), 3u);
+    CHECK(event.Contains(handle2));
+    CHECK_FALSE(event.Contains(TriggerEvent::Handle{}));
+
+    event(nullptr);
+    CHECK_EQ(order, std::vector<int>{ 1, 2, 3 });
+
+    // Handlers are run in order of subscription after removal
+    event.RemoveHandler(handle2);
+    CHECK_FALSE(event.Contains(handle2));
+    CHECK_EQ(event.GetCount(), 2u);
+
+    order.clear();
+    event(nullptr);
+    CHECK_EQ(order, std::vector<int>{ 1, 3 });
+
+    // A stale handle doesn't remove the handler that reuses its slot
+    const auto handle4 = event.AddHandler(
+        TriggerEventHandler([&](Entity*) { order.emplace_back(4); }));
+    CHECK_EQ(handle4.index, handle2.index);
+    event.RemoveHandler(handle2);
+    CHECK(event.Contains(handle4));
+
+    order.clear();
+    event(nullptr);
+    CHECK_EQ(order, std::vector<int>{ 1, 3, 4 });
+
+    event.RemoveHandler(handle1);
+    event.RemoveHandler(handle3);
+    event.RemoveHandler(handle4);
+    CHECK_EQ(event.GetCount(), 0u);
+
+    order.clear();
+    event(nullptr);
+    CHECK(order.empty());
+}
+
+TEST_CASE("[TriggerEvent] - Notify")
+{
+    TriggerEvent event;
+    std::vector<int> order;
+    TriggerEvent::Handle handle2;
+    TriggerEvent::Handle handle3;
+
+    // Removes the next handlers and adds a new handler
+    event.AddHandler(TriggerEventHandler([&](Entity*) {
+        order.emplace_back(1);
+        event.RemoveHandler(handle2);
+        event.RemoveHandler(handle3);
+        event.AddHandler(
+            TriggerEventHandler([&](Entity*) { order.emplace_back(4); }));
+    }));
+    handle2 = event.AddHandler(
+        TriggerEventHandler([&](Entity*) { order.emplace_back(2); }));
+    handle3 = event.AddHandler(
+        TriggerEventHandler([&](Entity*) { order.emplace_back(3); }));
+
+    // The removed handlers are still run for the event being notified, and
+    // the added handler runs next time
+    event(nullptr);
+    CHECK_EQ(order, std::vector<int>{ 1, 2, 3 });
+    CHECK_FALSE(event.Contains(handle2));
+    CHECK_EQ(event.GetCount(), 2u);
+
+    order.clear();
+    event(nullptr);
+    CHECK_EQ(order, std::vector<int>{ 1, 4 });
+    CHECK_EQ(event.GetCount(), 3u);
+}
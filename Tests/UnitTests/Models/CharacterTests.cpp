@@ -7,6 +7,9 @@
 #include <Utils/TestUtils.hpp>
 #include "doctest_proxy.hpp"
 
+#include <Rosetta/Actions/ActionValidGetter.hpp>
+#include <Rosetta/Actions/Draw.hpp>
+#include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Zones/FieldZone.hpp>
 
@@ -97,4 +100,92 @@ TEST_CASE("[Character] - SpellPower")
 
     curField[0]->SetSpellPower(4);
     CHECK_EQ(curField[0]->GetSpellPower(), 4);
-}
\ No newline at end of file
+}
+
+TEST_CASE("[Character] - TargetMask")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::PALADIN;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    auto& curField = *(curPlayer->GetFieldZone());
+    auto& opField = *(opPlayer->GetFieldZone());
+
+    auto card1 = GenerateMinionCard("minion1", 3, 6);
+    auto card2 = GenerateMinionCard("minion2", 3, 6);
+    auto card3 = GenerateMinionCard("minion3", 3, 6);
+    auto card4 = GenerateMinionCard("minion4", 3, 6);
+    auto card5 = GenerateMinionCard("minion5", 3, 6);
+    PlayMinionCard(curPlayer, &card1);
+    PlayMinionCard(curPlayer, &card2);
+    PlayMinionCard(opPlayer, &card3);
+    PlayMinionCard(opPlayer, &card4);
+    PlayMinionCard(opPlayer, &card5);
+
+    opField[1]->SetGameTag(GameTag::TAUNT, 1);
+    opField[2]->SetGameTag(GameTag::STEALTH, 1);
+
+    const auto fireball = Generic::DrawCard(
+        curPlayer, Cards::FindCardByID("CS2_029"));
+
+    // The enemy minion that has stealth can't be targeted
+    const TargetMask playTargets = fireball->GetValidPlayTargetMask();
+    CHECK_EQ(playTargets, TargetMask(0b10000011, 0b10000011));
+    CHECK_EQ(playTargets.GetCount(), 6);
+    CHECK(playTargets.Has(curPlayer, opField[1]));
+    CHECK_FALSE(playTargets.Has(curPlayer, opField[2]));
+    CHECK(playTargets.Has(curPlayer, opPlayer->GetHero()));
+    CHECK_EQ(fireball->GetValidPlayTargets(),
+             std::vector<Character*>{ curField[0], curField[1], opField[0],
+                                      opField[1], curPlayer->GetHero(),
+                                      opPlayer->GetHero() });
+
+    // The minion that can't be targeted by spells is not a play target
+    opField[0]->SetGameTag(GameTag::CANT_BE_TARGETED_BY_SPELLS, 1);
+    CHECK_EQ(fireball->GetValidPlayTargetMask(),
+             TargetMask(0b10000011, 0b10000010));
+    CHECK_FALSE(fireball->IsValidPlayTarget(opField[0]));
+    opField[0]->SetGameTag(GameTag::CANT_BE_TARGETED_BY_SPELLS, 0);
+
+    // The minion that has taunt must be attacked first
+    CHECK_EQ(curField[0]->GetValidAttackTargetMask(opPlayer),
+             TargetMask(0, 0b00000010));
+    CHECK(curField[0]->IsValidAttackTarget(opPlayer, opField[1]));
+    CHECK_FALSE(curField[0]->IsValidAttackTarget(opPlayer, opField[0]));
+    CHECK_FALSE(
+        curField[0]->IsValidAttackTarget(opPlayer, opPlayer->GetHero()));
+
+    opField[1]->SetGameTag(GameTag::TAUNT, 0);
+    CHECK_EQ(curField[0]->GetValidAttackTargetMask(opPlayer),
+             TargetMask(0, 0b10000011));
+    CHECK_EQ(curField[0]->GetValidAttackTargets(opPlayer),
+             std::vector<Character*>{ opField[0], opField[1],
+                                      opPlayer->GetHero() });
+
+    // The attackers are the characters that CanAttack() accepts
+    curField[1]->SetExhausted(false);
+    const ActionValidGetter getter(game);
+    CHECK_EQ(getter.GetAttackerMask(), 0b00000010);
+
+    std::vector<Character*> attackers;
+    getter.ForEachAttacker([&](Character* character) {
+        attackers.emplace_back(character);
+        return true;
+    });
+    CHECK_EQ(attackers, std::vector<Character*>{ curField[1] });
+    CHECK_FALSE(curField[0]->CanAttack());
+    CHECK(curField[1]->CanAttack());
+    CHECK_FALSE(curPlayer->GetHero()->CanAttack());
+}
@@ -0,0 +1,213 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Actions/Draw.hpp>
+#include <Rosetta/Actions/Summon.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+
+using namespace RosettaStone;
+using namespace PlayerTasks;
+
+namespace
+{
+//! Plays minions of \p names in order by \p player.
+//! \param game The game context.
+//! \param player The player to play minions.
+//! \param names The names of minions to play.
+void PlayMinions(Game& game, Player* player,
+                 std::initializer_list<std::string> names)
+{
+    for (const auto& name : names)
+    {
+        const auto card =
+            Generic::DrawCard(player, Cards::FindCardByName(name));
+        game.Process(player, PlayCardTask::Minion(card));
+    }
+}
+
+//! Summons a minion of \p name for \p player.
+//! \param player The player to summon the minion.
+//! \param name The name of minion to summon.
+void SummonMinion(Player* player, const std::string& name)
+{
+    const auto minion = dynamic_cast<Minion*>(
+        Entity::GetFromCard(player, Cards::FindCardByName(name), std::nullopt,
+                            player->GetFieldZone()));
+    Generic::Summon(minion, -1, nullptr);
+}
+}  // namespace
+
+TEST_CASE("[FieldMirror] - Build")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+    curPlayer->GetHero()->SetArmor(4);
+
+    PlayMinions(game, curPlayer,
+                { "Wisp", "Argent Squire", "Goldshire Footman",
+                  "River Crocolisk" });
+
+    const FieldMirror& mirror = curPlayer->GetFieldMirror();
+    CHECK_EQ(mirror.occupied, static_cast<SideMask>(0b1000'1111));
+    CHECK_EQ(mirror.attack[3], 2);
+    CHECK_EQ(mirror.health[2], 2);
+    CHECK_EQ(mirror.health[4], 0);
+    CHECK_EQ(mirror.armor[HERO_BIT], 4);
+    CHECK_EQ(mirror.health[HERO_BIT], 30);
+    CHECK((mirror.keywords[1] & FieldMirror::DIVINE_SHIELD) != 0);
+    CHECK((mirror.keywords[2] & FieldMirror::TAUNT) != 0);
+    CHECK_EQ(mirror.keywords[3] & FieldMirror::CAN_ATTACK, 0u);
+
+    CHECK_EQ(mirror.GetTotalAttack(MINION_BITS), 5);
+    CHECK_EQ(mirror.CountRace(Race::BEAST), 1);
+    CHECK_EQ(mirror.CountRace(Race::MURLOC), 0);
+
+    // The mirror is built again after the tags are written
+    curPlayer->GetFieldZone()->GetAll()[3]->SetDamage(1);
+    CHECK_EQ(curPlayer->GetFieldMirror().health[3], 2);
+    CHECK_EQ(curPlayer->GetFieldMirror().damage[3], 1);
+}
+
+TEST_CASE("[FieldMirror] - DamageAllMinions")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    auto& curField = *(curPlayer->GetFieldZone());
+
+    PlayMinions(game, curPlayer,
+                { "Wisp", "Argent Squire", "Goldshire Footman",
+                  "River Crocolisk" });
+
+    FieldMirror mirror = curPlayer->GetFieldMirror();
+    const SideMask dead = mirror.DamageAllMinions(1);
+    CHECK_EQ(dead, static_cast<SideMask>(0b0001));
+    CHECK_EQ(mirror.keywords[1] & FieldMirror::DIVINE_SHIELD, 0u);
+    CHECK_EQ(mirror.health[1], 1);
+    CHECK_EQ(mirror.health[2], 1);
+    CHECK_EQ(mirror.health[3], 2);
+    CHECK_EQ(mirror.health[HERO_BIT], 30);
+
+    // The mirror agrees with the game after Whirlwind
+    const auto card = Generic::DrawCard(curPlayer,
+                                        Cards::FindCardByName("Whirlwind"));
+    game.Process(curPlayer, PlayCardTask::Spell(card));
+
+    CHECK_EQ(curField.GetCount(), 3);
+    CHECK_EQ(curField[0]->HasDivineShield(), false);
+    CHECK_EQ(curField[0]->GetHealth(), mirror.health[1]);
+    CHECK_EQ(curField[1]->GetHealth(), mirror.health[2]);
+    CHECK_EQ(curField[2]->GetHealth(), mirror.health[3]);
+}
+
+TEST_CASE("[FieldMirror] - HasLethal")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    PlayMinions(game, curPlayer,
+                { "River Crocolisk", "Young Dragonhawk", "Wisp" });
+
+    // Minions that are played this turn can't attack
+    CHECK_EQ(curPlayer->GetFieldMirror().GetFaceDamage(), 0);
+
+    for (Minion* minion : curPlayer->GetFieldZone()->GetAll())
+    {
+        minion->SetExhausted(false);
+    }
+
+    // Young Dragonhawk has windfury, so it can attack twice
+    const FieldMirror& mirror = curPlayer->GetFieldMirror();
+    CHECK_EQ(mirror.GetFaceDamage(), 2 + 1 * 2 + 1);
+
+    opPlayer->GetHero()->SetDamage(25);
+    CHECK(mirror.HasLethal(opPlayer->GetFieldMirror()));
+
+    opPlayer->GetHero()->SetArmor(1);
+    CHECK_FALSE(curPlayer->GetFieldMirror().HasLethal(
+        opPlayer->GetFieldMirror()));
+
+    opPlayer->GetHero()->SetArmor(0);
+    SummonMinion(opPlayer, "Goldshire Footman");
+    CHECK_FALSE(curPlayer->GetFieldMirror().HasLethal(
+        opPlayer->GetFieldMirror()));
+}
+
+TEST_CASE("[FieldMirror] - Destroy")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    PlayMinions(game, curPlayer, { "Wisp", "River Crocolisk" });
+    CHECK_EQ(curPlayer->GetFieldMirror().occupied,
+             static_cast<SideMask>(0b1000'0011));
+
+    // The destroyed minion leaves the mirror before the death processing
+    Minion* minion = curPlayer->GetFieldZone()->GetAll()[1];
+    const std::uint64_t lastMutation = minion->GetLastMutation();
+    minion->Destroy();
+    CHECK_GT(minion->GetLastMutation(), lastMutation);
+    CHECK_EQ(curPlayer->GetFieldZone()->GetCount(), 2);
+
+    const FieldMirror& mirror = curPlayer->GetFieldMirror();
+    CHECK_EQ(mirror.occupied, static_cast<SideMask>(0b1000'0001));
+    CHECK_EQ(mirror.attack[1], 0);
+    CHECK_EQ(mirror.GetTotalAttack(MINION_BITS), 1);
+}
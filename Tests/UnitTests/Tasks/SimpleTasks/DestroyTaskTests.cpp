@@ -39,7 +39,8 @@ TEST_CASE("[DestroyTask] - Run")
     const std::map<GameTag, int> tags;
 
     // Destroy Source Minion
-    const auto minion1 = new Minion(player1, &card, tags);
+    const auto minion1 =
+        player1->game->arena.Create<Minion>(player1, &card, tags);
     minion1->player = player1;
     p1Field.Add(minion1, 0);
 
@@ -54,7 +55,8 @@ TEST_CASE("[DestroyTask] - Run")
     CHECK_EQ(p1Field.GetCount(), 0);
 
     // Destroy Target Minion
-    const auto minion2 = new Minion(player2, &card, tags);
+    const auto minion2 =
+        player2->game->arena.Create<Minion>(player2, &card, tags);
     minion2->player = player2;
     p2Field.Add(minion2, 0);
 
@@ -70,7 +72,8 @@ TEST_CASE("[DestroyTask] - Run")
 
     // Destroy Target Weapon
     Card weaponCard;
-    player2->GetHero()->weapon = new Weapon(player2, &weaponCard, tags);
+    player2->GetHero()->weapon =
+        player2->game->arena.Create<Weapon>(player2, &weaponCard, tags);
     player2->GetWeapon().player = player2;
 
     DestroyTask task3(EntityType::ENEMY_WEAPON);
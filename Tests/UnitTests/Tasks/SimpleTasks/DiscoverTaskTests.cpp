@@ -0,0 +1,110 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Tasks/SimpleTasks/DiscoverTask.hpp>
+
+#include <algorithm>
+
+using namespace RosettaStone;
+using namespace SimpleTasks;
+
+TEST_CASE("[DiscoverTask] - GetDiscoverPool")
+{
+    Cards::GetInstance();
+
+    const auto& spells = DiscoverTask::GetDiscoverPool(
+        DiscoverType::SPELL, CardClass::MAGE, FormatType::STANDARD);
+
+    std::vector<Card*> expected;
+    for (const auto& card : Cards::GetAllStandardCards())
+    {
+        if (((card->GetCardClass() == CardClass::MAGE && !card->IsQuest()) ||
+             card->GetCardClass() == CardClass::NEUTRAL) &&
+            card->GetCardType() == CardType::SPELL)
+        {
+            expected.emplace_back(card);
+        }
+    }
+
+    CHECK_EQ(spells, expected);
+
+    // The pool is built once and shared
+    CHECK_EQ(&DiscoverTask::GetDiscoverPool(
+                 DiscoverType::SPELL, CardClass::MAGE, FormatType::STANDARD),
+             &spells);
+    CHECK_NE(&DiscoverTask::GetDiscoverPool(
+                 DiscoverType::SPELL, CardClass::PRIEST, FormatType::STANDARD),
+             &spells);
+    CHECK_NE(&DiscoverTask::GetDiscoverPool(DiscoverType::SPELL,
+                                            CardClass::MAGE, FormatType::WILD),
+             &spells);
+
+    CHECK_THROWS_AS(
+        DiscoverTask::GetDiscoverPool(DiscoverType::MADAME_LAZUL,
+                                      CardClass::MAGE, FormatType::STANDARD),
+        std::out_of_range);
+
+    // The class of the hero is only a part of the key for relative classes
+    const DiscoverCriteria mageMinions(CardType::MINION, CardClass::MAGE,
+                                       Race::INVALID, Rarity::INVALID);
+    CHECK_EQ(&DiscoverTask::GetDiscoverPool(mageMinions, CardClass::PRIEST,
+                                            FormatType::STANDARD),
+             &DiscoverTask::GetDiscoverPool(mageMinions, CardClass::ROGUE,
+                                            FormatType::STANDARD));
+
+    const DiscoverCriteria classMinions(CardType::MINION,
+                                        CardClass::PLAYER_CLASS, Race::INVALID,
+                                        Rarity::INVALID);
+    const auto& priestMinions = DiscoverTask::GetDiscoverPool(
+        classMinions, CardClass::PRIEST, FormatType::STANDARD);
+    CHECK_FALSE(priestMinions.empty());
+    CHECK(std::all_of(priestMinions.begin(), priestMinions.end(),
+                      [](const Card* card) {
+                          return card->GetCardClass() == CardClass::PRIEST &&
+                                 card->GetCardType() == CardType::MINION;
+                      }));
+    CHECK_NE(&DiscoverTask::GetDiscoverPool(classMinions, CardClass::ROGUE,
+                                            FormatType::STANDARD),
+             &priestMinions);
+}
+
+TEST_CASE("[DiscoverTask] - GetChoices")
+{
+    GameConfig config;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::PRIEST;
+    Game game(config);
+
+    const auto& pool = DiscoverTask::GetDiscoverPool(
+        DiscoverType::SPELL, CardClass::MAGE, FormatType::STANDARD);
+    REQUIRE(pool.size() > 3);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto choices = DiscoverTask::GetChoices(&game, pool, 3);
+        REQUIRE(choices.size() == 3);
+
+        // The choices are distinct and in the order of the pool
+        auto iter = pool.begin();
+        for (const auto& card : choices)
+        {
+            iter = std::find(iter, pool.end(), card);
+            REQUIRE(iter != pool.end());
+            ++iter;
+        }
+    }
+
+    const auto firstCards = DiscoverTask::GetChoices(&game, pool, 2, false);
+    CHECK_EQ(firstCards, std::vector<Card*>{ pool[0], pool[1] });
+
+    const std::vector<Card*> smallPool{ pool[0], pool[1] };
+    CHECK_EQ(DiscoverTask::GetChoices(&game, smallPool, 3), smallPool);
+}
@@ -38,7 +38,8 @@ TEST_CASE("[DrawTask] - Run")
         card->id = std::move(id);
         const std::map<GameTag, int> tags;
 
-        minions.emplace_back(new Minion(player, card, tags));
+        minions.emplace_back(
+            player->game->arena.Create<Minion>(player, card, tags));
 
         return minions.back();
     };
@@ -96,7 +97,8 @@ TEST_CASE("[DrawTask] - RunExhaust")
     card.id = "card1";
     const std::map<GameTag, int> tags;
 
-    const auto minion = new Minion(player, &card, tags);
+    const auto minion =
+        player->game->arena.Create<Minion>(player, &card, tags);
     playerDeck.Add(minion);
 
     result = draw.Run();
@@ -130,7 +132,8 @@ TEST_CASE("[DrawTask] - RunOverDraw")
         card->id = std::move(id);
         const std::map<GameTag, int> tags;
 
-        minions.emplace_back(new Minion(player, card, tags));
+        minions.emplace_back(
+            player->game->arena.Create<Minion>(player, card, tags));
 
         return minions.back();
     };
@@ -181,7 +184,8 @@ TEST_CASE("[DrawTask] - RunExhaustOverdraw")
         card->id = std::move(id);
         const std::map<GameTag, int> tags;
 
-        minions.emplace_back(new Minion(player, card, tags));
+        minions.emplace_back(
+            player->game->arena.Create<Minion>(player, card, tags));
         return minions.back();
     };
 
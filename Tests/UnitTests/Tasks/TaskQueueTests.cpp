@@ -0,0 +1,131 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/TestUtils.hpp>
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Tasks/SimpleTasks/CustomTask.hpp>
+#include <Rosetta/Tasks/SimpleTasks/DamageTask.hpp>
+#include <Rosetta/Tasks/TaskQueue.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+
+using namespace RosettaStone;
+using namespace SimpleTasks;
+using namespace TestUtils;
+
+TEST_CASE("[TaskQueue] - Shared task with frames")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* player1 = game.GetPlayer1();
+    Player* player2 = game.GetPlayer2();
+    Hero* hero1 = player1->GetHero();
+    Hero* hero2 = player2->GetHero();
+
+    Card card = GenerateMinionCard("minion", 1, 1);
+    PlayMinionCard(player1, &card);
+    PlayMinionCard(player2, &card);
+    Minion* minion1 = (*player1->GetFieldZone())[0];
+    Minion* minion2 = (*player2->GetFieldZone())[0];
+
+    // One task is shared by the entries and runs with the frame of each entry
+    const auto damage = std::make_shared<DamageTask>(EntityType::TARGET, 2);
+
+    TaskQueue queue;
+    CHECK(queue.IsEmpty());
+
+    queue.Enqueue(damage, TaskFrame{ player1, minion1, hero2 });
+    queue.Enqueue(damage, TaskFrame{ player2, minion2, hero1 });
+    queue.Enqueue(damage, TaskFrame{ player1, minion1, hero2 });
+    CHECK_EQ(damage.use_count(), 4);
+
+    while (!queue.IsEmpty())
+    {
+        CHECK_EQ(queue.Process(), TaskStatus::COMPLETE);
+    }
+
+    CHECK_EQ(hero1->GetHealth(), 28);
+    CHECK_EQ(hero2->GetHealth(), 26);
+    CHECK_EQ(damage.use_count(), 1);
+
+    // The stored frame of task is not changed by running with other frames
+    CHECK_EQ(damage->GetPlayer(), nullptr);
+    CHECK_EQ(damage->GetTarget(), nullptr);
+
+    // Copying a queue maps the frames and shares the tasks
+    queue.Enqueue(damage, TaskFrame{ player1, minion1, hero2 });
+
+    TaskQueue copied;
+    copied.CopyFrom(queue, [&](const TaskFrame& frame) {
+        return TaskFrame{ frame.player, frame.source, hero1 };
+    });
+    CHECK_EQ(damage.use_count(), 3);
+
+    copied.Process();
+    CHECK_EQ(hero1->GetHealth(), 26);
+    CHECK_EQ(hero2->GetHealth(), 26);
+}
+
+TEST_CASE("[TaskQueue] - Event")
+{
+    std::vector<int> order;
+    const auto record = [&order](int value) {
+        return std::make_shared<CustomTask>(
+            [&order, value](Player*, Entity*, Playable*) {
+                order.emplace_back(value);
+            });
+    };
+
+    TaskQueue queue;
+
+    // An event without tasks doesn't create a new queue
+    queue.StartEvent();
+    CHECK(queue.IsEmpty());
+    queue.EndEvent();
+    CHECK(queue.IsEmpty());
+
+    queue.Enqueue(record(1), TaskFrame{});
+    queue.Enqueue(record(2), TaskFrame{});
+    CHECK_EQ(queue.GetCount(), 2u);
+
+    // The tasks of a nested event run before the pending tasks
+    queue.StartEvent();
+    CHECK(queue.IsEmpty());
+    queue.Enqueue(record(3), TaskFrame{});
+    queue.Enqueue(record(4), TaskFrame{});
+    CHECK_EQ(queue.GetCount(), 2u);
+
+    CHECK_EQ(queue.Process(), TaskStatus::COMPLETE);
+    queue.Enqueue(record(5), TaskFrame{});
+    while (!queue.IsEmpty())
+    {
+        queue.Process();
+    }
+    queue.EndEvent();
+    CHECK_EQ(queue.GetCount(), 2u);
+
+    while (!queue.IsEmpty())
+    {
+        queue.Process();
+    }
+    CHECK_EQ(order, std::vector<int>{ 3, 4, 5, 1, 2 });
+
+    // The storage is reused after all tasks are processed
+    queue.Enqueue(record(6), TaskFrame{});
+    queue.Process();
+    CHECK(queue.IsEmpty());
+    CHECK_EQ(order.back(), 6);
+}
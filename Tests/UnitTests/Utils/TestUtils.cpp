@@ -61,9 +61,10 @@ void PlayMinionCard(Player* player, Card* card)
     FieldZone& fieldZone = *(player->GetFieldZone());
     const std::map<GameTag, int> tags;
 
-    const auto minion = new Minion(player, card, tags);
-    player->game->entityList.emplace(minion->GetGameTag(GameTag::ENTITY_ID),
-                                     minion);
+    const auto minion =
+        player->game->arena.Create<Minion>(player, card, tags);
+    player->game->entityList.Set(minion->GetGameTag(GameTag::ENTITY_ID),
+                                 minion);
 
     fieldZone.Add(minion);
     fieldZone[minion->GetZonePosition()]->player = player;
@@ -73,9 +74,10 @@ void PlayWeaponCard(Player* player, Card* card)
 {
     const std::map<GameTag, int> tags;
 
-    const auto weapon = new Weapon(player, card, tags);
-    player->game->entityList.emplace(weapon->GetGameTag(GameTag::ENTITY_ID),
-                                     weapon);
+    const auto weapon =
+        player->game->arena.Create<Weapon>(player, card, tags);
+    player->game->entityList.Set(weapon->GetGameTag(GameTag::ENTITY_ID),
+                                 weapon);
 
     player->GetHero()->AddWeapon(*weapon);
 }
@@ -85,8 +87,9 @@ void PlayEnchantmentCard(Player* player, Card* card, Entity* target)
     GraveyardZone& graveyardZone = *(player->GetGraveyardZone());
     const std::map<GameTag, int> tags;
 
-    const auto enchantment = new Enchantment(player, card, tags, target, -1);
-    player->game->entityList.emplace(
+    const auto enchantment = player->game->arena.Create<Enchantment>(
+        player, card, tags, target, -1);
+    player->game->entityList.Set(
         enchantment->GetGameTag(GameTag::ENTITY_ID), enchantment);
 
     graveyardZone.Add(enchantment);
@@ -103,15 +106,15 @@ void ExpectCardEqual(const Card& card1, const Card& card2)
     CHECK_EQ(card1.GetFaction(), card2.GetFaction());
     CHECK_EQ(card1.GetRace(), card2.GetRace());
     CHECK_EQ(card1.GetRarity(), card2.GetRarity());
-    CHECK_EQ(card1.gameTags.at(GameTag::COLLECTIBLE),
-             card2.gameTags.at(GameTag::COLLECTIBLE));
-    CHECK_EQ(card1.gameTags.at(GameTag::COST),
-             card2.gameTags.at(GameTag::COST));
-    CHECK_EQ(card1.gameTags.at(GameTag::ATK), card2.gameTags.at(GameTag::ATK));
-    CHECK_EQ(card1.gameTags.at(GameTag::HEALTH),
-             card2.gameTags.at(GameTag::HEALTH));
-    CHECK_EQ(card1.gameTags.at(GameTag::DURABILITY),
-             card2.gameTags.at(GameTag::DURABILITY));
+    CHECK_EQ(card1.gameTags.At(GameTag::COLLECTIBLE),
+             card2.gameTags.At(GameTag::COLLECTIBLE));
+    CHECK_EQ(card1.gameTags.At(GameTag::COST),
+             card2.gameTags.At(GameTag::COST));
+    CHECK_EQ(card1.gameTags.At(GameTag::ATK), card2.gameTags.At(GameTag::ATK));
+    CHECK_EQ(card1.gameTags.At(GameTag::HEALTH),
+             card2.gameTags.At(GameTag::HEALTH));
+    CHECK_EQ(card1.gameTags.At(GameTag::DURABILITY),
+             card2.gameTags.At(GameTag::DURABILITY));
     CHECK_EQ(card1.gameTags, card2.gameTags);
     CHECK_EQ(card1.playRequirements, card2.playRequirements);
     CHECK_EQ(card1.entourages, card2.entourages);
@@ -130,7 +133,7 @@ Playable* ChooseNthChoice(Game& game, std::size_t n)
     game.Process(game.GetCurrentPlayer(),
                  ChooseTask::Pick(game.GetCurrentPlayer(), pick));
 
-    return game.entityList[pick];
+    return game.entityList.Get(pick);
 }
 
 std::vector<Card*> GetChoiceCards(Game& game)
@@ -147,7 +150,7 @@ std::vector<Card*> GetChoiceCards(Game& game)
 
     for (int choice : choices)
     {
-        result.emplace_back(game.entityList[choice]->card);
+        result.emplace_back(game.entityList.Get(choice)->card);
     }
 
     return result;
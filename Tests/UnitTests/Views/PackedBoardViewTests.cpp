@@ -0,0 +1,107 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/TestUtils.hpp>
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Games/GameConfig.hpp>
+#include <Rosetta/Views/BoardRefView.hpp>
+#include <Rosetta/Views/PackedBoardView.hpp>
+#include <Rosetta/Views/ReducedBoardView.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+
+using namespace RosettaStone;
+using namespace TestUtils;
+
+TEST_CASE("[PackedBoardView] - All")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::ROGUE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+
+    curPlayer->SetTotalMana(4);
+    opPlayer->SetTotalMana(7);
+    curPlayer->SetUsedMana(4);
+    opPlayer->SetUsedMana(3);
+
+    Card curWeaponCard = GenerateWeaponCard("weapon1", 3, 2);
+    PlayWeaponCard(curPlayer, &curWeaponCard);
+
+    std::vector<Card> curCards, opCards;
+    curCards.reserve(5);
+    opCards.reserve(3);
+
+    const std::string name = "test";
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        const auto id = static_cast<char>(i + 0x30);
+        curCards.emplace_back(GenerateMinionCard(name + id, 1, 2));
+        PlayMinionCard(curPlayer, &curCards[i]);
+    }
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        const auto id = static_cast<char>(i + 0x31);
+        opCards.emplace_back(GenerateMinionCard(name + id, 3, 4));
+        PlayMinionCard(opPlayer, &opCards[i]);
+    }
+
+    const BoardRefView board(game, curPlayer->playerType);
+    const PackedBoardView packedBoard1(board), packedBoard2(board);
+
+    CHECK(packedBoard1 == packedBoard2);
+    CHECK_FALSE(packedBoard1 != packedBoard2);
+    CHECK_EQ(packedBoard1.GetHash(), packedBoard2.GetHash());
+
+    CHECK_EQ(packedBoard1.GetTurn(), 1);
+    CHECK_EQ(packedBoard1.GetSide(), PlayerType::PLAYER1);
+
+    const auto& mySide = packedBoard1.GetMySide();
+    CHECK_EQ(mySide.hero.attack, 3);
+    CHECK(mySide.hero.flags & PackedBoardView::ATTACKABLE);
+    CHECK_EQ(mySide.heroPower.card,
+             Cards::FindCardByID("CS2_102")->handle.GetOrdinal());
+    CHECK_EQ(mySide.weapon.durability, 2);
+    CHECK_EQ(mySide.manaCrystal.total, 4);
+    CHECK_EQ(mySide.manaCrystal.remaining, 0);
+    CHECK_EQ(mySide.minionCount, 5);
+    CHECK_EQ(mySide.minions[0].attack, 1);
+    CHECK_EQ(mySide.minions[0].health, 2);
+    CHECK_NE(mySide.minions[0].card, mySide.minions[1].card);
+    CHECK_EQ(mySide.minions[5].card, 0u);
+    CHECK_EQ(mySide.handCount, 4);
+    CHECK_EQ(mySide.deckCount, 5);
+
+    const auto& opSide = packedBoard1.GetOpSide();
+    CHECK_EQ(opSide.weapon.card, CardHandle::INVALID);
+    CHECK_EQ(opSide.manaCrystal.total, 7);
+    CHECK_EQ(opSide.manaCrystal.remaining, 4);
+    CHECK_EQ(opSide.minionCount, 3);
+    CHECK_EQ(opSide.minions[0].attack, 3);
+    CHECK_EQ(opSide.minions[0].health, 4);
+    CHECK_EQ(opSide.handCount, 5);
+    CHECK_EQ(opSide.deckCount, 5);
+
+    // The packed view changes whenever the reduced view changes
+    const ReducedBoardView reducedBoard(board);
+    (*curPlayer->GetFieldZone())[0]->SetGameTag(GameTag::TAUNT, 1);
+    CHECK_NE(ReducedBoardView(board), reducedBoard);
+    CHECK_NE(PackedBoardView(board), packedBoard1);
+
+    (*curPlayer->GetFieldZone())[0]->SetGameTag(GameTag::TAUNT, 0);
+    CHECK_EQ(ReducedBoardView(board), reducedBoard);
+    CHECK_EQ(PackedBoardView(board), packedBoard1);
+}
@@ -10,6 +10,9 @@
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
 #include <Rosetta/Zones/FieldZone.hpp>
+#include <Rosetta/Zones/GraveyardZone.hpp>
+
+#include <vector>
 
 using namespace RosettaStone;
 using namespace PlayerTasks;
@@ -46,6 +49,57 @@ TEST_CASE("[FieldZone] - GetAll")
     CHECK_EQ(minions[1]->card->name, "Wisp");
 }
 
+TEST_CASE("[FieldZone] - GetView")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::PALADIN;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    auto& curField = *(curPlayer->GetFieldZone());
+    CHECK(curField.GetView().IsEmpty());
+
+    for (const auto& name : { "Flame Imp", "Wisp", "Acolyte of Pain" })
+    {
+        Playable* playable =
+            Entity::GetFromCard(curPlayer, Cards::FindCardByName(name),
+                                std::nullopt, curPlayer->GetFieldZone());
+        curField.Add(playable);
+    }
+
+    std::vector<Minion*> minions;
+    for (auto& minion : curField.GetView())
+    {
+        minions.emplace_back(minion);
+    }
+    CHECK_EQ(minions, curField.GetAll());
+    CHECK_EQ(curField.GetView().GetCount(), 3);
+
+    // Destroyed minions are skipped as GetAll() does
+    curField[1]->isDestroyed = true;
+    minions.clear();
+    for (auto& minion : curField.GetView())
+    {
+        minions.emplace_back(minion);
+    }
+    CHECK_EQ(minions, curField.GetAll());
+    CHECK_EQ(curField.GetView().GetCount(), 2);
+
+    // Unlimited zones visit all entities
+    auto& curGraveyard = *(curPlayer->GetGraveyardZone());
+    const int graveyardCount = curGraveyard.GetCount();
+    curGraveyard.Add(curField.Remove(curField[1]));
+    CHECK_EQ(curGraveyard.GetView().GetCount(), graveyardCount + 1);
+    CHECK_EQ(*curGraveyard.GetView().begin(), curGraveyard.GetAll()[0]);
+}
+
 TEST_CASE("[FieldZone] - FindIndex")
 {
     GameConfig config;